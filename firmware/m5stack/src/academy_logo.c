@@ -1,216 +1,206 @@
 #include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 const uint8_t academy_logo_map[]={
-  0xcb,0x52,0xff,0x65,0x21,0xff,0xa6,0x29,0xff,0xa6,0x29,0xff,0xa6,0x29,0xff,0x86,
-  0x29,0xff,0x86,0x29,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x29,0xff,0x86,0x29,
-  0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x21,0xff,0x86,0x21,0xff,
-  0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,
-  0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,
-  0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,
-  0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,
-  0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x21,0xff,0x86,0x21,
-  0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,
-  0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,
-  0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,
-  0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,
-  0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x21,0xff,0x86,
-  0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,
-  0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,
-  0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,0x21,0xff,0x86,
-  0x21,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x86,0x29,0xff,0x45,0x19,0xff,0xaf,0x73,
-  0xff,0x28,0x3a,0xff,0xc2,0x08,0xff,0x04,0x11,0xff,0xe3,0x08,0xff,0xe4,0x08,0xff,
-  0xe4,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0xe3,0x08,0xff,0xe3,0x10,0xff,0xe3,
-  0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe4,0x10,0xff,0xe4,0x08,0xff,0xe4,0x08,
-  0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,
-  0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x08,0xff,0xe3,
-  0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x08,0xff,0xe3,0x08,
-  0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,
-  0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0xe3,
-  0x08,0xff,0xe4,0x08,0xff,0x04,0x09,0xff,0xe4,0x10,0xff,0xe4,0x08,0xff,0xe4,0x10,
-  0xff,0xe4,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,
-  0xe3,0x10,0xff,0xe3,0x10,0xff,0xe4,0x10,0xff,0xe4,0x10,0xff,0xe4,0x10,0xff,0xe3,
-  0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,
-  0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x10,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,
-  0xe3,0x08,0xff,0xe3,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0x04,0x09,0xff,0xe4,
-  0x08,0xff,0xe4,0x08,0xff,0xe4,0x10,0xff,0x04,0x09,0xff,0xe4,0x08,0xff,0xe4,0x08,
-  0xff,0xe4,0x08,0xff,0xe4,0x10,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,
-  0xe3,0x08,0xff,0xe4,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0xa2,0x00,0xff,0x6d,
-  0x63,0xff,0x49,0x3a,0xff,0xe3,0x08,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x45,0x11,0xff,0xc3,0x08,0xff,
-  0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,
-  0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0xc3,
-  0x08,0xff,0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,
-  0xc3,0x08,0xff,0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x25,0x11,
-  0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x19,
-  0xff,0x24,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,
-  0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,
-  0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,
-  0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,
-  0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,
-  0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,
-  0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,
-  0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,
-  0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x25,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,0xff,0xc3,0x08,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0xe4,0x10,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,
-  0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,
-  0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,
-  0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,
-  0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,
-  0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,
-  0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,
-  0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,
-  0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,
-  0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,
-  0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,
-  0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,
-  0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,
-  0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x19,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,0xff,0xc3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0xe4,0x10,0xff,0x66,0x21,0xff,0xcf,0x73,0xff,0xcf,0x73,0xff,0xcf,0x73,0xff,
-  0xef,0x73,0xff,0xef,0x7b,0xff,0xf0,0x7b,0xff,0xf0,0x7b,0xff,0x10,0x7c,0xff,0x10,
-  0x7c,0xff,0x10,0x7c,0xff,0x10,0x7c,0xff,0x10,0x7c,0xff,0x30,0x7c,0xff,0x30,0x7c,
-  0xff,0x30,0x7c,0xff,0x30,0x7c,0xff,0x31,0x7c,0xff,0x30,0x84,0xff,0x30,0x84,0xff,
-  0x30,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x31,0x84,0xff,0x51,0x84,0xff,0x51,
-  0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,
-  0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,
-  0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,
-  0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x31,0x84,0xff,0x31,0x84,
-  0xff,0x31,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,
-  0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,
-  0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,
-  0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x51,0x84,0xff,0x31,0x7c,0xff,
-  0x30,0x7c,0xff,0x30,0x7c,0xff,0x51,0x84,0xff,0x8e,0x6b,0xff,0xe4,0x10,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9a,0xce,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0xc3,0x08,0xff,0x08,0x32,0xff,0xbe,0xf7,0xff,0xff,0xff,0xff,0xdf,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0x18,0xbe,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x28,0x32,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0x52,0xcb,0xff,0x21,0x65,0xff,0x29,0xa6,0xff,0x29,0xa6,0xff,0x29,0xa6,0xff,0x29,
+  0x86,0xff,0x29,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x29,0x86,0xff,0x29,0x86,
+  0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,
+  0x21,0x86,0xff,0x21,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,
+  0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,
+  0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,
+  0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,
+  0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x21,0x86,0xff,0x21,0x86,
+  0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,
+  0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,
+  0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,
+  0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,
+  0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x21,0x86,0xff,0x21,
+  0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,
+  0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,
+  0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,0x86,0xff,0x21,
+  0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x29,0x86,0xff,0x19,0x45,0xff,0x73,0xaf,
+  0xff,0x3a,0x28,0xff,0x08,0xc2,0xff,0x11,0x04,0xff,0x08,0xe3,0xff,0x08,0xe4,0xff,
+  0x08,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe3,0xff,0x10,0xe3,0xff,0x10,
+  0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe4,
+  0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,
+  0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x08,0xe3,0xff,0x10,
+  0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,
+  0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,
+  0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,
+  0xe3,0xff,0x08,0xe4,0xff,0x09,0x04,0xff,0x10,0xe4,0xff,0x08,0xe4,0xff,0x10,0xe4,
+  0xff,0x10,0xe4,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,
+  0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe4,0xff,0x10,0xe4,0xff,0x10,0xe4,0xff,0x10,
+  0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,
+  0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x10,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,
+  0x08,0xe3,0xff,0x08,0xe3,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x09,0x04,0xff,0x08,
+  0xe4,0xff,0x08,0xe4,0xff,0x10,0xe4,0xff,0x09,0x04,0xff,0x08,0xe4,0xff,0x08,0xe4,
+  0xff,0x08,0xe4,0xff,0x10,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,
+  0x08,0xe3,0xff,0x10,0xe4,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x00,0xa2,0xff,0x63,
+  0x6d,0xff,0x3a,0x49,0xff,0x08,0xe3,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x45,0xff,0x08,0xc3,0xff,
+  0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x08,0xc3,
+  0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x08,
+  0xc3,0xff,0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x25,0xff,
+  0x08,0xc3,0xff,0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x25,
+  0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x19,0x24,
+  0xff,0x19,0x24,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,
+  0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x11,
+  0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,
+  0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,
+  0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,
+  0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,
+  0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,
+  0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,
+  0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x25,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x19,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,0xff,0x08,0xc3,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x10,0xe4,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,
+  0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,
+  0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,
+  0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,
+  0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,
+  0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,
+  0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,
+  0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,
+  0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,
+  0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,
+  0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,
+  0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,
+  0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,
+  0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x19,0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,0xff,0x08,0xc3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x10,0xe4,0xff,0x21,0x66,0xff,0x73,0xcf,0xff,0x73,0xcf,0xff,0x73,0xcf,0xff,
+  0x73,0xef,0xff,0x7b,0xef,0xff,0x7b,0xf0,0xff,0x7b,0xf0,0xff,0x7c,0x10,0xff,0x7c,
+  0x10,0xff,0x7c,0x10,0xff,0x7c,0x10,0xff,0x7c,0x10,0xff,0x7c,0x30,0xff,0x7c,0x30,
+  0xff,0x7c,0x30,0xff,0x7c,0x30,0xff,0x7c,0x31,0xff,0x84,0x30,0xff,0x84,0x30,0xff,
+  0x84,0x30,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x31,0xff,0x84,0x51,0xff,0x84,
+  0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,
+  0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,
+  0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,
+  0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x31,0xff,0x84,0x31,
+  0xff,0x84,0x31,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,
+  0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,
+  0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,
+  0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x84,0x51,0xff,0x7c,0x31,0xff,
+  0x7c,0x30,0xff,0x7c,0x30,0xff,0x84,0x51,0xff,0x6b,0x8e,0xff,0x10,0xe4,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x9a,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x08,0xc3,0xff,0x32,0x08,0xff,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,
+  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -218,13 +208,13 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xbe,0x18,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x32,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0xbe,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -235,13 +225,13 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x18,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0xbe,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x69,0x42,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -252,13 +242,13 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x18,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x42,0x69,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0xbe,
-  0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x63,0xff,0x49,
-  0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -269,13 +259,13 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x18,
+  0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x63,0x8e,0xff,0x3a,
+  0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,
-  0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x8e,0x63,0xff,
-  0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -286,13 +276,14 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,
+  0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x63,0x8e,0xff,
+  0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0x18,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x19,0xff,0xc3,0x08,0xff,0x6d,0x63,
-  0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -301,15 +292,12 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xdf,
-  0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,
-  0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x18,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x19,0xff,0xc3,0x08,0xff,0x6d,
-  0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,
+  0xbe,0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x24,0xff,0x08,0xc3,0xff,0x63,0x6d,
+  0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,
   0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -318,15 +306,15 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0xdf,0xff,0x69,0x42,0xff,
-  0x49,0x3a,0xff,0x49,0x42,0xff,0x49,0x42,0xff,0x49,0x42,0xff,0x49,0x3a,0xff,0x49,
-  0x3a,0xff,0x49,0x3a,0xff,0x49,0x3a,0xff,0x08,0x3a,0xff,0x9a,0xd6,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,
+  0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,
+  0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x18,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,
-  0x4d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,
+  0xff,0xbe,0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x24,0xff,0x08,0xc3,0xff,0x63,
+  0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,
   0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -335,1025 +323,1039 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0xa3,0x08,
-  0xff,0xa3,0x00,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xe3,0x08,0xff,0x83,0x00,0xff,0x39,0xc6,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0x1c,0xff,0x42,0x69,0xff,
+  0x3a,0x49,0xff,0x42,0x49,0xff,0x42,0x49,0xff,0x42,0x49,0xff,0x3a,0x49,0xff,0x3a,
+  0x49,0xff,0x3a,0x49,0xff,0x3a,0x49,0xff,0x3a,0x08,0xff,0xd6,0x9a,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xbe,0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,
+  0x63,0x4d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x3a,0x29,
+  0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x18,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,
-  0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x29,
-  0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x08,0xa3,
+  0xff,0x00,0xa3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xe3,0xff,0x00,0x83,0xff,0xc6,0x39,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xde,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0xe4,0x08,0xff,0x59,0xc6,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xbe,0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,
+  0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x3a,
+  0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x18,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,
-  0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,0x11,0xff,0xc3,0x08,0xff,
-  0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xbe,0xf7,0xff,0xbe,0xf7,0xff,0xbe,0xf7,0xff,0xbe,0xf7,0xff,
-  0xbe,0xf7,0xff,0xbe,0xf7,0xff,0xbe,0xf7,0xff,0xbe,0xf7,0xff,0xbe,0xf7,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xde,0xff,
-  0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x59,0xc6,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xdb,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x08,0xe4,0xff,0xc6,0x59,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x18,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,0x11,0xff,0xc3,0x08,
-  0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xb6,0xb5,0xff,0x65,0x21,0xff,0xe7,0x31,0xff,0xc7,0x31,0xff,0xc7,0x31,
-  0xff,0xe7,0x31,0xff,0xe7,0x31,0xff,0xe7,0x31,0xff,0xe7,0x31,0xff,0xe7,0x31,0xff,
-  0xc7,0x29,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xbe,0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,
+  0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x05,0xff,0x08,0xc3,0xff,
+  0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xf7,0xbe,0xff,0xf7,0xbe,0xff,0xf7,0xbe,0xff,0xf7,0xbe,0xff,
+  0xf7,0xbe,0xff,0xf7,0xbe,0xff,0xf7,0xbe,0xff,0xf7,0xbe,0xff,0xf7,0xbe,0xff,0xff,
+  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xde,
-  0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x59,
-  0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xbe,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,
-  0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,0x11,0xff,0xc3,
-  0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xdb,0xff,
+  0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0xc6,0x59,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x34,0xa5,0xff,0x41,0x00,0xff,0x03,0x09,0xff,0xe3,0x08,0xff,0xe3,
-  0x08,0xff,0xe3,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,
-  0xff,0x82,0x08,0xff,0x39,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xbe,0x18,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x05,0xff,0x08,0xc3,
+  0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xb5,0xb6,0xff,0x21,0x65,0xff,0x31,0xe7,0xff,0x31,0xc7,0xff,0x31,0xc7,
+  0xff,0x31,0xe7,0xff,0x31,0xe7,0xff,0x31,0xe7,0xff,0x31,0xe7,0xff,0x31,0xe7,0xff,
+  0x29,0xc7,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,
-  0xde,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x08,0xff,
-  0x59,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,
-  0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0xc3,0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x55,0xa5,0xff,0x82,0x00,0xff,0x45,0x19,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,
-  0x19,0xff,0xe4,0x08,0xff,0x59,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xdb,
+  0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0xce,
+  0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0x38,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,
+  0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x05,0xff,0x08,
+  0xc3,0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xa5,0x34,0xff,0x00,0x41,0xff,0x09,0x03,0xff,0x08,0xe3,0xff,0x08,
+  0xe3,0xff,0x08,0xe3,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x08,0xe4,
+  0xff,0x08,0x82,0xff,0xc6,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xdb,0xde,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x08,
-  0xff,0x59,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0xc3,0x08,0xff,0x48,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,
+  0xdb,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe3,0xff,
+  0xce,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0xff,0x82,0x00,0xff,0x25,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x25,0x11,0xff,0xc3,0x08,0xff,0x59,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xa5,0x55,0xff,0x00,0x82,0xff,0x19,0x45,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x19,
+  0x25,0xff,0x08,0xe4,0xff,0xc6,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xdb,0xde,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,
-  0x08,0xff,0x59,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xa3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xde,0xdb,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe3,
+  0xff,0xce,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xa5,0xff,0x82,0x00,0xff,0x25,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x05,0x11,0xff,0xc3,0x08,0xff,0x38,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xa3,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x08,0xc3,0xff,0x3a,0x48,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xa5,0x34,0xff,0x00,0x82,0xff,0x11,0x25,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x25,0xff,0x08,0xc3,0xff,0xc6,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xdb,0xde,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0xe4,0x08,0xff,0x59,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xde,0xdb,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,
+  0xe4,0xff,0xce,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xa5,0xff,0x82,0x00,0xff,0x25,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x38,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xa3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x35,0xff,0x00,0x82,0xff,0x11,0x25,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x05,0xff,0x08,0xc3,0xff,0xc6,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xdb,0xde,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0xe4,0x08,0xff,0x79,0xc6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x48,0x3a,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xde,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x08,0xe4,0xff,0xc6,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xa5,0xff,0x82,0x00,0xff,0x25,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x38,0xc6,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x35,0xff,0x00,0x82,0xff,0x11,0x25,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0xc6,0x38,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xdb,0xde,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0xe4,0x08,0xff,0x79,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x29,0x3a,0xff,
-  0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xde,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x08,0xe4,0xff,0xc6,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xa5,0xff,0x82,0x00,0xff,0x24,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x38,0xc6,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x48,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x35,0xff,0x00,0x82,0xff,0x11,0x25,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0xc6,0x38,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xdb,0xde,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0xe4,0x08,0xff,0x79,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x29,0x3a,
-  0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xde,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x08,0xe4,0xff,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x34,0xa5,0xff,0x82,0x00,0xff,
-  0x25,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x10,0xff,0x38,0xc6,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x29,0xff,
+  0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x35,0xff,0x00,0x82,0xff,0x11,
+  0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0xc6,0x38,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x79,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x48,
-  0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xde,0xdb,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x14,0x9d,0xff,0x61,0x00,
-  0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0xa3,0x10,0xff,0x38,0xc6,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x29,
+  0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x34,0xff,0x00,0x82,0xff,
+  0x11,0x25,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x10,0xc3,0xff,0xc6,0x38,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x79,0xce,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,
-  0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,
-  0x48,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x55,0xa5,0xff,0xa3,
-  0x08,0xff,0x25,0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x03,0x11,0xff,0x03,0x09,0xff,0xe4,0x08,0xff,0x82,0x08,0xff,0x38,0xc6,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,
+  0x48,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9d,0x14,0xff,0x00,0x61,
+  0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x10,0xa3,0xff,0xc6,0x38,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0xe4,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x7a,0xce,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x79,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0x59,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6d,0x63,
-  0xff,0x48,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0xdf,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,
+  0x59,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,
+  0x3a,0x48,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0xff,
-  0xfc,0xde,0xff,0xfb,0xde,0xff,0xbb,0xd6,0xff,0xba,0xd6,0xff,0x9a,0xd6,0xff,0x9a,
-  0xd6,0xff,0x9a,0xd6,0xff,0x9a,0xce,0xff,0x9a,0xce,0xff,0x7a,0xce,0xff,0xbe,0xf7,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x55,0xff,0x08,
+  0xa3,0xff,0x19,0x25,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x03,0xff,0x09,0x03,0xff,0x08,0xe4,0xff,0x08,0x82,0xff,0xc6,0x38,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0xe4,0x10,0xff,0xe4,
-  0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x7a,0xce,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x08,0xe4,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x7a,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x59,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,
-  0x63,0xff,0x48,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,
+  0xc6,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,
+  0xff,0x3a,0x48,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xff,
   0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbe,0xff,
+  0xde,0xfc,0xff,0xde,0xfb,0xff,0xd6,0xbb,0xff,0xd6,0xba,0xff,0xd6,0x9a,0xff,0xd6,
+  0x9a,0xff,0xd6,0x9a,0xff,0xce,0x9a,0xff,0xce,0x9a,0xff,0xce,0x7a,0xff,0xf7,0xbe,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x10,0xe4,0xff,0x10,
+  0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x7a,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xc6,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x63,
+  0x6d,0xff,0x3a,0x48,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,
+  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0xe4,0x10,0xff,
-  0xe4,0x10,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x7a,0xce,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x59,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,
-  0x6e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x49,0x3a,
-  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x10,0xe4,0xff,
+  0x10,0xe4,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0xce,0x7a,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xc6,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,
+  0x6b,0x6e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,0x49,
+  0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xda,0xd6,0xff,0xe3,0x10,
-  0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x9a,0xce,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x59,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,
-  0xff,0x6e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x49,
-  0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xda,0xff,0x10,0xe3,
+  0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x9a,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,
+  0xff,0x6b,0x6e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,
+  0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0xe4,
-  0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x08,0xff,0x99,0xce,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,
-  0x08,0xff,0x8e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,
-  0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x10,
+  0xe4,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe3,0xff,0xce,0x99,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,
+  0xc3,0xff,0x6b,0x8e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,
+  0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,
-  0xe3,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x08,0xff,0x9a,0xce,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xc3,0x08,0xff,0x8e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xc3,0x08,
-  0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,
+  0x10,0xe3,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe3,0xff,0xce,0x9a,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xc3,0xff,0x6b,0x8e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xc3,
+  0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,0xd6,
-  0xff,0xe3,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x08,0xff,0x9a,
-  0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,
-  0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,0x11,0xff,0xc3,
-  0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,
+  0xff,0x10,0xe3,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe3,0xff,0xce,
+  0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,
+  0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x05,0xff,0x08,
+  0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,
-  0xd6,0xff,0xe3,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,
-  0x9a,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,
-  0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,0x11,0xff,
-  0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,
+  0xba,0xff,0x10,0xe3,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,
+  0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,
+  0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x05,0xff,
+  0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xda,0xd6,0xff,0xe3,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x10,
-  0xff,0x9a,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x25,0x19,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xd6,0xda,0xff,0x10,0xe3,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x10,0xe4,
+  0xff,0xd6,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0x08,0xa3,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xba,0xd6,0xff,0xe4,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,
-  0x10,0xff,0x9a,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,0xa3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xd6,0xba,0xff,0x10,0xe4,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x10,
+  0xe4,0xff,0xd6,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0x08,0xa3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xdb,0xd6,0xff,0xe4,0x10,0xff,0xe4,0x10,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0xe4,0x08,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,0xa3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x29,0x3a,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xd6,0xdb,0xff,0x10,0xe4,0xff,0x10,0xe4,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x08,0xe4,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0x08,0xa3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x29,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0xe4,0x08,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,0xa3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6d,0x63,0xff,0x29,0x3a,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x08,0xe4,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0x08,0xa3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x63,0x6d,0xff,0x3a,0x29,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0xe4,0x08,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,0xa3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x08,0xe4,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,0x08,
+  0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0xe4,0x08,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xce,0xff,
-  0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,0x49,0x3a,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x59,0xff,
+  0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,0x3a,0x49,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0xe4,0x10,0xff,0x9a,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xc6,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,0x49,
-  0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x10,0xe4,0xff,0xd6,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x79,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,0x3a,
+  0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x9a,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,
-  0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,
-  0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xd6,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,
+  0x59,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,
+  0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0xe4,0x08,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6e,0x6b,
-  0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x08,0xe4,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,
+  0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,
+  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x09,0xff,0x9a,0xce,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6e,
-  0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,
-  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x09,0x04,0xff,0xce,0x9a,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,
+  0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,
+  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x03,0x09,0xff,0x9a,0xce,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,
-  0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,
-  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x09,0x03,0xff,0xce,0x9a,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,
+  0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,
+  0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x10,0xff,0x9a,0xd6,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,
-  0xff,0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x29,
-  0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x10,0xe3,0xff,0xd6,0x9a,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,
+  0xff,0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,
+  0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdb,0xd6,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x10,0xff,0x9a,0xd6,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,
-  0x08,0xff,0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,
-  0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xdb,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x10,0xe3,0xff,0xd6,0x9a,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,
+  0xa3,0xff,0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,
+  0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0xd6,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe3,0x10,0xff,0x9a,0xd6,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xa3,0x08,0xff,0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,
-  0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xbb,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x10,0xe3,0xff,0xd6,0x9a,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xa3,0xff,0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,
+  0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,0xd6,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xba,
-  0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,
-  0xff,0xc3,0x08,0xff,0x6e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,
-  0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xba,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0xd6,
+  0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,
+  0xff,0x08,0xc3,0xff,0x6b,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,
+  0xc3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xba,
-  0xd6,0xff,0xe3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0xba,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,
-  0x11,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,
-  0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,
+  0xba,0xff,0x08,0xe3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,
+  0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xba,0xd6,0xff,0xe3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0xba,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x25,0x11,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xd6,0xba,0xff,0x08,0xe3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,
+  0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x9a,0xce,0xff,0xe3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0xba,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,0x49,0x42,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0xe3,0x08,0xff,0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,
-  0xc6,0xff,0xf3,0x9c,0xff,0x75,0xad,0xff,0x55,0xa5,0xff,0x55,0xa5,0xff,0x55,0xa5,
-  0xff,0x55,0xa5,0xff,0x34,0x9d,0xff,0x14,0x9d,0xff,0xd3,0x94,0xff,0xd3,0x94,0xff,
-  0x9d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x18,0xbe,0xff,0xa3,0x08,0xff,0x24,0x19,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0xdb,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xce,0x9a,0xff,0x08,0xe3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0xd6,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6e,0x63,0xff,0x69,0x42,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0xe3,0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,0x42,0x49,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x08,0xe3,0xff,0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
-  0x51,0x84,0xff,0x00,0x00,0xff,0xc2,0x08,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,
-  0x00,0xff,0xa2,0x00,0xff,0xa2,0x00,0xff,0xa2,0x00,0xff,0xa2,0x00,0xff,0x61,0x00,
-  0xff,0x18,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,
+  0x38,0xff,0x9c,0xf3,0xff,0xad,0x75,0xff,0xa5,0x55,0xff,0xa5,0x55,0xff,0xa5,0x55,
+  0xff,0xa5,0x55,0xff,0x9d,0x34,0xff,0x9d,0x14,0xff,0x94,0xd3,0xff,0x94,0xd3,0xff,
+  0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xd3,0x94,0xff,0x82,0x00,0xff,0x25,0x19,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x45,0x19,0xff,0x1c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xbe,0x18,0xff,0x08,0xa3,0xff,0x19,0x24,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0xd6,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xa3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6e,0x63,0xff,0x69,0x42,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x49,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6e,0xff,0x42,0x69,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x08,0xe3,0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
+  0x84,0x51,0xff,0x00,0x00,0xff,0x08,0xc2,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,
+  0x82,0xff,0x00,0xa2,0xff,0x00,0xa2,0xff,0x00,0xa2,0xff,0x00,0xa2,0xff,0x00,0x61,
+  0xff,0xbe,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xf7,0xbd,0xff,0xc3,0x08,0xff,0x44,0x19,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x25,0x11,0xff,0x25,0x11,0xff,0x44,0x11,0xff,0x45,0x11,0xff,0x65,0x19,0xff,0xa3,
-  0x00,0xff,0x30,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0x94,0xd3,0xff,0x00,0x82,0xff,0x19,0x25,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x19,0x45,0xff,0xe7,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x0c,0x5b,0xff,0x82,0x00,0xff,0x24,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xe4,
-  0x08,0xff,0xc7,0x29,0xff,0x9e,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xa3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6e,0xff,0x42,0x69,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x3a,0x49,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6e,0x63,0xff,0x69,0x42,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xbd,0xf7,0xff,0x08,0xc3,0xff,0x19,0x44,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x44,0xff,0x11,0x45,0xff,0x19,0x65,0xff,0x00,
+  0xa3,0xff,0x7c,0x30,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x3c,0xe7,0xff,0x44,0x19,0xff,0xe3,0x10,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0xe3,0x08,0xff,0xc7,0x29,0xff,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x5b,0x0c,0xff,0x00,0x82,0xff,0x11,0x24,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,
+  0xe4,0xff,0x29,0xc7,0xff,0xef,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x3c,0xe7,0xff,0x24,0x19,0xff,0xe4,0x10,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xc3,0x08,0xff,0xab,0x4a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6e,0xff,0x42,0x69,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,
-  0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,0x69,0x42,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xe7,0x3c,0xff,0x19,0x44,0xff,0x10,0xe3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x08,0xe3,0xff,0x29,0xc7,0xff,0xf7,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xaa,0x4a,0xff,0xa2,0x08,0xff,0x24,0x19,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0x25,0x19,0xff,0x82,0x00,0xff,0xd3,0x94,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,
-  0xff,0xff,0xff,0x31,0x84,0xff,0x82,0x00,0xff,0x25,0x19,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,
-  0xff,0x82,0x00,0xff,0x10,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xe7,0x3c,0xff,0x19,0x24,0xff,0x10,0xe4,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xc3,0xff,0x4a,0xab,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,
-  0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x6e,0x6b,0xff,0x49,
-  0x42,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,
+  0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,0x42,0x69,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd3,0x94,0xff,0x82,0x00,0xff,0x24,0x19,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x45,0x19,0xff,0xfb,0xde,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x4a,0xaa,0xff,0x08,0xa2,0xff,0x19,0x24,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x19,0x25,0xff,0x00,0x82,0xff,0x94,0xd3,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,
+  0xff,0xff,0xff,0x84,0x31,0xff,0x00,0x82,0xff,0x19,0x25,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,
+  0xff,0x00,0x82,0xff,0x7c,0x10,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xdb,0xd6,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,
-  0x11,0xff,0xc3,0x08,0xff,0x18,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,
+  0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x6e,0xff,0x42,
+  0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,
-  0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,
-  0x49,0x42,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x94,0xd3,0xff,0x00,0x82,0xff,0x19,0x24,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x19,0x45,0xff,0xde,0xfb,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0xff,0x24,0x19,0xff,0xe4,0x10,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x49,0x3a,0xff,0x9e,
-  0xf7,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,
-  0xf7,0xff,0x28,0x3a,0xff,0xa3,0x08,0xff,0x24,0x19,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xe4,0x08,0xff,0xe7,0x29,0xff,0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xd6,0xdb,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x25,0xff,0x08,0xc3,0xff,0xbe,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0x79,0xce,0xff,0xa3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,
-  0xff,0x49,0x42,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x28,0x3a,0xff,0xdf,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,
+  0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,
+  0x42,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x6d,0x63,0xff,0x82,
-  0x00,0xff,0x24,0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa2,0x08,0xff,
-  0xaa,0x4a,0xff,0x5d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,0xff,0x19,0x24,0xff,0x10,0xe4,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x3a,0x49,0xff,0xf7,
+  0x9e,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xef,0xff,
-  0x8a,0x42,0xff,0x82,0x00,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,
-  0xff,0x82,0x00,0xff,0x31,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,
+  0xbe,0xff,0x3a,0x28,0xff,0x08,0xa3,0xff,0x19,0x24,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xe4,0xff,0x29,0xe7,0xff,0xf7,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,0x8e,
-  0x6b,0xff,0x49,0x42,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x28,0x3a,0xff,
+  0xce,0x79,0xff,0x08,0xa3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,
+  0xff,0x42,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x3a,0x28,0xff,0xff,
   0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xde,0xff,
-  0x04,0x19,0xff,0xe3,0x10,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x45,0x19,
-  0xff,0xa2,0x08,0xff,0xc7,0x29,0xff,0xf7,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x63,0x6d,0xff,0x00,
+  0x82,0xff,0x19,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa2,0xff,
+  0x4a,0xaa,0xff,0xef,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0xc6,0xff,0xe7,0x31,
-  0xff,0xa2,0x00,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x45,0x19,0xff,0x1c,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7d,0xff,
+  0x42,0x8a,0xff,0x00,0x82,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,
+  0xff,0x00,0x82,0xff,0x7c,0x31,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,0xff,
-  0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x29,0x3a,
+  0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,0x6b,
+  0x8e,0xff,0x42,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x3a,0x28,0xff,
   0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xde,0xfb,0xff,
+  0x19,0x04,0xff,0x10,0xe3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x45,
+  0xff,0x08,0xa2,0xff,0x29,0xc7,0xff,0xb5,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x51,0x84,0xff,0x61,0x00,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x19,0xff,0xe3,0x08,0xff,0xe3,0x08,0xff,0x0c,0x53,0xff,0xd7,0xb5,
-  0xff,0x9d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x9e,0xf7,0xff,0x18,0xc6,0xff,0x6d,0x63,0xff,0xe3,0x10,0xff,0xc3,
-  0x08,0xff,0x25,0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0x82,0x00,0xff,0x51,0x7c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x39,0xff,0x31,0xe7,
+  0xff,0x00,0xa2,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x19,0x45,0xff,0xdf,0x1c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,0x08,
-  0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x29,
-  0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,0xff,
+  0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x29,
+  0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xbe,0xf7,0xff,0xe7,0x31,0xff,0xa2,0x08,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0xc3,0x00,0xff,0xc3,
-  0x08,0xff,0xa6,0x29,0xff,0xca,0x4a,0xff,0x6d,0x63,0xff,0xcf,0x73,0xff,0xae,0x6b,
-  0xff,0xcb,0x52,0xff,0xc7,0x29,0xff,0xc3,0x08,0xff,0x82,0x00,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,
-  0xff,0xe7,0x29,0xff,0x9e,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0x84,0x51,0xff,0x00,0x61,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x19,0x24,0xff,0x08,0xe3,0xff,0x08,0xe3,0xff,0x53,0x0c,0xff,0xb5,0xd7,
+  0xff,0xef,0x9d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xf7,0x9e,0xff,0xc6,0x18,0xff,0x63,0x6d,0xff,0x10,0xe3,0xff,0x08,
+  0xc3,0xff,0x19,0x25,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x00,0x82,0xff,0x7c,0x51,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xa3,
-  0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,
-  0x29,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xa3,
+  0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,
+  0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xa2,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,
-  0x24,0x11,0xff,0xe3,0x10,0xff,0xc3,0x08,0xff,0xa2,0x00,0xff,0x82,0x00,0xff,0xa2,
-  0x00,0xff,0xa3,0x08,0xff,0xe3,0x08,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0xc3,
-  0x08,0xff,0x18,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xf7,0xbe,0xff,0x31,0xe7,0xff,0x08,0xa2,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x00,0xc3,0xff,0x08,
+  0xc3,0xff,0x29,0xa6,0xff,0x4a,0xca,0xff,0x63,0x6d,0xff,0x73,0xcf,0xff,0x6b,0xae,
+  0xff,0x52,0xcb,0xff,0x29,0xc7,0xff,0x08,0xc3,0xff,0x00,0x82,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xe3,
+  0xff,0x29,0xe7,0xff,0xef,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,
-  0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,
+  0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,
+  0x3a,0x29,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x92,0x8c,0xff,0x61,0x00,0xff,
-  0x24,0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,
-  0x25,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0x82,0x00,0xff,
-  0x92,0x8c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xa2,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x25,0xff,
+  0x11,0x24,0xff,0x10,0xe3,0xff,0x08,0xc3,0xff,0x00,0xa2,0xff,0x00,0x82,0xff,0x00,
+  0xa2,0xff,0x08,0xa3,0xff,0x08,0xe3,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x08,
+  0xc3,0xff,0xbe,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,
-  0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,
-  0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,
+  0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8e,0x6b,
-  0xff,0x41,0x00,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0x62,0x00,0xff,0x6e,0x63,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x8c,0x92,0xff,0x00,0x61,0xff,
+  0x19,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,
+  0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x00,0x82,0xff,
+  0x8c,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,
+  0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,
+  0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,
-  0x05,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,
-  0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,
-  0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x6b,0x8e,
+  0xff,0x00,0x41,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x00,0x62,0xff,0x63,0x6e,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x4d,0x63,0xff,0x61,0x00,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0x62,0x00,0xff,0x2d,0x63,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,
+  0x11,0x05,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,
+  0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,
+  0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x79,0xce,0xff,0xc3,0x08,0xff,0x04,0x11,
-  0xff,0x05,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x63,0x4d,0xff,0x00,0x61,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x00,0x62,0xff,0x63,0x2d,0xff,0xff,
+  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x0f,0x7c,0xff,0x61,0x00,0xff,0xe3,0x08,0xff,0x24,
-  0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x82,0x00,0xff,0xcf,0x73,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xce,0x79,0xff,0x08,0xc3,0xff,0x11,0x04,
+  0xff,0x11,0x05,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xc3,0x08,0xff,0x04,
-  0x11,0xff,0x05,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,
-  0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0x0f,0xff,0x00,0x61,0xff,0x08,0xe3,0xff,0x19,
+  0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x00,0x82,0xff,0x73,0xcf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x96,0xad,0xff,0x65,0x21,0xff,
-  0x82,0x00,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,
-  0x09,0xff,0x82,0x00,0xff,0x65,0x21,0xff,0x75,0xad,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xc3,0xff,0x11,
+  0x04,0xff,0x11,0x05,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xc3,0x08,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xad,0x96,0xff,0x21,0x65,0xff,
+  0x00,0x82,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x09,
+  0x04,0xff,0x00,0x82,0xff,0x21,0x65,0xff,0xad,0x75,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,
-  0xff,0x8e,0x6b,0xff,0xe3,0x08,0xff,0x82,0x00,0xff,0xe3,0x10,0xff,0x24,0x11,0xff,
-  0x24,0x19,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0xe3,0x08,0xff,0x82,0x00,0xff,
-  0x04,0x11,0xff,0x8e,0x6b,0xff,0x3c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xc3,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xc3,0x08,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3c,
+  0xff,0x6b,0x8e,0xff,0x08,0xe3,0xff,0x00,0x82,0xff,0x10,0xe3,0xff,0x11,0x24,0xff,
+  0x19,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x08,0xe3,0xff,0x00,0x82,0xff,
+  0x11,0x04,0xff,0x6b,0x8e,0xff,0xe7,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xc3,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x9a,0xce,0xff,0xae,0x6b,0xff,0x65,0x21,0xff,0x82,0x00,
-  0xff,0x82,0x00,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0xe4,
-  0x10,0xff,0xc3,0x08,0xff,0x82,0x00,0xff,0xa2,0x00,0xff,0x86,0x21,0xff,0xef,0x73,
-  0xff,0xbb,0xd6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x58,0xc6,0xff,0xc3,
-  0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xce,0x9a,0xff,0x6b,0xae,0xff,0x21,0x65,0xff,0x00,0x82,
+  0xff,0x00,0x82,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x10,
+  0xe4,0xff,0x08,0xc3,0xff,0x00,0x82,0xff,0x00,0xa2,0xff,0x21,0x86,0xff,0x73,0xef,
+  0xff,0xd6,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x58,0xff,0x08,
+  0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xe7,0xff,0x55,
-  0x9d,0xff,0x2c,0x5b,0xff,0xc7,0x29,0xff,0xe4,0x10,0xff,0xa2,0x08,0xff,0x82,0x00,
-  0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0x82,0x00,0xff,0xc3,0x08,0xff,
-  0x24,0x19,0xff,0x08,0x32,0xff,0x8e,0x63,0xff,0x96,0xad,0xff,0x7d,0xef,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x5d,0xff,0x9d,
+  0x55,0xff,0x5b,0x2c,0xff,0x29,0xc7,0xff,0x10,0xe4,0xff,0x08,0xa2,0xff,0x00,0x82,
+  0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x00,0x82,0xff,0x08,0xc3,0xff,
+  0x19,0x24,0xff,0x32,0x08,0xff,0x63,0x8e,0xff,0xad,0x96,0xff,0xef,0x7d,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,0xff,
-  0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,0x3a,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,0xff,
+  0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,0x49,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0xff,0xba,0xd6,0xff,0xd7,0xb5,0xff,0x34,
-  0x9d,0xff,0xd3,0x94,0xff,0xd3,0x94,0xff,0xf3,0x94,0xff,0x75,0xad,0xff,0x38,0xc6,
-  0xff,0x1c,0xdf,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0x9e,0xff,0xd6,0xba,0xff,0xb5,0xd7,0xff,0x9d,
+  0x34,0xff,0x94,0xd3,0xff,0x94,0xd3,0xff,0x94,0xf3,0xff,0xad,0x75,0xff,0xc6,0x38,
+  0xff,0xdf,0x1c,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,0xc6,
-  0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,0x49,
-  0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x38,
+  0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,0x3a,
+  0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1363,14 +1365,14 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x38,
-  0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xa3,0x08,0xff,0x8e,0x6b,0xff,
-  0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,
+  0x38,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xa3,0xff,0x6b,0x8e,0xff,
+  0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1381,13 +1383,14 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0x38,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6e,0x63,
-  0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,0xdf,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xc6,0x38,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,0x6e,
+  0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,0xff,
+  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1398,13 +1401,13 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0x38,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,0x6e,
-  0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,0xff,
-  0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xc6,0x38,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,0x63,
+  0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,0xff,
+  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1415,11 +1418,13 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0x38,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,0xff,
-  0x6e,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,0x3a,
-  0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xc6,0x38,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,0xff,
+  0x63,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,0x28,
+  0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1432,11 +1437,11 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0x38,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x19,0xff,0xc3,0x08,
-  0xff,0x6e,0x63,0xff,0x29,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x28,
-  0x3a,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x19,0x25,0xff,0x08,0xc3,
+  0xff,0x63,0x6e,0xff,0x3a,0x29,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x3a,
+  0x28,0xff,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1449,11 +1454,11 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0x38,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,0xc3,
-  0x08,0xff,0x6e,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,
-  0x28,0x3a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xc6,0x38,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,0x08,
+  0xc3,0xff,0x63,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,
+  0x3a,0x28,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
@@ -1466,179 +1471,179 @@ const uint8_t academy_logo_map[]={
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
   0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-  0xff,0xff,0xff,0xff,0xff,0x59,0xc6,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,0xff,
-  0xc3,0x08,0xff,0x6e,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x45,0x19,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,
-  0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,
-  0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x69,0x42,0xff,0x69,0x42,
-  0xff,0x69,0x42,0xff,0x69,0x42,0xff,0x89,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,
-  0x8a,0x4a,0xff,0x8a,0x4a,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,
-  0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x6a,0x42,0xff,0x6a,0x42,
-  0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,
-  0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x6a,0x42,0xff,0x8a,
-  0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0xaa,0x4a,0xff,0xaa,0x4a,
-  0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xca,0x4a,0xff,
-  0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,
-  0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,
-  0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0x8a,0x42,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,
-  0x8a,0x42,0xff,0xaa,0x4a,0xff,0x28,0x3a,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,0x11,
-  0xff,0xc3,0x08,0xff,0x6e,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xa3,0x08,0xff,0xa3,0x08,0xff,0xa3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xa3,0x08,0xff,0xa3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x00,0xff,0xc3,0x08,0xff,0xc3,0x00,0xff,0xc3,
-  0x00,0xff,0xc3,0x00,0xff,0xc3,0x00,0xff,0xc3,0x00,0xff,0xc3,0x00,0xff,0xc3,0x00,
-  0xff,0xc3,0x00,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xa3,0x08,0xff,0xc3,0x08,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x25,
-  0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x19,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x19,0xff,0x24,0x19,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,
-  0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,
-  0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,
-  0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,
-  0x11,0xff,0x25,0x11,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,
-  0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,
-  0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x25,0x19,0xff,0x24,
-  0x11,0xff,0x25,0x19,0xff,0x24,0x19,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,0x24,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,
-  0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,
-  0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,
-  0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,0x11,
-  0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x49,0x3a,0xff,0xc3,0x08,0xff,
-  0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,
-  0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,
-  0xff,0x25,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x05,
-  0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x63,0xff,0x28,0x3a,0xff,0xc3,0x08,
-  0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x25,0x11,0xff,0xc3,0x08,0xff,0x6d,0x6b,0xff,0x28,0x3a,0xff,0xc3,
-  0x08,0xff,0x24,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,
-  0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,
-  0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,0xff,0x04,0x11,
-  0xff,0x04,0x11,0xff,0x24,0x11,0xff,0xc3,0x08,0xff,0x6d,0x6b,0xff,0x28,0x3a,0xff,
-  0xe3,0x08,0xff,0x25,0x19,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,
-  0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,
-  0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x25,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,
-  0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,
-  0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,
-  0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x24,0x11,0xff,0x25,0x11,0xff,0x25,
-  0x11,0xff,0x25,0x19,0xff,0x45,0x19,0xff,0xc3,0x08,0xff,0x8e,0x6b,0xff,0xe7,0x31,
-  0xff,0x82,0x00,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc4,0x08,0xff,0xc4,0x08,0xff,0xc4,0x08,0xff,0xc4,0x08,0xff,0xc3,0x08,0xff,0xc4,
-  0x08,0xff,0xc4,0x08,0xff,0xc4,0x08,0xff,0xc4,0x08,0xff,0xc4,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,
-  0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,
-  0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,0xc3,0x08,0xff,
-  0xc3,0x08,0xff,0xe4,0x08,0xff,0xe4,0x08,0xff,0x82,0x00,0xff,0x4d,0x63,0xff,0x4d,
-  0x63,0xff,0x69,0x42,0xff,0x8a,0x4a,0xff,0x6a,0x4a,0xff,0x6a,0x4a,0xff,0x6a,0x4a,
-  0xff,0x8a,0x4a,0xff,0x8a,0x4a,0xff,0x8a,0x4a,0xff,0x8a,0x4a,0xff,0x8a,0x4a,0xff,
-  0x8a,0x4a,0xff,0x8a,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xaa,0x4a,0xff,0xab,
-  0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,
-  0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,
-  0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,
-  0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0x8a,0x4a,
-  0xff,0xaa,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,
-  0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,
-  0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xaa,0x4a,0xff,0xab,0x4a,
-  0xff,0xab,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,
-  0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xab,0x4a,0xff,0xab,0x4a,0xff,0xaa,0x4a,0xff,0xaa,
-  0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,
-  0xff,0x8a,0x4a,0xff,0x8a,0x4a,0xff,0xaa,0x4a,0xff,0xaa,0x4a,0xff,0x8a,0x4a,0xff,
-  0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,0x42,0xff,0x8a,
-  0x42,0xff,0x6a,0x42,0xff,0x6a,0x42,0xff,0x8a,0x42,0xff,0x6a,0x42,0xff,0x6a,0x42,
-  0xff,0x6a,0x42,0xff,0x69,0x42,0xff,0x69,0x42,0xff,0x08,0x32,0xff,0x51,0x84,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xc6,0x59,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,0xff,
+  0x08,0xc3,0xff,0x63,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x19,0x45,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,
+  0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,
+  0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x69,0xff,0x42,0x69,
+  0xff,0x42,0x69,0xff,0x42,0x69,0xff,0x42,0x89,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,
+  0x4a,0x8a,0xff,0x4a,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,
+  0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x6a,0xff,0x42,0x6a,
+  0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,
+  0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x6a,0xff,0x42,
+  0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x4a,0xaa,0xff,0x4a,0xaa,
+  0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xca,0xff,
+  0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,
+  0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,
+  0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x42,0x8a,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,
+  0x42,0x8a,0xff,0x4a,0xaa,0xff,0x3a,0x28,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x25,
+  0xff,0x08,0xc3,0xff,0x63,0x6e,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xa3,0xff,0x08,0xa3,0xff,0x08,0xa3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xa3,0xff,0x08,0xa3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x00,0xc3,0xff,0x08,0xc3,0xff,0x00,0xc3,0xff,0x00,
+  0xc3,0xff,0x00,0xc3,0xff,0x00,0xc3,0xff,0x00,0xc3,0xff,0x00,0xc3,0xff,0x00,0xc3,
+  0xff,0x00,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xa3,0xff,0x08,0xc3,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,0x24,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x19,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x19,0x24,0xff,0x19,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,
+  0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,
+  0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,
+  0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,
+  0x25,0xff,0x11,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,
+  0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,
+  0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x19,0x25,0xff,0x11,
+  0x24,0xff,0x19,0x25,0xff,0x19,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,0x11,
+  0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,
+  0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,
+  0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,
+  0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x05,
+  0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x49,0xff,0x08,0xc3,0xff,
+  0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x25,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,
+  0xff,0x11,0x25,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x05,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x63,0x6d,0xff,0x3a,0x28,0xff,0x08,0xc3,
+  0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x25,0xff,0x08,0xc3,0xff,0x6b,0x6d,0xff,0x3a,0x28,0xff,0x08,
+  0xc3,0xff,0x11,0x24,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,
+  0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,
+  0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,0xff,0x11,0x04,
+  0xff,0x11,0x04,0xff,0x11,0x24,0xff,0x08,0xc3,0xff,0x6b,0x6d,0xff,0x3a,0x28,0xff,
+  0x08,0xe3,0xff,0x19,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,
+  0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,
+  0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x25,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,
+  0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,
+  0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,
+  0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x24,0xff,0x11,0x25,0xff,0x11,
+  0x25,0xff,0x19,0x25,0xff,0x19,0x45,0xff,0x08,0xc3,0xff,0x6b,0x8e,0xff,0x31,0xe7,
+  0xff,0x00,0x82,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc4,0xff,0x08,0xc4,0xff,0x08,0xc4,0xff,0x08,0xc4,0xff,0x08,0xc3,0xff,0x08,
+  0xc4,0xff,0x08,0xc4,0xff,0x08,0xc4,0xff,0x08,0xc4,0xff,0x08,0xc4,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,
+  0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,
+  0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,0x08,0xc3,0xff,
+  0x08,0xc3,0xff,0x08,0xe4,0xff,0x08,0xe4,0xff,0x00,0x82,0xff,0x63,0x4d,0xff,0x63,
+  0x4d,0xff,0x42,0x69,0xff,0x4a,0x8a,0xff,0x4a,0x6a,0xff,0x4a,0x6a,0xff,0x4a,0x6a,
+  0xff,0x4a,0x8a,0xff,0x4a,0x8a,0xff,0x4a,0x8a,0xff,0x4a,0x8a,0xff,0x4a,0x8a,0xff,
+  0x4a,0x8a,0xff,0x4a,0x8a,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xaa,0xff,0x4a,
+  0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,
+  0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,
+  0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,
+  0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0x8a,
+  0xff,0x4a,0xaa,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,
+  0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,
+  0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xaa,0xff,0x4a,0xab,
+  0xff,0x4a,0xab,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,
+  0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xab,0xff,0x4a,0xab,0xff,0x4a,0xaa,0xff,0x4a,
+  0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0xaa,
+  0xff,0x4a,0x8a,0xff,0x4a,0x8a,0xff,0x4a,0xaa,0xff,0x4a,0xaa,0xff,0x4a,0x8a,0xff,
+  0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,0x8a,0xff,0x42,
+  0x8a,0xff,0x42,0x6a,0xff,0x42,0x6a,0xff,0x42,0x8a,0xff,0x42,0x6a,0xff,0x42,0x6a,
+  0xff,0x42,0x6a,0xff,0x42,0x69,0xff,0x42,0x69,0xff,0x32,0x08,0xff,0x84,0x51,0xff,
 };
 
 const lv_img_dsc_t academy_logo={.header={.always_zero=0,.w=91,.h=96,.cf=LV_IMG_CF_TRUE_COLOR_ALPHA},.data_size=26208,.data=academy_logo_map};
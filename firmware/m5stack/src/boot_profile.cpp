@@ -0,0 +1,146 @@
+#include "boot_profile.h"
+
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <string.h>
+
+#define DEP(s) (1u << (s))
+
+namespace {
+
+struct StageDef {
+  const char* name;
+  uint32_t deps;
+};
+
+// 단계 이름과 의존 관계. setup()의 run() 순서는 이 표를 어기지 않아야 한다.
+const StageDef kStages[BOOT_STAGE_COUNT] = {
+  {"hw", 0},
+  {"nvs", DEP(BOOT_STAGE_HW)},
+  {"wifi_start", DEP(BOOT_STAGE_HW)},
+  {"ntp_start", DEP(BOOT_STAGE_WIFI_START)},  // lwIP가 WiFi.mode()에서 올라온다
+  {"fs", DEP(BOOT_STAGE_HW)},
+  {"lvgl", DEP(BOOT_STAGE_FS) | DEP(BOOT_STAGE_NVS)},
+  {"hw_stream", DEP(BOOT_STAGE_HW)},
+  {"snapshot", DEP(BOOT_STAGE_LVGL) | DEP(BOOT_STAGE_HW_STREAM) | DEP(BOOT_STAGE_NVS)},
+  {"mqtt_setup", DEP(BOOT_STAGE_NVS) | DEP(BOOT_STAGE_WIFI_START)},
+  {"wifi_up", DEP(BOOT_STAGE_WIFI_START)},
+  {"time_sync", DEP(BOOT_STAGE_NTP_START) | DEP(BOOT_STAGE_WIFI_UP)},
+  {"mqtt_up", DEP(BOOT_STAGE_MQTT_SETUP) | DEP(BOOT_STAGE_WIFI_UP)},
+  {"first_screen", DEP(BOOT_STAGE_LVGL)},
+  {"first_data", DEP(BOOT_STAGE_MQTT_UP)},
+};
+
+const uint32_t kMagic = 0x424F4F54;  // "BOOT"
+const uint32_t kNone = 0xFFFFFFFFu;
+
+struct Timeline {
+  uint32_t magic;
+  uint32_t boot_no;
+  uint32_t reset_reason;
+  uint32_t start_ms[BOOT_STAGE_COUNT];
+  uint32_t end_ms[BOOT_STAGE_COUNT];
+};
+
+// 이번 부팅 기록. 다음 부팅의 begin()이 prev로 옮긴다.
+RTC_NOINIT_ATTR Timeline s_cur;
+Timeline s_prev;
+bool s_prev_valid = false;
+
+uint32_t deps_end(uint32_t deps) {
+  uint32_t t = 0;
+  for (uint8_t d = 0; d < BOOT_STAGE_COUNT; ++d) {
+    if (!(deps & DEP(d))) continue;
+    if (s_cur.end_ms[d] != kNone && s_cur.end_ms[d] > t) t = s_cur.end_ms[d];
+  }
+  return t;
+}
+
+}  // namespace
+
+void BootProfile::begin() {
+  s_prev_valid = s_cur.magic == kMagic;
+  if (s_prev_valid) s_prev = s_cur;
+  const uint32_t boot_no = s_prev_valid ? s_prev.boot_no + 1 : 1;
+  memset(&s_cur, 0xFF, sizeof(s_cur));
+  s_cur.magic = kMagic;
+  s_cur.boot_no = boot_no;
+  s_cur.reset_reason = (uint32_t)esp_reset_reason();
+  if (s_prev_valid) {
+    // 이전 부팅이 끝내지 못한 단계: 부팅 중 멈춤/재부팅 위치
+    for (uint8_t i = 0; i < BOOT_STAGE_WIFI_UP; ++i) {
+      if (s_prev.start_ms[i] != kNone && s_prev.end_ms[i] == kNone) {
+        Serial.printf("[BOOT] previous boot #%lu stopped in stage %s (started at %lums)\n",
+                      (unsigned long)s_prev.boot_no, kStages[i].name, (unsigned long)s_prev.start_ms[i]);
+      }
+    }
+  }
+}
+
+bool BootProfile::done(BootStage s) const {
+  return s_cur.end_ms[s] != kNone;
+}
+
+const char* BootProfile::name(BootStage s) {
+  return s < BOOT_STAGE_COUNT ? kStages[s].name : "?";
+}
+
+void BootProfile::run(BootStage s, StageFn fn) {
+  const uint32_t deps = kStages[s].deps;
+  for (uint8_t d = 0; d < BOOT_STAGE_COUNT; ++d) {
+    if ((deps & DEP(d)) && !done((BootStage)d)) {
+      Serial.printf("[BOOT] stage %s started before dependency %s\n", kStages[s].name, kStages[d].name);
+    }
+  }
+  s_cur.start_ms[s] = millis();
+  fn();
+  s_cur.end_ms[s] = millis();
+  Serial.printf("[BOOT] %s %lu+%lums\n",
+                kStages[s].name,
+                (unsigned long)s_cur.start_ms[s],
+                (unsigned long)(s_cur.end_ms[s] - s_cur.start_ms[s]));
+}
+
+void BootProfile::mark(BootStage s) {
+  if (done(s)) return;
+  const uint32_t now = millis();
+  uint32_t start = deps_end(kStages[s].deps);
+  if (start > now) start = now;
+  s_cur.start_ms[s] = start;
+  s_cur.end_ms[s] = now;
+  Serial.printf("[BOOT] %s at %lums (waited %lums)\n", kStages[s].name, (unsigned long)now, (unsigned long)(now - start));
+}
+
+void BootProfile::append_diag(String& out) const {
+  out += "boot_no=" + String((unsigned long)s_cur.boot_no) + " reset_reason=" + String((unsigned long)s_cur.reset_reason) + "\n";
+  // 단계별 "시작+소요"(ms). 아직 안 끝난 단계는 "-".
+  out += "boot_timeline=";
+  for (uint8_t i = 0; i < BOOT_STAGE_COUNT; ++i) {
+    if (i) out += ",";
+    out += kStages[i].name;
+    out += ":";
+    if (s_cur.end_ms[i] == kNone) {
+      out += "-";
+    } else {
+      out += String((unsigned long)s_cur.start_ms[i]) + "+" + String((unsigned long)(s_cur.end_ms[i] - s_cur.start_ms[i]));
+    }
+  }
+  out += "\n";
+  if (!s_prev_valid) return;
+  // 이전 부팅: 주요 마일스톤 완료 시각과 끝나지 못한 단계만 요약
+  out += "boot_prev=no:" + String((unsigned long)s_prev.boot_no) + " reason:" + String((unsigned long)s_prev.reset_reason);
+  static const BootStage kKey[] = {BOOT_STAGE_WIFI_UP, BOOT_STAGE_MQTT_UP, BOOT_STAGE_FIRST_SCREEN, BOOT_STAGE_FIRST_DATA};
+  for (BootStage k : kKey) {
+    out += " ";
+    out += kStages[k].name;
+    out += ":";
+    out += s_prev.end_ms[k] == kNone ? String("-") : String((unsigned long)s_prev.end_ms[k]);
+  }
+  for (uint8_t i = 0; i < BOOT_STAGE_WIFI_UP; ++i) {
+    if (s_prev.start_ms[i] != kNone && s_prev.end_ms[i] == kNone) {
+      out += " stuck:";
+      out += kStages[i].name;
+    }
+  }
+  out += "\n";
+}
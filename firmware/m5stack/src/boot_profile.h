@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+// 부팅 단계 선언과 타임라인 기록.
+//
+// setup()을 의존 관계가 선언된 단계로 나누고 단계마다 시작/끝 시각(ms, 부팅 기준)을
+// RTC_NOINIT 메모리에 남긴다. 소프트 리셋(워치독, OTA) 뒤에도 이전 부팅의 기록이 살아 있어
+// 어느 단계에서 멈췄는지와 이전 부팅 소요를 함께 보고할 수 있다.
+//
+// 동기 단계(run)는 loop 태스크에서 순서대로 돌지만, WiFi 연결·SNTP·MQTT 연결은 시작만 하고
+// 드라이버/lwIP 태스크(코어 0)에서 진행된다. 그래서 WIFI_START를 LVGL/UI 구성보다 앞에 두면
+// 무선 연결이 폰트·화면 구성과 겹쳐 진행된다. 비동기 단계의 완료는 mark()로 남기고,
+// 시작 시각은 선행 단계 중 가장 늦게 끝난 시각으로 잡는다(실제로 기다린 시간만 보이게).
+
+enum BootStage : uint8_t {
+  BOOT_STAGE_HW = 0,       // M5.begin(디스플레이/터치/전원)
+  BOOT_STAGE_NVS,          // device_id, student_id
+  BOOT_STAGE_WIFI_START,   // 캐시 AP 접속/스캔 시작(비차단)
+  BOOT_STAGE_NTP_START,    // configTime(SNTP는 네트워크가 생기면 알아서 진행)
+  BOOT_STAGE_FS,           // LittleFS 마운트 + 커맨드 저널 복원
+  BOOT_STAGE_LVGL,         // lv_init, 드라이버, ui_port_init(설정 파일, 화면 골격)
+  BOOT_STAGE_HW_STREAM,    // homeworks 프레임 풀
+  BOOT_STAGE_SNAPSHOT,     // 부팅 캐시 화면
+  BOOT_STAGE_MQTT_SETUP,   // MQTT 설정 + 연결 시작
+  // 비동기 마일스톤(mark)
+  BOOT_STAGE_WIFI_UP,
+  BOOT_STAGE_TIME_SYNC,
+  BOOT_STAGE_MQTT_UP,
+  BOOT_STAGE_FIRST_SCREEN, // 쓸 수 있는 화면(부팅 캐시 또는 실데이터)
+  BOOT_STAGE_FIRST_DATA,   // 게이트웨이 실데이터 반영
+  BOOT_STAGE_COUNT
+};
+
+class BootProfile {
+ public:
+  typedef void (*StageFn)();
+
+  // setup 맨 앞(Serial 이후): 이전 부팅 기록을 보관하고 이번 기록을 시작한다.
+  void begin();
+  // 동기 단계 실행. 선행 단계가 안 끝났으면 경고를 남기고 그대로 실행한다.
+  void run(BootStage s, StageFn fn);
+  // 비동기 단계 완료(처음 한 번만 기록).
+  void mark(BootStage s);
+  bool done(BootStage s) const;
+
+  static const char* name(BootStage s);
+  // 진단 문자열에 이번/이전 부팅 타임라인을 덧붙인다.
+  void append_diag(String& out) const;
+};
@@ -0,0 +1,255 @@
+#include "boot_snapshot.h"
+
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <stddef.h>
+#include <string.h>
+#include "hw_sync.h"
+
+#ifndef CFG_BOOT_SNAP_QUIET_MS
+#define CFG_BOOT_SNAP_QUIET_MS 3000          // 마지막 반영 뒤 이만큼 조용하면 쓴다
+#endif
+#ifndef CFG_BOOT_SNAP_MIN_INTERVAL_MS
+#define CFG_BOOT_SNAP_MIN_INTERVAL_MS 10000  // 쓰기 사이 최소 간격(섹션 무관)
+#endif
+
+static const char* const kPaths[BOOT_SNAP_COUNT] = {"/snap_students.bin", "/snap_info.bin", "/snap_hw.bin"};
+static const char* kTmpPath = "/snap.tmp";
+static const uint32_t kMagic = 0x50414E53;  // "SNAP"
+static const uint16_t kFormat = 1;
+// 구조체 배치가 바뀐 펌웨어에서 옛 homeworks 섹션을 읽지 않도록 크기를 함께 적는다.
+static const uint32_t kLayout = (uint32_t)sizeof(HwGroupData) << 16 | (uint32_t)sizeof(HwChildEntry);
+static const size_t kGroupPrefix = offsetof(HwGroupData, children);
+
+struct __attribute__((packed)) SnapHeader {
+  uint32_t magic;
+  uint16_t format;
+  uint8_t kind;
+  uint8_t reserved;
+  uint32_t layout;
+  uint32_t len;
+  uint32_t sum;  // student_id + tag + 본문 FNV-1a
+  char student_id[BootSnapshot::kIdBytes];
+  char tag[BootSnapshot::kTagBytes];
+};
+
+static uint32_t fnv(uint32_t h, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static uint32_t section_sum(const char* student_id, const char* tag, const char* body, size_t len) {
+  uint32_t h = fnv(2166136261u, student_id, strlen(student_id));
+  h = fnv(h, "|", 1);
+  h = fnv(h, tag, strlen(tag));
+  h = fnv(h, "|", 1);
+  h = fnv(h, body, len);
+  return h ? h : 1;  // 0은 "모름"
+}
+
+static void copy_str(char* dst, size_t cap, const char* src) {
+  strncpy(dst, src ? src : "", cap - 1);
+  dst[cap - 1] = '\0';
+}
+
+BootSnapshot::BootSnapshot() : last_write_ms_(0) {
+  memset(pending_, 0, sizeof(pending_));
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+bool BootSnapshot::reserve(Pending& p, size_t len) {
+  if (len <= p.cap) return true;
+  void* n = heap_caps_realloc(p.buf, len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!n) n = heap_caps_realloc(p.buf, len, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!n) return false;
+  p.buf = (char*)n;
+  p.cap = len;
+  return true;
+}
+
+void BootSnapshot::stage(BootSnapKind kind, const char* data, size_t len) {
+  Pending& p = pending_[kind];
+  p.staged = false;
+  p.too_big = len == 0 || len > kMaxBytes;
+  if (p.too_big || !reserve(p, len)) return;
+  memcpy(p.buf, data, len);
+  p.len = len;
+  p.staged = true;
+}
+
+void BootSnapshot::commit(BootSnapKind kind, const char* student_id, const char* tag, uint32_t now_ms) {
+  Pending& p = pending_[kind];
+  if (!p.staged) return;
+  p.staged = false;
+  copy_str(p.student_id, sizeof(p.student_id), student_id);
+  copy_str(p.tag, sizeof(p.tag), tag);
+  p.dirty = true;
+  p.commit_ms = now_ms;
+}
+
+void BootSnapshot::commit_homeworks(const HwSyncFrame& frame, uint32_t now_ms) {
+  Pending& p = pending_[BOOT_SNAP_HOMEWORKS];
+  const uint8_t cnt = frame.group_cnt > HW_MAX_GROUPS ? HW_MAX_GROUPS : frame.group_cnt;
+  size_t len = 1;
+  for (uint8_t i = 0; i < cnt; ++i) {
+    const uint8_t cc = frame.groups[i].child_cnt > HW_MAX_CHILDREN ? HW_MAX_CHILDREN : frame.groups[i].child_cnt;
+    len += kGroupPrefix + 1 + cc * sizeof(HwChildEntry);
+  }
+  p.staged = false;
+  if (len > kMaxBytes || !reserve(p, len)) return;
+  char* w = p.buf;
+  *w++ = (char)cnt;
+  for (uint8_t i = 0; i < cnt; ++i) {
+    const HwGroupData& g = frame.groups[i];
+    const uint8_t cc = g.child_cnt > HW_MAX_CHILDREN ? HW_MAX_CHILDREN : g.child_cnt;
+    memcpy(w, &g, kGroupPrefix);
+    w += kGroupPrefix;
+    *w++ = (char)cc;
+    memcpy(w, g.children, cc * sizeof(HwChildEntry));
+    w += cc * sizeof(HwChildEntry);
+  }
+  p.len = len;
+  p.staged = true;
+  commit(BOOT_SNAP_HOMEWORKS, frame.meta.student_id, frame.meta.sync_fp, now_ms);
+}
+
+void BootSnapshot::clear(BootSnapKind kind) {
+  Pending& p = pending_[kind];
+  p.staged = false;
+  p.dirty = false;
+  p.disk_sum = 0;
+  if (LittleFS.begin(true) && LittleFS.exists(kPaths[kind])) {
+    LittleFS.remove(kPaths[kind]);
+    Serial.printf("[SNAP] cleared %s\n", kPaths[kind]);
+  }
+}
+
+bool BootSnapshot::write_section(BootSnapKind kind, Pending& p) {
+  if (!LittleFS.begin(true)) return false;
+  SnapHeader h;
+  memset(&h, 0, sizeof(h));
+  h.magic = kMagic;
+  h.format = kFormat;
+  h.kind = kind;
+  h.layout = kLayout;
+  h.len = p.len;
+  copy_str(h.student_id, sizeof(h.student_id), p.student_id);
+  copy_str(h.tag, sizeof(h.tag), p.tag);
+  h.sum = section_sum(h.student_id, h.tag, p.buf, p.len);
+  File f = LittleFS.open(kTmpPath, "w");
+  if (!f) return false;
+  const bool ok = f.write((const uint8_t*)&h, sizeof(h)) == sizeof(h) &&
+                  f.write((const uint8_t*)p.buf, p.len) == p.len;
+  f.close();
+  // 쓰는 도중 꺼져도 이전 파일이 남도록 임시 파일을 다 쓴 뒤에 바꾼다.
+  if (!ok) {
+    LittleFS.remove(kTmpPath);
+    return false;
+  }
+  LittleFS.remove(kPaths[kind]);
+  if (!LittleFS.rename(kTmpPath, kPaths[kind])) return false;
+  p.disk_sum = h.sum;
+  return true;
+}
+
+void BootSnapshot::service(uint32_t now_ms) {
+  if (last_write_ms_ != 0 && now_ms - last_write_ms_ < CFG_BOOT_SNAP_MIN_INTERVAL_MS) return;
+  for (uint8_t k = 0; k < BOOT_SNAP_COUNT; ++k) {
+    Pending& p = pending_[k];
+    if (!p.dirty || now_ms - p.commit_ms < CFG_BOOT_SNAP_QUIET_MS) continue;
+    p.dirty = false;
+    if (section_sum(p.student_id, p.tag, p.buf, p.len) == p.disk_sum) {
+      stats_.skipped_same++;
+      continue;
+    }
+    // 한 번에 한 섹션만 쓴다(loop 한 바퀴를 길게 잡지 않게).
+    const uint32_t t0 = micros();
+    if (write_section((BootSnapKind)k, p)) {
+      stats_.writes++;
+      stats_.last_write_us = micros() - t0;
+      Serial.printf("[SNAP] wrote %s bytes=%u us=%lu\n", kPaths[k], (unsigned)p.len, (unsigned long)stats_.last_write_us);
+    } else {
+      stats_.write_fail++;
+      Serial.printf("[SNAP] write failed %s\n", kPaths[k]);
+    }
+    last_write_ms_ = now_ms;
+    return;
+  }
+}
+
+char* BootSnapshot::load(BootSnapKind kind, const char* student_id, size_t* len_out) {
+  if (!LittleFS.begin(true)) return nullptr;
+  File f = LittleFS.open(kPaths[kind], "r");
+  if (!f) return nullptr;
+  SnapHeader h;
+  char* body = nullptr;
+  if (f.read((uint8_t*)&h, sizeof(h)) == sizeof(h) && h.magic == kMagic && h.format == kFormat &&
+      h.kind == kind && h.layout == kLayout && h.len > 0 && h.len <= kMaxBytes) {
+    h.student_id[sizeof(h.student_id) - 1] = '\0';
+    h.tag[sizeof(h.tag) - 1] = '\0';
+    if (!student_id || strcmp(student_id, h.student_id) == 0) {
+      body = (char*)heap_caps_malloc(h.len + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (!body) body = (char*)malloc(h.len + 1);
+    }
+  }
+  if (body) {
+    if (f.read((uint8_t*)body, h.len) != h.len || section_sum(h.student_id, h.tag, body, h.len) != h.sum) {
+      Serial.printf("[SNAP] %s corrupt -> ignored\n", kPaths[kind]);
+      free(body);
+      body = nullptr;
+    } else {
+      body[h.len] = '\0';
+      *len_out = h.len;
+      Pending& p = pending_[kind];
+      p.disk_sum = h.sum;
+      copy_str(p.student_id, sizeof(p.student_id), h.student_id);
+      copy_str(p.tag, sizeof(p.tag), h.tag);
+    }
+  }
+  f.close();
+  return body;
+}
+
+bool BootSnapshot::load_homeworks(const char* student_id, HwSyncFrame* frame) {
+  size_t len = 0;
+  char* body = load(BOOT_SNAP_HOMEWORKS, student_id, &len);
+  if (!body) return false;
+  memset(frame, 0, sizeof(*frame));
+  const char* r = body;
+  const char* end = body + len;
+  const uint8_t cnt = (uint8_t)*r++;
+  bool ok = cnt <= HW_MAX_GROUPS;
+  for (uint8_t i = 0; ok && i < cnt; ++i) {
+    HwGroupData& g = frame->groups[i];
+    if (end - r < (ptrdiff_t)(kGroupPrefix + 1)) {
+      ok = false;
+      break;
+    }
+    memcpy(&g, r, kGroupPrefix);
+    r += kGroupPrefix;
+    const uint8_t cc = (uint8_t)*r++;
+    if (cc > HW_MAX_CHILDREN || end - r < (ptrdiff_t)(cc * sizeof(HwChildEntry))) {
+      ok = false;
+      break;
+    }
+    memcpy(g.children, r, cc * sizeof(HwChildEntry));
+    r += cc * sizeof(HwChildEntry);
+    g.child_cnt = cc;
+    g.display_anchor_valid = false;  // 앵커는 반영 때 lv_tick 기준으로 다시 잡는다
+  }
+  if (ok) {
+    const Pending& p = pending_[BOOT_SNAP_HOMEWORKS];
+    frame->group_cnt = cnt;
+    frame->meta.present = true;
+    copy_str(frame->meta.student_id, sizeof(frame->meta.student_id), p.student_id);
+    copy_str(frame->meta.sync_fp, sizeof(frame->meta.sync_fp), p.tag);
+    copy_str(frame->meta.source, sizeof(frame->meta.source), "boot_snapshot");
+    frame->bytes = len;
+  }
+  free(body);
+  return ok;
+}
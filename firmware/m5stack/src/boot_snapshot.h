@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+
+// 부팅 화면 캐시(LittleFS, stale-while-revalidate).
+//
+// 재부팅 직후에는 WiFi → MQTT → list_today/list_homeworks 왕복이 끝날 때까지 부팅 상태 화면만 보였다.
+// 마지막으로 화면에 반영한 데이터를 섹션별 파일로 남겨 두고, setup()에서 곧바로 그려 "동기화 중" 표시를 단다.
+// 새 데이터가 오면 평소 경로로 반영된다(같은 sync_fp면 디코더가 unchanged로 건너뛴다).
+//  - STUDENTS / INFO: 파싱 전 원본 페이로드(JSON 또는 msgpack). ArduinoJson이 버퍼를 제자리에서
+//    고치므로 stage()로 먼저 복사해 두고, 반영에 성공하면 commit()한다.
+//  - HOMEWORKS: 스트리밍 디코더가 완성한 HwGroupData 배열. children은 실제 개수만 적는다.
+// 쓰기는 loop()의 service()가 마지막 변경 뒤 잠시 조용할 때 섹션 하나씩, 내용이 바뀐 경우에만 한다
+// (과제 탭마다 플래시를 쓰지 않게). 모든 메서드는 loop() 스레드 전용이다.
+
+struct HwSyncFrame;
+
+enum BootSnapKind : uint8_t {
+  BOOT_SNAP_STUDENTS = 0,  // students_today (바인딩 전 화면)
+  BOOT_SNAP_INFO,          // student_info
+  BOOT_SNAP_HOMEWORKS,     // 과제 그룹(s_groups와 같은 내용)
+  BOOT_SNAP_COUNT
+};
+
+struct BootSnapStats {
+  uint32_t writes;
+  uint32_t skipped_same;  // 디스크 내용과 같아 쓰지 않은 횟수
+  uint32_t write_fail;
+  uint32_t last_write_us;
+  uint32_t restore_ms;    // setup()에서 캐시를 읽고 그리는 데 걸린 시간(0: 복원 없음)
+  uint8_t restored_mask;  // 복원한 섹션 비트(1 << BootSnapKind)
+};
+
+class BootSnapshot {
+ public:
+  static const size_t kMaxBytes = 16 * 1024;
+  static const size_t kIdBytes = 48;
+  static const size_t kTagBytes = 65;  // homeworks sync_fp
+
+  BootSnapshot();
+
+  // 원본 페이로드를 복사해 둔다(파싱이 버퍼를 바꾸기 전). 너무 크면 이 섹션은 저장하지 않는다.
+  void stage(BootSnapKind kind, const char* data, size_t len);
+  // stage한 내용을 화면에 반영했다. student_id가 다르면 복원 때 쓰지 않는다.
+  void commit(BootSnapKind kind, const char* student_id, const char* tag, uint32_t now_ms);
+  // 화면에 반영한 homeworks 프레임을 직렬화해 stage + commit.
+  void commit_homeworks(const HwSyncFrame& frame, uint32_t now_ms);
+  // 바인딩 해제 등: 섹션 파일과 대기 중인 쓰기를 지운다.
+  void clear(BootSnapKind kind);
+
+  void service(uint32_t now_ms);
+
+  // setup: 섹션을 읽어 malloc 버퍼로 돌려준다(호출 측 free). student_id가 주어지면 일치해야 한다.
+  char* load(BootSnapKind kind, const char* student_id, size_t* len_out);
+  // setup: homeworks 섹션을 frame에 풀어 놓는다(meta.student_id/sync_fp 포함).
+  bool load_homeworks(const char* student_id, HwSyncFrame* frame);
+
+  void note_restored(uint8_t mask, uint32_t elapsed_ms) {
+    stats_.restored_mask = mask;
+    stats_.restore_ms = elapsed_ms;
+  }
+  const BootSnapStats& stats() const { return stats_; }
+
+ private:
+  struct Pending {
+    char* buf;
+    size_t len;
+    size_t cap;
+    bool staged;    // stage 이후 commit 전
+    bool dirty;     // commit됐고 아직 안 씀
+    bool too_big;
+    uint32_t commit_ms;
+    uint32_t disk_sum;  // 마지막으로 쓰거나 읽은 내용 체크섬(0: 모름)
+    char student_id[kIdBytes];
+    char tag[kTagBytes];
+  };
+
+  bool reserve(Pending& p, size_t len);
+  bool write_section(BootSnapKind kind, Pending& p);
+
+  Pending pending_[BOOT_SNAP_COUNT];
+  uint32_t last_write_ms_;
+  BootSnapStats stats_;
+};
@@ -1,9 +1,14 @@
 #include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x05, 0xf7, 0xbd, 0x04, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0x05, 0xbd, 0xf7, 0x04, 0x00, 0x00, 0x01,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -15,8 +20,8 @@ const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -26,9 +31,9 @@ const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b,
-  0x02, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x0e, 0xd3, 0x9c, 0x65, 0xd3, 0x9c, 0x5b, 0x6d, 0x6b, 0x07,
-  0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef,
+  0x02, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x0e, 0x9c, 0xd3, 0x65, 0x9c, 0xd3, 0x5b, 0x6b, 0x6d, 0x07,
+  0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -38,616 +43,616 @@ const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00,
-  0x00, 0xd3, 0x9c, 0x77, 0x14, 0xa5, 0xdd, 0x14, 0xa5, 0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xd9,
-  0xb2, 0x94, 0x41, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00,
+  0x00, 0x9c, 0xd3, 0x77, 0xa5, 0x14, 0xdd, 0xa5, 0x14, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xd9,
+  0x94, 0xb2, 0x41, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0xef, 0x7b, 0x02, 0xff, 0xff, 0x01,
-  0xff, 0xff, 0x01, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0x7b, 0xef, 0x02, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0x01, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xb2, 0x94,
-  0x79, 0x34, 0xa5, 0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfb, 0x14, 0xa5, 0xff,
-  0xf3, 0x9c, 0xe1, 0xd3, 0x9c, 0x23, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b,
-  0x02, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xef,
-  0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x94, 0xb2,
+  0x79, 0xa5, 0x34, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfb, 0xa5, 0x14, 0xff,
+  0x9c, 0xf3, 0xe1, 0x9c, 0xd3, 0x23, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef,
+  0x02, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x7b,
+  0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x01, 0xb2, 0x94, 0x35, 0xf3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xf8,
-  0x55, 0xad, 0xff, 0xd3, 0x9c, 0x4f, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x33, 0xf3, 0x9c, 0x48, 0xd3, 0x9c, 0x94, 0xd3, 0x9c, 0xc3,
-  0xd3, 0x9c, 0xc4, 0xb2, 0x94, 0x94, 0xd3, 0x9c, 0x48, 0xd3, 0x9c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x01, 0x94, 0xb2, 0x35, 0x9c, 0xf3,
+  0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xf8,
+  0xad, 0x55, 0xff, 0x9c, 0xd3, 0x4f, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x33, 0x9c, 0xf3, 0x48, 0x9c, 0xd3, 0x94, 0x9c, 0xd3, 0xc3,
+  0x9c, 0xd3, 0xc4, 0x94, 0xb2, 0x94, 0x9c, 0xd3, 0x48, 0x9c, 0xd3, 0x33, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x52, 0x03, 0xef, 0x7b, 0x02, 0xd3, 0x9c, 0x90, 0x14, 0xa5,
-  0xfe, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfc,
-  0x14, 0xa5, 0xfd, 0xd3, 0x9c, 0x78, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xf3, 0x9c,
-  0x2f, 0xf3, 0x9c, 0xa8, 0xd3, 0x9c, 0xff, 0x34, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xa8, 0xf3,
-  0x9c, 0x2f, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0x03, 0x7b, 0xef, 0x02, 0x9c, 0xd3, 0x90, 0xa5, 0x14,
+  0xfe, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfc,
+  0xa5, 0x14, 0xfd, 0x9c, 0xd3, 0x78, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c, 0xf3,
+  0x2f, 0x9c, 0xf3, 0xa8, 0x9c, 0xd3, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xa8, 0x9c,
+  0xf3, 0x2f, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x14, 0xa5, 0x0b, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfc,
-  0x14, 0xa5, 0xff, 0xd3, 0x9c, 0x96, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x81, 0xf3, 0x9c,
-  0xf8, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xfb,
-  0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xfe, 0x34, 0xa5, 0xff, 0xf3,
-  0x9c, 0xf8, 0xb2, 0x94, 0x81, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x0b, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3,
+  0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfc,
+  0xa5, 0x14, 0xff, 0x9c, 0xd3, 0x96, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x81, 0x9c, 0xf3,
+  0xf8, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xfb,
+  0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xfe, 0xa5, 0x34, 0xff, 0x9c,
+  0xf3, 0xf8, 0x94, 0xb2, 0x81, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x55, 0xad, 0x03, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x6d, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xfb, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xd3, 0xd3, 0x9c, 0xa7, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf9,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x86, 0x34, 0xa5, 0xff, 0xd3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfb, 0x14, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0x34, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfa, 0xd3,
-  0x9c, 0xff, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x86, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0xad, 0x55, 0x03, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0x6d, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
+  0xfb, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xd3, 0x9c, 0xd3, 0xa7, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf9,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x86, 0xa5, 0x34, 0xff, 0x9c, 0xd3,
+  0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfb, 0xa5, 0x14, 0xff, 0xa5, 0x34, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfa, 0x9c,
+  0xd3, 0xff, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x86, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0xba, 0x34, 0xa5, 0xff, 0xd3, 0x9c,
-  0xf8, 0x34, 0xa5, 0xfd, 0xd3, 0x9c, 0x8a, 0xd3, 0x9c, 0x7d, 0x55, 0xad, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x02, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x7e, 0x55, 0xad, 0xff, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c,
-  0xfd, 0xd3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xbc, 0xd3, 0x9c, 0x99, 0xd3, 0x9c, 0x78,
-  0xd3, 0x9c, 0x78, 0xd3, 0x9c, 0x99, 0xd3, 0x9c, 0xbc, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xff, 0xd3,
-  0x9c, 0xfd, 0xd3, 0x9c, 0xf9, 0x55, 0xad, 0xff, 0xb2, 0x94, 0x7d, 0x00, 0x00, 0x00, 0xef, 0x7b,
+  0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0xba, 0xa5, 0x34, 0xff, 0x9c, 0xd3,
+  0xf8, 0xa5, 0x34, 0xfd, 0x9c, 0xd3, 0x8a, 0x9c, 0xd3, 0x7d, 0xad, 0x55, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x02, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x7e, 0xad, 0x55, 0xff, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3,
+  0xfd, 0x9c, 0xd3, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xbc, 0x9c, 0xd3, 0x99, 0x9c, 0xd3, 0x78,
+  0x9c, 0xd3, 0x78, 0x9c, 0xd3, 0x99, 0x9c, 0xd3, 0xbc, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xff, 0x9c,
+  0xd3, 0xfd, 0x9c, 0xd3, 0xf9, 0xad, 0x55, 0xff, 0x94, 0xb2, 0x7d, 0x00, 0x00, 0x00, 0x7b, 0xef,
   0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
-  0xad, 0x03, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x31, 0xd3, 0x9c, 0xf0, 0xd3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xfc, 0x34, 0xa5, 0xff, 0x92, 0x94, 0x17, 0xd3, 0x9c, 0x86, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0x00,
-  0x00, 0x00, 0xb2, 0x94, 0x25, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xf6, 0xd3, 0x9c, 0x55, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xd3, 0x9c, 0x55, 0xd3, 0x9c, 0xf7, 0xd3,
-  0x9c, 0xff, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xf8, 0xb2, 0x94, 0x25, 0x00, 0x00,
-  0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad,
+  0x55, 0x03, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x31, 0x9c, 0xd3, 0xf0, 0x9c, 0xd3, 0xff, 0x9c, 0xd3,
+  0xfc, 0xa5, 0x34, 0xff, 0x94, 0x92, 0x17, 0x9c, 0xd3, 0x86, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x00,
+  0x00, 0x00, 0x94, 0xb2, 0x25, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3,
+  0xff, 0x9c, 0xd3, 0xf6, 0x9c, 0xd3, 0x55, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x9c, 0xd3, 0x55, 0x9c, 0xd3, 0xf7, 0x9c,
+  0xd3, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xf8, 0x94, 0xb2, 0x25, 0x00, 0x00,
+  0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x04, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x4e, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0xf3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xd1, 0xf7, 0xbd, 0x04, 0xb2, 0x94, 0x8d, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0xab, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c,
-  0xf5, 0xd3, 0x9c, 0x38, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xd3, 0x9c, 0x05, 0xef, 0x7b, 0x04,
-  0xef, 0x7b, 0x04, 0xd3, 0x9c, 0x05, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x39, 0xf3,
-  0x9c, 0xf5, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfa, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xaa, 0x00, 0x00,
-  0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x4e, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf8, 0x9c, 0xf3,
+  0xff, 0x9c, 0xd3, 0xd1, 0xbd, 0xf7, 0x04, 0x94, 0xb2, 0x8d, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0xab, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3,
+  0xf5, 0x9c, 0xd3, 0x38, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x9c, 0xd3, 0x05, 0x7b, 0xef, 0x04,
+  0x7b, 0xef, 0x04, 0x9c, 0xd3, 0x05, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x39, 0x9c,
+  0xf3, 0xf5, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfa, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xaa, 0x00, 0x00,
+  0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0x01, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x9e, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xf6, 0x55, 0xad,
-  0xff, 0xd3, 0x9c, 0x8c, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x96, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0xb2,
-  0x94, 0x2f, 0xf3, 0x9c, 0xf6, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x50, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0xb2,
-  0x94, 0x51, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0x14, 0xa5, 0xf5, 0xb2, 0x94,
-  0x2f, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x01, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0x9e, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xf6, 0xad, 0x55,
+  0xff, 0x9c, 0xd3, 0x8c, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x96, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x94,
+  0xb2, 0x2f, 0x9c, 0xf3, 0xf6, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x50, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x94,
+  0xb2, 0x51, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0xa5, 0x14, 0xf5, 0x94, 0xb2,
+  0x2f, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x55, 0xad, 0x03, 0xd3, 0x9c, 0xf1, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c,
-  0xfb, 0xd3, 0x9c, 0x61, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x93, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x48, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xbd, 0xb6, 0xb5,
-  0x07, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x9c, 0x05, 0xf3,
-  0x9c, 0x08, 0xd3, 0x9c, 0xbd, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x34, 0xa5, 0xff, 0xb2, 0x94,
-  0x47, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xad, 0x55, 0x03, 0x9c, 0xd3, 0xf1, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3,
+  0xfb, 0x9c, 0xd3, 0x61, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x93, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x48, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xbd, 0xb5, 0xb6,
+  0x07, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c, 0xd3, 0x05, 0x9c,
+  0xf3, 0x08, 0x9c, 0xd3, 0xbd, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x34, 0xff, 0x94, 0xb2,
+  0x47, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xb2, 0x94, 0x0c, 0xb2, 0x94, 0xef, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xb2, 0x94,
-  0xe0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x90, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x96, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x8a, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xf8, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x93, 0x00, 0x00,
-  0x00, 0xef, 0x7b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x06, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x93, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x14, 0xa5, 0xfe, 0xb2, 0x94,
-  0x88, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x94, 0xb2, 0x0c, 0x94, 0xb2, 0xef, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xff, 0x94, 0xb2,
+  0xe0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x90, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x96, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x8a, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xf8, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x93, 0x00, 0x00,
+  0x00, 0x7b, 0xef, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x06, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x93, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x14, 0xfe, 0x94, 0xb2,
+  0x88, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00,
-  0x00, 0x00, 0xb2, 0x94, 0x5f, 0xf3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfc, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x90, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xd3, 0x9c, 0x95, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0xba, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfb, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0x7c, 0x00, 0x00,
-  0x01, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00,
-  0x00, 0x01, 0xd3, 0x9c, 0x7d, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfb, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00,
+  0x00, 0x00, 0x94, 0xb2, 0x5f, 0x9c, 0xf3, 0xfe, 0x9c, 0xd3, 0xfc, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
+  0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x90, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x9c, 0xd3, 0x95, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0xba, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfb, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0x7c, 0x00, 0x00,
+  0x01, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00,
+  0x00, 0x01, 0x9c, 0xd3, 0x7d, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
   0xb8, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x9c, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x90, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7,
-  0x14, 0xa5, 0xff, 0xd3, 0x9c, 0x9d, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0xbb, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfb, 0x14, 0xa5, 0xff, 0xb2, 0x94, 0x7f, 0x00, 0x00,
-  0x01, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00,
-  0x00, 0x01, 0xd3, 0x9c, 0x7f, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfb, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x9c, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x90, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7,
+  0xa5, 0x14, 0xff, 0x9c, 0xd3, 0x9d, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0xbb, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfb, 0xa5, 0x14, 0xff, 0x94, 0xb2, 0x7f, 0x00, 0x00,
+  0x01, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00,
+  0x00, 0x01, 0x9c, 0xd3, 0x7f, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
   0xba, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x9b, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x8e, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf8,
-  0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xbd, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x8c, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xf8, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x95, 0x00, 0x00,
-  0x00, 0xef, 0x7b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x06, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x95, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x14, 0xa5, 0xfe, 0xd3, 0x9c,
-  0x89, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x9b, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x8e, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf8,
+  0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xbd, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x8c, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xf8, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x95, 0x00, 0x00,
+  0x00, 0x7b, 0xef, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x06, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x95, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x14, 0xfe, 0x9c, 0xd3,
+  0x89, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x9b, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x60, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfd,
-  0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xe6, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x47, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x14, 0xa5, 0xff, 0xb2, 0x94, 0xbc, 0xb6, 0xb5,
-  0x07, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd3, 0x9c, 0x05, 0xf3,
-  0x9c, 0x08, 0xd3, 0x9c, 0xbd, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x34, 0xa5, 0xff, 0xd3, 0x9c,
-  0x46, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x9b, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x60, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfd,
+  0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xe6, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x47, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x14, 0xff, 0x94, 0xb2, 0xbc, 0xb5, 0xb6,
+  0x07, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c, 0xd3, 0x05, 0x9c,
+  0xf3, 0x08, 0x9c, 0xd3, 0xbd, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x34, 0xff, 0x9c, 0xd3,
+  0x46, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x01, 0xff,
-  0xff, 0x01, 0xd3, 0x9c, 0xb3, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x14, 0xa5, 0xff, 0xb2, 0x94,
-  0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x92, 0x94, 0x1a, 0xd3, 0x9c, 0xee, 0xd3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0xb2, 0x94, 0xe8, 0xff, 0xff, 0x01, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xb2,
-  0x94, 0x2f, 0x14, 0xa5, 0xf6, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x50, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0xb2,
-  0x94, 0x51, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xf3, 0x9c, 0xf6, 0xb2, 0x94,
-  0x2f, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xb2,
-  0x94, 0x0c, 0xd3, 0x9c, 0xcc, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xf9, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x3c, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0xec, 0xf3, 0x9c, 0xff,
-  0xd3, 0x9c, 0xfc, 0x14, 0xa5, 0xfb, 0xb2, 0x94, 0x5e, 0x00, 0x00, 0x00, 0x92, 0x94, 0x07, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0xac, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c,
-  0xf5, 0xd3, 0x9c, 0x39, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xd3, 0x9c, 0x05, 0xef, 0x7b, 0x04,
-  0xef, 0x7b, 0x04, 0xd3, 0x9c, 0x05, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x39, 0xf3,
-  0x9c, 0xf5, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xac, 0x00, 0x00,
-  0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x92,
-  0x94, 0x13, 0xd3, 0x9c, 0xd5, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xf9, 0x14, 0xa5, 0xff, 0xb2, 0x94,
-  0x3b, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x01, 0xd3, 0x9c, 0xa2, 0x14, 0xa5, 0xff,
-  0xd3, 0x9c, 0xf8, 0x34, 0xa5, 0xff, 0xb2, 0x94, 0xa7, 0x55, 0xad, 0x03, 0x55, 0xad, 0x06, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x26, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xf7, 0xb2, 0x94, 0x56, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xb2, 0x94, 0x56, 0xd3, 0x9c, 0xf7, 0xd3,
-  0x9c, 0xff, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c, 0x26, 0x00, 0x00,
-  0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x12, 0xd3, 0x9c, 0xd4, 0xf3, 0x9c, 0xff, 0xb2, 0x94, 0xfa, 0x14, 0xa5, 0xff, 0xb2, 0x94,
-  0x3b, 0x00, 0x00, 0x00, 0x92, 0x94, 0x07, 0x00, 0x00, 0x00, 0xf3, 0x9c, 0x3e, 0x34, 0xa5, 0xff,
-  0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c, 0xf7, 0xb2, 0x94, 0x2a, 0xef, 0x7b, 0x02, 0xd3,
-  0x9c, 0x05, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x80, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c,
-  0xfd, 0xd3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xbd, 0xd3, 0x9c, 0x9a, 0xd3, 0x9c, 0x7a,
-  0xd3, 0x9c, 0x7a, 0xd3, 0x9c, 0x9a, 0xd3, 0x9c, 0xbd, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xff, 0xd3,
-  0x9c, 0xfd, 0xd3, 0x9c, 0xf9, 0x55, 0xad, 0xff, 0xb2, 0x94, 0x7e, 0x00, 0x00, 0x00, 0xef, 0x7b,
+  0xff, 0x01, 0x9c, 0xd3, 0xb3, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x14, 0xff, 0x94, 0xb2,
+  0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94, 0x92, 0x1a, 0x9c, 0xd3, 0xee, 0x9c, 0xd3, 0xff,
+  0x9c, 0xf3, 0xff, 0x94, 0xb2, 0xe8, 0xff, 0xff, 0x01, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x94,
+  0xb2, 0x2f, 0xa5, 0x14, 0xf6, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x50, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x94,
+  0xb2, 0x51, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c, 0xf3, 0xf6, 0x94, 0xb2,
+  0x2f, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x94,
+  0xb2, 0x0c, 0x9c, 0xd3, 0xcc, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xf9, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x3c, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0xec, 0x9c, 0xf3, 0xff,
+  0x9c, 0xd3, 0xfc, 0xa5, 0x14, 0xfb, 0x94, 0xb2, 0x5e, 0x00, 0x00, 0x00, 0x94, 0x92, 0x07, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0xac, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3,
+  0xf5, 0x9c, 0xd3, 0x39, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x9c, 0xd3, 0x05, 0x7b, 0xef, 0x04,
+  0x7b, 0xef, 0x04, 0x9c, 0xd3, 0x05, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x39, 0x9c,
+  0xf3, 0xf5, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xac, 0x00, 0x00,
+  0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x94,
+  0x92, 0x13, 0x9c, 0xd3, 0xd5, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xf9, 0xa5, 0x14, 0xff, 0x94, 0xb2,
+  0x3b, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x01, 0x9c, 0xd3, 0xa2, 0xa5, 0x14, 0xff,
+  0x9c, 0xd3, 0xf8, 0xa5, 0x34, 0xff, 0x94, 0xb2, 0xa7, 0xad, 0x55, 0x03, 0xad, 0x55, 0x06, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x26, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3,
+  0xff, 0x9c, 0xd3, 0xf7, 0x94, 0xb2, 0x56, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x94, 0xb2, 0x56, 0x9c, 0xd3, 0xf7, 0x9c,
+  0xd3, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3, 0x26, 0x00, 0x00,
+  0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x12, 0x9c, 0xd3, 0xd4, 0x9c, 0xf3, 0xff, 0x94, 0xb2, 0xfa, 0xa5, 0x14, 0xff, 0x94, 0xb2,
+  0x3b, 0x00, 0x00, 0x00, 0x94, 0x92, 0x07, 0x00, 0x00, 0x00, 0x9c, 0xf3, 0x3e, 0xa5, 0x34, 0xff,
+  0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3, 0xf7, 0x94, 0xb2, 0x2a, 0x7b, 0xef, 0x02, 0x9c,
+  0xd3, 0x05, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x80, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3,
+  0xfd, 0x9c, 0xd3, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xbd, 0x9c, 0xd3, 0x9a, 0x9c, 0xd3, 0x7a,
+  0x9c, 0xd3, 0x7a, 0x9c, 0xd3, 0x9a, 0x9c, 0xd3, 0xbd, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xff, 0x9c,
+  0xd3, 0xfd, 0x9c, 0xd3, 0xf9, 0xad, 0x55, 0xff, 0x94, 0xb2, 0x7e, 0x00, 0x00, 0x00, 0x7b, 0xef,
   0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x92,
-  0x94, 0x07, 0xd3, 0x9c, 0xc7, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf9, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x3c, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x04, 0xef, 0x7b, 0x02, 0x14, 0xa5, 0x0e, 0xd3, 0x9c, 0xcd,
-  0x14, 0xa5, 0xfc, 0xd3, 0x9c, 0xf9, 0x14, 0xa5, 0xff, 0xb2, 0x94, 0xb5, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x04, 0xf7, 0xbd, 0x04, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x85, 0x34, 0xa5, 0xff, 0xd3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfb, 0x14, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfa, 0xd3,
-  0x9c, 0xff, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x85, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x94,
+  0x92, 0x07, 0x9c, 0xd3, 0xc7, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf9, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x3c, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x04, 0x7b, 0xef, 0x02, 0xa5, 0x14, 0x0e, 0x9c, 0xd3, 0xcd,
+  0xa5, 0x14, 0xfc, 0x9c, 0xd3, 0xf9, 0xa5, 0x14, 0xff, 0x94, 0xb2, 0xb5, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x04, 0xbd, 0xf7, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x85, 0xa5, 0x34, 0xff, 0x9c, 0xd3,
+  0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfb, 0xa5, 0x14, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfa, 0x9c,
+  0xd3, 0xff, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x85, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0xab, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xb2, 0x94,
-  0x3d, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x5d,
-  0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfb, 0x14, 0xa5, 0xf9, 0xb2, 0x94, 0x5c, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x05, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x7d, 0xd3, 0x9c,
-  0xf7, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xfa,
-  0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xfe, 0x34, 0xa5, 0xff, 0xd3,
-  0x9c, 0xf6, 0xd3, 0x9c, 0x7c, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0xab, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x94, 0xb2,
+  0x3d, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x5d,
+  0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfb, 0xa5, 0x14, 0xf9, 0x94, 0xb2, 0x5c, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x05, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x7d, 0x9c, 0xd3,
+  0xf7, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xfa,
+  0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xfe, 0xa5, 0x34, 0xff, 0x9c,
+  0xd3, 0xf6, 0x9c, 0xd3, 0x7c, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x99, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x3a, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02,
-  0xd3, 0x9c, 0xc0, 0x14, 0xa5, 0xff, 0xb2, 0x94, 0xfc, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x4d, 0x00, 0x00, 0x00, 0x55, 0xad, 0x06, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xb2, 0x94,
-  0x29, 0xf3, 0x9c, 0xa3, 0xd3, 0x9c, 0xfe, 0x34, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfe, 0xf3, 0x9c, 0xa3, 0xd3,
-  0x9c, 0x28, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x99, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x3a, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02,
+  0x9c, 0xd3, 0xc0, 0xa5, 0x14, 0xff, 0x94, 0xb2, 0xfc, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x4d, 0x00, 0x00, 0x00, 0xad, 0x55, 0x06, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x94, 0xb2,
+  0x29, 0x9c, 0xf3, 0xa3, 0x9c, 0xd3, 0xfe, 0xa5, 0x34, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xf3, 0xa3, 0x9c,
+  0xd3, 0x28, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x9f, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xd3, 0x9c,
-  0x79, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x01,
-  0xd3, 0x9c, 0x2b, 0xf3, 0x9c, 0xfb, 0xf3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfb, 0xf3, 0x9c, 0xfd, 0xf3,
-  0x9c, 0xf7, 0xb2, 0x94, 0x54, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x30, 0xf3, 0x9c, 0x3e, 0xd3, 0x9c, 0x7d, 0xd3, 0x9c, 0xbb,
-  0xd3, 0x9c, 0xbb, 0xd3, 0x9c, 0x7d, 0xf3, 0x9c, 0x3e, 0xd3, 0x9c, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x9f, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x9c, 0xd3,
+  0x79, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x01,
+  0x9c, 0xd3, 0x2b, 0x9c, 0xf3, 0xfb, 0x9c, 0xf3, 0xfb, 0x9c, 0xd3, 0xfb, 0x9c, 0xf3, 0xfd, 0x9c,
+  0xf3, 0xf7, 0x94, 0xb2, 0x54, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x30, 0x9c, 0xf3, 0x3e, 0x9c, 0xd3, 0x7d, 0x9c, 0xd3, 0xbb,
+  0x9c, 0xd3, 0xbb, 0x9c, 0xd3, 0x7d, 0x9c, 0xf3, 0x3e, 0x9c, 0xd3, 0x30, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x04, 0x00,
-  0x00, 0x00, 0xb2, 0x94, 0x83, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xd2, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03,
-  0x00, 0x00, 0x00, 0xb2, 0x94, 0x69, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfe, 0xd3,
-  0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xb2, 0x94, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b,
-  0x04, 0xf3, 0x9c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x04, 0x00,
+  0x00, 0x00, 0x94, 0xb2, 0x83, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
+  0xd2, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03,
+  0x00, 0x00, 0x00, 0x94, 0xb2, 0x69, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfe, 0x9c,
+  0xd3, 0xff, 0x9c, 0xf3, 0xff, 0x94, 0xb2, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef,
+  0x04, 0x9c, 0xf3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0xff,
   0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00,
-  0x00, 0x00, 0x92, 0x94, 0x21, 0xd3, 0x9c, 0xf3, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xb2, 0x94,
+  0x00, 0x00, 0x94, 0x92, 0x21, 0x9c, 0xd3, 0xf3, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xff, 0x94, 0xb2,
   0xe2, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x72, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xd3,
-  0x9c, 0xfb, 0xd3, 0x9c, 0xfe, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xc0, 0xd3, 0x9c, 0x34, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02,
-  0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0xf7, 0xbd, 0x04, 0xf7, 0xbd, 0x04, 0x55, 0xad, 0x03, 0x55,
-  0xad, 0x03, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0x55, 0xad, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x72, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfa, 0x9c,
+  0xd3, 0xfb, 0x9c, 0xd3, 0xfe, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xc0, 0x9c, 0xd3, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02,
+  0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0xbd, 0xf7, 0x04, 0xbd, 0xf7, 0x04, 0xad, 0x55, 0x03, 0xad,
+  0x55, 0x03, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0xad, 0x55, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xef, 0x7b, 0x02, 0xd3, 0x9c, 0xf2, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfc, 0xf3, 0x9c,
-  0xf9, 0xb2, 0x94, 0x59, 0x00, 0x00, 0x01, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x71, 0x34, 0xa5, 0xff, 0xf3,
-  0x9c, 0xff, 0xb2, 0x94, 0xfc, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c,
-  0xa8, 0xd3, 0x9c, 0x71, 0xd3, 0x9c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7b, 0xef, 0x02, 0x9c, 0xd3, 0xf2, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xf3,
+  0xf9, 0x94, 0xb2, 0x59, 0x00, 0x00, 0x01, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x71, 0xa5, 0x34, 0xff, 0x9c,
+  0xf3, 0xff, 0x94, 0xb2, 0xfc, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3,
+  0xa8, 0x9c, 0xd3, 0x71, 0x9c, 0xd3, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xd3, 0x9c,
-  0x05, 0x55, 0xad, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x9c, 0xd3,
+  0x05, 0xad, 0x55, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0x01, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0xa1, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xf7, 0x34, 0xa5,
-  0xff, 0xd3, 0x9c, 0x8c, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x06, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x66, 0x14,
-  0xa5, 0xea, 0x14, 0xa5, 0xff, 0xb2, 0x94, 0xfe, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c, 0xfc, 0x34, 0xa5,
-  0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xe9, 0xd3, 0x9c, 0xe6, 0xd3, 0x9c, 0xd9, 0xd3, 0x9c, 0xc5,
-  0xd3, 0x9c, 0xbb, 0xd3, 0x9c, 0xb3, 0xd3, 0x9c, 0xa9, 0xb2, 0x94, 0x8e, 0xd3, 0x9c, 0x6b, 0xd3,
-  0x9c, 0x49, 0xb2, 0x94, 0x45, 0xf3, 0x9c, 0x45, 0xb2, 0x94, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x01,
+  0xff, 0x01, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0xa1, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xf7, 0xa5, 0x34,
+  0xff, 0x9c, 0xd3, 0x8c, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x06, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x66, 0xa5,
+  0x14, 0xea, 0xa5, 0x14, 0xff, 0x94, 0xb2, 0xfe, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3, 0xfc, 0xa5, 0x34,
+  0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xe9, 0x9c, 0xd3, 0xe6, 0x9c, 0xd3, 0xd9, 0x9c, 0xd3, 0xc5,
+  0x9c, 0xd3, 0xbb, 0x9c, 0xd3, 0xb3, 0x9c, 0xd3, 0xa9, 0x94, 0xb2, 0x8e, 0x9c, 0xd3, 0x6b, 0x9c,
+  0xd3, 0x49, 0x94, 0xb2, 0x45, 0x9c, 0xf3, 0x45, 0x94, 0xb2, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x01,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x04, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x4d, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf9, 0xf3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xe0, 0xd3, 0x9c, 0x14, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x28, 0xf3, 0x9c, 0xaf, 0xf3, 0x9c, 0xfe, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c,
-  0xf8, 0xd3, 0x9c, 0xfb, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x34,
-  0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xb7, 0xf3, 0x9c,
-  0xa5, 0xd3, 0x9c, 0x6f, 0xd7, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x4d, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf9, 0x9c, 0xf3,
+  0xff, 0x9c, 0xd3, 0xe0, 0x9c, 0xd3, 0x14, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x28, 0x9c, 0xf3, 0xaf, 0x9c, 0xf3, 0xfe, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3,
+  0xf8, 0x9c, 0xd3, 0xfb, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xb7, 0x9c, 0xf3,
+  0xa5, 0x9c, 0xd3, 0x6f, 0xbd, 0xd7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x02, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x24, 0xd3, 0x9c, 0xe2, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xfb, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0x3f, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x48, 0x14, 0xa5, 0xb1, 0xf3, 0x9c, 0xff, 0x14, 0xa5,
-  0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfb,
-  0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3,
-  0x9c, 0xf6, 0xd3, 0x9c, 0xf6, 0xd3, 0x9c, 0xf8, 0xd3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x34, 0xa5,
-  0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xf4, 0xd3, 0x9c, 0xbc, 0xb2, 0x94, 0x54, 0x55, 0xad, 0x03,
-  0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x02, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0x24, 0x9c, 0xd3, 0xe2, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
+  0xfb, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0x3f, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x48, 0xa5, 0x14, 0xb1, 0x9c, 0xf3, 0xff, 0xa5, 0x14,
+  0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfb,
+  0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c,
+  0xd3, 0xf6, 0x9c, 0xd3, 0xf6, 0x9c, 0xd3, 0xf8, 0x9c, 0xd3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x34,
+  0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xf4, 0x9c, 0xd3, 0xbc, 0x94, 0xb2, 0x54, 0xad, 0x55, 0x03,
+  0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0xae, 0x34, 0xa5, 0xff, 0xd3, 0x9c,
-  0xf8, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xb6, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x02, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x3e, 0xd3, 0x9c,
-  0x7a, 0xb2, 0x94, 0xe1, 0xd3, 0x9c, 0xe6, 0xd3, 0x9c, 0xf3, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34,
-  0xa5, 0xff, 0x34, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c,
-  0xf8, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xca,
-  0xd3, 0x9c, 0x42, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0xae, 0xa5, 0x34, 0xff, 0x9c, 0xd3,
+  0xf8, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xb6, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x02, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x3e, 0x9c, 0xd3,
+  0x7a, 0x94, 0xb2, 0xe1, 0x9c, 0xd3, 0xe6, 0x9c, 0xd3, 0xf3, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5,
+  0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3,
+  0xf8, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xca,
+  0x9c, 0xd3, 0x42, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0x02, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x49, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xfd, 0xf3, 0x9c, 0xfe, 0xd3, 0x9c, 0xe9, 0xb2, 0x94, 0x25, 0xff, 0xff, 0x01, 0xef, 0x7b, 0x02,
+  0x00, 0x00, 0xff, 0xff, 0x02, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0x49, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
+  0xfd, 0x9c, 0xf3, 0xfe, 0x9c, 0xd3, 0xe9, 0x94, 0xb2, 0x25, 0xff, 0xff, 0x01, 0x7b, 0xef, 0x02,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x29, 0xd3, 0x9c, 0x5f, 0xd3, 0x9c, 0x67,
-  0xd3, 0x9c, 0x70, 0xd3, 0x9c, 0x78, 0xd3, 0x9c, 0x85, 0xd3, 0x9c, 0x90, 0xd3, 0x9c, 0x90, 0xd3,
-  0x9c, 0x90, 0xd3, 0x9c, 0x90, 0xd3, 0x9c, 0xc3, 0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5,
-  0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xb2, 0x94, 0xfa, 0xd3, 0x9c, 0xfb, 0xf3, 0x9c, 0xff,
-  0x14, 0xa5, 0xff, 0xb2, 0x94, 0x88, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x29, 0x9c, 0xd3, 0x5f, 0x9c, 0xd3, 0x67,
+  0x9c, 0xd3, 0x70, 0x9c, 0xd3, 0x78, 0x9c, 0xd3, 0x85, 0x9c, 0xd3, 0x90, 0x9c, 0xd3, 0x90, 0x9c,
+  0xd3, 0x90, 0x9c, 0xd3, 0x90, 0x9c, 0xd3, 0xc3, 0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14,
+  0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xff, 0x94, 0xb2, 0xfa, 0x9c, 0xd3, 0xfb, 0x9c, 0xf3, 0xff,
+  0xa5, 0x14, 0xff, 0x94, 0xb2, 0x88, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x55, 0xad, 0x06, 0xd3, 0x9c, 0xea, 0xd3, 0x9c,
-  0xff, 0xd3, 0x9c, 0xf9, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x7a, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
+  0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xad, 0x55, 0x06, 0x9c, 0xd3, 0xea, 0x9c, 0xd3,
+  0xff, 0x9c, 0xd3, 0xf9, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x7a, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xef, 0x7b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x7b, 0xef,
   0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x08, 0xd3, 0x9c, 0x30, 0xf3, 0x9c, 0x32, 0xd3, 0x9c,
-  0x80, 0xf3, 0x9c, 0xd5, 0xd3, 0x9c, 0xfd, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfb,
-  0xd3, 0x9c, 0xfb, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x89, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x08, 0x9c, 0xd3, 0x30, 0x9c, 0xf3, 0x32, 0x9c, 0xd3,
+  0x80, 0x9c, 0xf3, 0xd5, 0x9c, 0xd3, 0xfd, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfb,
+  0x9c, 0xd3, 0xfb, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x89, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00,
   0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x79, 0x34, 0xa5,
-  0xff, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xe1, 0x92, 0x94, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0xff, 0xff, 0x01, 0x9c, 0xd3, 0x79, 0xa5, 0x34,
+  0xff, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xe1, 0x94, 0x92, 0x07, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0xef, 0x7b, 0x04,
-  0xef, 0x7b, 0x04, 0xf7, 0xbd, 0x04, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3,
-  0x9c, 0x05, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x4a, 0xf3, 0x9c, 0xb2, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xff,
-  0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfa, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x7f, 0x00, 0x00, 0x00, 0x55,
-  0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0x7b, 0xef, 0x04,
+  0x7b, 0xef, 0x04, 0xbd, 0xf7, 0x04, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c,
+  0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x4a, 0x9c, 0xf3, 0xb2, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xff,
+  0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfa, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x7f, 0x00, 0x00, 0x00, 0xad,
+  0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xff, 0xff, 0x01, 0xf3, 0x9c, 0x31, 0xd3, 0x9c,
-  0xef, 0xf3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfc, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0x5d, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0xff, 0xff, 0x01, 0x9c, 0xf3, 0x31, 0x9c, 0xd3,
+  0xef, 0x9c, 0xf3, 0xfe, 0x9c, 0xd3, 0xfc, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0x5d, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x03, 0xef, 0x7b,
-  0x02, 0x55, 0xad, 0x03, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xf3, 0x9c, 0x56, 0x14, 0xa5, 0xf7,
-  0xf3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xf2, 0xd3, 0x9c, 0x28, 0x00,
-  0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x03, 0x7b, 0xef,
+  0x02, 0xad, 0x55, 0x03, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x9c, 0xf3, 0x56, 0xa5, 0x14, 0xf7,
+  0x9c, 0xf3, 0xfe, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xf2, 0x9c, 0xd3, 0x28, 0x00,
+  0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0xb7, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xf8, 0x14, 0xa5, 0xfe, 0xd3, 0x9c, 0xc2, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0xb7, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xf8, 0xa5, 0x14, 0xfe, 0x9c, 0xd3, 0xc2, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xef, 0x7b, 0x02,
-  0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef,
-  0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0xef, 0x7b, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x42,
-  0xf3, 0x9c, 0xf8, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xf9, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0x81, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0x7b, 0xef, 0x02,
+  0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b,
+  0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x7b, 0xef, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x94, 0xb2, 0x42,
+  0x9c, 0xf3, 0xf8, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xf9, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0x81, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0xff, 0xff, 0x01, 0xd3, 0x9c,
-  0x48, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xb8, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0xff, 0xff, 0x01, 0x9c, 0xd3,
+  0x48, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xb8, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x05, 0x00, 0x00, 0x00,
-  0xb2, 0x94, 0x81, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xf9, 0xf3, 0x9c, 0xfe, 0xd3, 0x9c, 0xd6, 0xb2,
-  0x94, 0x11, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x05, 0x00, 0x00, 0x00,
+  0x94, 0xb2, 0x81, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xf9, 0x9c, 0xf3, 0xfe, 0x9c, 0xd3, 0xd6, 0x94,
+  0xb2, 0x11, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x39, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xef, 0x7b,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xad, 0x12, 0xb2, 0x94, 0x1b, 0xd3, 0x9c, 0x46,
-  0xd3, 0x9c, 0x4d, 0xd3, 0x9c, 0x4d, 0xd3, 0x9c, 0x4d, 0xd3, 0x9c, 0x4d, 0xd3, 0x9c, 0x4d, 0xd3,
-  0x9c, 0x4d, 0xd3, 0x9c, 0x4d, 0xd3, 0x9c, 0x4d, 0xd3, 0x9c, 0x4e, 0xb2, 0x94, 0x49, 0xb2, 0x94,
-  0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03,
-  0xf3, 0x9c, 0x28, 0xf3, 0x9c, 0xe7, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfc, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x23, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x39, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7b, 0xef,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x55, 0x12, 0x94, 0xb2, 0x1b, 0x9c, 0xd3, 0x46,
+  0x9c, 0xd3, 0x4d, 0x9c, 0xd3, 0x4d, 0x9c, 0xd3, 0x4d, 0x9c, 0xd3, 0x4d, 0x9c, 0xd3, 0x4d, 0x9c,
+  0xd3, 0x4d, 0x9c, 0xd3, 0x4d, 0x9c, 0xd3, 0x4d, 0x9c, 0xd3, 0x4e, 0x94, 0xb2, 0x49, 0x94, 0xb2,
+  0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03,
+  0x9c, 0xf3, 0x28, 0x9c, 0xf3, 0xe7, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfc, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x23, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xb2, 0x94,
-  0x3d, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x94, 0xb2,
+  0x3d, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xb2, 0x94, 0x50, 0xf3, 0x9c, 0xa9, 0xf3, 0x9c, 0xf9, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xff,
-  0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3,
-  0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xf5, 0xd3, 0x9c,
-  0x28, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
-  0x00, 0x00, 0x00, 0xb2, 0x94, 0xb9, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfe, 0xb2,
-  0x94, 0x20, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x55, 0xad, 0x06, 0xf3, 0x9c,
-  0xa3, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfc,
-  0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xd3,
-  0x9c, 0xfc, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfc, 0xd3, 0x9c, 0xef, 0xf3, 0x9c,
-  0x27, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
-  0x00, 0x00, 0x01, 0xd3, 0x9c, 0xba, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x30, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x92, 0x94, 0x0e, 0xd3, 0x9c, 0xc1, 0x34, 0xa5,
-  0xff, 0xd3, 0x9c, 0xfb, 0xb2, 0x94, 0xfa, 0xd3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14,
-  0xa5, 0xff, 0x14, 0xa5, 0xff, 0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c,
-  0x29, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
-  0x00, 0x00, 0x00, 0xd3, 0x9c, 0xba, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3d, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0x01, 0xef, 0x7b, 0x04, 0x92, 0x94, 0x07, 0xf3, 0x9c, 0xb1, 0x34, 0xa5, 0xff, 0xb2, 0x94,
-  0xfa, 0xd3, 0x9c, 0xfd, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xcd,
-  0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xcd, 0xd3,
-  0x9c, 0xcd, 0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xcc, 0xd3, 0x9c, 0xcd, 0xd3, 0x9c, 0xc2, 0xf3, 0x9c,
-  0x1f, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
-  0x00, 0x00, 0x00, 0xd3, 0x9c, 0xba, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa,
-  0x52, 0x03, 0x00, 0x00, 0x00, 0xd3, 0x9c, 0x87, 0x55, 0xad, 0xff, 0xd3, 0x9c, 0xf9, 0xd3, 0x9c,
-  0xfd, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xca, 0xd3, 0x9c, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
-  0x00, 0x00, 0x00, 0xd3, 0x9c, 0xba, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xba, 0x00, 0x00, 0x00,
-  0xef, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0xb2, 0x94, 0x16, 0xd3, 0x9c, 0xf3, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfc, 0x14, 0xa5,
-  0xff, 0xd3, 0x9c, 0xc3, 0x71, 0x8c, 0x10, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0x04, 0x55, 0xad, 0x03,
-  0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55,
-  0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x04,
-  0x00, 0x00, 0x00, 0xd3, 0x9c, 0xba, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xbb, 0xef, 0x7b, 0x04,
-  0xef, 0x7b, 0x08, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0x71, 0x8c, 0x09, 0xf7,
-  0xbd, 0x04, 0xd3, 0x9c, 0x89, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfb, 0xd3, 0x9c, 0xfe, 0xf3, 0x9c,
-  0xee, 0x92, 0x94, 0x23, 0xef, 0x7b, 0x02, 0x55, 0xad, 0x09, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04,
-  0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef,
-  0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b,
-  0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x04, 0xef, 0x7b, 0x08,
-  0xef, 0x7b, 0x04, 0xd3, 0x9c, 0xbb, 0x14, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfa, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xb5, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xd3, 0x9c, 0xa2, 0x34, 0xa5, 0xfe, 0xd3, 0x9c, 0xf7, 0x14, 0xa5, 0xff, 0xb2, 0x94,
+  0x00, 0x94, 0xb2, 0x50, 0x9c, 0xf3, 0xa9, 0x9c, 0xf3, 0xf9, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xff,
+  0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c,
+  0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xf5, 0x9c, 0xd3,
+  0x28, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
+  0x00, 0x00, 0x00, 0x94, 0xb2, 0xb9, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfe, 0x94,
+  0xb2, 0x20, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xad, 0x55, 0x06, 0x9c, 0xf3,
+  0xa3, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfc,
+  0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c,
+  0xd3, 0xfc, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfc, 0x9c, 0xd3, 0xef, 0x9c, 0xf3,
+  0x27, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
+  0x00, 0x00, 0x01, 0x9c, 0xd3, 0xba, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x30, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x94, 0x92, 0x0e, 0x9c, 0xd3, 0xc1, 0xa5, 0x34,
+  0xff, 0x9c, 0xd3, 0xfb, 0x94, 0xb2, 0xfa, 0x9c, 0xd3, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x14, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3,
+  0x29, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
+  0x00, 0x00, 0x00, 0x9c, 0xd3, 0xba, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3d, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0x01, 0x7b, 0xef, 0x04, 0x94, 0x92, 0x07, 0x9c, 0xf3, 0xb1, 0xa5, 0x34, 0xff, 0x94, 0xb2,
+  0xfa, 0x9c, 0xd3, 0xfd, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xcd,
+  0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xcd, 0x9c,
+  0xd3, 0xcd, 0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xcc, 0x9c, 0xd3, 0xcd, 0x9c, 0xd3, 0xc2, 0x9c, 0xf3,
+  0x1f, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
+  0x00, 0x00, 0x00, 0x9c, 0xd3, 0xba, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+  0xaa, 0x03, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0x87, 0xad, 0x55, 0xff, 0x9c, 0xd3, 0xf9, 0x9c, 0xd3,
+  0xfd, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xca, 0x9c, 0xd3, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
+  0x00, 0x00, 0x00, 0x9c, 0xd3, 0xba, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xba, 0x00, 0x00, 0x00,
+  0x7b, 0xef, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x94, 0xb2, 0x16, 0x9c, 0xd3, 0xf3, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfc, 0xa5, 0x14,
+  0xff, 0x9c, 0xd3, 0xc3, 0x8c, 0x71, 0x10, 0x00, 0x00, 0x00, 0xbd, 0xf7, 0x04, 0xad, 0x55, 0x03,
+  0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad,
+  0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x04,
+  0x00, 0x00, 0x00, 0x9c, 0xd3, 0xba, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xbb, 0x7b, 0xef, 0x04,
+  0x7b, 0xef, 0x08, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x8c, 0x71, 0x09, 0xbd,
+  0xf7, 0x04, 0x9c, 0xd3, 0x89, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfb, 0x9c, 0xd3, 0xfe, 0x9c, 0xf3,
+  0xee, 0x94, 0x92, 0x23, 0x7b, 0xef, 0x02, 0xad, 0x55, 0x09, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04,
+  0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b,
+  0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef,
+  0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x04, 0x7b, 0xef, 0x08,
+  0x7b, 0xef, 0x04, 0x9c, 0xd3, 0xbb, 0xa5, 0x14, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfa, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xb5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9c, 0xd3, 0xa2, 0xa5, 0x34, 0xfe, 0x9c, 0xd3, 0xf7, 0xa5, 0x14, 0xff, 0x94, 0xb2,
   0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xd3, 0x9c, 0xb5, 0x34, 0xa5, 0xff, 0xd3, 0x9c, 0xfa, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9c, 0xd3, 0xb5, 0xa5, 0x34, 0xff, 0x9c, 0xd3, 0xfa, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xec, 0xd3, 0x9c, 0xba,
-  0xd3, 0x9c, 0xbb, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3,
-  0x9c, 0xba, 0xd3, 0x9c, 0xec, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c, 0xff, 0xd3, 0x9c,
-  0xc4, 0xd3, 0x9c, 0xbc, 0xd3, 0x9c, 0xbb, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba,
-  0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3,
-  0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c,
-  0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xbb,
-  0xd3, 0x9c, 0xba, 0xd3, 0x9c, 0xec, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xec, 0x9c, 0xd3, 0xba,
+  0x9c, 0xd3, 0xbb, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c,
+  0xd3, 0xba, 0x9c, 0xd3, 0xec, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3, 0xff, 0x9c, 0xd3,
+  0xc4, 0x9c, 0xd3, 0xbc, 0x9c, 0xd3, 0xbb, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba,
+  0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c,
+  0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3,
+  0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xbb,
+  0x9c, 0xd3, 0xba, 0x9c, 0xd3, 0xec, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14,
-  0xa5, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0x14, 0xa5,
-  0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14,
-  0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5,
-  0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0xf3, 0x9c, 0xff, 0xd3, 0x9c, 0xff, 0xd3, 0x9c, 0xfe, 0xf3, 0x9c, 0xff, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xff, 0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x14, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xff, 0xa5, 0x14,
+  0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14,
+  0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xd3, 0xfe, 0x9c, 0xf3, 0xff, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3c, 0xf3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfa,
-  0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3,
-  0x9c, 0xfa, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c,
-  0xfb, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa,
-  0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3,
-  0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c,
-  0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfa,
-  0xd3, 0x9c, 0xfa, 0xd3, 0x9c, 0xfd, 0xd3, 0x9c, 0xfe, 0xd3, 0x9c, 0xfd, 0xf3, 0x9c, 0xfe, 0xd3,
-  0x9c, 0x3c, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3c, 0x9c, 0xf3, 0xfe, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfa,
+  0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c,
+  0xd3, 0xfa, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3,
+  0xfb, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa,
+  0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c,
+  0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3,
+  0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfa,
+  0x9c, 0xd3, 0xfa, 0x9c, 0xd3, 0xfd, 0x9c, 0xd3, 0xfe, 0x9c, 0xd3, 0xfd, 0x9c, 0xf3, 0xfe, 0x9c,
+  0xd3, 0x3c, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0xd3, 0x9c,
-  0x3e, 0x14, 0xa5, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3,
-  0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c,
-  0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3,
-  0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c,
-  0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff,
-  0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0xf3, 0x9c, 0xff, 0x14, 0xa5, 0xff, 0xd3,
-  0x9c, 0x3e, 0x00, 0x00, 0x00, 0xef, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x9c, 0xd3,
+  0x3e, 0xa5, 0x14, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c,
+  0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3,
+  0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c,
+  0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3,
+  0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff,
+  0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0x9c, 0xf3, 0xff, 0xa5, 0x14, 0xff, 0x9c,
+  0xd3, 0x3e, 0x00, 0x00, 0x00, 0x7b, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x94,
-  0x0c, 0xd3, 0x9c, 0x36, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35,
-  0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3,
-  0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c,
-  0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35,
-  0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3,
-  0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c,
-  0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35,
-  0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x35, 0xd3, 0x9c, 0x36, 0xb2,
-  0x94, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xb2,
+  0x0c, 0x9c, 0xd3, 0x36, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35,
+  0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c,
+  0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3,
+  0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35,
+  0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c,
+  0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3,
+  0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35,
+  0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x35, 0x9c, 0xd3, 0x36, 0x94,
+  0xb2, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -662,16 +667,16 @@ const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xef, 0x7b,
-  0x02, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03,
-  0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55,
-  0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad,
-  0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03,
-  0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55,
-  0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad,
-  0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03,
-  0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0x55, 0xad, 0x03, 0xef,
-  0x7b, 0x02, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0x7b, 0xef,
+  0x02, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03,
+  0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad,
+  0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55,
+  0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03,
+  0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad,
+  0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55,
+  0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03,
+  0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0xad, 0x55, 0x03, 0x7b,
+  0xef, 0x02, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -685,65 +690,65 @@ const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x78, 0xd3, 0x9c, 0x9f, 0xd3, 0x9c, 0x9b, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c,
-  0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d,
-  0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3,
-  0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c,
-  0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d,
-  0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3,
-  0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c,
-  0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d,
-  0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3,
-  0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9d, 0xd3, 0x9c, 0x9b, 0xd3, 0x9c, 0x9f, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x78, 0x9c, 0xd3, 0x9f, 0x9c, 0xd3, 0x9b, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3,
+  0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d,
+  0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c,
+  0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3,
+  0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d,
+  0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c,
+  0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3,
+  0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d,
+  0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c,
+  0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9d, 0x9c, 0xd3, 0x9b, 0x9c, 0xd3, 0x9f, 0x9c, 0xd3,
   0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0xce, 0x55, 0xad, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5,
-  0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14,
-  0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5,
-  0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14,
-  0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5,
-  0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff,
-  0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14,
-  0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x14, 0xa5, 0xff, 0x55, 0xad, 0xff, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0xce, 0xad, 0x55, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14,
+  0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14,
+  0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14,
+  0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff,
+  0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5,
+  0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xa5, 0x14, 0xff, 0xad, 0x55, 0xff, 0x9c, 0xd3,
   0xce, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0xbd, 0xf3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf5, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c,
-  0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7,
-  0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3,
-  0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c,
-  0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7,
-  0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3,
-  0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c,
-  0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7,
-  0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3,
-  0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf7, 0xd3, 0x9c, 0xf5, 0xf3, 0x9c, 0xf7, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0xbd, 0x9c, 0xf3, 0xf7, 0x9c, 0xd3, 0xf5, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3,
+  0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7,
+  0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c,
+  0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3,
+  0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7,
+  0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c,
+  0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3,
+  0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7,
+  0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c,
+  0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf7, 0x9c, 0xd3, 0xf5, 0x9c, 0xf3, 0xf7, 0x9c, 0xd3,
   0xbd, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0xd4, 0x75, 0xad, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5,
-  0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff,
-  0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34,
-  0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5,
-  0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff,
-  0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34,
-  0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5,
-  0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff,
-  0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34,
-  0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x34, 0xa5, 0xff, 0x75, 0xad, 0xff, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0xd4, 0xad, 0x75, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34,
+  0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff,
+  0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5,
+  0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34,
+  0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff,
+  0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5,
+  0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34,
+  0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff,
+  0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5,
+  0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xa5, 0x34, 0xff, 0xad, 0x75, 0xff, 0x9c, 0xd3,
   0xd4, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3,
-  0x9c, 0x55, 0xf3, 0x9c, 0x6f, 0xb2, 0x94, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c,
-  0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f,
-  0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3,
-  0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c,
-  0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f,
-  0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3,
-  0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c,
-  0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f,
-  0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3,
-  0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xd3, 0x9c, 0x6f, 0xb2, 0x94, 0x6f, 0xf3, 0x9c, 0x6f, 0xd3, 0x9c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c,
+  0xd3, 0x55, 0x9c, 0xf3, 0x6f, 0x94, 0xb2, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3,
+  0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f,
+  0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c,
+  0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3,
+  0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f,
+  0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c,
+  0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3,
+  0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f,
+  0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c,
+  0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x9c, 0xd3, 0x6f, 0x94, 0xb2, 0x6f, 0x9c, 0xf3, 0x6f, 0x9c, 0xd3,
   0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -757,17 +762,17 @@ const uint8_t bottom_sheet_question_64_map[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
-  0x7b, 0x04, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c,
-  0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05,
-  0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3,
-  0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c,
-  0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05,
-  0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3,
-  0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c,
-  0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05,
-  0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3,
-  0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xd3, 0x9c, 0x05, 0xef, 0x7b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b,
+  0xef, 0x04, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3,
+  0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05,
+  0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c,
+  0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3,
+  0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05,
+  0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c,
+  0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3,
+  0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05,
+  0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c,
+  0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x9c, 0xd3, 0x05, 0x7b, 0xef,
   0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
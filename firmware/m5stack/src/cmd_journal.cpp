@@ -0,0 +1,367 @@
+#include "cmd_journal.h"
+
+#include <LittleFS.h>
+#include <esp_system.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef CFG_CMD_JOURNAL_REPLAY_MS
+#define CFG_CMD_JOURNAL_REPLAY_MS 200        // 재전송 간격(초당 5건)
+#endif
+#ifndef CFG_CMD_JOURNAL_ACK_TIMEOUT_MS
+#define CFG_CMD_JOURNAL_ACK_TIMEOUT_MS 30000 // 같은 세션에서 ack가 이만큼 없으면 다시 보낸다
+#endif
+// 이보다 오래된 탭은 다시 보내지 않는다. 게이트웨이의 중복 제거 기억(IDEMP_TTL_MS, 10분)보다 짧아야
+// 재전송이 같은 키로 걸러진다. 그보다 늦게 가면 시작/정지/완료가 한 번 더 실행된다.
+#ifndef CFG_CMD_JOURNAL_MAX_AGE_S
+#define CFG_CMD_JOURNAL_MAX_AGE_S (8 * 60)
+#endif
+
+static const char* kPath = "/cmd_journal.bin";
+static const char* kTmpPath = "/cmd_journal.tmp";
+static const uint32_t kCompactIdleBytes = 2 * 1024;   // 대기 0건이면 이 크기부터 비운다
+static const uint32_t kCompactBusyBytes = 16 * 1024;  // 대기가 있어도 이 크기면 다시 쓴다
+
+enum : uint8_t {
+  REC_SEQ = 1,  // op = 다음 op, wall_s = 저널 epoch
+  REC_CMD = 2,  // 본문 = 토픽 + 페이로드
+  REC_ACK = 3,  // 본문 없음
+};
+
+struct __attribute__((packed)) RecHeader {
+  uint8_t magic;
+  uint8_t type;
+  uint16_t topic_len;
+  uint16_t payload_len;
+  uint16_t reserved;
+  uint32_t op;
+  uint32_t wall_s;
+  uint32_t sum;  // 헤더(sum=0) + 본문 FNV-1a. 전원 차단으로 잘린 끝 레코드를 가린다.
+};
+
+static const uint8_t kMagic = 0xC7;
+// 재부팅 전에 기록된 항목: 어떤 세션 번호와도 달라 첫 연결에서 재전송(재생)으로 센다.
+static const uint32_t kRestored = 0xFFFFFFFFu;
+
+static uint32_t fnv(uint32_t h, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static uint32_t record_sum(RecHeader h, const char* topic, const char* payload) {
+  h.sum = 0;
+  uint32_t s = fnv(2166136261u, &h, sizeof(h));
+  s = fnv(s, topic, h.topic_len);
+  return fnv(s, payload, h.payload_len);
+}
+
+static uint32_t wall_now() {
+  time_t now = time(nullptr);
+  return now < 1700000000 ? 0 : (uint32_t)now;  // main.cpp와 같은 미동기화 기준
+}
+
+static bool put_record(File& f, uint8_t type, uint32_t op, uint32_t wall_s, const char* topic, const char* payload) {
+  RecHeader h;
+  h.magic = kMagic;
+  h.type = type;
+  h.topic_len = (uint16_t)(topic ? strlen(topic) : 0);
+  h.payload_len = (uint16_t)(payload ? strlen(payload) : 0);
+  h.reserved = 0;
+  h.op = op;
+  h.wall_s = wall_s;
+  h.sum = record_sum(h, topic, payload);
+  if (f.write((const uint8_t*)&h, sizeof(h)) != sizeof(h)) return false;
+  if (h.topic_len && f.write((const uint8_t*)topic, h.topic_len) != h.topic_len) return false;
+  if (h.payload_len && f.write((const uint8_t*)payload, h.payload_len) != h.payload_len) return false;
+  return true;
+}
+
+// 헤더와 본문을 읽어 체크섬까지 맞는지 본다. topic/payload는 kTopicBytes/kPayloadBytes 버퍼.
+static bool get_record(File& f, RecHeader& h, char* topic, char* payload) {
+  if (f.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) return false;
+  if (h.magic != kMagic || h.type < REC_SEQ || h.type > REC_ACK) return false;
+  if (h.topic_len >= CmdJournal::kTopicBytes || h.payload_len >= CmdJournal::kPayloadBytes) return false;
+  if (h.topic_len && f.read((uint8_t*)topic, h.topic_len) != h.topic_len) return false;
+  if (h.payload_len && f.read((uint8_t*)payload, h.payload_len) != h.payload_len) return false;
+  topic[h.topic_len] = '\0';
+  payload[h.payload_len] = '\0';
+  return record_sum(h, topic, payload) == h.sum;
+}
+
+// 재부팅 복원/압축/재전송이 모두 loop()에서 돌므로 본문 버퍼 하나를 같이 쓴다.
+static char s_topic[CmdJournal::kTopicBytes];
+static char s_payload[CmdJournal::kPayloadBytes];
+
+CmdJournal::CmdJournal()
+    : ready_(false), epoch_(0), next_op_(1), count_(0), next_send_ms_(0) {
+  epoch_hex_[0] = '\0';
+  memset(entries_, 0, sizeof(entries_));
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+bool CmdJournal::begin() {
+  // LittleFS는 한 번 마운트하면 내리지 않는다(폰트 fallback 태스크·스냅샷이 같이 쓴다). begin은 이미 마운트면 바로 true.
+  if (!LittleFS.begin(true)) {
+    Serial.println("[CMDJ] LittleFS mount failed -> journal off");
+    return false;
+  }
+  ready_ = load();
+  Serial.printf("[CMDJ] ready=%d epoch=%s next_op=%lu pending=%u bytes=%lu corrupt_tail=%lu\n",
+                ready_ ? 1 : 0,
+                epoch_hex_,
+                (unsigned long)next_op_,
+                (unsigned)count_,
+                (unsigned long)stats_.file_bytes,
+                (unsigned long)stats_.corrupt_tail);
+  return ready_;
+}
+
+bool CmdJournal::load() {
+  if (!LittleFS.exists(kPath) && LittleFS.exists(kTmpPath)) {
+    LittleFS.rename(kTmpPath, kPath);  // 압축 도중 꺼진 경우
+  }
+  count_ = 0;
+  epoch_ = 0;
+  bool rewrite = false;
+  File f = LittleFS.open(kPath, "r");
+  if (f) {
+    const uint32_t size = (uint32_t)f.size();
+    uint32_t pos = 0;
+    while (pos < size) {
+      RecHeader h;
+      if (!get_record(f, h, s_topic, s_payload)) {
+        stats_.corrupt_tail++;
+        rewrite = true;
+        break;
+      }
+      if (h.type == REC_SEQ) {
+        if (epoch_ == 0) epoch_ = h.wall_s;
+        if (h.op > next_op_) next_op_ = h.op;
+      } else if (h.type == REC_CMD) {
+        if (h.op >= next_op_) next_op_ = h.op + 1;
+        if (h.wall_s == 0) {
+          // 시간 동기화 전에 기록되어 나이를 알 수 없다. 재전송하면 게이트웨이가 이미 잊었을 수 있다.
+          stats_.expired++;
+          rewrite = true;
+        } else if (find(h.op) < 0) {
+          if (count_ == kMaxPending) {
+            remove_at(0, false);
+            stats_.dropped_full++;
+            rewrite = true;
+          }
+          Entry& e = entries_[count_++];
+          e.op = h.op;
+          e.offset = pos;
+          e.wall_s = h.wall_s;
+          e.rec_ms = 0;
+          e.sent_ms = 0;
+          e.sent_session = kRestored;
+        }
+      } else {
+        int i = find(h.op);
+        if (i >= 0) remove_at((uint8_t)i, false);
+      }
+      pos += sizeof(h) + h.topic_len + h.payload_len;
+    }
+    stats_.file_bytes = pos;
+    f.close();
+  }
+  if (epoch_ == 0) {
+    // 새 저널: 키가 다른 기기/이전 저널과 겹치지 않게 epoch를 새로 뽑는다.
+    do { epoch_ = esp_random(); } while (epoch_ == 0);
+    count_ = 0;
+    rewrite = true;
+  }
+  snprintf(epoch_hex_, sizeof(epoch_hex_), "%08lx", (unsigned long)epoch_);
+  return rewrite ? compact() : true;
+}
+
+int CmdJournal::find(uint32_t op) const {
+  for (uint8_t i = 0; i < count_; ++i) {
+    if (entries_[i].op == op) return i;
+  }
+  return -1;
+}
+
+uint32_t CmdJournal::reserve(char* key) {
+  if (!ready_) {
+    // 저널이 없으면 예전처럼 무작위 키로 바로 발행한다.
+    snprintf(key, kKeyBytes, "%lx", (unsigned long)esp_random());
+    return 0;
+  }
+  const uint32_t op = next_op_++;
+  snprintf(key, kKeyBytes, "%s%08lx", epoch_hex_, (unsigned long)op);
+  return op;
+}
+
+bool CmdJournal::write_record(uint8_t type, uint32_t op, uint32_t wall_s, const char* topic, const char* payload,
+                              uint32_t* offset_out) {
+  if (!LittleFS.begin(true)) return false;
+  File f = LittleFS.open(kPath, "a");
+  if (!f) return false;
+  const uint32_t offset = (uint32_t)f.size();
+  const bool ok = put_record(f, type, op, wall_s, topic, payload);
+  stats_.file_bytes = (uint32_t)f.size();
+  f.close();
+  if (ok && offset_out) *offset_out = offset;
+  return ok;
+}
+
+bool CmdJournal::append(uint32_t op, const char* topic, const char* payload) {
+  if (!ready_ || op == 0 || !topic || !payload) return false;
+  if (strlen(topic) >= kTopicBytes || strlen(payload) >= kPayloadBytes) return false;
+  if (count_ == kMaxPending) {
+    Serial.printf("[CMDJ] full -> drop oldest op=%lu\n", (unsigned long)entries_[0].op);
+    remove_at(0, true);
+    stats_.dropped_full++;
+  }
+  const uint32_t wall = wall_now();
+  uint32_t offset = 0;
+  if (!write_record(REC_CMD, op, wall, topic, payload, &offset)) {
+    Serial.printf("[CMDJ] append failed op=%lu\n", (unsigned long)op);
+    return false;
+  }
+  Entry& e = entries_[count_++];
+  e.op = op;
+  e.offset = offset;
+  e.wall_s = wall;
+  e.rec_ms = millis();
+  e.sent_ms = 0;
+  e.sent_session = 0;
+  stats_.appended++;
+  return true;
+}
+
+bool CmdJournal::read_command(const Entry& e, char* topic, char* payload) {
+  if (!LittleFS.begin(true)) return false;
+  File f = LittleFS.open(kPath, "r");
+  if (!f) return false;
+  RecHeader h;
+  const bool ok = f.seek(e.offset) && get_record(f, h, topic, payload) && h.type == REC_CMD && h.op == e.op;
+  f.close();
+  return ok;
+}
+
+void CmdJournal::remove_at(uint8_t i, bool write_ack) {
+  if (i >= count_) return;
+  if (write_ack) write_record(REC_ACK, entries_[i].op, 0, nullptr, nullptr, nullptr);
+  memmove(&entries_[i], &entries_[i + 1], (size_t)(count_ - i - 1) * sizeof(Entry));
+  count_--;
+}
+
+// SEQ 한 줄 + 남은 CMD만 새 파일에 옮겨 쓰고 바꿔 끼운다.
+// 새 위치는 따로 모았다가 파일을 바꿔 끼운 뒤에만 entries_에 옮긴다. 쓰다 실패하면 옛 파일과
+// entries_가 그대로 맞고, 바꿔 끼우다 실패하면 어느 파일도 entries_와 맞지 않으므로 저널을 끈다
+// (다음 부팅의 load()가 임시 파일을 이어받는다).
+bool CmdJournal::compact() {
+  if (!LittleFS.begin(true)) return false;
+  File out = LittleFS.open(kTmpPath, "w");
+  if (!out) return false;
+  static Entry s_kept[kMaxPending];
+  bool ok = put_record(out, REC_SEQ, next_op_, epoch_, nullptr, nullptr);
+  uint8_t kept = 0;
+  for (uint8_t i = 0; ok && i < count_; ++i) {
+    Entry e = entries_[i];
+    if (!read_command(e, s_topic, s_payload)) continue;  // 읽을 수 없는 항목은 버린다
+    e.offset = (uint32_t)out.size();
+    ok = put_record(out, REC_CMD, e.op, e.wall_s, s_topic, s_payload);
+    s_kept[kept++] = e;
+  }
+  const uint32_t bytes = (uint32_t)out.size();
+  out.close();
+  if (!ok) {
+    LittleFS.remove(kTmpPath);
+    return false;
+  }
+  LittleFS.remove(kPath);
+  if (!LittleFS.rename(kTmpPath, kPath)) {
+    Serial.println("[CMDJ] compact rename failed -> journal off until reboot");
+    count_ = 0;
+    ready_ = false;
+    return false;
+  }
+  memcpy(entries_, s_kept, (size_t)kept * sizeof(Entry));
+  count_ = kept;
+  stats_.file_bytes = bytes;
+  stats_.compactions++;
+  return true;
+}
+
+// 재전송해도 게이트웨이가 같은 키로 걸러 줄 만큼 최근인지. 모르면 아니다.
+bool CmdJournal::expired(const Entry& e, uint32_t now_ms, uint32_t wall) const {
+  const uint32_t max_ms = (uint32_t)CFG_CMD_JOURNAL_MAX_AGE_S * 1000u;
+  if (e.sent_session != kRestored) return now_ms - e.rec_ms > max_ms;  // 이번 부팅 기록: 단조 시계로 잰다
+  if (wall) return e.wall_s == 0 || (wall > e.wall_s && wall - e.wall_s > CFG_CMD_JOURNAL_MAX_AGE_S);
+  // 시간 미동기화: 부팅 전에 기록됐으니 나이는 가동 시간보다 길다.
+  return now_ms > max_ms;
+}
+
+void CmdJournal::on_ack(const char* key) {
+  if (!key || epoch_hex_[0] == '\0' || strlen(key) != kKeyBytes - 1) return;
+  if (memcmp(key, epoch_hex_, 8) != 0) return;  // 다른 기기(또는 이전 저널)의 ack
+  const uint32_t op = (uint32_t)strtoul(key + 8, nullptr, 16);
+  if (op != 0) acks_.push(op);  // 링이 차면 버린다: 재전송하면 게이트웨이가 ack를 다시 보낸다
+}
+
+void CmdJournal::service(uint32_t now_ms, bool connected, CmdJournalPublishFn publish) {
+  if (!ready_) return;
+
+  bool changed = false;
+  uint32_t op = 0;
+  while (acks_.pop(op)) {
+    const int i = find(op);
+    if (i < 0) continue;
+    remove_at((uint8_t)i, true);
+    stats_.acked++;
+    changed = true;
+  }
+
+  const uint32_t wall = wall_now();
+  for (uint8_t i = 0; i < count_;) {
+    const Entry& e = entries_[i];
+    if (expired(e, now_ms, wall)) {
+      Serial.printf("[CMDJ] expire op=%lu wall_s=%lu synced=%d\n", (unsigned long)e.op, (unsigned long)e.wall_s,
+                    wall ? 1 : 0);
+      remove_at(i, true);
+      stats_.expired++;
+      changed = true;
+    } else {
+      ++i;
+    }
+  }
+
+  if (changed && ((count_ == 0 && stats_.file_bytes > kCompactIdleBytes) || stats_.file_bytes > kCompactBusyBytes)) {
+    compact();
+  }
+
+  if (!connected || count_ == 0 || !publish) return;
+  if ((int32_t)(now_ms - next_send_ms_) < 0) return;
+
+  const uint32_t session = session_.load(std::memory_order_acquire);
+  for (uint8_t i = 0; i < count_; ++i) {
+    Entry& e = entries_[i];
+    // 부팅 전 항목은 시계가 맞아 나이를 확인할 수 있을 때까지 보내지 않는다.
+    if (e.sent_session == kRestored && !wall) continue;
+    const bool due = e.sent_session != session || (now_ms - e.sent_ms) >= CFG_CMD_JOURNAL_ACK_TIMEOUT_MS;
+    if (!due) continue;
+    next_send_ms_ = now_ms + CFG_CMD_JOURNAL_REPLAY_MS;
+    if (!read_command(e, s_topic, s_payload)) {
+      Serial.printf("[CMDJ] unreadable op=%lu -> drop\n", (unsigned long)e.op);
+      remove_at(i, true);
+      return;
+    }
+    if (publish(s_topic, s_payload) == 0) return;  // 연결이 막 끊겼다: 다음 세션에서 다시
+    if (e.sent_session != 0) {
+      stats_.replayed++;
+      Serial.printf("[CMDJ] replay op=%lu pending=%u\n", (unsigned long)e.op, (unsigned)count_);
+    }
+    e.sent_session = session;
+    e.sent_ms = now_ms;
+    stats_.sent++;
+    return;  // 한 번에 하나
+  }
+}
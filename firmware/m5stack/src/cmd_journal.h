@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "mqtt_rx_queue.h"
+
+// 오프라인 커맨드 저널(LittleFS /cmd_journal.bin, 추가 전용).
+//
+// WiFi가 끊긴 동안 누른 시작/정지/완료는 mqtt.publish가 0을 돌려주며 사라졌고,
+// AsyncMqttClient의 QoS1 재전송도 같은 세션 안에서만 유효했다.
+// 여기서는 과제 커맨드를 먼저 파일에 적고(op id 단조 증가), 게이트웨이 ack
+// (academies/{a}/ack/{idempotency_key})가 오면 ACK 레코드를 덧붙여 지운 것으로 친다.
+//  - idempotency_key = 저널 epoch(8 hex) + op id(8 hex). 같은 op는 재부팅 후 재전송해도 같은 키라
+//    게이트웨이가 중복을 걸러내고 이전 ack를 다시 보낸다.
+//  - onMqttConnect는 세션 번호만 올리고(start_replay), 실제 재전송은 loop()의 service()가
+//    CFG_CMD_JOURNAL_REPLAY_MS 간격으로 하나씩, op 순서대로 보낸다(복귀 직후 게이트웨이 폭주 방지).
+//  - 끝이 잘린 레코드(전원 차단)는 체크섬으로 걸러 그 앞까지만 살린다.
+//  - 게이트웨이는 키를 10분만 기억한다. 그보다 오래됐거나 나이를 알 수 없는(시간 미동기화 때 기록한
+//    부팅 전) 커맨드는 다시 보내지 않고 버린다(CFG_CMD_JOURNAL_MAX_AGE_S).
+// 파일은 loop() 스레드에서만 만진다. async-tcp 쪽(on_ack)은 op 번호만 링에 넣는다.
+
+typedef uint16_t (*CmdJournalPublishFn)(const char* topic, const char* payload);
+
+struct CmdJournalStats {
+  uint32_t appended;     // 기록한 커맨드 수
+  uint32_t sent;         // 보낸 횟수(재전송 포함)
+  uint32_t replayed;     // 그중 재연결/타임아웃 재전송
+  uint32_t acked;        // ack로 지운 커맨드 수
+  uint32_t dropped_full; // 대기열이 차서 버린 가장 오래된 커맨드 수
+  uint32_t expired;      // 너무 오래됐거나 나이를 알 수 없어 버린 커맨드 수
+  uint32_t corrupt_tail; // 부팅 시 잘려 있던 끝 레코드 수
+  uint32_t compactions;
+  uint32_t file_bytes;
+};
+
+class CmdJournal {
+ public:
+  static const uint8_t kMaxPending = 32;
+  static const size_t kKeyBytes = 17;  // 16 hex + 널
+  static const size_t kTopicBytes = 160;
+  static const size_t kPayloadBytes = 384;
+
+  CmdJournal();
+
+  // loop(setup): 파일을 읽어 미확인 커맨드 목록을 복원한다. 실패하면 저널 없이 바로 발행한다.
+  bool begin();
+  bool ready() const { return ready_; }
+
+  // loop: 다음 op를 예약하고 그 idempotency_key를 key(kKeyBytes)에 쓴다.
+  uint32_t reserve(char* key);
+  // loop: 예약한 op를 기록한다. 실패(파일 오류, 크기 초과)면 false — 호출 측이 직접 발행한다.
+  bool append(uint32_t op, const char* topic, const char* payload);
+
+  // async-tcp: 학원 ack 토픽의 마지막 구간(키). 이 기기 저널 키가 아니면 무시한다.
+  void on_ack(const char* key);
+  // async-tcp(onMqttConnect): 새 세션이므로 아직 ack가 없는 커맨드를 모두 다시 보낸다.
+  void start_replay() { session_.fetch_add(1, std::memory_order_release); }
+
+  // loop: ack 반영, 오래된 항목 정리, 간격에 맞춰 커맨드 하나 발행.
+  void service(uint32_t now_ms, bool connected, CmdJournalPublishFn publish);
+
+  uint8_t pending() const { return count_; }
+  const CmdJournalStats& stats() const { return stats_; }
+
+ private:
+  struct Entry {
+    uint32_t op;
+    uint32_t offset;        // 파일 안 CMD 레코드 위치
+    uint32_t wall_s;        // 기록 시각(epoch 초, 시간 미동기화면 0)
+    uint32_t rec_ms;        // 이번 부팅에 기록한 millis(부팅 전 항목은 0)
+    uint32_t sent_ms;
+    uint32_t sent_session;  // 0: 이번 부팅에 기록 후 아직 안 보냄
+  };
+
+  bool load();
+  bool write_record(uint8_t type, uint32_t op, uint32_t wall_s, const char* topic, const char* payload,
+                    uint32_t* offset_out);
+  bool read_command(const Entry& e, char* topic, char* payload);
+  bool compact();
+  bool expired(const Entry& e, uint32_t now_ms, uint32_t wall) const;
+  void remove_at(uint8_t i, bool write_ack);
+  int find(uint32_t op) const;
+
+  bool ready_;
+  uint32_t epoch_;
+  uint32_t next_op_;
+  char epoch_hex_[9];
+  Entry entries_[kMaxPending];  // op 오름차순
+  uint8_t count_;
+  uint32_t next_send_ms_;
+  std::atomic<uint32_t> session_{1};
+  SpscRing<uint32_t, 16> acks_;  // async-tcp → loop
+  CmdJournalStats stats_;
+};
@@ -0,0 +1,279 @@
+#include "display_flush.h"
+
+#include <M5Unified.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+#ifndef CFG_DISP_FLUSH_DMA
+#define CFG_DISP_FLUSH_DMA 1
+#endif
+
+// draw buffer 전략
+//  0: 내부 RAM 320x40 밴드 2장(partial). PSRAM이 없어도 동작하는 기본값.
+//  1: PSRAM 320x240 1장 + direct mode. 바뀐 영역만 제자리에 그리고 그 영역만 보낸다.
+//  2: PSRAM 320x120 밴드 2장(partial). 밴드 수가 1/3로 줄고 내부 RAM은 바운스 버퍼만 쓴다.
+// 1/2는 PSRAM을 SPI DMA가 직접 읽지 못하므로 내부 RAM 바운스 버퍼(320x16 2장)를 거쳐 보낸다.
+#ifndef CFG_DISP_BUF_MODE
+#define CFG_DISP_BUF_MODE 0
+#endif
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP == 0
+#error "display_flush는 LV_COLOR_16_SWAP=1 RGB565 버퍼를 그대로 전송한다"
+#endif
+
+enum DispBufMode : uint8_t {
+  kBufPartialInternal = 0,
+  kBufFullPsramDirect = 1,
+  kBufHybridPsram = 2,
+};
+
+static const int kHorRes = 320;
+static const int kVerRes = 240;
+static const int kBandLines = 40;
+static const int kHybridBandLines = 120;
+static const int kBounceLines = 16;
+static const uint32_t kReportWindowMs = 3000;
+static const uint32_t kAnimGapMs = 100;
+
+static lv_disp_draw_buf_t s_draw_buf;
+static lv_color_t* s_buf1 = nullptr;
+static lv_color_t* s_buf2 = nullptr;
+static lv_color_t* s_bounce[2] = {nullptr, nullptr};
+static uint8_t s_bounce_next = 0;
+static uint8_t s_mode = kBufPartialInternal;
+static uint32_t s_internal_bytes = 0;
+static uint32_t s_psram_bytes = 0;
+static bool s_in_write = false;
+
+static const char* mode_name(uint8_t m) {
+  switch (m) {
+    case kBufFullPsramDirect: return "psram_direct";
+    case kBufHybridPsram: return "hybrid";
+    default: return "internal";
+  }
+}
+
+static DisplayFlushStats s_acc = {};
+static DisplayFlushStats s_last = {};
+static uint32_t s_window_start_ms = 0;
+static uint32_t s_last_frame_ms = 0;
+
+static void begin_frame_write() {
+  if (!s_in_write) {
+    M5.Display.startWrite();
+    s_in_write = true;
+  }
+}
+
+static void end_frame_write() {
+  M5.Display.waitDMA();
+  M5.Display.endWrite();
+  s_in_write = false;
+}
+
+// PSRAM 버퍼(src, 한 줄 stride 픽셀)의 w x h 영역을 바운스 버퍼 두 장에 번갈아 옮겨 보낸다.
+// pushImageDMA가 앞 전송을 기다리므로, 한 장이 버스에 있는 동안 다른 장을 채운다.
+// 마지막 조각을 복사한 뒤에는 src를 더 읽지 않으므로 바로 flush_ready를 알려도 된다.
+static void push_via_bounce(int32_t x, int32_t y, int32_t w, int32_t h, const lv_color_t* src, int32_t stride) {
+  const int32_t rows_per_chunk = LV_MAX(1, (kHorRes * kBounceLines) / w);
+  for (int32_t row = 0; row < h; row += rows_per_chunk) {
+    const int32_t rows = LV_MIN(rows_per_chunk, h - row);
+    lv_color_t* dst = s_bounce[s_bounce_next];
+    s_bounce_next ^= 1;
+    for (int32_t r = 0; r < rows; r++) {
+      memcpy(dst + r * w, src + (row + r) * stride, sizeof(lv_color_t) * w);
+    }
+#if CFG_DISP_FLUSH_DMA
+    M5.Display.pushImageDMA(x, y + row, w, rows, (const lgfx::swap565_t*)&dst->full);
+#else
+    M5.Display.setAddrWindow(x, y + row, w, rows);
+    M5.Display.pushPixels((const lgfx::swap565_t*)&dst->full, w * rows);
+#endif
+  }
+}
+
+static void flush_cb(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p) {
+  const int64_t t0 = esp_timer_get_time();
+  const int32_t w = area->x2 - area->x1 + 1;
+  const int32_t h = area->y2 - area->y1 + 1;
+  // 트랜잭션은 한 프레임 동안 열어 두고 마지막 밴드에서 전송 완료를 기다려 버스를 놓는다.
+  // 절전/밝기 등 다른 SPI 사용자와 겹치지 않게 하기 위함이다.
+  begin_frame_write();
+  if (s_mode == kBufFullPsramDirect) {
+    // direct mode: color_p는 화면 전체 버퍼이고 LVGL 8.3은 area로 화면 전체를 넘긴다.
+    // 바뀐 영역을 다 그린 마지막 호출에서 무효 영역 목록만 골라 보낸다.
+    if (lv_disp_flush_is_last(disp)) {
+      const lv_disp_t* d = _lv_refr_get_disp_refreshing();
+      for (uint16_t i = 0; d && i < d->inv_p; i++) {
+        if (d->inv_area_joined[i]) continue;
+        const lv_area_t& a = d->inv_areas[i];
+        const int32_t aw = lv_area_get_width(&a);
+        const int32_t ah = lv_area_get_height(&a);
+        push_via_bounce(a.x1, a.y1, aw, ah, color_p + a.y1 * kHorRes + a.x1, kHorRes);
+        s_acc.pixels += (uint32_t)(aw * ah);
+      }
+    }
+  } else if (s_mode == kBufHybridPsram) {
+    push_via_bounce(area->x1, area->y1, w, h, color_p, w);
+  } else {
+    const lgfx::swap565_t* px = (const lgfx::swap565_t*)&color_p->full;
+#if CFG_DISP_FLUSH_DMA
+    // pushImageDMA는 앞 밴드의 DMA가 끝날 때까지만 기다렸다가 이 밴드를 걸고 돌아온다.
+    // 여기서 곧바로 flush_ready를 알려도 되는 이유: LVGL은 다음 밴드를 다른 버퍼에 그리고,
+    // 이 버퍼를 다시 쓰기 전에 반드시 다음 flush_cb(= 이 버퍼 DMA 완료 대기)를 거친다.
+    M5.Display.pushImageDMA(area->x1, area->y1, w, h, px);
+#else
+    M5.Display.setAddrWindow(area->x1, area->y1, w, h);
+    M5.Display.pushPixels(px, w * h);
+#endif
+  }
+  if (lv_disp_flush_is_last(disp)) {
+    end_frame_write();
+  }
+  s_acc.bands++;
+  if (s_mode != kBufFullPsramDirect) s_acc.pixels += (uint32_t)(w * h);
+  s_acc.flush_us += (uint32_t)(esp_timer_get_time() - t0);
+  lv_disp_flush_ready(disp);
+}
+
+static void monitor_cb(lv_disp_drv_t* disp, uint32_t time_ms, uint32_t px) {
+  (void)disp;
+  (void)px;
+  const uint32_t now = millis();
+  s_acc.frames++;
+  s_acc.render_ms += time_ms;
+  if (s_last_frame_ms && now - s_last_frame_ms <= kAnimGapMs) {
+    s_acc.anim_frames++;
+    s_acc.anim_ms += now - s_last_frame_ms;
+  }
+  s_last_frame_ms = now;
+}
+
+static lv_color_t* alloc_px(size_t px, uint32_t caps, uint32_t* counter) {
+  lv_color_t* p = (lv_color_t*)heap_caps_malloc(sizeof(lv_color_t) * px, caps);
+  if (p) *counter += sizeof(lv_color_t) * px;
+  return p;
+}
+
+static void free_buffers() {
+  heap_caps_free(s_buf1);
+  heap_caps_free(s_buf2);
+  heap_caps_free(s_bounce[0]);
+  heap_caps_free(s_bounce[1]);
+  s_buf1 = s_buf2 = s_bounce[0] = s_bounce[1] = nullptr;
+  s_internal_bytes = s_psram_bytes = 0;
+}
+
+static bool alloc_buffers(uint8_t mode, lv_disp_drv_t* drv) {
+  const uint32_t kPsram = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+  const uint32_t kDma = MALLOC_CAP_DMA | MALLOC_CAP_8BIT;
+  if (mode == kBufFullPsramDirect || mode == kBufHybridPsram) {
+    const size_t px = (size_t)kHorRes * (mode == kBufFullPsramDirect ? kVerRes : kHybridBandLines);
+    s_buf1 = alloc_px(px, kPsram, &s_psram_bytes);
+    if (mode == kBufHybridPsram) s_buf2 = alloc_px(px, kPsram, &s_psram_bytes);
+    s_bounce[0] = alloc_px((size_t)kHorRes * kBounceLines, kDma, &s_internal_bytes);
+    s_bounce[1] = alloc_px((size_t)kHorRes * kBounceLines, kDma, &s_internal_bytes);
+    if (!s_buf1 || (mode == kBufHybridPsram && !s_buf2) || !s_bounce[0] || !s_bounce[1]) return false;
+    lv_disp_draw_buf_init(&s_draw_buf, s_buf1, s_buf2, px);
+    drv->direct_mode = (mode == kBufFullPsramDirect) ? 1 : 0;
+    return true;
+  }
+  // 320x40 밴드 2장. DMA 가능 내부 RAM이어야 M5GFX가 중간 복사 없이 바로 전송한다.
+  const size_t px = (size_t)kHorRes * kBandLines;
+  s_buf1 = alloc_px(px, kDma, &s_internal_bytes);
+  s_buf2 = alloc_px(px, kDma, &s_internal_bytes);
+  if (!s_buf1 || !s_buf2) return false;
+  lv_disp_draw_buf_init(&s_draw_buf, s_buf1, s_buf2, px);
+  drv->direct_mode = 0;
+  return true;
+}
+
+bool display_flush_init(lv_disp_drv_t* drv) {
+  // SPI 바이트 순서 그대로 보내므로 M5GFX 쪽 변환은 끈다.
+  M5.Display.setColorDepth(16);
+  M5.Display.setSwapBytes(false);
+  s_mode = CFG_DISP_BUF_MODE;
+  if (s_mode != kBufPartialInternal && !psramFound()) {
+    Serial.printf("[DISP] WARN: no PSRAM for buf=%s, fallback to internal\n", mode_name(s_mode));
+    s_mode = kBufPartialInternal;
+  }
+  if (!alloc_buffers(s_mode, drv)) {
+    free_buffers();
+    if (s_mode == kBufPartialInternal || !alloc_buffers(kBufPartialInternal, drv)) {
+      Serial.println("[DISP] ERROR: draw buffer alloc failed");
+      return false;
+    }
+    Serial.printf("[DISP] WARN: buf=%s alloc failed, fallback to internal\n", mode_name(s_mode));
+    s_mode = kBufPartialInternal;
+  }
+  drv->hor_res = kHorRes;
+  drv->ver_res = kVerRes;
+  drv->flush_cb = flush_cb;
+  drv->monitor_cb = monitor_cb;
+  drv->draw_buf = &s_draw_buf;
+  Serial.printf("[DISP] flush=%s buf=%s internal=%luB psram=%luB int_free=%u int_largest=%u\n",
+                CFG_DISP_FLUSH_DMA ? "dma" : "sync",
+                mode_name(s_mode),
+                (unsigned long)s_internal_bytes,
+                (unsigned long)s_psram_bytes,
+                (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+  return true;
+}
+
+void display_flush_bench(uint16_t frames) {
+  // 전체 화면 무효화 → 즉시 리프레시를 반복해 최악(화면 전체 다시 그리기) 렌더 시간을 잰다.
+  // 버퍼 전략끼리 비교할 때 같은 화면에서 빌드만 바꿔 돌린다.
+  if (frames == 0) return;
+  uint32_t bands0 = s_acc.bands;
+  uint32_t flush0 = s_acc.flush_us;
+  uint32_t worst_us = 0;
+  const int64_t t0 = esp_timer_get_time();
+  for (uint16_t i = 0; i < frames; i++) {
+    const int64_t f0 = esp_timer_get_time();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(nullptr);
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - f0);
+    if (us > worst_us) worst_us = us;
+  }
+  const uint32_t total_us = (uint32_t)(esp_timer_get_time() - t0);
+  Serial.printf("[DISP] bench buf=%s flush=%s frames=%u frame_us avg=%lu max=%lu flush_us/frame=%lu bands/frame=%lu "
+                "int_free=%u int_min=%u int_largest=%u psram_free=%u\n",
+                mode_name(s_mode),
+                CFG_DISP_FLUSH_DMA ? "dma" : "sync",
+                (unsigned)frames,
+                (unsigned long)(total_us / frames),
+                (unsigned long)worst_us,
+                (unsigned long)((s_acc.flush_us - flush0) / frames),
+                (unsigned long)((s_acc.bands - bands0) / frames),
+                (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+                (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
+                (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+}
+
+void display_flush_report(uint32_t now_ms) {
+  if (s_window_start_ms == 0) s_window_start_ms = now_ms;
+  if (now_ms - s_window_start_ms < kReportWindowMs) return;
+  s_acc.window_ms = now_ms - s_window_start_ms;
+  s_last = s_acc;
+  s_acc = {};
+  s_window_start_ms = now_ms;
+  if (s_last.frames == 0) return;
+  const uint32_t fps10 = s_last.anim_ms ? (s_last.anim_frames * 10000u) / s_last.anim_ms : 0;
+  Serial.printf("[DISP] mode=%s buf=%s frames=%lu anim_fps=%lu.%lu flush_us/frame=%lu render_ms/frame=%lu bands/frame=%lu px/frame=%lu int_free=%u\n",
+                CFG_DISP_FLUSH_DMA ? "dma" : "sync",
+                mode_name(s_mode),
+                (unsigned long)s_last.frames,
+                (unsigned long)(fps10 / 10),
+                (unsigned long)(fps10 % 10),
+                (unsigned long)(s_last.flush_us / s_last.frames),
+                (unsigned long)(s_last.render_ms / s_last.frames),
+                (unsigned long)(s_last.bands / s_last.frames),
+                (unsigned long)(s_last.pixels / s_last.frames),
+                (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+}
+
+const DisplayFlushStats& display_flush_last_window() {
+  return s_last;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <lvgl.h>
+
+// LVGL 디스플레이 드라이버의 draw buffer와 flush 경로.
+//
+// LV_COLOR_16_SWAP=1이라 LVGL이 그린 버퍼가 이미 SPI 바이트 순서다. flush는 CPU 변환 없이
+// pushImageDMA로 밴드를 걸어 두고 곧바로 돌아오므로, 그동안 LVGL은 다른 버퍼에 다음 밴드를 그린다.
+// CFG_DISP_FLUSH_DMA=0이면 이전과 같은 동기 전송(비교 측정용)이다.
+// 버퍼 배치는 CFG_DISP_BUF_MODE(0 내부 RAM partial / 1 PSRAM 전체 direct / 2 PSRAM 큰 밴드)로 고른다.
+// PSRAM을 못 쓰면 0으로 내려간다.
+
+struct DisplayFlushStats {
+  uint32_t frames;       // 리프레시 완료 수(monitor_cb)
+  uint32_t bands;        // flush_cb 호출 수
+  uint32_t pixels;       // 전송 픽셀 수
+  uint32_t flush_us;     // flush_cb 안에서 CPU가 머문 시간(앞 밴드 DMA 대기 포함)
+  uint32_t render_ms;    // monitor_cb가 알려준 리프레시 시간 합(그리기 + flush)
+  uint32_t anim_frames;  // 100ms 이내로 이어진 프레임(애니메이션 구간)
+  uint32_t anim_ms;      // 그 프레임 간격 합
+  uint32_t window_ms;    // 집계 구간 길이
+};
+
+// lv_init() 뒤, lv_disp_drv_register() 전에 호출. draw buffer와 flush/monitor 콜백을 채운다.
+bool display_flush_init(lv_disp_drv_t* drv);
+
+// loop()에서 매번 호출. 3초 구간마다 프레임이 있었으면 [DISP] 로그를 남기고 구간을 넘긴다.
+void display_flush_report(uint32_t now_ms);
+
+// 화면 전체를 frames번 즉시 다시 그려 프레임 시간·flush 시간·내부 힙 여유를 [DISP] bench 로그로 남긴다.
+// 버퍼 전략 비교용(CFG_DISP_BENCH). UI가 만들어진 뒤 호출한다.
+void display_flush_bench(uint16_t frames);
+
+// 직전에 닫힌 구간의 통계
+const DisplayFlushStats& display_flush_last_window();
@@ -0,0 +1,346 @@
+#include "font_fallback.h"
+
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <string.h>
+#include <lvgl.h>
+#include <soc/soc_memory_layout.h>
+#include <atomic>
+#include "glyph_cache.h"
+#if LV_USE_TINY_TTF
+#include "extra/libs/tiny_ttf/lv_tiny_ttf.h"
+#endif
+
+#ifndef CFG_FONT_FALLBACK
+#define CFG_FONT_FALLBACK 1
+#endif
+#ifndef CFG_FONT_FALLBACK_PATH
+#define CFG_FONT_FALLBACK_PATH "/font_fallback.ttf"
+#endif
+#ifndef CFG_FONT_FALLBACK_TASK_STACK
+#define CFG_FONT_FALLBACK_TASK_STACK 4096
+#endif
+// 글리프 캐시 칸 풀(PSRAM, 두 크기가 반씩). 0이면 캐시 없이 매번 래스터라이즈한다.
+#ifndef CFG_FONT_CACHE_BYTES
+#define CFG_FONT_CACHE_BYTES (256 * 1024)
+#endif
+// font_fallback_poll() 한 번에 예열에 쓰는 시간 상한
+#ifndef CFG_FONT_WARM_BUDGET_US
+#define CFG_FONT_WARM_BUDGET_US 3000
+#endif
+
+// font_subset.py가 만든 폰트는 const가 아니다(다른 파일은 const로 선언해 읽기만 한다).
+extern lv_font_t kakao_kr_16;
+extern lv_font_t kakao_kr_24;
+
+namespace {
+
+enum LoadState : uint8_t { LOAD_IDLE = 0, LOAD_RUNNING, LOAD_READY, LOAD_FAILED, LOAD_ATTACHED };
+
+struct Slot {
+  lv_font_t* base;
+  const char* name;
+  lv_font_t* ttf;   // tiny_ttf
+  lv_font_t proxy;  // ttf 복사본. 콜백만 캐시 shim으로 바꿔 base->fallback에 건다
+  GlyphCache cache;
+};
+
+Slot s_slots[2] = {{&kakao_kr_16, "16", nullptr, {}, {}}, {&kakao_kr_24, "24", nullptr, {}, {}}};
+std::atomic<uint8_t> s_state{LOAD_IDLE};
+uint8_t* s_ttf = nullptr;  // PSRAM, tiny_ttf가 계속 참조한다
+FontFallbackStats s_stats = {};
+
+// 최근 fallback 글자(중복 없이). 서브셋에 더할 후보를 찾는 용도.
+const uint8_t kRecent = 12;
+uint32_t s_recent[kRecent] = {};
+uint8_t s_recent_pos = 0;
+
+// 예열 대기열: (슬롯 << 24) | 코드포인트. loop 스레드 전용.
+const uint16_t kWarmQueue = 192;
+uint32_t s_warm[kWarmQueue];
+uint16_t s_warm_head = 0;
+uint16_t s_warm_len = 0;
+
+// 벤치 글자: 서브셋에 확실히 있는 UI 문자열 글자(비트맵/TTF 양쪽에서 같은 글자를 잰다).
+const char* const kBenchText = "과제진행완료학습대기시간";
+
+Slot* slot_of(const lv_font_t* font) {
+  for (Slot& s : s_slots) {
+    if (&s.proxy == font) return &s;
+  }
+  return nullptr;
+}
+
+void note_recent(uint32_t letter) {
+  for (uint8_t i = 0; i < kRecent; ++i) {
+    if (s_recent[i] == letter) return;
+  }
+  s_recent[s_recent_pos] = letter;
+  s_recent_pos = (uint8_t)((s_recent_pos + 1) % kRecent);
+}
+
+bool shim_glyph_dsc(const lv_font_t* font, lv_font_glyph_dsc_t* dsc, uint32_t letter, uint32_t next) {
+  const Slot* s = slot_of(font);
+  return s && s->ttf->get_glyph_dsc(s->ttf, dsc, letter, next);
+}
+
+// 래스터라이즈해서 캐시에 넣는다. 칸보다 크거나 캐시가 없으면 tiny_ttf 버퍼를 그대로 돌려준다.
+const uint8_t* rasterize(Slot& s, uint32_t letter) {
+  const int64_t t0 = esp_timer_get_time();
+  lv_font_glyph_dsc_t g;
+  const bool have_dsc = s.ttf->get_glyph_dsc(s.ttf, &g, letter, 0);
+  const uint8_t* bmp = s.ttf->get_glyph_bitmap(s.ttf, letter);
+  const uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+  s_stats.rasterized++;
+  s_stats.raster_us_total += us;
+  if (us > s_stats.raster_us_max) s_stats.raster_us_max = us;
+  if (!bmp || !have_dsc) return bmp;
+  const uint32_t bytes = ((uint32_t)g.box_w * g.box_h * g.bpp + 7) / 8;
+  uint8_t* cell = s.cache.insert(letter, bytes);
+  if (!cell) return bmp;
+  memcpy(cell, bmp, bytes);
+  return cell;
+}
+
+const uint8_t* shim_glyph_bitmap(const lv_font_t* font, uint32_t letter) {
+  Slot* s = slot_of(font);
+  if (!s) return nullptr;
+  if (const uint8_t* hit = s->cache.find(letter)) {
+    s_stats.cache_hits++;
+    return hit;
+  }
+  s_stats.cache_misses++;
+  note_recent(letter);
+  return rasterize(*s, letter);
+}
+
+// PSRAM 칸 풀 + 내부 RAM 인덱스. 칸은 tiny_ttf(8bpp) 글리프 박스 상한(line_height + 2)^2.
+void init_cache(Slot& s) {
+  const uint32_t side = (uint32_t)s.base->line_height + 2;
+  const uint32_t cell = side * side;
+  const uint32_t n = (uint32_t)CFG_FONT_CACHE_BYTES / 2 / cell;
+  if (n == 0) return;
+  const uint16_t count = (uint16_t)(n > 0xFFFE ? 0xFFFE : n);
+  uint8_t* pool = (uint8_t*)heap_caps_malloc((size_t)count * cell, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!pool) return;  // 내부 RAM을 수백 KB 쓰느니 캐시 없이 간다
+  const size_t idx_bytes = GlyphCache::index_bytes(count);
+  void* idx = heap_caps_malloc(idx_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!idx) idx = heap_caps_malloc(idx_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!idx) {
+    heap_caps_free(pool);
+    return;
+  }
+  s.cache.init(idx, pool, count, cell);
+  s_stats.cache_glyphs += count;
+  s_stats.cache_bytes += (uint32_t)count * cell + (uint32_t)idx_bytes;
+}
+
+// 대기열의 글자를 시간 상한 안에서 캐시에 미리 그려 둔다.
+void run_warm() {
+  if (!s_warm_len) return;
+  const int64_t t0 = esp_timer_get_time();
+  while (s_warm_len && esp_timer_get_time() - t0 < CFG_FONT_WARM_BUDGET_US) {
+    const uint32_t v = s_warm[s_warm_head];
+    s_warm_head = (uint16_t)((s_warm_head + 1) % kWarmQueue);
+    s_warm_len--;
+    Slot& s = s_slots[v >> 24];
+    const uint32_t letter = v & 0xFFFFFF;
+    if (s.cache.find(letter)) continue;
+    rasterize(s, letter);
+    s_stats.warmed++;
+  }
+}
+
+void load_task(void*) {
+  const uint32_t t0 = millis();
+  // 보통은 부팅 때 이미 마운트되어 있어 바로 true다. LittleFS는 한 번 마운트하면 내리지 않는다.
+  File f;
+  if (LittleFS.begin(true)) f = LittleFS.open(CFG_FONT_FALLBACK_PATH, "r");
+  const size_t len = f ? f.size() : 0;
+  uint8_t* buf = nullptr;
+  if (len > 0) {
+    buf = (uint8_t*)heap_caps_malloc(len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buf) buf = (uint8_t*)heap_caps_malloc(len, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  size_t got = 0;
+  if (buf) {
+    while (got < len) {
+      const size_t n = f.read(buf + got, len - got);
+      if (n == 0) break;
+      got += n;
+    }
+  }
+  if (f) f.close();
+  if (!buf || got != len) {
+    Serial.printf("[FONT] fallback %s unavailable (size=%u read=%u)\n", CFG_FONT_FALLBACK_PATH, (unsigned)len,
+                  (unsigned)got);
+    if (buf) heap_caps_free(buf);
+    s_state.store(LOAD_FAILED, std::memory_order_release);
+  } else {
+    s_ttf = buf;
+    s_stats.ttf_bytes = (uint32_t)len;
+    s_stats.load_ms = millis() - t0;
+    s_state.store(LOAD_READY, std::memory_order_release);
+  }
+  vTaskDelete(NULL);
+}
+
+// 글리프당 시간(ns): lv_font_get_glyph_dsc 뒤 비트맵을 받아 끝까지 읽는다(그리기 전 단계만).
+uint32_t bench_ns(const lv_font_t* font) {
+  uint32_t n = 0;
+  volatile uint32_t sink = 0;
+  const int64_t t0 = esp_timer_get_time();
+  for (uint32_t i = 0; kBenchText[i];) {
+    const uint32_t letter = _lv_txt_encoded_next(kBenchText, &i);
+    lv_font_glyph_dsc_t g;
+    if (!font->get_glyph_dsc(font, &g, letter, 0)) continue;
+    const uint8_t* bmp = font->get_glyph_bitmap(font, letter);
+    if (!bmp) continue;
+    const uint32_t bytes = ((uint32_t)g.box_w * g.box_h * g.bpp + 7) / 8;
+    for (uint32_t k = 0; k < bytes; ++k) sink += bmp[k];
+    ++n;
+  }
+  const int64_t us = esp_timer_get_time() - t0;
+  (void)sink;
+  return n ? (uint32_t)(us * 1000 / n) : 0;
+}
+
+void append_utf8(String& out, uint32_t cp) {
+  char b[5] = {};
+  if (cp < 0x80) {
+    b[0] = (char)cp;
+  } else if (cp < 0x800) {
+    b[0] = (char)(0xC0 | (cp >> 6));
+    b[1] = (char)(0x80 | (cp & 0x3F));
+  } else {
+    b[0] = (char)(0xE0 | (cp >> 12));
+    b[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    b[2] = (char)(0x80 | (cp & 0x3F));
+  }
+  out += b;
+}
+
+}  // namespace
+
+void font_fallback_begin() {
+#if CFG_FONT_FALLBACK && LV_USE_TINY_TTF
+  uint8_t expected = LOAD_IDLE;
+  if (!s_state.compare_exchange_strong(expected, LOAD_RUNNING)) return;
+  // 옛 폰트 소스(const, 플래시)면 fallback 포인터를 쓸 수 없다.
+  for (const Slot& s : s_slots) {
+    if (!esp_ptr_in_dram(s.base)) {
+      Serial.printf("[FONT] kakao_kr_%s is const (regenerate with tools/font_subset.py), fallback off\n", s.name);
+      s_state.store(LOAD_FAILED);
+      return;
+    }
+  }
+  if (xTaskCreatePinnedToCore(load_task, "font_fb", CFG_FONT_FALLBACK_TASK_STACK, nullptr, 1, nullptr, 0) != pdPASS) {
+    s_state.store(LOAD_FAILED);
+  }
+#endif
+}
+
+void font_fallback_poll() {
+#if CFG_FONT_FALLBACK && LV_USE_TINY_TTF
+  const uint8_t st = s_state.load(std::memory_order_acquire);
+  if (st == LOAD_ATTACHED) {
+    run_warm();
+    return;
+  }
+  if (st != LOAD_READY) return;
+  s_state.store(LOAD_ATTACHED);
+
+  const uint32_t t0 = millis();
+  for (Slot& s : s_slots) {
+    // line_height를 비트맵과 같게 주면 tiny_ttf 스케일이 lv_font_conv(--size)와 같아진다.
+    s.ttf = lv_tiny_ttf_create_data(s_ttf, s_stats.ttf_bytes, s.base->line_height);
+    if (!s.ttf) {
+      Serial.printf("[FONT] tiny_ttf create failed (%s)\n", s.name);
+      s_state.store(LOAD_FAILED);
+      return;
+    }
+  }
+  s_stats.create_ms = millis() - t0;
+
+  // 벤치는 fallback을 걸기 전에(비트맵 폰트가 글자를 직접 찾게) 16px로 한 번.
+  s_stats.bench_bitmap_ns = bench_ns(s_slots[0].base);
+  s_stats.bench_ttf_ns = bench_ns(s_slots[0].ttf);
+
+  for (Slot& s : s_slots) {
+    init_cache(s);
+    s.proxy = *s.ttf;
+    s.proxy.get_glyph_dsc = shim_glyph_dsc;
+    s.proxy.get_glyph_bitmap = shim_glyph_bitmap;
+    s.proxy.fallback = nullptr;
+    s.base->fallback = &s.proxy;
+  }
+  s_stats.attached_ms = millis();
+  // 빠졌던 글자 폭으로 잡힌 라벨을 다시 배치한다.
+  lv_obj_report_style_change(NULL);
+  Serial.printf("[FONT] fallback attached ttf=%u load_ms=%u create_ms=%u glyph_ns bitmap=%u ttf=%u cache=%u/%uB\n",
+                (unsigned)s_stats.ttf_bytes, (unsigned)s_stats.load_ms, (unsigned)s_stats.create_ms,
+                (unsigned)s_stats.bench_bitmap_ns, (unsigned)s_stats.bench_ttf_ns, (unsigned)s_stats.cache_glyphs,
+                (unsigned)s_stats.cache_bytes);
+#endif
+}
+
+void font_fallback_warm(const lv_font_t* font, const char* utf8) {
+#if CFG_FONT_FALLBACK && LV_USE_TINY_TTF
+  if (!utf8 || !*utf8) return;
+  const uint8_t st = s_state.load(std::memory_order_acquire);
+  if (st == LOAD_FAILED) return;
+  uint32_t idx = 0;
+  while (idx < 2 && s_slots[idx].base != font) ++idx;
+  if (idx == 2) return;
+  const lv_font_t* base = s_slots[idx].base;
+  for (uint32_t i = 0; utf8[i];) {
+    const uint32_t letter = _lv_txt_encoded_next(utf8, &i);
+    if (letter < 0x80) continue;
+    // 비트맵 서브셋에 있는 글자는 fallback까지 안 간다(base 콜백은 fallback을 따라가지 않는다).
+    lv_font_glyph_dsc_t g;
+    if (base->get_glyph_dsc(base, &g, letter, 0)) continue;
+    if (s_warm_len == kWarmQueue) {
+      s_stats.warm_dropped++;
+      continue;
+    }
+    s_warm[(s_warm_head + s_warm_len) % kWarmQueue] = (idx << 24) | letter;
+    s_warm_len++;
+  }
+#else
+  (void)font;
+  (void)utf8;
+#endif
+}
+
+const FontFallbackStats& font_fallback_stats() {
+  return s_stats;
+}
+
+void font_fallback_append_diag(String& out) {
+  const uint8_t st = s_state.load(std::memory_order_acquire);
+  out += "font_fallback=" + String(st == LOAD_ATTACHED ? "on" : (st == LOAD_FAILED ? "off" : "pending")) +
+         " ttf_bytes=" + String((unsigned long)s_stats.ttf_bytes) + " load_ms=" + String((unsigned long)s_stats.load_ms) +
+         " create_ms=" + String((unsigned long)s_stats.create_ms) +
+         " attached_ms=" + String((unsigned long)s_stats.attached_ms) + "\n";
+  const uint32_t n = s_stats.rasterized;
+  out += "font_fallback_raster=" + String((unsigned long)n) +
+         " avg_us=" + String((unsigned long)(n ? s_stats.raster_us_total / n : 0)) +
+         " max_us=" + String((unsigned long)s_stats.raster_us_max) + "\n";
+  const uint32_t lookups = s_stats.cache_hits + s_stats.cache_misses;
+  out += "font_cache hits=" + String((unsigned long)s_stats.cache_hits) +
+         " misses=" + String((unsigned long)s_stats.cache_misses) +
+         " hit_pct=" + String((unsigned long)(lookups ? s_stats.cache_hits * 100ull / lookups : 0)) +
+         " glyphs=" + String((unsigned)(s_slots[0].cache.used() + s_slots[1].cache.used())) + "/" +
+         String((unsigned long)s_stats.cache_glyphs) +
+         " evict=" + String((unsigned long)(s_slots[0].cache.evictions() + s_slots[1].cache.evictions())) +
+         " bytes=" + String((unsigned long)s_stats.cache_bytes) + " warmed=" + String((unsigned long)s_stats.warmed) +
+         " warm_dropped=" + String((unsigned long)s_stats.warm_dropped) + "\n";
+  out += "font_glyph_ns bitmap=" + String((unsigned long)s_stats.bench_bitmap_ns) +
+         " ttf=" + String((unsigned long)s_stats.bench_ttf_ns) + "\n";
+  out += "font_fallback_recent=";
+  for (uint8_t i = 0; i < kRecent; ++i) {
+    if (s_recent[i]) append_utf8(out, s_recent[i]);
+  }
+  out += "\n";
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// 서브셋 밖 글자의 fallback(tiny_ttf).
+//
+// kakao_kr_16/24는 tools/font_subset.py가 UI 문자열 리터럴 + 흔한 이름·교재명 음절만 담아 만든
+// 비트맵 폰트다(플래시 매핑이라 로드 시간 0). 학생 이름처럼 서브셋에 없는 글자는 LittleFS의
+// /font_fallback.ttf(완성형 2,350자 서브셋)를 tiny_ttf로 그때그때 래스터라이즈해 그린다.
+//  - 첫 화면이 뜬 뒤 백그라운드 태스크(코어 0)가 TTF를 PSRAM으로 읽는다. 부팅 경로에는 폰트 로드가 없다.
+//  - loop 스레드의 font_fallback_poll()이 tiny_ttf 폰트를 만들어 lv_font_t.fallback에 건다.
+//    생성된 폰트 구조체가 const가 아니어야 한다(font_subset.py가 const를 뗀다). 옛 폰트면 fallback 없이 그대로 쓴다.
+//  - fallback 래스터라이즈 횟수·시간과, 붙일 때 잰 비트맵 대 TTF 글리프당 시간을 LIST-DIAG에 싣는다.
+//  - fallback 비트맵은 PSRAM LRU 캐시(glyph_cache.h, 폰트·크기별, 키는 코드포인트)에 남겨 두어
+//    카드를 다시 만들거나 목록을 스크롤해도 같은 글자를 다시 래스터라이즈하지 않는다.
+//    학생 이름·교재명처럼 곧 그릴 문자열은 font_fallback_warm()으로 미리 넣어 둔다(poll에서 시간 상한 안에서).
+//    자주 보이는 fallback 글자는 최근 목록(font_fallback_recent)을 보고 tools/font_subset_extra.txt에 더한다.
+
+struct FontFallbackStats {
+  uint32_t ttf_bytes;         // 0: 파일 없음/아직 안 읽음
+  uint32_t load_ms;           // LittleFS → PSRAM
+  uint32_t create_ms;         // tiny_ttf 폰트 생성(두 크기)
+  uint32_t attached_ms;       // 부팅 기준 fallback이 붙은 시각(0: 안 붙음)
+  uint32_t rasterized;        // tiny_ttf 래스터라이즈 횟수(캐시 미스 + 예열)
+  uint32_t raster_us_total;
+  uint32_t raster_us_max;
+  uint32_t bench_bitmap_ns;   // 붙일 때 잰 글리프당 시간(dsc + bitmap), 비트맵 폰트
+  uint32_t bench_ttf_ns;      // 같은 글자를 TTF로
+  uint32_t cache_hits;
+  uint32_t cache_misses;
+  uint32_t cache_glyphs;      // 칸 수(두 크기 합)
+  uint32_t cache_bytes;       // 칸 풀 + 인덱스
+  uint32_t warmed;            // 예열로 미리 그린 글리프
+  uint32_t warm_dropped;      // 대기열이 차서 버린 예열 요청
+};
+
+// loop: 첫 화면 뒤 한 번. TTF 읽기 태스크를 띄운다.
+void font_fallback_begin();
+// loop(LVGL 스레드): 읽기가 끝났으면 fallback을 붙이고 화면을 다시 배치한다.
+void font_fallback_poll();
+// loop(LVGL 스레드): 곧 font로 그릴 문자열의 서브셋 밖 글자를 캐시에 미리 그려 두도록 예약한다.
+// fallback이 아직 안 붙었으면 붙은 뒤에 처리한다. font는 kakao_kr_16/24 중 하나.
+void font_fallback_warm(const lv_font_t* font, const char* utf8);
+const FontFallbackStats& font_fallback_stats();
+void font_fallback_append_diag(String& out);
@@ -0,0 +1,109 @@
+#include "glyph_cache.h"
+
+#include <string.h>
+
+// 버킷 수: count 이상인 2의 거듭제곱(평균 체인 길이 1 이하).
+static uint16_t bucket_count(uint16_t count) {
+  uint32_t n = 1;
+  while (n < count) n <<= 1;
+  return (uint16_t)(n > 0x8000 ? 0x8000 : n);
+}
+
+GlyphCache::GlyphCache()
+    : entries_(nullptr),
+      buckets_(nullptr),
+      pool_(nullptr),
+      cell_(0),
+      count_(0),
+      used_(0),
+      bucket_mask_(0),
+      head_(kNil),
+      tail_(kNil),
+      evictions_(0) {}
+
+size_t GlyphCache::index_bytes(uint16_t count) {
+  return sizeof(Entry) * count + sizeof(uint16_t) * bucket_count(count);
+}
+
+bool GlyphCache::init(void* index, uint8_t* pool, uint16_t count, uint32_t cell_bytes) {
+  if (!index || !pool || count == 0 || count == kNil || cell_bytes == 0) return false;
+  entries_ = (Entry*)index;
+  const uint16_t nb = bucket_count(count);
+  buckets_ = (uint16_t*)(entries_ + count);
+  memset(buckets_, 0xFF, sizeof(uint16_t) * nb);
+  bucket_mask_ = (uint16_t)(nb - 1);
+  pool_ = pool;
+  cell_ = cell_bytes;
+  count_ = count;
+  used_ = 0;
+  head_ = tail_ = kNil;
+  evictions_ = 0;
+  return true;
+}
+
+uint16_t GlyphCache::bucket_of(uint32_t key) const {
+  // 한글 음절은 연속 구간이라 하위 비트만 써도 고르게 퍼지지만, 크기가 다른 키가 섞여도 되게 한 번 섞는다.
+  return (uint16_t)((key * 2654435761u) >> 16) & bucket_mask_;
+}
+
+void GlyphCache::unlink(uint16_t i) {
+  Entry& e = entries_[i];
+  if (e.prev != kNil) entries_[e.prev].next = e.next;
+  else head_ = e.next;
+  if (e.next != kNil) entries_[e.next].prev = e.prev;
+  else tail_ = e.prev;
+  e.prev = e.next = kNil;
+}
+
+void GlyphCache::push_front(uint16_t i) {
+  Entry& e = entries_[i];
+  e.prev = kNil;
+  e.next = head_;
+  if (head_ != kNil) entries_[head_].prev = i;
+  head_ = i;
+  if (tail_ == kNil) tail_ = i;
+}
+
+void GlyphCache::unchain(uint16_t i) {
+  uint16_t* p = &buckets_[bucket_of(entries_[i].key)];
+  while (*p != kNil) {
+    if (*p == i) {
+      *p = entries_[i].chain;
+      return;
+    }
+    p = &entries_[*p].chain;
+  }
+}
+
+const uint8_t* GlyphCache::find(uint32_t key) {
+  if (!pool_) return nullptr;
+  for (uint16_t i = buckets_[bucket_of(key)]; i != kNil; i = entries_[i].chain) {
+    if (entries_[i].key != key) continue;
+    if (head_ != i) {
+      unlink(i);
+      push_front(i);
+    }
+    return pool_ + (size_t)i * cell_;
+  }
+  return nullptr;
+}
+
+uint8_t* GlyphCache::insert(uint32_t key, uint32_t bytes) {
+  if (!pool_ || bytes > cell_) return nullptr;
+  uint16_t i;
+  if (used_ < count_) {
+    i = used_++;
+  } else {
+    i = tail_;
+    unlink(i);
+    unchain(i);
+    evictions_++;
+  }
+  Entry& e = entries_[i];
+  e.key = key;
+  uint16_t& b = buckets_[bucket_of(key)];
+  e.chain = b;
+  b = i;
+  push_front(i);
+  return pool_ + (size_t)i * cell_;
+}
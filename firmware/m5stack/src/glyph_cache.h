@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 글리프 비트맵 LRU 캐시(폰트 하나·크기 하나당 하나, 키는 코드포인트).
+//
+// tiny_ttf는 get_glyph_bitmap마다 글자를 새로 래스터라이즈한다. 카드가 다시 만들어지거나 목록을 스크롤해
+// 같은 이름·교재명이 다시 그려질 때마다 같은 일을 반복하므로, 결과 비트맵을 고정 크기 칸(cell)에 보관한다.
+//  - 칸 풀은 호출 측이 준다(PSRAM). 칸보다 큰 글리프는 캐시하지 않는다(insert가 nullptr).
+//  - 인덱스(엔트리 + 해시 버킷)는 index_bytes(count)만큼 따로 받는다(내부 RAM 권장, 조회가 잦다).
+//  - find()가 맞으면 MRU로 올린다. 꽉 차면 insert()가 가장 오래 안 쓴 칸을 비운다.
+// 반환한 포인터는 다음 insert() 전까지만 유효하다(LVGL은 받은 비트맵을 바로 그린다).
+// 스레드 안전하지 않다(LVGL 스레드 전용). Arduino 의존이 없어 tools/check_glyph_cache.cpp로 호스트 검증한다.
+
+class GlyphCache {
+ public:
+  static const uint16_t kNil = 0xFFFF;
+
+  GlyphCache();
+
+  static size_t index_bytes(uint16_t count);
+  // count는 1..0xFFFE. index는 index_bytes(count) 바이트, pool은 count * cell_bytes 바이트.
+  bool init(void* index, uint8_t* pool, uint16_t count, uint32_t cell_bytes);
+  bool ready() const { return pool_ != nullptr; }
+
+  const uint8_t* find(uint32_t key);
+  // 비어 있거나 밀려난 칸을 key에 배정해 돌려준다. 호출 측이 bytes만큼 채운다. find()로 없는 걸 확인한 key만.
+  uint8_t* insert(uint32_t key, uint32_t bytes);
+
+  uint16_t count() const { return count_; }
+  uint16_t used() const { return used_; }
+  uint32_t cell_bytes() const { return cell_; }
+  uint32_t evictions() const { return evictions_; }
+
+ private:
+  struct Entry {
+    uint32_t key;
+    uint16_t prev;   // LRU, head_ 쪽이 최근
+    uint16_t next;
+    uint16_t chain;  // 같은 버킷의 다음 엔트리
+  };
+
+  uint16_t bucket_of(uint32_t key) const;
+  void unlink(uint16_t i);
+  void push_front(uint16_t i);
+  void unchain(uint16_t i);
+
+  Entry* entries_;
+  uint16_t* buckets_;
+  uint8_t* pool_;
+  uint32_t cell_;
+  uint16_t count_;
+  uint16_t used_;
+  uint16_t bucket_mask_;
+  uint16_t head_;
+  uint16_t tail_;
+  uint32_t evictions_;
+};
@@ -0,0 +1,1030 @@
+#include "hw_sync.h"
+
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void extract_content_marker_value(const char* content, const char* marker, char* out, size_t out_sz) {
+  if (!out || out_sz == 0) return;
+  out[0] = '\0';
+  if (!content || !*content || !marker || !*marker) return;
+  const char* pos = strstr(content, marker);
+  if (!pos) return;
+  const char* start = pos + strlen(marker);
+  while (*start == ' ' || *start == '\t') start++;
+  const char* end = strchr(start, '\n');
+  size_t len = end ? (size_t)(end - start) : strlen(start);
+  while (len > 0 && (start[len - 1] == ' ' || start[len - 1] == '\r' || start[len - 1] == '\t')) len--;
+  if (len > out_sz - 1) len = out_sz - 1;
+  memcpy(out, start, len);
+  out[len] = '\0';
+}
+
+// 과정명 약어: 공통수학1→공수1, 미적분2→미적2, 확률과 통계→확통 등
+static void abbreviate_course(char* buf, size_t buf_sz) {
+  if (!buf || !buf[0]) return;
+  static const char* const kFull[] = {
+    u8"공통수학1", u8"공통수학2", u8"미적분1", u8"미적분2", u8"확률과 통계", u8"확률과통계"
+  };
+  static const char* const kAbbr[] = {
+    u8"공수1", u8"공수2", u8"미적1", u8"미적2", u8"확통", u8"확통"
+  };
+  for (size_t i = 0; i < sizeof(kFull) / sizeof(kFull[0]); ++i) {
+    if (strcmp(buf, kFull[i]) == 0) {
+      strncpy(buf, kAbbr[i], buf_sz - 1);
+      buf[buf_sz - 1] = '\0';
+      return;
+    }
+  }
+}
+
+// content 원문은 스트리밍 중 그룹 종료까지 들고 있지 않으므로 "과정:"/"교재:" 마커 값만 미리 뽑아 넘긴다.
+static void compose_book_name(const char* content_course, const char* content_book, const char* title,
+                              bool has_linked_book, const char* grade_label, bool is_naesin,
+                              char* out, size_t out_sz) {
+  out[0] = '\0';
+  char book_buf[96] = {0};
+  char course_buf[32] = {0};
+
+  // 과정: grade_label 우선 → content "과정:" → title "·" 뒤
+  if (grade_label && *grade_label) {
+    strncpy(course_buf, grade_label, sizeof(course_buf) - 1);
+    course_buf[sizeof(course_buf) - 1] = '\0';
+  } else {
+    strncpy(course_buf, content_course, sizeof(course_buf) - 1);
+    course_buf[sizeof(course_buf) - 1] = '\0';
+  }
+  if (!course_buf[0] && title && *title) {
+    const char* dot = strstr(title, u8"·");
+    if (dot) {
+      const char* start = dot + strlen(u8"·");
+      while (*start == ' ' || *start == '\t') start++;
+      size_t len = strlen(start);
+      while (len > 0 && (start[len - 1] == ' ' || start[len - 1] == '\t')) len--;
+      if (len > sizeof(course_buf) - 1) len = sizeof(course_buf) - 1;
+      memcpy(course_buf, start, len);
+      course_buf[len] = '\0';
+    }
+  }
+  abbreviate_course(course_buf, sizeof(course_buf));
+
+  // 교재명: 내신기출이면 "내신기출"; 연결된 교재가 없는 문제은행이면 생략.
+  if (is_naesin) {
+    strncpy(book_buf, u8"내신기출", sizeof(book_buf) - 1);
+    book_buf[sizeof(book_buf) - 1] = '\0';
+  } else if (has_linked_book) {
+    strncpy(book_buf, content_book, sizeof(book_buf) - 1);
+    book_buf[sizeof(book_buf) - 1] = '\0';
+    if (!book_buf[0] && title && *title) {
+      const char* dot = strstr(title, u8"·");
+      if (dot) {
+        size_t len = (size_t)(dot - title);
+        while (len > 0 && (title[len - 1] == ' ' || title[len - 1] == '\t')) len--;
+        if (len > sizeof(book_buf) - 1) len = sizeof(book_buf) - 1;
+        memcpy(book_buf, title, len);
+        book_buf[len] = '\0';
+      }
+    }
+  }
+  // else(연결 교재 없음): 교재명 생략
+
+  // 최종 1열: "교재명 · 과정"
+  if (book_buf[0] && course_buf[0]) {
+    if (strstr(book_buf, course_buf)) {
+      strncpy(out, book_buf, out_sz - 1);
+      out[out_sz - 1] = '\0';
+    } else {
+      snprintf(out, out_sz, "%s · %s", book_buf, course_buf);
+    }
+    return;
+  }
+  if (book_buf[0]) {
+    strncpy(out, book_buf, out_sz - 1);
+    out[out_sz - 1] = '\0';
+    return;
+  }
+  if (course_buf[0]) {
+    strncpy(out, course_buf, out_sz - 1);
+    out[out_sz - 1] = '\0';
+    return;
+  }
+  // 비워둠: 연결 교재 없는 문제은행은 1열 교재명 생략(호출부에서 상황에 따라 보완)
+}
+
+static int64_t days_from_civil_utc(int y, unsigned m, unsigned d) {
+  y -= (m <= 2) ? 1 : 0;
+  const int era = (y >= 0 ? y : y - 399) / 400;
+  const unsigned yoe = (unsigned)(y - era * 400);                       // [0, 399]
+  const int mp = (int)m + (m > 2 ? -3 : 9);
+  const unsigned doy = (153u * (unsigned)mp + 2) / 5 + d - 1; // [0, 365]
+  const unsigned doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;        // [0, 146096]
+  return (int64_t)era * 146097 + (int64_t)doe - 719468;                 // days since 1970-01-01
+}
+
+static int64_t parse_iso8601_epoch(const char* iso) {
+  if (!iso || !*iso) return 0;
+  int y = 0, mon = 0, day = 0, hh = 0, mm = 0, ss = 0;
+  int n = 0;
+  if (sscanf(iso, "%4d-%2d-%2dT%2d:%2d:%2d%n", &y, &mon, &day, &hh, &mm, &ss, &n) < 6) {
+    return 0;
+  }
+
+  const char* p = iso + n;
+  if (*p == '.') {
+    p++;
+    while (*p && isdigit((unsigned char)*p)) p++;
+  }
+
+  int tz_sign = 0;
+  int tz_h = 0;
+  int tz_m = 0;
+  if (*p == '+' || *p == '-') {
+    tz_sign = (*p == '-') ? -1 : 1;
+    p++;
+    if (isdigit((unsigned char)p[0]) && isdigit((unsigned char)p[1])) {
+      tz_h = (p[0] - '0') * 10 + (p[1] - '0');
+      p += 2;
+    }
+    if (*p == ':') p++;
+    if (isdigit((unsigned char)p[0]) && isdigit((unsigned char)p[1])) {
+      tz_m = (p[0] - '0') * 10 + (p[1] - '0');
+    }
+  }
+
+  int64_t epoch =
+      days_from_civil_utc(y, (unsigned)mon, (unsigned)day) * 86400LL +
+      (int64_t)hh * 3600LL + (int64_t)mm * 60LL + (int64_t)ss;
+  if (tz_sign != 0) {
+    epoch -= (int64_t)tz_sign * ((int64_t)tz_h * 3600LL + (int64_t)tz_m * 60LL);
+  }
+  return epoch;
+}
+
+static void copy_field(char* dst, size_t dst_sz, const char* src) {
+  strncpy(dst, src ? src : "", dst_sz - 1);
+  dst[dst_sz - 1] = '\0';
+}
+
+// msgpack 정수 키 → 필드 이름. 게이트웨이 m5_wire_codec.js의 M5_HW_WIRE_KEYS와 같은 순서여야 한다
+// (뒤에 추가만 한다). 표에 없는 키는 게이트웨이가 문자열로 보낸다.
+static const char* const kHwWireKeys[] = {
+  "meta", "groups", "order",
+  "sync_seq", "sync_fp", "source", "academy_id", "device_id", "student_id", "published_at", "group_count",
+  "mode", "base_seq", "base_fp",
+  "group_id", "group_title", "page_summary", "order_index", "is_homework", "is_test", "is_naesin",
+  "pending_complete", "phase", "accumulated", "cycle_elapsed", "check_count", "total_count",
+  "time_limit_minutes", "color", "run_start", "content", "type", "book_id", "grade_label", "m5_wait_title",
+  "children", "item_id", "title", "page", "memo", "count",
+};
+static const uint32_t kHwWireKeyCount = sizeof(kHwWireKeys) / sizeof(kHwWireKeys[0]);
+
+// ---------------------------------------------------------------------------
+// HwStreamDecoder
+// ---------------------------------------------------------------------------
+
+void HwStreamDecoder::reset(HwSyncFrame* frame, AppliedCheck check, void* check_ctx, const HwSyncFrame* base) {
+  frame_ = frame;
+  check_ = check;
+  check_ctx_ = check_ctx;
+  base_ = base;
+  groups_seen_ = false;
+  skip_groups_ = false;
+  started_ = false;
+  msgpack_ = false;
+  mp_state_ = MP_HEAD;
+  order_seen_ = false;
+  error_ = false;
+  order_cnt_ = 0;
+  slot_filled_ = 0;
+  cur_grp_ = nullptr;
+  if (frame_) {
+    frame_->group_cnt = 0;
+    frame_->unchanged = false;
+    frame_->patch_rejected = false;
+    memset(&frame_->meta, 0, sizeof(frame_->meta));
+  }
+  lex_ = LX_WS;
+  depth_ = 0;
+  expect_key_ = false;
+  closed_root_ = false;
+  key_[0] = '\0';
+  str_len_ = 0;
+  str_overflow_ = false;
+  num_len_ = 0;
+  uni_high_ = 0;
+  truncated_ = 0;
+  grp_active_ = false;
+  child_active_ = false;
+}
+
+void HwStreamDecoder::str_put(char c) {
+  if (str_len_ < kStrMax - 1) {
+    str_[str_len_++] = c;
+  } else if (!str_overflow_) {
+    str_overflow_ = true;
+    truncated_++;
+  }
+}
+
+void HwStreamDecoder::put_utf8(uint32_t cp) {
+  if (cp < 0x80) {
+    str_put((char)cp);
+  } else if (cp < 0x800) {
+    str_put((char)(0xC0 | (cp >> 6)));
+    str_put((char)(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    str_put((char)(0xE0 | (cp >> 12)));
+    str_put((char)(0x80 | ((cp >> 6) & 0x3F)));
+    str_put((char)(0x80 | (cp & 0x3F)));
+  } else {
+    str_put((char)(0xF0 | (cp >> 18)));
+    str_put((char)(0x80 | ((cp >> 12) & 0x3F)));
+    str_put((char)(0x80 | ((cp >> 6) & 0x3F)));
+    str_put((char)(0x80 | (cp & 0x3F)));
+  }
+}
+
+bool HwStreamDecoder::feed(const char* p, size_t len) {
+  if (!frame_) return false;
+  for (size_t i = 0; i < len; ++i) {
+    // 이미 적용한 스냅샷이면 나머지 바이트는 볼 필요가 없다.
+    if (skip_groups_) return true;
+    if (!started_) {
+      // JSON은 '{'(또는 공백)로 시작하고, msgpack 루트 map은 0x80~0x8f/0xde/0xdf로 시작한다.
+      const uint8_t b = (uint8_t)p[i];
+      started_ = true;
+      msgpack_ = (b >= 0x80 && b <= 0x8f) || b == 0xde || b == 0xdf;
+    }
+    if (!(msgpack_ ? mp_step((uint8_t)p[i]) : step(p[i]))) {
+      lex_ = LX_ERROR;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool HwStreamDecoder::step(char c) {
+  if (error_) return false;
+  switch (lex_) {
+    case LX_ERROR:
+      return false;
+    case LX_STRING:
+      if (c == '"') {
+        str_[str_len_] = '\0';
+        lex_ = LX_WS;
+        if (depth_ > 0 && is_obj_[depth_ - 1] && expect_key_) {
+          copy_field(key_, sizeof(key_), str_);
+          expect_key_ = false;
+        } else {
+          on_scalar(V_STRING);
+        }
+      } else if (c == '\\') {
+        lex_ = LX_ESCAPE;
+      } else if ((uint8_t)c < 0x20) {
+        return false;
+      } else {
+        str_put(c);
+      }
+      return true;
+    case LX_ESCAPE:
+      lex_ = LX_STRING;
+      switch (c) {
+        case '"': case '\\': case '/': str_put(c); return true;
+        case 'b': str_put('\b'); return true;
+        case 'f': str_put('\f'); return true;
+        case 'n': str_put('\n'); return true;
+        case 'r': str_put('\r'); return true;
+        case 't': str_put('\t'); return true;
+        case 'u': lex_ = LX_UNICODE; uni_acc_ = 0; uni_digits_ = 0; return true;
+        default: return false;
+      }
+    case LX_UNICODE: {
+      uint8_t v;
+      if (c >= '0' && c <= '9') v = (uint8_t)(c - '0');
+      else if (c >= 'a' && c <= 'f') v = (uint8_t)(c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F') v = (uint8_t)(c - 'A' + 10);
+      else return false;
+      uni_acc_ = (uint16_t)((uni_acc_ << 4) | v);
+      if (++uni_digits_ < 4) return true;
+      lex_ = LX_STRING;
+      if (uni_acc_ >= 0xD800 && uni_acc_ <= 0xDBFF) {
+        uni_high_ = uni_acc_;
+      } else if (uni_acc_ >= 0xDC00 && uni_acc_ <= 0xDFFF) {
+        if (uni_high_) put_utf8(0x10000u + (((uint32_t)uni_high_ - 0xD800u) << 10) + ((uint32_t)uni_acc_ - 0xDC00u));
+        uni_high_ = 0;
+      } else {
+        put_utf8(uni_acc_);
+        uni_high_ = 0;
+      }
+      return true;
+    }
+    case LX_NUMBER:
+      if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+        if (num_len_ >= sizeof(num_) - 1) return false;
+        num_[num_len_++] = c;
+        return true;
+      } else {
+        num_[num_len_] = '\0';
+        char* end = nullptr;
+        num_val_ = strtod(num_, &end);
+        if (end != num_ + num_len_) return false;
+        lex_ = LX_WS;
+        on_scalar(V_NUMBER);
+      }
+      break;  // 종료 문자는 아래에서 다시 처리
+    case LX_LITERAL:
+      if (c >= 'a' && c <= 'z') {
+        if (num_len_ >= 5) return false;
+        num_[num_len_++] = c;
+        return true;
+      } else {
+        num_[num_len_] = '\0';
+        lex_ = LX_WS;
+        if (strcmp(num_, "true") == 0) { bool_val_ = true; on_scalar(V_BOOL); }
+        else if (strcmp(num_, "false") == 0) { bool_val_ = false; on_scalar(V_BOOL); }
+        else if (strcmp(num_, "null") == 0) { on_scalar(V_NULL); }
+        else return false;
+      }
+      break;
+    case LX_DONE:
+      return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    case LX_WS:
+      break;
+  }
+
+  switch (c) {
+    case ' ': case '\t': case '\r': case '\n':
+      return true;
+    case '{':
+      if (depth_ >= kMaxDepth) return false;
+      begin_container(true);
+      expect_key_ = true;
+      return true;
+    case '[':
+      if (depth_ >= kMaxDepth) return false;
+      begin_container(false);
+      expect_key_ = false;
+      return true;
+    case '}':
+      return end_container(true);
+    case ']':
+      return end_container(false);
+    case ',':
+      expect_key_ = depth_ > 0 && is_obj_[depth_ - 1];
+      return true;
+    case ':':
+      expect_key_ = false;
+      return true;
+    case '"':
+      lex_ = LX_STRING;
+      str_len_ = 0;
+      str_overflow_ = false;
+      uni_high_ = 0;
+      return true;
+    case 't': case 'f': case 'n':
+      if (depth_ == 0) return false;
+      lex_ = LX_LITERAL;
+      num_len_ = 0;
+      num_[num_len_++] = c;
+      return true;
+    default:
+      if (c == '-' || (c >= '0' && c <= '9')) {
+        if (depth_ == 0) return false;
+        lex_ = LX_NUMBER;
+        num_len_ = 0;
+        num_[num_len_++] = c;
+        return true;
+      }
+      return false;
+  }
+}
+
+bool HwStreamDecoder::mp_step(uint8_t b) {
+  // 루트 map이 닫힌 뒤의 바이트는 오류
+  if (error_ || lex_ == LX_DONE) return false;
+  switch (mp_state_) {
+    case MP_HEAD:
+      return mp_head(b);
+    case MP_STR:
+      str_put((char)b);
+      if (--mp_remain_ == 0) return mp_str_end();
+      return true;
+    case MP_LEN:
+    case MP_NUM:
+      break;
+  }
+  mp_buf_[mp_got_++] = b;
+  if (mp_got_ < mp_need_) return true;
+  uint64_t u = 0;
+  for (uint8_t i = 0; i < mp_need_; ++i) u = (u << 8) | mp_buf_[i];
+  if (mp_state_ == MP_LEN) {
+    mp_state_ = MP_HEAD;
+    if (u > 0x7FFFFFFFu) return false;
+    switch (mp_type_) {
+      case 0xd9: case 0xda: case 0xdb: return mp_str_begin((uint32_t)u);
+      case 0xdc: case 0xdd: return mp_open(false, (uint32_t)u);
+      default: return mp_open(true, (uint32_t)u);
+    }
+  }
+  mp_state_ = MP_HEAD;
+  switch (mp_type_) {
+    case 0xca: { uint32_t bits = (uint32_t)u; float f; memcpy(&f, &bits, sizeof(f)); num_val_ = f; break; }
+    case 0xcb: { double d; memcpy(&d, &u, sizeof(d)); num_val_ = d; break; }
+    case 0xd0: num_val_ = (int8_t)u; break;
+    case 0xd1: num_val_ = (int16_t)u; break;
+    case 0xd2: num_val_ = (int32_t)u; break;
+    case 0xd3: num_val_ = (double)(int64_t)u; break;
+    default: num_val_ = (double)u; break;  // 0xcc~0xcf
+  }
+  return mp_scalar(V_NUMBER);
+}
+
+bool HwStreamDecoder::mp_head(uint8_t b) {
+  if (b <= 0x7f) { num_val_ = b; return mp_scalar(V_NUMBER); }
+  if (b <= 0x8f) return mp_open(true, b & 0x0f);
+  if (b <= 0x9f) return mp_open(false, b & 0x0f);
+  if (b <= 0xbf) return mp_str_begin(b & 0x1f);
+  if (b >= 0xe0) { num_val_ = (int8_t)b; return mp_scalar(V_NUMBER); }
+  mp_type_ = b;
+  mp_got_ = 0;
+  switch (b) {
+    case 0xc0: return mp_scalar(V_NULL);
+    case 0xc2: bool_val_ = false; return mp_scalar(V_BOOL);
+    case 0xc3: bool_val_ = true; return mp_scalar(V_BOOL);
+    case 0xcc: case 0xd0: mp_need_ = 1; mp_state_ = MP_NUM; return true;
+    case 0xcd: case 0xd1: mp_need_ = 2; mp_state_ = MP_NUM; return true;
+    case 0xca: case 0xce: case 0xd2: mp_need_ = 4; mp_state_ = MP_NUM; return true;
+    case 0xcb: case 0xcf: case 0xd3: mp_need_ = 8; mp_state_ = MP_NUM; return true;
+    case 0xd9: mp_need_ = 1; mp_state_ = MP_LEN; return true;
+    case 0xda: case 0xdc: case 0xde: mp_need_ = 2; mp_state_ = MP_LEN; return true;
+    case 0xdb: case 0xdd: case 0xdf: mp_need_ = 4; mp_state_ = MP_LEN; return true;
+    default: return false;  // bin/ext는 게이트웨이가 쓰지 않는다
+  }
+}
+
+// map의 남은 항목 수는 키+값 단위라 짝수면 다음은 키다.
+bool HwStreamDecoder::mp_is_key() const {
+  return depth_ > 0 && is_obj_[depth_ - 1] && (mp_left_[depth_ - 1] & 1u) == 0;
+}
+
+bool HwStreamDecoder::mp_scalar(ValKind kind) {
+  if (depth_ == 0) return false;
+  if (mp_is_key()) {
+    if (kind != V_NUMBER || num_val_ < 0) return false;
+    return mp_int_key((uint32_t)num_val_);
+  }
+  on_scalar(kind);
+  return mp_item_done();
+}
+
+bool HwStreamDecoder::mp_int_key(uint32_t idx) {
+  copy_field(key_, sizeof(key_), idx < kHwWireKeyCount ? kHwWireKeys[idx] : "");
+  return mp_item_done();
+}
+
+bool HwStreamDecoder::mp_str_begin(uint32_t n) {
+  str_len_ = 0;
+  str_overflow_ = false;
+  if (n == 0) return mp_str_end();
+  mp_remain_ = n;
+  mp_state_ = MP_STR;
+  return true;
+}
+
+bool HwStreamDecoder::mp_str_end() {
+  mp_state_ = MP_HEAD;
+  str_[str_len_] = '\0';
+  if (depth_ == 0) return false;
+  if (mp_is_key()) {
+    copy_field(key_, sizeof(key_), str_);
+  } else {
+    on_scalar(V_STRING);
+  }
+  return mp_item_done();
+}
+
+bool HwStreamDecoder::mp_open(bool is_object, uint32_t n) {
+  if (depth_ >= kMaxDepth || mp_is_key()) return false;
+  begin_container(is_object);
+  mp_left_[depth_ - 1] = is_object ? n * 2 : n;
+  if (n > 0) return !error_;
+  if (!end_container(is_object)) return false;
+  return mp_item_done();
+}
+
+// 값 하나(또는 키 하나)를 끝냈다. 남은 항목이 0이 된 컨테이너는 바깥쪽으로 차례로 닫는다.
+bool HwStreamDecoder::mp_item_done() {
+  while (depth_ > 0) {
+    if (--mp_left_[depth_ - 1] != 0) break;
+    if (!end_container(is_obj_[depth_ - 1])) return false;
+  }
+  return !error_;
+}
+
+void HwStreamDecoder::begin_container(bool is_object) {
+  Ctx next = CX_SKIP;
+  if (depth_ == 0) {
+    next = is_object ? CX_ROOT : CX_SKIP;
+  } else {
+    switch (ctx_[depth_ - 1]) {
+      case CX_ROOT:
+        if (!is_object && strcmp(key_, "groups") == 0) {
+          groups_seen_ = true;
+          // patch는 meta → order → groups 순서여야 항목을 제자리에 병합할 수 있다.
+          if (frame_->meta.patch && !order_seen_) error_ = true;
+          next = skip_groups_ ? CX_SKIP : CX_GROUPS;
+        } else if (!is_object && strcmp(key_, "order") == 0) {
+          order_seen_ = true;
+          next = CX_ORDER;
+        } else if (is_object && strcmp(key_, "meta") == 0) {
+          next = CX_META;
+          frame_->meta.present = true;
+        }
+        break;
+      case CX_GROUPS:
+        if (!is_object) break;
+        if (frame_->meta.patch) {
+          next = CX_GROUP;
+          group_begin();
+        } else if (frame_->group_cnt < HW_MAX_GROUPS) {
+          next = CX_GROUP;
+          group_begin();
+        }
+        break;
+      case CX_GROUP:
+        if (!is_object && strcmp(key_, "children") == 0) {
+          // children은 항상 통째로 교체된다(patch 포함).
+          if (!cur_grp_) { error_ = true; break; }
+          cur_grp_->child_cnt = 0;
+          next = CX_CHILDREN;
+        }
+        break;
+      case CX_CHILDREN:
+        if (is_object && cur_grp_ && cur_grp_->child_cnt < HW_MAX_CHILDREN) {
+          next = CX_CHILD;
+          HwChildEntry& ce = cur_grp_->children[cur_grp_->child_cnt];
+          memset(&ce, 0, sizeof(ce));
+          ce.phase = 1;
+          child_active_ = true;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  ctx_[depth_] = next;
+  is_obj_[depth_] = is_object;
+  depth_++;
+}
+
+bool HwStreamDecoder::end_container(bool is_object) {
+  if (depth_ == 0 || is_obj_[depth_ - 1] != is_object) return false;
+  const Ctx c = ctx_[depth_ - 1];
+  depth_--;
+  expect_key_ = false;
+  if (c == CX_GROUP) {
+    group_end();
+  } else if (c == CX_META) {
+    meta_end();
+  } else if (c == CX_CHILD && child_active_) {
+    cur_grp_->child_cnt++;
+    child_active_ = false;
+  }
+  if (depth_ == 0) {
+    closed_root_ = (c == CX_ROOT);
+    lex_ = LX_DONE;
+  }
+  return !error_;
+}
+
+void HwStreamDecoder::on_scalar(ValKind kind) {
+  if (depth_ == 0) return;
+  const Ctx c = ctx_[depth_ - 1];
+  if (c == CX_ORDER) {
+    if (kind != V_STRING || order_cnt_ >= HW_MAX_GROUPS) { error_ = true; return; }
+    copy_field(order_[order_cnt_], sizeof(order_[0]), str_);
+    order_cnt_++;
+    return;
+  }
+  if (!is_obj_[depth_ - 1]) return;
+  switch (c) {
+    case CX_GROUP: group_field(kind); break;
+    case CX_CHILD: if (child_active_) child_field(kind); break;
+    case CX_META: meta_field(kind); break;
+    default: break;
+  }
+}
+
+void HwStreamDecoder::meta_end() {
+  HwSyncMeta& m = frame_->meta;
+  // patch인데 groups를 이미 전체 스냅샷으로 읽어 버렸다면 되돌릴 수 없다.
+  if (m.patch && groups_seen_) { error_ = true; return; }
+  if (check_ && check_(m, check_ctx_)) {
+    frame_->unchanged = true;
+    // meta가 먼저 왔다면 뒤따르는 groups는 토큰화조차 하지 않는다(feed/finish 참고).
+    if (!groups_seen_) skip_groups_ = true;
+    return;
+  }
+  if (m.patch) {
+    // 병합 기준은 이 디코더가 마지막으로 완성한 스냅샷이다. 게이트웨이가 잡은 기준과
+    // 다르면 적용하지 않고 loop()에서 ok:false ack로 전체 스냅샷을 요청한다.
+    if (!base_ || !base_->meta.sync_fp[0] || !m.base_fp[0] ||
+        strcmp(base_->meta.sync_fp, m.base_fp) != 0 ||
+        strcmp(base_->meta.student_id, m.student_id) != 0) {
+      frame_->patch_rejected = true;
+      skip_groups_ = true;
+    }
+  }
+}
+
+const HwGroupData* HwStreamDecoder::find_base_group(const char* group_id) const {
+  if (!base_) return nullptr;
+  for (uint8_t i = 0; i < base_->group_cnt; i++) {
+    if (strcmp(base_->groups[i].group_id, group_id) == 0) return &base_->groups[i];
+  }
+  return nullptr;
+}
+
+// ArduinoJson의 (int)/(double) 변환과 같은 규칙: 숫자·불리언·숫자 문자열만 값으로 본다.
+static int scalar_int(bool is_num, bool is_bool, bool is_str, double num, bool b, const char* s) {
+  if (is_num) return (int)num;
+  if (is_bool) return b ? 1 : 0;
+  if (is_str) return (int)strtod(s, nullptr);
+  return 0;
+}
+
+static void init_group_defaults(HwGroupData& g) {
+  memset(&g, 0, sizeof(g));
+  copy_field(g.group_title, sizeof(g.group_title), u8"과제 그룹");
+  g.phase = 1;
+  g.color = 0x1E88E5;
+}
+
+#define HW_KEY(k) (strcmp(key_, (k)) == 0)
+#define HW_INT() scalar_int(kind == V_NUMBER, kind == V_BOOL, kind == V_STRING, num_val_, bool_val_, str_)
+
+void HwStreamDecoder::group_begin() {
+  grp_active_ = true;
+  grp_has_order_ = false;
+  grp_has_book_id_ = false;
+  grp_derived_seen_ = false;
+  grp_from_base_ = false;
+  grp_grade_label_[0] = '\0';
+  grp_content_course_[0] = '\0';
+  grp_content_book_[0] = '\0';
+  if (frame_->meta.patch) {
+    // 어느 자리에 병합할지는 첫 키(group_id)를 읽어야 안다.
+    cur_grp_ = nullptr;
+    grp_slot_ = 0;
+    return;
+  }
+  grp_slot_ = frame_->group_cnt;
+  cur_grp_ = &frame_->groups[grp_slot_];
+  init_group_defaults(*cur_grp_);
+}
+
+// patch 항목의 첫 키(group_id)로 order 상 위치를 찾고 기준 그룹을 복사해 둔다.
+bool HwStreamDecoder::patch_entry_bind(ValKind kind) {
+  if (!HW_KEY("group_id") || kind != V_STRING) return false;
+  for (uint8_t i = 0; i < order_cnt_; i++) {
+    if (strcmp(order_[i], str_) != 0) continue;
+    if (slot_filled_ & (1u << i)) return false;
+    slot_filled_ |= (uint16_t)(1u << i);
+    grp_slot_ = i;
+    cur_grp_ = &frame_->groups[i];
+    const HwGroupData* base = find_base_group(str_);
+    if (base) {
+      *cur_grp_ = *base;
+      grp_from_base_ = true;
+    } else {
+      init_group_defaults(*cur_grp_);
+    }
+    copy_field(cur_grp_->group_id, sizeof(cur_grp_->group_id), str_);
+    return true;
+  }
+  return false;
+}
+
+// 각 필드는 값이 오면 그 값(형이 맞지 않으면 기본값)으로 덮어쓴다.
+// 전체 스냅샷에서는 기본값에서 시작하므로 종전 파서와 같고, patch에서는 기준값을 대체한다.
+void HwStreamDecoder::group_field(ValKind kind) {
+  if (!cur_grp_) {
+    if (!patch_entry_bind(kind)) error_ = true;
+    return;
+  }
+  HwGroupData& g = *cur_grp_;
+  const bool is_str = (kind == V_STRING);
+  if (HW_KEY("group_id")) {
+    copy_field(g.group_id, sizeof(g.group_id), is_str ? str_ : "");
+  } else if (HW_KEY("group_title")) {
+    grp_derived_seen_ = true;
+    copy_field(g.group_title, sizeof(g.group_title), is_str ? str_ : u8"과제 그룹");
+  } else if (HW_KEY("page_summary")) {
+    copy_field(g.page_summary, sizeof(g.page_summary), is_str ? str_ : "");
+  } else if (HW_KEY("order_index")) {
+    grp_has_order_ = true;
+    g.order_index = (int16_t)HW_INT();
+  } else if (HW_KEY("is_homework")) {
+    g.is_homework = kind == V_BOOL && bool_val_;
+  } else if (HW_KEY("is_test")) {
+    g.is_test = kind == V_BOOL && bool_val_;
+  } else if (HW_KEY("is_naesin")) {
+    grp_derived_seen_ = true;
+    g.is_naesin = kind == V_BOOL && bool_val_;
+  } else if (HW_KEY("pending_complete")) {
+    g.pending_complete = kind == V_BOOL && bool_val_;
+  } else if (HW_KEY("phase")) {
+    g.phase = (int8_t)HW_INT();
+  } else if (HW_KEY("accumulated")) {
+    g.accumulated = HW_INT();
+  } else if (HW_KEY("cycle_elapsed")) {
+    g.cycle_elapsed = HW_INT();
+  } else if (HW_KEY("check_count")) {
+    g.check_count = (int16_t)HW_INT();
+  } else if (HW_KEY("total_count")) {
+    g.total_count = (int16_t)HW_INT();
+  } else if (HW_KEY("time_limit_minutes")) {
+    int tlm = kind != V_NULL ? HW_INT() : 0;
+    if (tlm < 0) tlm = 0;
+    if (tlm > 24 * 60) tlm = 24 * 60;
+    g.time_limit_minutes = (int16_t)tlm;
+  } else if (HW_KEY("color")) {
+    double v = kind == V_NUMBER ? num_val_ : (is_str ? strtod(str_, nullptr) : (kind == V_BOOL && bool_val_ ? 1.0 : 0.0));
+    g.color = v > 0 ? (((uint32_t)v) & 0xFFFFFFu) : 0x1E88E5;
+  } else if (HW_KEY("run_start")) {
+    // msgpack은 epoch 초(숫자), JSON은 ISO 문자열
+    if (kind == V_NUMBER) g.run_start_epoch = num_val_ > 0 ? (int64_t)num_val_ : 0;
+    else g.run_start_epoch = (is_str && str_[0]) ? parse_iso8601_epoch(str_) : 0;
+  } else if (HW_KEY("content")) {
+    grp_derived_seen_ = true;
+    extract_content_marker_value(is_str ? str_ : "", u8"과정:", grp_content_course_, sizeof(grp_content_course_));
+    extract_content_marker_value(is_str ? str_ : "", u8"교재:", grp_content_book_, sizeof(grp_content_book_));
+  } else if (HW_KEY("type")) {
+    grp_derived_seen_ = true;
+    copy_field(g.item_type, sizeof(g.item_type), is_str ? str_ : "");
+  } else if (HW_KEY("book_id")) {
+    grp_derived_seen_ = true;
+    grp_has_book_id_ = is_str && str_[0];
+  } else if (HW_KEY("grade_label")) {
+    grp_derived_seen_ = true;
+    copy_field(grp_grade_label_, sizeof(grp_grade_label_), is_str ? str_ : "");
+  } else if (HW_KEY("m5_wait_title")) {
+    copy_field(g.m5_wait_title, sizeof(g.m5_wait_title), is_str ? str_ : "");
+  }
+}
+
+void HwStreamDecoder::group_end() {
+  if (!grp_active_) return;
+  grp_active_ = false;
+  if (!cur_grp_) {
+    // group_id 없는 patch 항목
+    error_ = true;
+    return;
+  }
+  HwGroupData& g = *cur_grp_;
+  if (!grp_from_base_ && !grp_has_order_) g.order_index = (int16_t)grp_slot_;
+  // patch에서 파생 필드가 하나도 오지 않았으면 기준 그룹의 book_name을 그대로 쓴다.
+  // 하나라도 바뀌면 게이트웨이가 파생 필드 전부를 함께 보낸다.
+  if (!grp_from_base_ || grp_derived_seen_) {
+    compose_book_name(grp_content_course_, grp_content_book_, g.group_title, grp_has_book_id_,
+                      grp_grade_label_, g.is_naesin, g.book_name, sizeof(g.book_name));
+    // 연결 교재가 있거나 내신기출인데 파싱 실패한 경우에만 그룹명으로 보완.
+    // 연결 교재 없는 문제은행은 1열 교재명을 의도적으로 비워둔다.
+    if (!g.book_name[0] && (grp_has_book_id_ || g.is_naesin)) {
+      copy_field(g.book_name, sizeof(g.book_name), g.group_title);
+    }
+  }
+  if (!frame_->meta.patch) frame_->group_cnt++;
+  cur_grp_ = nullptr;
+}
+
+void HwStreamDecoder::child_field(ValKind kind) {
+  HwChildEntry& ce = cur_grp_->children[cur_grp_->child_cnt];
+  const bool is_str = (kind == V_STRING);
+  if (HW_KEY("item_id")) {
+    if (is_str) copy_field(ce.item_id, sizeof(ce.item_id), str_);
+  } else if (HW_KEY("title")) {
+    if (is_str) copy_field(ce.title, sizeof(ce.title), str_);
+  } else if (HW_KEY("page")) {
+    if (is_str) copy_field(ce.page, sizeof(ce.page), str_);
+  } else if (HW_KEY("memo")) {
+    if (is_str) copy_field(ce.memo, sizeof(ce.memo), str_);
+  } else if (HW_KEY("count")) {
+    ce.count = (int16_t)HW_INT();
+  } else if (HW_KEY("check_count")) {
+    ce.check_count = (int16_t)HW_INT();
+  } else if (HW_KEY("phase")) {
+    ce.phase = (int8_t)HW_INT();
+  } else if (HW_KEY("accumulated")) {
+    ce.accumulated = HW_INT();
+  }
+}
+
+void HwStreamDecoder::meta_field(ValKind kind) {
+  HwSyncMeta& m = frame_->meta;
+  const bool is_str = (kind == V_STRING);
+  if (HW_KEY("sync_fp")) {
+    if (is_str) copy_field(m.sync_fp, sizeof(m.sync_fp), str_);
+  } else if (HW_KEY("sync_seq")) {
+    if (kind == V_NUMBER && num_val_ >= 0) m.sync_seq = (unsigned long)num_val_;
+  } else if (HW_KEY("source")) {
+    if (is_str) copy_field(m.source, sizeof(m.source), str_);
+  } else if (HW_KEY("student_id")) {
+    if (is_str) copy_field(m.student_id, sizeof(m.student_id), str_);
+  } else if (HW_KEY("mode")) {
+    m.patch = is_str && strcmp(str_, "patch") == 0;
+  } else if (HW_KEY("base_fp")) {
+    if (is_str) copy_field(m.base_fp, sizeof(m.base_fp), str_);
+  } else if (HW_KEY("base_seq")) {
+    if (kind == V_NUMBER && num_val_ >= 0) m.base_seq = (unsigned long)num_val_;
+  }
+}
+
+#undef HW_INT
+#undef HW_KEY
+
+bool HwStreamDecoder::finish() {
+  if (frame_ && skip_groups_) return true;
+  if (!frame_ || error_ || lex_ != LX_DONE || !closed_root_) return false;
+  if (frame_->meta.patch) {
+    // 항목이 오지 않은 자리는 기준 스냅샷의 같은 그룹을 그대로 쓴다.
+    for (uint8_t i = 0; i < order_cnt_; i++) {
+      if (slot_filled_ & (1u << i)) continue;
+      const HwGroupData* base = find_base_group(order_[i]);
+      if (!base) return false;
+      frame_->groups[i] = *base;
+    }
+    frame_->group_cnt = order_cnt_;
+  }
+  // 정렬: order_index → group_id (학습앱과 동일 순서). 숙제도 뒤로 밀지 않는다.
+  HwGroupData* groups = frame_->groups;
+  for (uint8_t i = 1; i < frame_->group_cnt; i++) {
+    HwGroupData key = groups[i];
+    int j = (int)i - 1;
+    while (j >= 0 &&
+           (groups[j].order_index > key.order_index ||
+            (groups[j].order_index == key.order_index &&
+             strcmp(groups[j].group_id, key.group_id) > 0))) {
+      groups[j + 1] = groups[j];
+      j--;
+    }
+    groups[j + 1] = key;
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// HwSyncStream
+// ---------------------------------------------------------------------------
+
+bool HwSyncStream::begin() {
+  if (frames_[0]) return true;
+  for (uint8_t i = 0; i < kFrameCount; ++i) {
+    void* p = heap_caps_calloc(1, sizeof(HwSyncFrame), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!p) p = heap_caps_calloc(1, sizeof(HwSyncFrame), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!p) return false;
+    frames_[i] = (HwSyncFrame*)p;
+    free_.push(i);
+  }
+  void* b = heap_caps_calloc(1, sizeof(HwSyncFrame), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!b) b = heap_caps_calloc(1, sizeof(HwSyncFrame), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  // 기준 프레임이 없어도 전체 스냅샷은 동작한다(patch만 모두 거부).
+  base_ = (HwSyncFrame*)b;
+  return true;
+}
+
+bool HwSyncStream::acquire_frame(uint8_t& idx) {
+  if (spare_cnt_ > 0) {
+    idx = spare_[--spare_cnt_];
+    return true;
+  }
+  return free_.pop(idx);
+}
+
+void HwSyncStream::recycle(uint8_t idx) {
+  if (spare_cnt_ < kFrameCount) spare_[spare_cnt_++] = idx;
+}
+
+void HwSyncStream::abandon() {
+  if (cur_ >= 0) recycle((uint8_t)cur_);
+  cur_ = -1;
+  expected_ = 0;
+  received_ = 0;
+}
+
+bool HwSyncStream::on_chunk(const char* payload, size_t len, size_t index, size_t total, uint32_t now_ms) {
+  if (index == 0) {
+    // 이전 메시지가 끝나지 않은 채 새 메시지가 시작되면 이전 것은 버린다.
+    abandon();
+    dropping_ = false;
+    failed_ = false;
+    uint8_t f = 0;
+    if (!frames_[0] || !acquire_frame(f)) {
+      stats_.dropped++;
+      dropping_ = true;
+      return false;
+    }
+    cur_ = (int8_t)f;
+    expected_ = total;
+    received_ = 0;
+    dec_.reset(frames_[f], &HwSyncStream::is_applied, this, base_);
+    frames_[f]->bytes = (uint32_t)total;
+    frames_[f]->decode_us = 0;
+  } else if (dropping_ || cur_ < 0 || index != received_) {
+    if (!dropping_) stats_.dropped++;
+    abandon();
+    dropping_ = true;
+    return false;
+  }
+
+  HwSyncFrame* fr = frames_[cur_];
+  int64_t t0 = esp_timer_get_time();
+  if (!failed_ && !dec_.feed(payload, len)) failed_ = true;
+  received_ += len;
+  bool ok = false;
+  const bool complete = received_ >= expected_;
+  if (complete) ok = !failed_ && dec_.finish();
+  fr->decode_us += (uint32_t)(esp_timer_get_time() - t0);
+  if (!complete) return false;
+
+  fr->rx_ms = now_ms;
+  fr->msgpack = dec_.msgpack();
+  stats_.last_decode_us = fr->decode_us;
+  if (fr->decode_us > stats_.max_decode_us) stats_.max_decode_us = fr->decode_us;
+  stats_.last_bytes = (uint32_t)received_;
+  const uint8_t idx = (uint8_t)cur_;
+  cur_ = -1;
+  expected_ = 0;
+  received_ = 0;
+  if (!ok) {
+    stats_.parse_errors++;
+    recycle(idx);
+    return false;
+  }
+  if (fr->patch_rejected) {
+    stats_.patch_rejects++;
+  } else if (!fr->unchanged) {
+    if (fr->meta.patch) stats_.patches++;
+    // 다음 patch의 기준. 그룹 배열은 정렬된 채로 두어도 병합은 group_id로 찾는다.
+    if (base_) {
+      memcpy(base_->groups, fr->groups, sizeof(HwGroupData) * fr->group_cnt);
+      base_->group_cnt = fr->group_cnt;
+      base_->meta = fr->meta;
+    }
+  }
+  if (!ready_.push(idx)) {
+    stats_.dropped++;
+    recycle(idx);
+    return false;
+  }
+  if (fr->unchanged) stats_.unchanged++;
+  if (fr->msgpack) stats_.msgpack_frames++;
+  stats_.frames++;
+  return true;
+}
+
+HwSyncFrame* HwSyncStream::take() {
+  uint8_t idx = 0;
+  uint8_t latest = 0;
+  bool have = false;
+  while (ready_.pop(idx)) {
+    if (have) {
+      free_.push(latest);
+      stats_.coalesced++;
+    }
+    latest = idx;
+    have = true;
+  }
+  return have ? frames_[latest] : nullptr;
+}
+
+void HwSyncStream::release(HwSyncFrame* frame) {
+  for (uint8_t i = 0; i < kFrameCount; ++i) {
+    if (frames_[i] == frame) {
+      free_.push(i);
+      return;
+    }
+  }
+}
+
+void HwSyncStream::set_applied(const char* student_id, const char* sync_fp) {
+  portENTER_CRITICAL(&applied_mux_);
+  copy_field(applied_student_, sizeof(applied_student_), student_id);
+  copy_field(applied_fp_, sizeof(applied_fp_), sync_fp);
+  portEXIT_CRITICAL(&applied_mux_);
+}
+
+bool HwSyncStream::is_applied(const HwSyncMeta& meta, void* ctx) {
+  HwSyncStream* self = (HwSyncStream*)ctx;
+  if (!meta.sync_fp[0]) return false;
+  bool same;
+  portENTER_CRITICAL(&self->applied_mux_);
+  same = self->applied_fp_[0] &&
+         strcmp(self->applied_fp_, meta.sync_fp) == 0 &&
+         strcmp(self->applied_student_, meta.student_id) == 0;
+  portEXIT_CRITICAL(&self->applied_mux_);
+  return same;
+}
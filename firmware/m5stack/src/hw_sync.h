@@ -0,0 +1,256 @@
+#pragma once
+
+#include <Arduino.h>
+#include "mqtt_rx_queue.h"
+
+// homeworks 토픽 스트리밍 디코더.
+//
+// MQTT 청크가 도착하는 즉시 한 글자씩 토큰화해 스테이징 HwGroupData 배열을 바로 채운다.
+// 재조립 버퍼(String)와 DOM(DynamicJsonDocument)이 없으므로 동기화 1회의 힙 사용량이
+// 페이로드 크기와 무관하게 고정된다(프레임 풀 + 디코더 상태).
+// 완성된 프레임은 SPSC 링으로 loop()에 넘기고, loop()는 s_groups로 복사만 한다.
+//
+// 게이트웨이는 바뀐 그룹만 담은 patch(meta.mode="patch")도 보낸다.
+// {"meta":{...,"base_fp"},"order":[group_id...],"groups":[{"group_id",바뀐 필드...}]}
+// 병합 기준은 디코더가 마지막으로 완성한 스냅샷(base)이고, base_fp가 다르면 적용하지 않는다.
+//
+// presence에 wire=msgpack을 알린 기기에는 같은 구조가 MessagePack으로 온다(첫 바이트로 판별).
+// 키는 정수 인덱스(kHwWireKeys), run_start는 epoch 초라 ISO 문자열을 다시 파싱하지 않는다.
+// 두 형식 모두 같은 스키마 싱크(begin_container/on_scalar)로 들어간다.
+// 페이로드당 할당·시간은 호스트에서 tools/bench_hw_sync.cpp로 잰다.
+
+static const uint8_t HW_MAX_GROUPS = 8;
+static const uint8_t HW_MAX_CHILDREN = 8;
+
+// 그룹 과제 children 메모리 저장 (상세 페이지용)
+struct HwChildEntry {
+  char item_id[40];
+  char title[32];
+  char page[16];
+  char memo[64];
+  int16_t count;
+  int16_t check_count;
+  int8_t phase;
+  int32_t accumulated;
+};
+
+struct HwGroupData {
+  char group_id[40];
+  char group_title[40];
+  char book_name[64];
+  char m5_wait_title[128];
+  char page_summary[32];
+  char item_type[24];
+  int16_t order_index;
+  bool is_homework;   // 하원 시 배정된 take-home 숙제 그룹(읽기 전용, 원에 "숙제" 표시)
+  bool is_test;       // 테스트 플로우 소속 (수행 시 테스트 카운트다운 화면)
+  bool is_naesin;     // 내신기출 (1열에 "내신기출" 표기)
+  bool pending_complete; // '완료' 예약 (확인 phase=4에서 4칸; 단순 확인은 3칸)
+  int8_t phase; int32_t accumulated; int32_t cycle_elapsed; int16_t check_count; int16_t total_count;
+  int16_t time_limit_minutes;
+  uint32_t color;
+  int64_t run_start_epoch;
+  /** 서버 run_start 기준 1회 정렬 + lv_tick 모노토닉 표시용 (목록/상세 공통) */
+  bool display_anchor_valid;
+  int64_t display_anchor_run_start;
+  uint32_t display_anchor_tick;
+  int32_t display_segment0_sec;
+  HwChildEntry children[HW_MAX_CHILDREN];
+  uint8_t child_cnt;
+};
+
+struct HwSyncMeta {
+  bool present;
+  char sync_fp[65];
+  unsigned long sync_seq;
+  char source[48];
+  char student_id[48];
+  bool patch;            // meta.mode == "patch"
+  char base_fp[65];      // patch가 기준으로 삼은 스냅샷
+  unsigned long base_seq;
+};
+
+struct HwSyncFrame {
+  HwGroupData groups[HW_MAX_GROUPS];   // order_index → group_id 순으로 정렬된 상태
+  uint8_t group_cnt;
+  HwSyncMeta meta;
+  uint32_t bytes;      // 원본 페이로드 바이트
+  uint32_t decode_us;  // 청크 디코딩에 쓴 누적 시간
+  uint32_t rx_ms;      // 마지막 청크 수신 시각
+  // meta(sync_fp/student_id)가 마지막으로 적용한 것과 같다. meta가 groups보다 먼저 오면
+  // 나머지 바이트는 읽지도 않으므로 이때 groups/group_cnt는 비어 있다.
+  bool unchanged;
+  // patch의 base_fp가 디코더의 기준 스냅샷과 달라 병합하지 않았다(groups 비어 있음).
+  // loop()는 ok:false ack로 전체 스냅샷을 요청한다.
+  bool patch_rejected;
+  bool msgpack;        // wire 형식(false = JSON)
+};
+
+// 범용 JSON 토크나이저 + homeworks 스키마 싱크. 문자열 값은 고정 스크래치 버퍼로 받으며
+// 넘치는 부분은 잘린다(필드 버퍼 자체가 더 작으므로 표시 결과는 같다).
+class HwStreamDecoder {
+ public:
+  // meta 객체가 닫히는 시점에 호출. true면 이미 적용한 스냅샷으로 본다.
+  typedef bool (*AppliedCheck)(const HwSyncMeta& meta, void* ctx);
+
+  // base: patch 병합 기준(마지막으로 완성한 스냅샷). 없으면 patch는 모두 거부된다.
+  void reset(HwSyncFrame* frame, AppliedCheck check = nullptr, void* check_ctx = nullptr,
+             const HwSyncFrame* base = nullptr);
+  // false면 문법 오류(이후 입력은 무시된다)
+  bool feed(const char* p, size_t len);
+  // 루트 객체가 닫혔고 오류가 없으면 true. patch면 빠진 그룹을 base에서 채우고, 그룹 정렬까지 마친다.
+  bool finish();
+  uint32_t truncated() const { return truncated_; }
+  bool msgpack() const { return msgpack_; }
+
+ private:
+  enum Lex : uint8_t { LX_WS, LX_STRING, LX_ESCAPE, LX_UNICODE, LX_NUMBER, LX_LITERAL, LX_DONE, LX_ERROR };
+  enum Ctx : uint8_t { CX_SKIP, CX_ROOT, CX_GROUPS, CX_GROUP, CX_CHILDREN, CX_CHILD, CX_META, CX_ORDER };
+  enum ValKind : uint8_t { V_STRING, V_NUMBER, V_BOOL, V_NULL };
+  static const uint8_t kMaxDepth = 16;
+  static const size_t kStrMax = 1024;
+
+  bool step(char c);
+  // MessagePack 경로: 컨테이너 끝 표시가 없으므로 깊이별 남은 항목 수로 닫는다.
+  enum MpState : uint8_t { MP_HEAD, MP_LEN, MP_NUM, MP_STR };
+  bool mp_step(uint8_t b);
+  bool mp_head(uint8_t b);
+  bool mp_is_key() const;
+  bool mp_scalar(ValKind kind);
+  bool mp_int_key(uint32_t idx);
+  bool mp_str_begin(uint32_t n);
+  bool mp_str_end();
+  bool mp_open(bool is_object, uint32_t n);
+  bool mp_item_done();
+  void begin_container(bool is_object);
+  bool end_container(bool is_object);
+  void on_scalar(ValKind kind);
+  void put_utf8(uint32_t cp);
+  void str_put(char c);
+
+  void group_begin();
+  void group_field(ValKind kind);
+  void group_end();
+  void child_field(ValKind kind);
+  void meta_field(ValKind kind);
+  void meta_end();
+  bool patch_entry_bind(ValKind kind);
+  const HwGroupData* find_base_group(const char* group_id) const;
+
+  HwSyncFrame* frame_ = nullptr;
+  AppliedCheck check_ = nullptr;
+  void* check_ctx_ = nullptr;
+  bool groups_seen_ = false;
+  bool skip_groups_ = false;
+  bool started_ = false;   // 첫 유효 바이트를 봤는지(형식 판별)
+  bool msgpack_ = false;
+  bool error_ = false;   // 스키마 오류(patch 형식 위반). 이후 입력은 무시된다.
+  Lex lex_ = LX_WS;
+  uint8_t depth_ = 0;
+  Ctx ctx_[kMaxDepth];
+  bool is_obj_[kMaxDepth];
+  bool expect_key_ = false;
+  bool closed_root_ = false;
+
+  char key_[24];
+  char str_[kStrMax];
+  size_t str_len_ = 0;
+  bool str_overflow_ = false;
+  char num_[32];
+  uint8_t num_len_ = 0;
+  uint16_t uni_acc_ = 0;
+  uint8_t uni_digits_ = 0;
+  uint16_t uni_high_ = 0;
+  double num_val_ = 0;
+  bool bool_val_ = false;
+  uint32_t truncated_ = 0;
+
+  MpState mp_state_ = MP_HEAD;
+  uint8_t mp_type_ = 0;
+  uint8_t mp_need_ = 0;
+  uint8_t mp_got_ = 0;
+  uint8_t mp_buf_[8];
+  uint32_t mp_remain_ = 0;
+  uint32_t mp_left_[kMaxDepth];  // 깊이별 남은 항목 수(map은 키+값이라 2배)
+
+  // 현재 그룹에서 book_name 계산에 필요한 원본 값(키 순서와 무관하게 그룹 종료 시 합성)
+  bool grp_active_ = false;
+  bool grp_has_order_ = false;
+  bool grp_has_book_id_ = false;
+  bool grp_derived_seen_ = false;  // book_name 재계산이 필요한 필드가 왔는지(patch)
+  bool grp_from_base_ = false;     // patch 항목이 기준 그룹 위에 병합 중인지
+  uint8_t grp_slot_ = 0;
+  HwGroupData* cur_grp_ = nullptr;
+  char grp_grade_label_[32];
+  char grp_content_course_[32];
+  char grp_content_book_[96];
+  bool child_active_ = false;
+
+  // patch 전용: 최종 그룹 순서와 항목이 채운 자리
+  const HwSyncFrame* base_ = nullptr;
+  bool order_seen_ = false;
+  char order_[HW_MAX_GROUPS][40];
+  uint8_t order_cnt_ = 0;
+  uint16_t slot_filled_ = 0;
+};
+
+struct HwSyncStats {
+  uint32_t frames;          // 생산자: loop()로 넘긴 프레임 수
+  uint32_t coalesced;       // 소비자: 더 새 프레임이 있어 건너뛴 수
+  uint32_t parse_errors;    // 생산자
+  uint32_t unchanged;       // 생산자: meta가 마지막 적용분과 같았던 프레임 수
+  uint32_t dropped;         // 생산자: 빈 프레임/링 공간 부족, 청크 순서 어긋남
+  uint32_t patches;         // 생산자: 병합에 성공한 patch 수
+  uint32_t patch_rejects;   // 생산자: base_fp 불일치로 거부한 patch 수
+  uint32_t msgpack_frames;  // 생산자: MessagePack으로 받은 프레임 수
+  uint32_t last_decode_us;  // 생산자
+  uint32_t max_decode_us;   // 생산자
+  uint32_t last_bytes;      // 생산자
+};
+
+// MQTT 콜백(생산자)과 loop()(소비자) 사이의 homeworks 프레임 인계.
+class HwSyncStream {
+ public:
+  static const uint8_t kFrameCount = 3;
+
+  // setup()에서 1회 호출. PSRAM이 있으면 프레임(풀 + patch 기준 1장)을 그쪽에 둔다.
+  bool begin();
+  // 생산자 전용. 마지막 청크까지 디코딩되어 프레임이 큐에 들어가면 true.
+  bool on_chunk(const char* payload, size_t len, size_t index, size_t total, uint32_t now_ms);
+  // 소비자 전용. 쌓인 프레임 중 가장 최신 것만 돌려준다(나머지는 반납).
+  HwSyncFrame* take();
+  void release(HwSyncFrame* frame);
+
+  // 소비자 전용. 화면에 실제로 반영한 스냅샷을 기록한다(빈 값이면 초기화).
+  // 생산자는 다음 페이로드의 meta를 이것과 비교해 groups 디코딩을 건너뛴다.
+  void set_applied(const char* student_id, const char* sync_fp);
+
+  const HwSyncStats& stats() const { return stats_; }
+  // 디코딩 경로가 차지하는 고정 메모리(프레임 풀 + 디코더)
+  size_t footprint_bytes() const { return sizeof(HwSyncFrame) * (kFrameCount + 1) + sizeof(HwStreamDecoder); }
+
+ private:
+  void abandon();
+  // 생산자 전용: free 링에 넣는 쪽은 소비자뿐이라, 생산자가 못 쓴 프레임은 예비 목록에 두고 먼저 쓴다.
+  bool acquire_frame(uint8_t& idx);
+  void recycle(uint8_t idx);
+  static bool is_applied(const HwSyncMeta& meta, void* ctx);
+
+  HwSyncFrame* frames_[kFrameCount] = {};
+  HwSyncFrame* base_ = nullptr;  // 생산자 전용: 마지막으로 완성한 스냅샷(patch 병합 기준)
+  SpscRing<uint8_t, 4> ready_;
+  SpscRing<uint8_t, 4> free_;
+  uint8_t spare_[kFrameCount];
+  uint8_t spare_cnt_ = 0;
+  HwStreamDecoder dec_;
+  int8_t cur_ = -1;
+  bool dropping_ = false;
+  bool failed_ = false;
+  size_t expected_ = 0;
+  size_t received_ = 0;
+  HwSyncStats stats_ = {};
+  // 두 태스크가 함께 보는 값이라 짧은 memcpy만 임계 구역 안에서 한다(힙 사용 없음).
+  portMUX_TYPE applied_mux_ = portMUX_INITIALIZER_UNLOCKED;
+  char applied_fp_[65] = {};
+  char applied_student_[48] = {};
+};
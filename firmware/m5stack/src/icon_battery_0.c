@@ -1,31 +1,12 @@
 #include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bin[] = {
-  0x05,0x00,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0x01,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -194,55 +175,11 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xB7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x1C,0xE7,0x30,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x10,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xF7,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0x68,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0x48,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -250,11 +187,7 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xBF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x10,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -263,95 +196,142 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x10,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xf7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x68,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x10,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xEF,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x10,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xef,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -359,10 +339,11 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -370,72 +351,83 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -443,10 +435,11 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x10,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -454,128 +447,140 @@ static const uint8_t battery_android_0_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_bi
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xEF,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xef,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x18,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x50,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xCF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xF7,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0x68,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x10,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xf7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x68,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x10,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x1C,0xE7,0x28,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0x00,0xe7,0x3c,0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xB7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -1,13 +1,12 @@
 #include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
-  0x05,0x00,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0x01,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -30,237 +29,231 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x40,0x3C,0xE7,0xFF,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,
+  0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x1C,0xE7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x40,0xe7,0x00,0xff,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1C,0xE7,0x40,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x1C,0xE7,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x1c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x40,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,
+  0xff,0xe7,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x48,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x30,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x1C,0xE7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x38,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,
+  0xff,0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x38,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x38,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x28,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x20,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x08,0x1C,0xE7,0x20,0x1C,0xE7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1C,0xE7,0x18,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3D,0xEF,0xA7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xAF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x1c,0x08,0xe7,0x1c,0x20,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,
-  0xEF,0xDF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xD7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0xa7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0xaf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,
+  0xef,0x3c,0xdf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -269,11 +262,10 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x40,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xEF,0x3C,0xE7,0xE7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,
-  0xE7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -281,23 +273,24 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x28,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x28,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x1C,0xE7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x40,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xef,0xe7,0x3c,0xe7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x1C,0xE7,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3C,0xE7,0x80,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x28,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x1c,0xff,0xe7,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -305,336 +298,348 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xD7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,
-  0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x1c,0xff,0xe7,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x38,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0x80,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x70,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x38,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x78,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x70,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0xEF,0x97,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x78,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xAF,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0x97,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x28,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xaf,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x28,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x28,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x08,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,
-  0xE7,0xE7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,
-  0xE7,0xEF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x08,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xef,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xe7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x38,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x20,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0xEF,0xA7,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xF7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3D,0xEF,0x9F,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0xa7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x9f,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x70,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x08,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x80,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x70,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3C,0xE7,0xD7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,
-  0xE7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xD7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x1C,0xE7,0x70,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0x00,0xe7,0x3c,0x70,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x1C,0xE7,0x28,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xF7,0x3D,0xEF,0x30,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x28,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x1C,0xE7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xf7,0xef,0x00,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x48,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xEF,0x3C,0xE7,0xEF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,
-  0xE7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xef,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x28,0x3C,0xE7,0xFF,0x3C,
-  0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x20,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,
-  0xEF,0xDF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xD7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,
+  0xef,0x3c,0xdf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,0x1C,0xE7,0x08,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1C,0xE7,0x08,0x3D,0xEF,0xA7,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3D,0xEF,0xA7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,
-  0xFF,0x1C,0xE7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x1c,0xff,0xe7,0x00,0x08,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x1C,0xE7,0x30,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x08,
+  0x00,0x1c,0x00,0xe7,0x3d,0x08,0xef,0x3c,0xa7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,
+  0xff,0xef,0x00,0xa7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,
+  0x1c,0xff,0xe7,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x08,0x1C,0xE7,0x20,0x1C,0xE7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x1c,0x08,0xe7,0x1c,0x20,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x30,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x30,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x38,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x40,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x40,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x18,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x48,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x40,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x40,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x20,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x1C,0xE7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,
+  0xff,0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
-  0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,
-  0xFF,0x1C,0xE7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1C,0xE7,0x20,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x08,0x3C,0xE7,0xFF,0x1C,0xE7,
-  0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x1c,0xff,0xe7,
+  0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x28,0x3C,0xE7,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,0xe7,0x00,0xff,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -642,8 +647,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -654,8 +659,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -666,8 +671,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -678,8 +683,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -690,8 +695,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -702,8 +707,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -714,8 +719,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -726,8 +731,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE7,
-  0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x3C,0xE7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -738,8 +743,8 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,
-  0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x1C,0xE7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -769,7 +774,7 @@ const uint8_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00
+  0x00,0x00,0x00,0x00,
 };
 
 const lv_img_dsc_t light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48={.header={.always_zero=0,.w=64,.h=64,.cf=LV_IMG_CF_TRUE_COLOR_ALPHA},.data_size=12292,.data=light_mode_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map};
@@ -1,11 +1,12 @@
 #include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 const uint8_t home_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
-  0x05,0x00,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0x01,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -103,575 +104,579 @@ const uint8_t home_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x00,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x38,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x40,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x38,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x38,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0x48,0x1c,0xe7,0x48,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x40,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x38,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x1c,0x48,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x40,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x08,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xb7,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xb7,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xc7,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xbf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xc7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x1c,0xe7,0x38,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x1c,0xe7,0x48,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0x00,0xe7,0x3c,0x38,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x1c,0xe7,0x08,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xb7,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xb7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xb7,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xc7,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xbf,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xc7,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xbf,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1c,0xe7,0x38,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x48,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x48,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x1c,0xe7,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x38,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x48,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x1c,0xff,0xe7,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
-  0xe7,0x08,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+  0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xbf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x38,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x48,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x38,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x48,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x40,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x08,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xbf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3c,0x00,0xe7,0x3c,0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1c,0xe7,0x48,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x28,0x3c,
-  0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,
-  0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x1c,0xe7,0x28,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,
+  0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,
+  0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x1c,0xcf,0xe7,0x00,0x28,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x1c,0xe7,0x30,0x1c,0xe7,
-  0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x3c,0xe7,0xd7,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xd7,0xe7,0x1c,0x30,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
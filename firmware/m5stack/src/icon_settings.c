@@ -1,7 +1,12 @@
 #include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
-  0x05,0x00,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x05,0x01,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -66,9 +71,9 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,
-  0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,
+  0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xcf,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -77,10 +82,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
-  0xe7,0x28,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+  0xe7,0x3c,0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -89,10 +94,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0x77,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0x77,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -101,10 +106,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xbf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -113,10 +118,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x1c,0xe7,
-  0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x1c,0x30,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -125,10 +130,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -137,490 +142,491 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xd7,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x10,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x10,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xe7,0x3c,0xe7,0x87,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x57,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x97,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x5f,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x6f,
-  0x3c,0xe7,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xe7,0xe7,0x00,0x87,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x57,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0x97,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x5f,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x18,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,
-  0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x28,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x57,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x57,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,
-  0xe7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0xa7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0x6f,0xe7,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3c,0xe7,0xef,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x18,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x18,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xf7,0x1c,0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,
-  0x08,0x3c,0xe7,0xd7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,
+  0x00,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x57,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0x57,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0xa7,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0x50,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x3c,0xe7,0x6f,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x67,0x3c,0xe7,0xef,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x18,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x18,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x1c,0xf7,0xe7,0x00,0x10,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x3c,0x08,0xe7,0x3c,0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0x50,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xf7,0xe7,0x3c,
+  0x6f,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xcf,0x1c,0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x97,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x97,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x08,0x3c,0xe7,
-  0xc7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xc7,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x9f,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,0x00,0x00,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0xa7,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x3c,0xe7,0x77,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x3c,0x67,0xe7,0x3c,0xef,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
-  0xe7,0x20,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xaf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x1c,0xcf,0xe7,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x97,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xd7,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x48,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x97,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x3c,0x08,0xe7,
+  0x3c,0xc7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xc7,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x08,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x50,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x9f,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0xa7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x77,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x10,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+  0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x00,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xaf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xd7,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0x6f,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,
-  0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x50,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x10,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3c,0xe7,0x40,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0x6f,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x08,0x3d,0xef,
-  0x8f,0x3c,0xe7,0xbf,0x3c,0xe7,0xbf,0x3d,0xef,0x8f,0x1c,0xe7,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0x68,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x1c,0xe7,0x08,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x48,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0xdf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x9f,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,
-  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0x40,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x18,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3d,0x08,0xef,
+  0x3c,0x8f,0xe7,0x3c,0xbf,0xe7,0x3d,0xbf,0xef,0x1c,0x8f,0xe7,0x00,0x10,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x28,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3d,0xef,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xbf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xe7,0x3c,0x68,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x3d,0xef,0x8f,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x20,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xe7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x50,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x50,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0xdf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xef,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3d,0xef,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x9f,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,
+  0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x80,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xef,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3d,0xff,0xef,0x00,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xbf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x8f,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x77,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3d,0xef,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x18,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x10,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3d,0xef,0x8f,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x80,
+  0x00,0x3c,0x00,0xe7,0x3c,0xe7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x50,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x50,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3c,0x00,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3d,0xff,0xef,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3d,0xef,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x87,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x80,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3d,0xef,0x57,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xbf,
+  0x3c,0x00,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x77,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x10,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3d,0xef,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xbf,0x00,
+  0x3d,0x00,0xef,0x3c,0x8f,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3d,0xef,0x38,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x87,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3d,0x00,0xef,0x3c,0x57,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xbf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xbf,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xb7,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3d,0xef,0x38,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xbf,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3d,0x00,0xef,0x3c,0x38,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3d,0xef,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x8f,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x8f,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3d,0xef,0x67,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xb7,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xbf,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xb7,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x3d,0x00,0xef,0x3c,0x38,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x80,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x18,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x8f,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x8f,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3d,0xef,0x97,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x87,
+  0x3d,0x00,0xef,0x3c,0x67,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0xb7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x80,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x10,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x87,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,
+  0x3d,0x00,0xef,0x3c,0x97,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,
+  0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xf7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x87,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xef,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x50,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x48,0x00,0x00,0x00,0x00,
+  0x3c,0x00,0xe7,0x3c,0xf7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x3c,0xe7,0xef,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3d,0xef,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x28,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3d,0xef,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xbf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x50,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x48,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x3c,0xe7,0x80,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x20,0x00,0x00,0x00,0x00,
+  0x3c,0x00,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3d,0xff,0xef,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xb7,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,
-  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3d,0xff,0xef,0x00,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xbf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x80,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x20,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xb7,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,
+  0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0xdf,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xbf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x58,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0xdf,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0xdf,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3c,0xe7,0x48,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x58,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x18,0x3d,0xef,
-  0x8f,0x3c,0xe7,0xb7,0x3c,0xe7,0xbf,0x3c,0xe7,0x87,0x1c,0xe7,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0xdf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0x48,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0x68,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3d,0x18,0xef,
+  0x3c,0x8f,0xe7,0x3c,0xb7,0xe7,0x3c,0xbf,0xe7,0x1c,0x87,0xe7,0x00,0x10,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xf7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0x68,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xf7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x10,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x10,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0x6f,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,
-  0xe7,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xd7,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x30,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0x6f,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,
+  0xe7,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xd7,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x18,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x3c,0xe7,0x48,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x18,0xe7,0x3c,0xff,0xe7,0x3c,0xf7,0xe7,0x00,0x48,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xa7,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x1c,0xe7,0x80,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xa7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x80,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0x68,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0xa7,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0x68,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x00,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0xa7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x97,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x08,0x3c,0xe7,
-  0xd7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x1c,0xe7,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,0x97,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x3c,0x08,0xe7,
+  0x3c,0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xf7,0xe7,0x00,0x08,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x08,0x3c,0xe7,0xef,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xef,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xcf,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xdf,0x3d,0xef,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3d,0xdf,0xef,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x1c,0xe7,0x28,0x3d,0xef,0xdf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x1c,0x00,0xe7,0x3d,0x28,0xef,0x3c,0xdf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0x58,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xf7,0xe7,0x3c,
+  0x60,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0x58,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xf7,0x3c,0xe7,0x60,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0x58,0xe7,0x3c,0xef,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x58,0x3c,0xe7,0xef,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+  0x00,0xe7,0x3c,0x08,0xe7,0x3c,0xef,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x18,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,
+  0x18,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,
+  0x3c,0x08,0xe7,0x3c,0xcf,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x1c,0xe7,0x08,0x3c,0xe7,0xef,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x18,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x18,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,
-  0x08,0x3c,0xe7,0xcf,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x1c,0x00,0xe7,0x3c,0x20,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,
+  0x00,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x28,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x57,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0x57,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,
+  0xe7,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0xa7,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x1c,0xff,0xe7,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x1c,0xe7,0x20,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,
-  0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x28,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x57,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x57,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,
-  0xe7,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0xa7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x1c,0xe7,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x1c,0xe7,0xe7,0x00,0x80,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xe7,0x1c,0xe7,0x80,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,0x5f,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x97,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0x00,0xef,0x3c,
+  0x97,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3d,0xff,0xef,0x00,0x57,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x5f,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x97,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xef,0x97,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3d,0xef,0x57,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0x77,0xe7,0x00,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0x77,
-  0x3c,0xe7,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0xe7,0x3c,0x10,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xd7,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xd7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x08,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe7,0x10,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xd7,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xd7,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x08,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -628,11 +634,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -641,10 +646,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -653,10 +658,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x30,0x1c,0xe7,
-  0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x1c,0xe7,0x30,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x1c,0x30,0xe7,
+  0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x1c,0x30,0xe7,0x3c,0x30,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -665,10 +670,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0xc7,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xbf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0xc7,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0xbf,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -677,10 +682,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
-  0xe7,0x6f,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,
+  0xe7,0x3c,0x6f,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -689,10 +694,10 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
-  0xe7,0x18,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,
-  0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x3c,0xe7,0xff,
-  0x3c,0xe7,0xff,0x3c,0xe7,0xff,0x1c,0xe7,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+  0xe7,0x3c,0x18,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,
+  0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,0xff,0xe7,0x3c,
+  0xff,0xe7,0x3c,0xff,0xe7,0x1c,0xff,0xe7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -702,9 +707,9 @@ const uint8_t settings_64dp_E3E3E3_FILL0_wght400_GRAD0_opsz48_map[]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,
-  0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,
-  0x3c,0xe7,0xcf,0x3c,0xe7,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x3c,0x00,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,
+  0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,0xcf,0xe7,0x3c,
+  0xcf,0xe7,0x3c,0xcf,0xe7,0x00,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -26,8 +26,11 @@
 /*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)*/
 #define LV_COLOR_DEPTH 16
 
-/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 0
+/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)
+ *1: draw buffers are already in SPI byte order, so the flush can DMA them without a CPU swap
+ *    (display_flush.cpp). Single-variant TRUE_COLOR_ALPHA images are stored swapped too
+ *    (tools/swap_rgb565_true_color_alpha.py).*/
+#define LV_COLOR_16_SWAP 1
 
 /*Enable features to draw on transparent background.
  *It's required if opa, and transform_* style properties are used.
@@ -49,14 +52,18 @@
 #define LV_MEM_CUSTOM 0
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
-    #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
+    /*The pool is taken from PSRAM by LV_MEM_POOL_ALLOC (lvgl_mem.cpp). Boards without PSRAM: -D CFG_LV_MEM_KB=48*/
+    #ifndef CFG_LV_MEM_KB
+        #define CFG_LV_MEM_KB 256
+    #endif
+    #define LV_MEM_SIZE (CFG_LV_MEM_KB * 1024U)          /*[bytes]*/
 
     /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
     #define LV_MEM_ADR 0     /*0: unused*/
     /*Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc*/
     #if LV_MEM_ADR == 0
-        #undef LV_MEM_POOL_INCLUDE
-        #undef LV_MEM_POOL_ALLOC
+        #define LV_MEM_POOL_INCLUDE "lvgl_mem.h"
+        #define LV_MEM_POOL_ALLOC   lvgl_mem_pool_alloc
     #endif
 
 #else       /*LV_MEM_CUSTOM*/
@@ -271,8 +278,8 @@
 #define LV_USE_ASSERT_OBJ           0   /*Check the object's type and existence (e.g. not deleted). (Slow)*/
 
 /*Add a custom handler when assert happens e.g. to restart the MCU*/
-#define LV_ASSERT_HANDLER_INCLUDE <stdint.h>
-#define LV_ASSERT_HANDLER while(1);   /*Halt by default*/
+#define LV_ASSERT_HANDLER_INCLUDE "lvgl_mem.h"
+#define LV_ASSERT_HANDLER lvgl_mem_assert_halt();   /*Log the LVGL pool state and reboot instead of hanging*/
 
 /*-------------
  * Others
@@ -679,8 +686,10 @@
     #endif
 #endif
 
-/*Tiny TTF library*/
-#define LV_USE_TINY_TTF 0
+/*Tiny TTF library (fallback for glyphs outside the kakao_kr subset, see font_fallback.h)*/
+#ifndef LV_USE_TINY_TTF
+    #define LV_USE_TINY_TTF 1
+#endif
 #if LV_USE_TINY_TTF
     /*Load TTF data from files*/
     #define LV_TINY_TTF_FILE_SUPPORT 0
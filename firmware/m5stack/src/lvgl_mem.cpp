@@ -0,0 +1,99 @@
+#include "lvgl_mem.h"
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <lvgl.h>
+
+static const uint32_t kSampleIntervalMs = 250;
+// 가장 큰 빈 블록이 이보다 작으면 팝업/상세 페이지 하나를 못 만들 수 있다.
+static const uint32_t kLowBiggestBytes = 8 * 1024;
+
+static bool s_in_psram = false;
+static LvglMemScreenPeak s_peaks[kLvglMemScreenSlots];
+static uint8_t s_peak_count = 0;
+static int8_t s_cur = -1;
+static uint32_t s_last_sample_ms = 0;
+static bool s_low_warned = false;
+
+extern "C" void* lvgl_mem_pool_alloc(size_t bytes) {
+  void* p = nullptr;
+  if (psramFound()) {
+    p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    s_in_psram = p != nullptr;
+  }
+  if (!p) p = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  Serial.printf("[LVMEM] pool=%u in=%s ok=%d\n", (unsigned)bytes, s_in_psram ? "psram" : "internal", p ? 1 : 0);
+  return p;
+}
+
+void lvgl_mem_query(LvglMemStats* out) {
+  lv_mem_monitor_t mon;
+  lv_mem_monitor(&mon);
+  out->total = mon.total_size;
+  out->used = mon.total_size - mon.free_size;
+  out->peak = mon.max_used;
+  out->free_biggest = mon.free_biggest_size;
+  out->used_pct = mon.used_pct;
+  out->frag_pct = mon.frag_pct;
+  out->in_psram = s_in_psram;
+}
+
+extern "C" void lvgl_mem_assert_halt(void) {
+  LvglMemStats st;
+  lvgl_mem_query(&st);
+  Serial.printf("[LVMEM] ASSERT screen=%s used=%lu/%lu peak=%lu biggest=%lu frag=%u%%\n",
+                lvgl_mem_current_screen(),
+                (unsigned long)st.used,
+                (unsigned long)st.total,
+                (unsigned long)st.peak,
+                (unsigned long)st.free_biggest,
+                (unsigned)st.frag_pct);
+  Serial.flush();
+  abort();
+}
+
+void lvgl_mem_mark_screen(const char* screen) {
+  for (uint8_t i = 0; i < s_peak_count; i++) {
+    if (s_peaks[i].screen == screen || strcmp(s_peaks[i].screen, screen) == 0) {
+      s_cur = (int8_t)i;
+      return;
+    }
+  }
+  if (s_peak_count < kLvglMemScreenSlots) {
+    s_peaks[s_peak_count] = {screen, 0, UINT32_MAX};
+    s_cur = (int8_t)s_peak_count++;
+  }
+}
+
+bool lvgl_mem_sample(uint32_t now_ms) {
+  if (now_ms - s_last_sample_ms < kSampleIntervalMs) return false;
+  s_last_sample_ms = now_ms;
+  LvglMemStats st;
+  lvgl_mem_query(&st);
+  if (s_cur >= 0) {
+    LvglMemScreenPeak& p = s_peaks[s_cur];
+    if (st.used > p.peak_used) p.peak_used = st.used;
+    if (st.free_biggest < p.min_free_biggest) p.min_free_biggest = st.free_biggest;
+  }
+  const bool low = st.free_biggest < kLowBiggestBytes;
+  const bool entered = low && !s_low_warned;
+  if (entered) {
+    Serial.printf("[LVMEM] WARN low screen=%s used=%lu/%lu biggest=%lu frag=%u%%\n",
+                  lvgl_mem_current_screen(),
+                  (unsigned long)st.used,
+                  (unsigned long)st.total,
+                  (unsigned long)st.free_biggest,
+                  (unsigned)st.frag_pct);
+  }
+  s_low_warned = low;
+  return entered;
+}
+
+uint8_t lvgl_mem_screen_peaks(const LvglMemScreenPeak** out) {
+  *out = s_peaks;
+  return s_peak_count;
+}
+
+const char* lvgl_mem_current_screen() {
+  return s_cur >= 0 ? s_peaks[s_cur].screen : "boot";
+}
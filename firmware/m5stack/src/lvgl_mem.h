@@ -0,0 +1,54 @@
+#pragma once
+
+// LVGL 힙(lv_mem_alloc) 풀 공급과 사용량 모니터링.
+//
+// lv_conf.h가 LV_MEM_POOL_INCLUDE로 이 헤더를 lv_mem.c(C)에 넣는다. LVGL 내장 TLSF가
+// lv_init() 때 lvgl_mem_pool_alloc(LV_MEM_SIZE)로 풀 한 덩어리를 받아 그 안에서 나눠 쓴다.
+// 크기는 컴파일 시 정한다(CFG_LV_MEM_KB, 기본 256KB). PSRAM에 잡고, 못 잡으면 내부 RAM을 시도한다.
+// 내장 TLSF는 풀 하나만 다루므로 객체별로 내부 RAM에 나눠 두지는 못한다. 렌더링 중 매 픽셀 닿는
+// draw buffer만 이 풀과 별개로 display_flush가 내부 RAM에 둔다.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void* lvgl_mem_pool_alloc(size_t bytes);
+// LV_ASSERT_HANDLER: 풀 상태를 남기고 재부팅한다(무한 루프로 멈춘 것처럼 보이지 않게).
+void lvgl_mem_assert_halt(void);
+
+#ifdef __cplusplus
+}
+
+struct LvglMemStats {
+  uint32_t total;         // 풀 크기
+  uint32_t used;          // 현재 사용
+  uint32_t peak;          // 부팅 후 최대 사용(LVGL 집계)
+  uint32_t free_biggest;  // 가장 큰 빈 블록
+  uint8_t used_pct;
+  uint8_t frag_pct;       // 100 - 가장 큰 빈 블록 / 전체 빈 공간
+  bool in_psram;
+};
+
+// 화면별 최대 사용량. 화면 전환 시 lvgl_mem_mark_screen()으로 구간을 나눈다.
+struct LvglMemScreenPeak {
+  const char* screen;
+  uint32_t peak_used;
+  uint32_t min_free_biggest;
+};
+
+static const uint8_t kLvglMemScreenSlots = 8;
+
+// 지금 풀 상태(lv_mem_monitor, 풀 전체 순회)
+void lvgl_mem_query(LvglMemStats* out);
+// 이후 샘플을 screen(정적 문자열) 몫으로 집계한다.
+void lvgl_mem_mark_screen(const char* screen);
+// loop()에서 매번 호출. 250ms마다 샘플을 떠 현재 화면의 최대치를 갱신한다.
+// 가장 큰 빈 블록이 경고선 아래로 새로 내려간 순간에만 true(호출 측이 diag를 보낸다).
+bool lvgl_mem_sample(uint32_t now_ms);
+// 화면별 최대치. 반환값은 채워진 슬롯 수.
+uint8_t lvgl_mem_screen_peaks(const LvglMemScreenPeak** out);
+const char* lvgl_mem_current_screen();
+#endif
@@ -1,18 +1,29 @@
 #include <M5Unified.h>
-#include <new>
 #include <WiFi.h>
 #include <AsyncMqttClient.h>
 #include <ArduinoJson.h>
-#include "esp_wifi.h"
 #include "esp_task_wdt.h"
 #include <lvgl.h>
 #include <LittleFS.h>
 #include <Preferences.h>
+#include <esp_heap_caps.h>
 #include "ui_port.h"
 #include "screensaver.h"
-#if LV_USE_TINY_TTF
-#include "extra/libs/tiny_ttf/lv_tiny_ttf.h"
-#endif
+#include "mqtt_rx_queue.h"
+#include "hw_sync.h"
+#include "display_flush.h"
+#include "lvgl_mem.h"
+#include "mqtt_topic_router.h"
+#include "mqtt_cmd_encoder.h"
+#include "cmd_journal.h"
+#include "mqtt_link.h"
+#include "wifi_manager.h"
+#include "boot_snapshot.h"
+#include "boot_profile.h"
+#include "ota_update.h"
+#include "font_fallback.h"
+#include "ui_sched.h"
+#include <atomic>
 
 // Build flags로 주입되는 설정(없으면 기본값)
 #ifndef CFG_WIFI_SSID
@@ -27,40 +38,100 @@
 #ifndef CFG_MQTT_PORT
 #define CFG_MQTT_PORT 1883
 #endif
+// 1이면 브로커와 TLS로 통신한다(mqtt_tls_client.h). 포트는 CFG_MQTT_PORT 대신 CFG_MQTT_TLS_PORT.
+#ifndef CFG_MQTT_TLS
+#define CFG_MQTT_TLS 0
+#endif
+#ifndef CFG_MQTT_TLS_PORT
+#define CFG_MQTT_TLS_PORT 8883
+#endif
 #ifndef CFG_ACADEMY_ID
 #define CFG_ACADEMY_ID "test-academy"
 #endif
 #ifndef CFG_DEVICE_ID
 #define CFG_DEVICE_ID "m5-001"
 #endif
+// 1이면 presence에 wire=msgpack을 실어 게이트웨이가 기기 토픽을 MessagePack으로 보내게 한다.
+// 수신 쪽은 값과 무관하게 JSON/msgpack을 첫 바이트로 구분해 둘 다 받는다.
+#ifndef CFG_WIRE_MSGPACK
+#define CFG_WIRE_MSGPACK 1
+#endif
+// 0보다 크면 부팅 화면에서 전체 화면 리프레시를 그 횟수만큼 돌려 [DISP] bench 로그를 남긴다.
+// draw buffer 전략(CFG_DISP_BUF_MODE) 비교용.
+#ifndef CFG_DISP_BENCH
+#define CFG_DISP_BENCH 0
+#endif
+// loop 한 바퀴에서 수신 큐(students_today/student_info)를 적용하는 시간 상한.
+// 넘으면 남은 이벤트는 다음 바퀴로 넘긴다(같은 토픽은 큐가 최신 것만 남긴다).
+#ifndef CFG_RX_DRAIN_BUDGET_US
+#define CFG_RX_DRAIN_BUDGET_US 8000
+#endif
 
 static const char* WIFI_SSID = CFG_WIFI_SSID;
 static const char* WIFI_PASS = CFG_WIFI_PASSWORD;
 static const char* MQTT_HOST = CFG_MQTT_HOST;
-static const uint16_t MQTT_PORT = CFG_MQTT_PORT;
+static const uint16_t MQTT_PORT = CFG_MQTT_TLS ? CFG_MQTT_TLS_PORT : CFG_MQTT_PORT;
 static String academyId = CFG_ACADEMY_ID;
 String studentId = "";
 static String deviceId;
 
-AsyncMqttClient mqtt;
-String ackFilterPrefix;
-String todayListTopic;
-String homeworksTopic;
-String updateTopic;
-String studentInfoTopic;
-String unboundTopic;
-static String deviceAckTopic;
-static uint32_t nextMqttReconnectMs = 0;
+MqttClient mqtt;
+// 구독 토픽 디스패치(onMqttConnect에서 구성, onMqttMessage에서 매칭 — 둘 다 async-tcp 태스크).
+static MqttTopicRouter g_topic_router;
+// 발신 토픽 캐시. 바인딩(academy/device/student)이 바뀐 뒤 첫 발행 때만 토픽을 다시 만든다.
+static MqttCmdEncoder g_cmd;
+// 과제 커맨드 오프라인 저널(LittleFS). 끊긴 동안의 탭을 재연결 후 순서대로 다시 보낸다.
+static CmdJournal g_cmd_journal;
+
+// loop 스레드 전용. async-tcp(onMqttConnect)에서 부르면 loop의 rebind와 토픽 버퍼를 같이 만지게 되므로,
+// 연결 직후 발행은 on_mqtt_session_ready()가 loop에서 한다.
+static const MqttCmdEncoder& cmd_topics() {
+  g_cmd.bind(academyId.c_str(), deviceId.c_str(), studentId.c_str());
+  return g_cmd;
+}
+
+// 스크래치 버퍼가 모자라 finish()가 nullptr이면 발행하지 않는다.
+static uint16_t publish_cmd(const char* topic, const char* payload, bool retain = false) {
+  if (!topic || !payload) {
+    Serial.printf("[CMD] encode overflow topic=%s\n", topic ? topic : "-");
+    return 0;
+  }
+  return mqtt.publish(topic, 1, retain, payload);
+}
+
+static uint16_t publish_journal_entry(const char* topic, const char* payload) {
+  return publish_cmd(topic, payload);
+}
+
+// 과제 커맨드: 저널에 먼저 적고 바로 service()로 보낸다(재생 중이면 순서를 지켜 뒤에 선다).
+// 저널을 쓸 수 없으면 예전처럼 바로 발행한다.
+static bool publish_journaled_cmd(uint32_t op, const char* topic, const char* payload) {
+  if (g_cmd_journal.append(op, topic, payload)) {
+    g_cmd_journal.service(millis(), mqtt.connected(), publish_journal_entry);
+    return true;
+  }
+  return publish_cmd(topic, payload) != 0;
+}
+
+// retain presence. 연결 직후(on_mqtt_session_ready)와 15초 주기 모두 loop()에서 불린다.
+static void publish_presence() {
+  CmdScratch<96> scratch;
+  CmdJsonWriter w = scratch.begin();
+  w.boolean("online", true).str("at", "").str("wire", CFG_WIRE_MSGPACK ? "msgpack" : "json");
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_PRESENCE), w.finish(), true);
+}
 // 전용 로컬 브로커만 사용한다. 공용 브로커 폴백은 게이트웨이가 접속하지 않은
 // 브로커로 M5가 붙는 split-brain을 유발하므로 제거(모두 로컬 브로커로 고정).
 static const char* kMqttHosts[] = { CFG_MQTT_HOST };
-static int mqttHostIndex = 0;
-static uint8_t mqttConsecutiveDisconnects = 0;
+// 프로브 → connect → 구독 → 첫 수신을 loop()에서 블로킹 없이 진행한다(mqtt_link.h).
+static MqttLink g_mqtt_link;
+// 캐시 BSSID/채널 빠른 접속, 비동기 스캔, RSSI 기반 로밍(wifi_manager.h).
+static WifiManager g_wifi_mgr;
 static char willPayloadBuf[128];
 static char willTopicBuf[128];
 
-// [WIFI-DIAG] 무선 연결 진단 누적 버퍼. setup()의 WiFi 연결 과정(스캔/RSSI/첫 시도/
-// fallback/최종 결과/소요시간)을 모았다가 onMqttConnect에서 diag 토픽으로 발행한다.
+// [WIFI-DIAG] 무선 연결 진단 누적 버퍼. 부팅 후 첫 WiFi 연결까지의 과정(캐시 접속/스캔/RSSI/
+// fallback/최종 결과/소요시간)을 모았다가 첫 MQTT 연결 뒤 loop의 on_mqtt_session_ready()에서 diag 토픽으로 발행한다.
 // USB를 꽂으면 증상이 사라져 시리얼로는 무선 문제를 재현할 수 없으므로 원격 수집한다.
 static String g_wifi_diag;
 static uint32_t g_wifi_connect_start_ms = 0;
@@ -70,6 +141,9 @@ static bool g_list_diag_sent = false;
 
 // MQTT stale watchdog states
 static uint32_t g_last_mqtt_connect_ms = 0;
+// onMqttConnect(async-tcp) → loop. 번호가 바뀌면 loop가 on_mqtt_session_ready()를 부른다.
+static std::atomic<uint32_t> g_mqtt_session_evt{0};
+static uint32_t g_mqtt_attempt_started_ms = 0;
 static uint32_t g_last_mqtt_rx_any_ms = 0;
 static uint32_t g_last_mqtt_rx_ack_ms = 0;
 static uint32_t g_last_mqtt_rx_homeworks_ms = 0;
@@ -80,6 +154,7 @@ static bool g_has_homeworks_sync_state = false;
 static uint32_t g_last_homeworks_sync_seq = 0;
 static char g_last_homeworks_sync_fp[65] = {0};
 static char g_last_homeworks_sync_source[48] = {0};
+static bool g_last_homeworks_msgpack = false;  // 마지막 homeworks 프레임의 wire(decode_us 비교용)
 static unsigned int g_last_homeworks_group_count = 0;
 static uint32_t g_last_homeworks_sync_status_ms = 0;
 static const uint32_t HOMEWORKS_SYNC_STATUS_INTERVAL_MS = 30000;
@@ -90,24 +165,6 @@ static const uint32_t MQTT_STALE_SOFT_MS = 45000;
 static const uint32_t MQTT_STALE_HARD_MS = 180000;
 static const uint32_t MQTT_STALE_SOFT_COOLDOWN_MS = 15000;
 static const uint32_t MQTT_STALE_HARD_COOLDOWN_MS = 90000;
-// MQTT 연결은 AsyncMqttClient 내부에서 비동기로 진행된다. connected()==false인 동안에도
-// CONNECTING 상태일 수 있으므로, 연결 실패 콜백이 오기 전 새 connect/disconnect를 겹치면
-// 같은 clientId가 서로 session takeover를 일으킨다.
-static uint32_t g_mqtt_connect_attempt_ms = 0;
-static bool g_mqtt_connect_in_flight = false;
-static uint8_t g_mqtt_connect_stall_count = 0;
-static uint32_t g_last_mqtt_connect_stall_ms = 0;
-static uint32_t g_mqtt_reconnect_backoff_ms = 2000;
-static const uint32_t MQTT_CONNECT_STALL_MS = 20000;
-// 안정성 우선: 재시도가 너무 뜸해지지 않도록 상한을 낮게 유지한다.
-static const uint32_t MQTT_RECONNECT_BACKOFF_MIN_MS = 2000;
-static const uint32_t MQTT_RECONNECT_BACKOFF_MAX_MS = 8000;
-static bool g_last_tcp_probe_ok = false;
-static uint32_t g_last_tcp_probe_ms = 0;
-static uint32_t g_last_tcp_probe_elapsed_ms = 0;
-static uint16_t g_tcp_probe_fail_count = 0;
-// 느린 경로에서 핸드셰이크 직전 오탐으로 끊기지 않도록 넉넉히 준다.
-static const uint32_t MQTT_TCP_PROBE_TIMEOUT_MS = 4000;
 static bool g_wifi_loop_connected = false;
 static const uint8_t ALERT_VIBRATION_STRENGTH = 150; // 실기기 모터 구동이 확인된 중간 출력
 static uint32_t g_last_boot_status_ui_ms = 0;
@@ -126,45 +183,14 @@ RTC_NOINIT_ATTR static uint32_t g_loop_stage_magic;
 RTC_NOINIT_ATTR static uint32_t g_ui_stage;
 void fw_mark_ui_stage(uint32_t stage) { g_ui_stage = stage; }
 
-// Deferred homework update (MQTT callback -> main loop)
+// Deferred bind/unbind flags (MQTT callback -> main loop)
 static portMUX_TYPE g_hw_mux = portMUX_INITIALIZER_UNLOCKED;
 
-// MQTT 콜백(async-tcp 태스크)과 loop() 사이의 JSON 인계 슬롯.
-// portENTER_CRITICAL 구간은 인터럽트를 끈 채 스핀락을 잡으므로 그 안에서
-// 힙을 건드리면 안 된다(다른 코어가 힙 잠금을 쥐고 있으면 영구 대기 → 기기 정지).
-// 따라서 할당/해제는 임계 구역 밖에서 하고, 안에서는 포인터만 교환한다.
-class PendingPayload {
- public:
-  void publish(const String& src) {
-    String* fresh = new (std::nothrow) String(src);
-    if (!fresh) return;
-    String* stale;
-    portENTER_CRITICAL(&g_hw_mux);
-    stale = slot_;
-    slot_ = fresh;
-    portEXIT_CRITICAL(&g_hw_mux);
-    delete stale;
-  }
-
-  // 소유권을 호출자에게 넘긴다. 반환값은 사용 후 delete 해야 한다.
-  String* take() {
-    String* taken;
-    portENTER_CRITICAL(&g_hw_mux);
-    taken = slot_;
-    slot_ = nullptr;
-    portEXIT_CRITICAL(&g_hw_mux);
-    return taken;
-  }
-
-  bool pending() const { return slot_ != nullptr; }
-
- private:
-  String* volatile slot_ = nullptr;
-};
-
-static PendingPayload g_hw_payload;
-static PendingPayload g_students_payload;
-static PendingPayload g_student_info_payload;
+// MQTT 콜백(async-tcp 태스크) -> loop() JSON 인계 큐. 자세한 구조는 mqtt_rx_queue.h 참고.
+// portENTER_CRITICAL 없이 SPSC 링으로 주고받으므로 콜백에서 힙 잠금과 얽힐 일이 없다.
+static MqttRxQueue g_rx_queue;
+// homeworks는 재조립 없이 청크 단위로 바로 디코딩해 프레임으로 넘긴다(hw_sync.h).
+static HwSyncStream g_hw_stream;
 
 // Deferred UI work from MQTT (async-tcp) task -> executed in loop() (LVGL thread).
 // LVGL is not thread-safe; building UI directly in the MQTT callback races with
@@ -184,6 +210,12 @@ static volatile bool g_students_received = false;
 static uint32_t g_last_list_request_ms = 0;
 static const uint32_t LIST_REQUEST_RETRY_MS = 6000;
 static bool g_first_ui_data_ready = false;
+// 마지막으로 반영한 목록/과제를 LittleFS에 두었다가 부팅 직후 그린다(boot_snapshot.h).
+// 새 데이터가 와서 다시 반영될 때까지 화면에 "동기화 중" 배지를 단다.
+static BootSnapshot g_boot_snap;
+static bool g_boot_snapshot_shown = false;
+// setup() 단계별/비동기 마일스톤 시각(RTC). 첫 diag에 타임라인을 싣는다.
+static BootProfile g_boot;
 // 부팅 때 NVS에서 복원된 바인딩이 학생 정보/숙제 데이터를 못 받으면
 // "학생" 기본명 화면에 갇히지 않도록 등원 리스트로 자동 복귀한다.
 static bool g_restored_binding_guard_active = false;
@@ -205,9 +237,6 @@ static String g_group_transition_lock_group_id;
 static uint32_t g_group_transition_lock_until_ms = 0;
 
 // LVGL objects
-static lv_disp_draw_buf_t g_lv_draw_buf;
-static lv_color_t* g_lv_buf1 = nullptr;
-static lv_color_t* g_lv_buf2 = nullptr;
 static lv_disp_drv_t g_lv_disp_drv;
 static lv_indev_drv_t g_lv_indev_drv;
 static lv_indev_t* g_lv_indev = nullptr;
@@ -227,34 +256,11 @@ static lv_obj_t* g_lblTitle = nullptr;
 static lv_obj_t* g_lblUpdate = nullptr;
 static lv_obj_t* g_lblStudents = nullptr;
 
-static void lvgl_flush_cb(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p) {
-  int32_t w = area->x2 - area->x1 + 1;
-  int32_t h = area->y2 - area->y1 + 1;
-  // Push 16-bit RGB565
-  M5.Display.startWrite();
-  M5.Display.setAddrWindow(area->x1, area->y1, w, h);
-  M5.Display.pushPixels((uint16_t*)&color_p->full, w * h);
-  M5.Display.endWrite();
-  lv_disp_flush_ready(disp);
-}
-
 static void initLvgl() {
   lv_init();
-  // Ensure color order matches LVGL buffer (RGB565)
-  M5.Display.setColorDepth(16);
-  M5.Display.setSwapBytes(true);
-  // Allocate 2 draw buffers (320x40 lines)
-  const int hor = 320;
-  const int ver_lines = 40;
-  g_lv_buf1 = (lv_color_t*)heap_caps_malloc(sizeof(lv_color_t) * hor * ver_lines, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-  g_lv_buf2 = (lv_color_t*)heap_caps_malloc(sizeof(lv_color_t) * hor * ver_lines, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-  lv_disp_draw_buf_init(&g_lv_draw_buf, g_lv_buf1, g_lv_buf2, hor * ver_lines);
-
   lv_disp_drv_init(&g_lv_disp_drv);
-  g_lv_disp_drv.hor_res = 320;
-  g_lv_disp_drv.ver_res = 240;
-  g_lv_disp_drv.flush_cb = lvgl_flush_cb;
-  g_lv_disp_drv.draw_buf = &g_lv_draw_buf;
+  // draw buffer(DMA 가능 320x40 x2)와 flush/monitor 콜백은 display_flush가 채운다.
+  display_flush_init(&g_lv_disp_drv);
   lv_disp_drv_register(&g_lv_disp_drv);
 
   // Root screen style: solid black, no radius
@@ -274,34 +280,30 @@ static void initLvgl() {
   g_lv_indev_drv.read_cb = lvgl_touch_read_cb;
   g_lv_indev = lv_indev_drv_register(&g_lv_indev_drv);
 
-  // KakaoSmallSans TTF를 LittleFS에서 로드하여 글로벌 폰트로 설정
-  // 성능 유지 위해 런타임 TTF는 사용하지 않음
+  // 화면별 주기 작업을 한 lv_timer로 모으고 리프레시·터치 읽기 주기를 상황에 맞춘다(ui_sched.h).
+  ui_sched_init();
+  // 화면별 평균 전류: AXP 배터리 전류를 5초마다 지금 화면 몫으로 더한다.
+  ui_sched_add([](UiSchedTask*) { ui_sched_note_current(M5.Power.getBatteryCurrent()); }, 5000, nullptr, "current");
+
+  // 비트맵 폰트는 UI 문자열 + 흔한 이름 음절 서브셋이다(tools/font_subset.py).
+  // 서브셋 밖 글자용 TTF fallback은 첫 화면 뒤 loop()에서 붙인다(font_fallback.h).
   // Build app UI skeleton
   ui_port_init();
   
   Serial.println("LVGL UI initialized");
 }
 
-static void configureMqttServer() {
-  const char* host = kMqttHosts[mqttHostIndex % (sizeof(kMqttHosts)/sizeof(kMqttHosts[0]))];
-  mqtt.setServer(host, MQTT_PORT);
-  Serial.print("MQTT host: "); Serial.println(host);
-}
-
 // 미바인딩(학생 리스트) 화면에서 오늘 학생 목록을 요청한다.
-// onMqttConnect와 loop()의 재요청 워치독에서 공통으로 사용.
+// 연결 직후(on_mqtt_session_ready)와 loop()의 재요청 워치독에서 공통으로 사용.
 static void fw_request_list_today() {
-  String cmdTopic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  DynamicJsonDocument cmd(64);
-  cmd["action"] = "list_today";
-  String payload; serializeJson(cmd, payload);
-  mqtt.publish(cmdTopic.c_str(), 1, false, payload.c_str());
+  CmdScratch<48> scratch;
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND), scratch.begin().str("action", "list_today").finish());
   g_last_list_request_ms = millis();
   Serial.println("[MQTT] Requested list_today");
 }
 
 static void update_boot_status_ui(bool force = false) {
-  if (g_first_ui_data_ready) {
+  if (g_first_ui_data_ready || g_boot_snapshot_shown) {
     ui_port_hide_boot_status();
     return;
   }
@@ -386,26 +388,24 @@ static bool is_group_cmd_v2_enabled() {
   return deviceId == GROUP_CMD_V2_TARGET_DEVICE;
 }
 
-static String make_group_transition_request_id(const char* groupId) {
+static void make_group_transition_request_id(const char* groupId, char* buf, size_t cap) {
   uint16_t gidHash = 0;
   if (groupId) {
     for (size_t i = 0; groupId[i] != '\0'; ++i) {
       gidHash = (uint16_t)((gidHash * 131u) ^ (uint8_t)groupId[i]);
     }
   }
-  char buf[56];
   uint32_t r1 = (uint32_t)esp_random();
   uint32_t r2 = (uint32_t)esp_random();
   uint32_t tick = millis();
   snprintf(
       buf,
-      sizeof(buf),
+      cap,
       "%08lx%08lx%08lx%04x",
       (unsigned long)r1,
       (unsigned long)r2,
       (unsigned long)tick,
       (unsigned int)gidHash);
-  return String(buf);
 }
 
 static void set_group_transition_lock(const char* groupId, uint32_t nowMs) {
@@ -499,12 +499,14 @@ void fw_clear_local_binding_state(void) {
       LittleFS.remove("/student_id.txt");
       Serial.println("[BIND] Cleared student_id.txt (local binding cleared)");
     }
-    LittleFS.end();
   }
   persist_student_id_nvs("");
   persist_bind_date_nvs(0);
+  g_boot_snap.clear(BOOT_SNAP_HOMEWORKS);
+  g_boot_snap.clear(BOOT_SNAP_INFO);
   studentId = "";
   g_has_homeworks_sync_state = false;
+  g_hw_stream.set_applied("", "");
   g_last_homeworks_sync_seq = 0;
   g_last_homeworks_sync_fp[0] = '\0';
   g_last_homeworks_sync_source[0] = '\0';
@@ -519,35 +521,53 @@ void fw_clear_local_binding_state(void) {
   g_group_transition_lock_until_ms = 0;
 }
 
+// LVGL 힙 상태와 화면별 최대치(lv_mem_*). 현장에서 어느 화면이 풀을 압박하는지 보려고 diag에 싣는다.
+static void append_lvgl_mem_diag(String& diag) {
+  LvglMemStats st;
+  lvgl_mem_query(&st);
+  diag += "lv_mem_in=" + String(st.in_psram ? "psram" : "internal") + "\n";
+  diag += "lv_mem_total=" + String((unsigned long)st.total) + "\n";
+  diag += "lv_mem_used=" + String((unsigned long)st.used) + "\n";
+  diag += "lv_mem_peak=" + String((unsigned long)st.peak) + "\n";
+  diag += "lv_mem_biggest=" + String((unsigned long)st.free_biggest) + "\n";
+  diag += "lv_mem_frag_pct=" + String((unsigned)st.frag_pct) + "\n";
+  diag += "lv_mem_screen=" + String(lvgl_mem_current_screen()) + "\n";
+  const LvglMemScreenPeak* peaks = nullptr;
+  uint8_t n = lvgl_mem_screen_peaks(&peaks);
+  for (uint8_t i = 0; i < n; i++) {
+    diag += "lv_mem_peak_" + String(peaks[i].screen) + "=" + String((unsigned long)peaks[i].peak_used) +
+            " biggest_min=" + String((unsigned long)(peaks[i].min_free_biggest == UINT32_MAX ? 0 : peaks[i].min_free_biggest)) + "\n";
+  }
+}
+
 void onMqttConnect(bool sessionPresent) {
   g_last_mqtt_connect_ms = millis();
-  uint32_t mqttAttemptStartedMs = g_mqtt_connect_attempt_ms;
-  uint8_t mqttStallsBeforeConnect = g_mqtt_connect_stall_count;
-  uint32_t lastMqttStallMs = g_last_mqtt_connect_stall_ms;
-  uint16_t tcpProbeFailBeforeConnect = g_tcp_probe_fail_count;
+  g_boot.mark(BOOT_STAGE_WIFI_UP);
+  g_boot.mark(BOOT_STAGE_MQTT_UP);
+  g_mqtt_attempt_started_ms = g_mqtt_link.connect_started_ms();
   g_last_mqtt_rx_any_ms = g_last_mqtt_connect_ms;
-  g_mqtt_connect_attempt_ms = 0;
-  g_mqtt_connect_in_flight = false;
-  g_mqtt_connect_stall_count = 0;
-  g_mqtt_reconnect_backoff_ms = MQTT_RECONNECT_BACKOFF_MIN_MS;
-  g_tcp_probe_fail_count = 0;
-  mqttConsecutiveDisconnects = 0;
-  ackFilterPrefix = String("academies/") + academyId + "/ack/";
-  String ackTopic = ackFilterPrefix + "+";
-  mqtt.subscribe(ackTopic.c_str(), 1);
-  todayListTopic = String("academies/") + academyId + "/devices/" + deviceId + "/students_today";
-  mqtt.subscribe(todayListTopic.c_str(), 1);
-  homeworksTopic = String("academies/") + academyId + "/devices/" + deviceId + "/homeworks";
-  mqtt.subscribe(homeworksTopic.c_str(), 1);
-  studentInfoTopic = String("academies/") + academyId + "/devices/" + deviceId + "/student_info";
-  mqtt.subscribe(studentInfoTopic.c_str(), 1);
-  unboundTopic = String("academies/") + academyId + "/devices/" + deviceId + "/unbound";
-  mqtt.subscribe(unboundTopic.c_str(), 1);
-  updateTopic = String("academies/") + academyId + "/devices/" + deviceId + "/update";
-  mqtt.subscribe(updateTopic.c_str(), 1);
-  deviceAckTopic = String("academies/") + academyId + "/devices/" + deviceId + "/ack";
-  mqtt.subscribe(deviceAckTopic.c_str(), 1);
+  g_mqtt_link.on_connected();
+  g_topic_router.configure(academyId.c_str(), deviceId.c_str());
+  {
+    static const MqttRoute kSubscribeRoutes[] = {
+        MQTT_ROUTE_ACADEMY_ACK, MQTT_ROUTE_STUDENTS_TODAY, MQTT_ROUTE_HOMEWORKS, MQTT_ROUTE_STUDENT_INFO,
+        MQTT_ROUTE_UNBOUND,     MQTT_ROUTE_UPDATE,         MQTT_ROUTE_DEVICE_ACK,
+    };
+    char topicBuf[MqttTopicRouter::kMaxPrefixBytes + 16];
+    for (MqttRoute r : kSubscribeRoutes) {
+      if (g_topic_router.topic(r, topicBuf, sizeof(topicBuf))) mqtt.subscribe(topicBuf, 1);
+    }
+  }
   Serial.printf("MQTT connected & subscribed (sessionPresent=%d)\n", sessionPresent ? 1 : 0);
+  // 새 세션: ack를 못 받은 저널 커맨드는 loop()에서 간격을 두고 다시 보낸다.
+  g_cmd_journal.start_replay();
+  // 토픽 캐시·studentId는 loop 스레드 것이다. 나머지 발행은 loop()에서 on_mqtt_session_ready()로 한다.
+  g_mqtt_session_evt.fetch_add(1, std::memory_order_release);
+}
+
+// loop: onMqttConnect 뒤 첫 loop에서 한 번. 진단·presence·초기 데이터 요청을 보낸다.
+static void on_mqtt_session_ready() {
+  const uint32_t mqttAttemptStartedMs = g_mqtt_attempt_started_ms;
   publish_last_homeworks_sync_status("mqtt_reconnect");
 
   // [WIFI-DIAG] WiFi 연결 진단을 원격 수집(최초 1회). 무선 상태에서만 재현되는
@@ -568,31 +588,46 @@ void onMqttConnect(bool sessionPresent) {
     diag += "gateway_ip=" + WiFi.gatewayIP().toString() + "\n";
     diag += "subnet=" + WiFi.subnetMask().toString() + "\n";
     diag += "mac=" + WiFi.macAddress() + "\n";
-    diag += "mqtt_host=" + String(kMqttHosts[mqttHostIndex]) + "\n";
+    g_wifi_mgr.append_diag(diag);
+    g_boot.append_diag(diag);
+    const MqttLinkStats& ls = g_mqtt_link.stats();
+    diag += "mqtt_host=" + String(g_mqtt_link.host()) + "\n";
     diag += "mqtt_port=" + String(MQTT_PORT) + "\n";
-    diag += "mqtt_connect_stalls=" + String((unsigned)mqttStallsBeforeConnect) + "\n";
-    diag += "last_mqtt_connect_stall_ms=" + String((unsigned long)lastMqttStallMs) + "\n";
-    diag += "tcp_probe_ok=" + String(g_last_tcp_probe_ok ? 1 : 0) + "\n";
-    diag += "tcp_probe_elapsed_ms=" + String((unsigned long)g_last_tcp_probe_elapsed_ms) + "\n";
-    diag += "tcp_probe_fail_count=" + String((unsigned)tcpProbeFailBeforeConnect) + "\n";
+    diag += "mqtt_attempts=" + String((unsigned long)ls.attempts) + "\n";
+    diag += "mqtt_connect_stalls=" + String((unsigned long)ls.connect_stall) + "\n";
+    diag += "mqtt_link_resumed=" + String((unsigned long)ls.resumed) + "\n";
+    diag += "last_mqtt_connect_stall_ms=" + String((unsigned long)ls.last_stall_at_ms) + "\n";
+    diag += "mqtt_host_rotations=" + String((unsigned long)ls.host_rotations) + "\n";
+    diag += "mqtt_last_backoff_ms=" + String((unsigned long)ls.last_backoff_ms) + "\n";
+    diag += "tcp_probe_ok=" + String(ls.last_probe_ok ? 1 : 0) + "\n";
+    diag += "tcp_probe_elapsed_ms=" + String((unsigned long)ls.last_probe_ms) + "\n";
+    diag += "tcp_probe_fail_count=" + String((unsigned long)ls.probe_fail) + "\n";
     diag += "free_heap=" + String((unsigned)esp_get_free_heap_size()) + "\n";
-    String diagTopic = String("academies/") + academyId + "/devices/" + deviceId + "/diag";
-    mqtt.publish(diagTopic.c_str(), 1, false, diag.c_str());
+#if CFG_MQTT_TLS
+    mqtt.append_diag(diag);
+#endif
+    append_lvgl_mem_diag(diag);
+    mqtt.publish(cmd_topics().device_topic(MQTT_DEV_TOPIC_DIAG), 1, false, diag.c_str());
     Serial.println("[WIFI-DIAG] published:\n" + diag);
   }
+#if CFG_MQTT_TLS
+  // WIFI-DIAG는 첫 연결(대개 전체 핸드셰이크) 때 나간다. 재개 수치는 처음 재개에 성공한 연결에서 한 번 더 보낸다.
+  static bool s_tls_resume_diag_sent = false;
+  if (!s_tls_resume_diag_sent && mqtt.stats().last_resumed) {
+    s_tls_resume_diag_sent = true;
+    String diag;
+    mqtt.append_diag(diag);
+    mqtt.publish(cmd_topics().device_topic(MQTT_DEV_TOPIC_DIAG), 1, false, diag.c_str());
+    Serial.println("[TLS-DIAG] published:\n" + diag);
+  }
+#endif
 
   // Presence (retain)
   {
-    DynamicJsonDocument pres(128);
-    pres["online"] = true;
-    pres["at"] = "";
-    String p; serializeJson(pres, p);
-    String presTopic = String("academies/") + academyId + "/devices/" + deviceId + "/presence";
-    mqtt.publish(presTopic.c_str(), 1, true, p.c_str());
+    publish_presence();
   }
   
   // Request initial data: 바인딩된 학생이 있으면 student_info 요청, 없으면 list_today 요청
-  String cmdTopic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
   if (studentId.length() > 0) {
     if (g_restored_binding_guard_active && g_restored_binding_guard_start_ms == 0) {
       g_restored_binding_guard_start_ms = millis();
@@ -618,12 +653,7 @@ void onMqttConnect(bool sessionPresent) {
   }
   
   // Optionally also check for updates once
-  {
-    DynamicJsonDocument doc(64);
-    doc["action"] = "check_update";
-    String payload; serializeJson(doc, payload);
-    mqtt.publish(cmdTopic.c_str(), 1, false, payload.c_str());
-  }
+  fw_publish_check_update();
 }
 
 void onMqttDisconnect(AsyncMqttClientDisconnectReason reason) {
@@ -636,231 +666,126 @@ void onMqttDisconnect(AsyncMqttClientDisconnectReason reason) {
                 WiFi.status() == WL_CONNECTED ? (int)WiFi.RSSI() : 0,
                 WiFi.status() == WL_CONNECTED ? WiFi.BSSIDstr().c_str() : "-",
                 WiFi.status() == WL_CONNECTED ? WiFi.channel() : 0);
-  g_mqtt_connect_in_flight = false;
-  g_mqtt_connect_attempt_ms = 0;
-  // 3초 후 재시도
-  nextMqttReconnectMs = millis() + g_mqtt_reconnect_backoff_ms;
-  // 짧은 끊김마다 호스트를 바꾸지 않고, 연속 실패가 누적될 때만 라운드로빈
-  mqttConsecutiveDisconnects++;
-  if (mqttConsecutiveDisconnects >= 3) {
-    mqttConsecutiveDisconnects = 0;
-    mqttHostIndex = (mqttHostIndex + 1) % (sizeof(kMqttHosts) / sizeof(kMqttHosts[0]));
-    Serial.println("[MQTT] rotating host after repeated disconnects");
-    configureMqttServer();
-  }
-}
-
-static void start_mqtt_connect(const char* reason) {
-  if (WiFi.status() != WL_CONNECTED) return;
-  if (mqtt.connected()) return;
-  if (g_mqtt_connect_in_flight) {
-    Serial.printf("[MQTT] connect skipped; already in flight (%s, age=%lums)\n",
-                  reason ? reason : "?",
-                  g_mqtt_connect_attempt_ms > 0 ? (unsigned long)(millis() - g_mqtt_connect_attempt_ms) : 0UL);
-    return;
-  }
-  const char* host = kMqttHosts[mqttHostIndex];
-  {
-    WiFiClient probe;
-    probe.setTimeout(MQTT_TCP_PROBE_TIMEOUT_MS);
-    uint32_t t0 = millis();
-    bool tcpOk = probe.connect(host, MQTT_PORT, MQTT_TCP_PROBE_TIMEOUT_MS);
-    uint32_t elapsed = millis() - t0;
-    probe.stop();
-    g_last_tcp_probe_ok = tcpOk;
-    g_last_tcp_probe_ms = millis();
-    g_last_tcp_probe_elapsed_ms = elapsed;
-    if (tcpOk) {
-      Serial.printf("[MQTT][TCP-PROBE] ok host=%s:%u elapsed=%lums ip=%s rssi=%d\n",
-                    host,
-                    (unsigned)MQTT_PORT,
-                    (unsigned long)elapsed,
-                    WiFi.localIP().toString().c_str(),
-                    (int)WiFi.RSSI());
-    } else {
-      g_tcp_probe_fail_count++;
-      Serial.printf("[MQTT][TCP-PROBE] fail host=%s:%u elapsed=%lums fails=%u ip=%s rssi=%d bssid=%s ch=%d\n",
-                    host,
-                    (unsigned)MQTT_PORT,
-                    (unsigned long)elapsed,
-                    (unsigned)g_tcp_probe_fail_count,
-                    WiFi.localIP().toString().c_str(),
-                    (int)WiFi.RSSI(),
-                    WiFi.BSSIDstr().c_str(),
-                    WiFi.channel());
-      nextMqttReconnectMs = millis() + g_mqtt_reconnect_backoff_ms;
-      g_mqtt_reconnect_backoff_ms = min(g_mqtt_reconnect_backoff_ms * 2, MQTT_RECONNECT_BACKOFF_MAX_MS);
-      if (g_tcp_probe_fail_count > 0 && (g_tcp_probe_fail_count % 3) == 0) {
-        Serial.println("[MQTT][TCP-PROBE] repeated failures -> keep WiFi, retry TCP with backoff");
-      }
-      update_boot_status_ui(true);
-      return;
-    }
-  }
-  g_mqtt_connect_in_flight = true;
-  g_mqtt_connect_attempt_ms = millis();
-  mqtt.connect();
-  Serial.printf("[MQTT] connecting (%s)\n", reason ? reason : "?");
+  // 재시도 시각·호스트 순환은 loop()의 g_mqtt_link.poll()이 정한다.
+  g_mqtt_link.on_disconnected();
 }
 
-static void handle_mqtt_connect_stall(uint32_t now) {
-  if (WiFi.status() != WL_CONNECTED) {
-    g_mqtt_connect_in_flight = false;
-    g_mqtt_connect_attempt_ms = 0;
-    return;
-  }
-  if (mqtt.connected() || !g_mqtt_connect_in_flight || g_mqtt_connect_attempt_ms == 0) return;
-
-  uint32_t ageMs = (now >= g_mqtt_connect_attempt_ms) ? (now - g_mqtt_connect_attempt_ms) : 0;
-  if (ageMs < MQTT_CONNECT_STALL_MS) return;
-
-  g_mqtt_connect_stall_count++;
-  g_last_mqtt_connect_stall_ms = now;
-  Serial.printf("[MQTT][CONNECT-STALL] age=%lums stalls=%u -> reset mqtt client, retry in %lums\n",
-                (unsigned long)ageMs,
-                (unsigned)g_mqtt_connect_stall_count,
-                (unsigned long)g_mqtt_reconnect_backoff_ms);
-  Serial.printf("[MQTT][CONNECT-STALL] wifi ip=%s rssi=%d bssid=%s ch=%d host=%s:%u\n",
-                WiFi.localIP().toString().c_str(),
-                (int)WiFi.RSSI(),
-                WiFi.BSSIDstr().c_str(),
-                WiFi.channel(),
-                kMqttHosts[mqttHostIndex],
-                (unsigned)MQTT_PORT);
-
-  mqtt.disconnect(true);
-  g_mqtt_connect_in_flight = false;
-  g_mqtt_connect_attempt_ms = 0;
-  nextMqttReconnectMs = now + g_mqtt_reconnect_backoff_ms;
-  g_mqtt_reconnect_backoff_ms = min(g_mqtt_reconnect_backoff_ms * 2, MQTT_RECONNECT_BACKOFF_MAX_MS);
-
-  // WiFi 재협상은 사용 중 화면을 계속 흔들어 더 나쁜 체감을 만든다.
-  // 연결 경로가 막혔더라도 WiFi는 유지하고 MQTT/TCP만 백오프로 재시도한다.
-  if (g_mqtt_connect_stall_count >= 3) {
-    Serial.println("[MQTT][CONNECT-STALL] repeated stalls -> keep WiFi, retry MQTT with backoff");
-    g_mqtt_connect_stall_count = 0;
-  }
+// 장치 ack 본문 처리(그룹 전환 잠금, UI 피드백, bind 결과 전달).
+static void handle_device_ack_body(const char* body) {
+  Serial.print("DEV_ACK: "); Serial.println(body);
+  handle_group_transition_device_ack(body);
+  ui_port_on_device_ack_json(body);
+  StaticJsonDocument<256> ackDoc;
+  if (deserializeJson(ackDoc, body) != DeserializationError::Ok) return;
+  const char* ackAction = ackDoc["action"] | "";
+  if (strcmp(ackAction, "bind") != 0) return;
+  bool ok = ackDoc["ok"] | false;
+  const char* reason = ackDoc["reason"] | "";
+  int attempts_left = ackDoc["attempts_left"] | -1;
+  int locked_seconds = ackDoc["locked_seconds"] | -1;
+  // Defer UI work to loop() (LVGL thread) — see g_bind_ack_pending notes.
+  portENTER_CRITICAL(&g_hw_mux);
+  g_bind_ack_ok = ok;
+  strncpy(g_bind_ack_reason, reason ? reason : "", sizeof(g_bind_ack_reason) - 1);
+  g_bind_ack_reason[sizeof(g_bind_ack_reason) - 1] = '\0';
+  g_bind_ack_attempts_left = attempts_left;
+  g_bind_ack_locked_seconds = locked_seconds;
+  g_bind_ack_pending = true;
+  portEXIT_CRITICAL(&g_hw_mux);
 }
 
+// async-tcp 태스크에서 불린다. 여기서는 힙 할당 없이 라우트만 가려 넘기고, 파싱/UI는 loop()로 미룬다.
 // AsyncMqttClient의 payload는 널 종료가 보장되지 않으므로 len 만큼만 읽는다.
-static void append_mqtt_payload(String& dst, const char* payload, size_t len) {
-  if (!payload || len == 0) return;
-  dst.reserve(dst.length() + len + 1);
-  for (size_t i = 0; i < len; ++i) dst += payload[i];
-}
-
 void onMqttMessage(char* topic, char* payload, AsyncMqttClientMessageProperties properties, size_t len, size_t index, size_t total) {
-  (void)properties; (void)index; (void)total;
-  String t = String(topic);
+  (void)properties;
   const uint32_t nowMs = millis();
   g_last_mqtt_rx_any_ms = nowMs;
-  Serial.print("MSG "); Serial.print(t); Serial.print(" len="); Serial.println((int)len);
-  if (t.startsWith(ackFilterPrefix)) {
-    g_last_mqtt_rx_ack_ms = nowMs;
-    String body; body.reserve(len + 1);
-    for (size_t i = 0; i < len; ++i) body += (char)payload[i];
-    Serial.print("ACK: "); Serial.println(body);
-  }
-  if (t == deviceAckTopic) {
-    static String da_acc;
-    static size_t da_expected = 0;
-    static size_t da_received = 0;
-    if (index == 0) {
-      da_acc.remove(0);
-      da_acc.reserve(total ? total : (len + 256));
-      da_expected = total ? total : len;
-      da_received = 0;
+  g_mqtt_link.on_rx();
+  Serial.printf("MSG %s len=%d\n", topic, (int)len);
+  const MqttRoute route = g_topic_router.match(topic);
+  g_topic_router.on_chunk(route, len, index, total);
+  switch (route) {
+    case MQTT_ROUTE_ACADEMY_ACK: {
+      g_last_mqtt_rx_ack_ms = nowMs;
+      Serial.print("ACK: "); Serial.write((const uint8_t*)payload, len); Serial.println();
+      const char* key = strrchr(topic, '/');
+      if (key && index == 0) g_cmd_journal.on_ack(key + 1);
+      break;
     }
-    append_mqtt_payload(da_acc, payload, len);
-    da_received += len;
-    if (total && da_received < total) { return; }
-    g_last_mqtt_rx_ack_ms = nowMs;
-    Serial.print("DEV_ACK: "); Serial.println(da_acc);
-    handle_group_transition_device_ack(da_acc.c_str());
-    ui_port_on_device_ack_json(da_acc.c_str());
-    {
-      StaticJsonDocument<256> ackDoc;
-      if (deserializeJson(ackDoc, da_acc.c_str()) == DeserializationError::Ok) {
-        const char* ackAction = ackDoc["action"] | "";
-        if (strcmp(ackAction, "bind") == 0) {
-          bool ok = ackDoc["ok"] | false;
-          const char* reason = ackDoc["reason"] | "";
-          int attempts_left = ackDoc["attempts_left"] | -1;
-          int locked_seconds = ackDoc["locked_seconds"] | -1;
-          // Defer UI work to loop() (LVGL thread) — see g_bind_ack_pending notes.
-          portENTER_CRITICAL(&g_hw_mux);
-          g_bind_ack_ok = ok;
-          strncpy(g_bind_ack_reason, reason ? reason : "", sizeof(g_bind_ack_reason) - 1);
-          g_bind_ack_reason[sizeof(g_bind_ack_reason) - 1] = '\0';
-          g_bind_ack_attempts_left = attempts_left;
-          g_bind_ack_locked_seconds = locked_seconds;
-          g_bind_ack_pending = true;
-          portEXIT_CRITICAL(&g_hw_mux);
-        }
+    case MQTT_ROUTE_DEVICE_ACK: {
+      const char* body = g_topic_router.assemble(route, payload, len, index, total);
+      if (!body) break;
+      g_last_mqtt_rx_ack_ms = nowMs;
+      handle_device_ack_body(body);
+      break;
+    }
+    case MQTT_ROUTE_STUDENTS_TODAY:
+      Serial.printf("students_today chunk: idx=%u len=%u total=%u\n", (unsigned)index, (unsigned)len, (unsigned)total);
+      // Defer parse + UI render to loop() (LVGL thread).
+      g_rx_queue.on_chunk(MQTT_RX_STUDENTS_TODAY, payload, len, index, total ? total : len, nowMs);
+      break;
+    case MQTT_ROUTE_HOMEWORKS: {
+      const size_t hwTotal = total ? total : len;
+      const bool done = g_hw_stream.on_chunk(payload, len, index, hwTotal, nowMs);
+      if (index + len >= hwTotal) {
+        const HwSyncStats& hs = g_hw_stream.stats();
+        if (done) g_last_mqtt_rx_homeworks_ms = nowMs;
+        Serial.printf("[M5SYNC][rx] device=%s student=%s len=%u ok=%d decode_us=%lu errors=%lu dropped=%lu\n",
+                      deviceId.c_str(),
+                      studentId.c_str(),
+                      (unsigned)hwTotal,
+                      done ? 1 : 0,
+                      (unsigned long)hs.last_decode_us,
+                      (unsigned long)hs.parse_errors,
+                      (unsigned long)hs.dropped);
       }
+      break;
     }
-    da_acc.remove(0);
-  }
-  if (t == todayListTopic) {
-    static String acc; static size_t expected = 0; static size_t received = 0;
-    if (index == 0) { acc.remove(0); acc.reserve(total ? total : (len + 512)); expected = total ? total : len; received = 0; }
-    append_mqtt_payload(acc, payload, len);
-    received += len;
-    Serial.printf("students_today chunk: idx=%u len=%u total=%u recv=%u\n", (unsigned)index, (unsigned)len, (unsigned)total, (unsigned)received);
-    if (total && received < total) { return; }
-    // Defer parse + UI render to loop() (LVGL thread).
-    g_students_payload.publish(acc);
-    acc.remove(0);
-  }
-  if (t == homeworksTopic) {
-    static String hw_acc; static size_t hw_expected = 0; static size_t hw_received = 0;
-    if (index == 0) { hw_acc.remove(0); hw_acc.reserve(total ? total : (len + 512)); hw_expected = total ? total : len; hw_received = 0; }
-    append_mqtt_payload(hw_acc, payload, len);
-    hw_received += len;
-    if (total && hw_received < total) { return; }
-    g_hw_payload.publish(hw_acc);
-    g_last_mqtt_rx_homeworks_ms = nowMs;
-    Serial.printf("[M5SYNC][rx] device=%s student=%s len=%u\n",
-                  deviceId.c_str(),
-                  studentId.c_str(),
-                  (unsigned)hw_acc.length());
-    hw_acc.remove(0);
-  }
-  if (t == updateTopic) {
-    String body; body.reserve(len + 1);
-    for (size_t i = 0; i < len; ++i) body += (char)payload[i];
-    // settings 화면에서 표시할 수 있도록 유지 (필요 시 별도 라벨 연결)
-    Serial.print("UPDATE resp: "); Serial.println(body);
-  }
-  if (t == studentInfoTopic) {
-    g_last_mqtt_rx_student_info_ms = nowMs;
-    // Defer parse + UI render to loop() (LVGL thread).
-    String body;
-    append_mqtt_payload(body, payload, len);
-    g_student_info_payload.publish(body);
-  }
-  if (t == unboundTopic) {
-    Serial.println("[MQTT] unbound received – returning to student list");
-    // Defer local-state clear + UI unbind to loop() (LVGL thread).
-    portENTER_CRITICAL(&g_hw_mux);
-    g_force_unbind_pending = true;
-    portEXIT_CRITICAL(&g_hw_mux);
-  }
+    case MQTT_ROUTE_UPDATE: {
+      // 게이트웨이가 presence(online) 응답으로 LAN 미러 매니페스트 주소를 알려 준다.
+      const char* body = g_topic_router.assemble(route, payload, len, index, total);
+      if (!body) break;
+      Serial.print("UPDATE resp: ");
+      Serial.println(body);
+      StaticJsonDocument<384> doc;
+      if (!deserializeJson(doc, body) && doc["type"] == "ota_source") ota_set_source(doc["manifest_url"] | "");
+      break;
+    }
+    case MQTT_ROUTE_STUDENT_INFO:
+      g_last_mqtt_rx_student_info_ms = nowMs;
+      // Defer parse + UI render to loop() (LVGL thread).
+      g_rx_queue.on_chunk(MQTT_RX_STUDENT_INFO, payload, len, index, total ? total : len, nowMs);
+      break;
+    case MQTT_ROUTE_UNBOUND:
+      Serial.println("[MQTT] unbound received – returning to student list");
+      // Defer local-state clear + UI unbind to loop() (LVGL thread).
+      portENTER_CRITICAL(&g_hw_mux);
+      g_force_unbind_pending = true;
+      portEXIT_CRITICAL(&g_hw_mux);
+      break;
+    default:
+      break;
+  }
+  // loop()가 ui_sched_idle()에서 자고 있으면 바로 깨워 적용한다.
+  ui_sched_wake();
 }
 
 void sendCommand(const char* action, const char* itemId) {
   Serial.printf("[CMD] >>> sendCommand action=%s itemId=%s heap=%u\n", action, itemId, (unsigned)esp_get_free_heap_size());
-  DynamicJsonDocument doc(256);
-  doc["action"] = action;
-  doc["academy_id"] = academyId;
-  doc["student_id"] = studentId;
-  doc["item_id"] = itemId;
-  doc["idempotency_key"] = String((uint32_t)esp_random(), HEX);
-  doc["at"] = "";
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/students/" + studentId + "/homework/" + itemId + "/command";
-  Serial.printf("[CMD] publish topic=%s len=%d\n", topic.c_str(), (int)payload.length());
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<256> scratch;
+  static char topic[MqttCmdEncoder::kTopicBytes];
+  const MqttCmdEncoder& enc = cmd_topics();
+  if (!enc.homework_topic(itemId, topic, sizeof(topic))) return;
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", action)
+      .str("academy_id", enc.academy_id())
+      .str("student_id", enc.student_id())
+      .str("item_id", itemId)
+      .hex32("idempotency_key", (uint32_t)esp_random())
+      .str("at", "");
+  const char* payload = w.finish();
+  Serial.printf("[CMD] publish topic=%s len=%d\n", topic, (int)w.length());
+  publish_cmd(topic, payload);
   Serial.println("[CMD] <<< sendCommand done");
 }
 
@@ -880,7 +805,6 @@ void fw_commit_bind(const char* studentIdArg) {
       f.close();
       Serial.printf("[BIND] Saved student_id: %s\n", studentIdArg);
     }
-    LittleFS.end();
   }
   g_mqtt_bind_announced = true;
 }
@@ -890,34 +814,27 @@ void fw_publish_bind(const char* studentIdArg) {
   if (!studentIdArg || !*studentIdArg) return;
   fw_commit_bind(studentIdArg);
 
-  DynamicJsonDocument doc(128);
-  doc["action"] = "bind";
-  doc["student_id"] = studentIdArg;
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  CmdScratch<128> scratch;
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND),
+              scratch.begin().str("action", "bind").str("student_id", studentIdArg).finish());
 }
 
 // 인터랙티브 로그인: 로컬 상태를 바꾸지 않고 bind 커맨드만 발행. ack 성공 시 fw_commit_bind로 확정.
 void fw_request_bind(const char* studentIdArg, const char* pin) {
   if (!studentIdArg || !*studentIdArg) return;
-  DynamicJsonDocument doc(192);
-  doc["action"] = "bind";
-  doc["student_id"] = studentIdArg;
-  if (pin && *pin) doc["pin"] = pin;
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<160> scratch;
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", "bind").str("student_id", studentIdArg);
+  if (pin && *pin) w.str("pin", pin);
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND), w.finish());
   Serial.printf("[BIND] request bind (await ack) student=%s pin=%s\n", studentIdArg, (pin && *pin) ? "set" : "none");
 }
 
 void fw_publish_unbind() {
-  DynamicJsonDocument doc(128);
-  doc["action"] = "unbind";
-  doc["student_id"] = studentId;
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<128> scratch;
+  const MqttCmdEncoder& enc = cmd_topics();
+  publish_cmd(enc.device_topic(MQTT_DEV_TOPIC_COMMAND),
+              scratch.begin().str("action", "unbind").str("student_id", enc.student_id()).finish());
   fw_clear_local_binding_state();
   Serial.println("[UNBIND] local binding cleared after publish");
 }
@@ -954,37 +871,35 @@ static void handle_bind_day_expiry(uint32_t nowTick) {
 
 void fw_publish_student_info(const char* studentIdArg) {
   if (!studentIdArg || !*studentIdArg) return;
-  DynamicJsonDocument doc(128);
-  doc["action"] = "student_info";
-  doc["student_id"] = studentIdArg;
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  CmdScratch<128> scratch;
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND),
+              scratch.begin().str("action", "student_info").str("student_id", studentIdArg).finish());
 }
 
 void fw_publish_list_homeworks(const char* studentIdArg) {
   if (!studentIdArg || !*studentIdArg) return;
-  DynamicJsonDocument doc(128);
-  doc["action"] = "list_homeworks";
-  doc["student_id"] = studentIdArg;
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  CmdScratch<128> scratch;
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND),
+              scratch.begin().str("action", "list_homeworks").str("student_id", studentIdArg).finish());
 }
 
 void fw_publish_homework_action(const char* action, const char* itemId) {
   if (!action || !*action || !itemId || !*itemId) return;
-  DynamicJsonDocument doc(256);
-  doc["action"] = action;
-  doc["academy_id"] = academyId;
-  doc["student_id"] = studentId;
-  doc["item_id"] = itemId;
-  doc["idempotency_key"] = String((uint32_t)esp_random(), HEX);
-  doc["at"] = "";
-  doc["updated_by"] = studentId;
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/students/" + studentId + "/homework/" + itemId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<288> scratch;
+  static char topic[MqttCmdEncoder::kTopicBytes];
+  const MqttCmdEncoder& enc = cmd_topics();
+  if (!enc.homework_topic(itemId, topic, sizeof(topic))) return;
+  char key[CmdJournal::kKeyBytes];
+  const uint32_t op = g_cmd_journal.reserve(key);
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", action)
+      .str("academy_id", enc.academy_id())
+      .str("student_id", enc.student_id())
+      .str("item_id", itemId)
+      .str("idempotency_key", key)
+      .str("at", "")
+      .str("updated_by", enc.student_id());
+  publish_journaled_cmd(op, topic, w.finish());
 }
 
 bool fw_publish_group_transition(const char* groupId, int from_phase) {
@@ -1001,33 +916,37 @@ bool fw_publish_group_transition(const char* groupId, int from_phase) {
     return false;
   }
 
-  DynamicJsonDocument doc(320);
-  doc["action"] = "group_transition";
-  doc["academy_id"] = academyId;
-  doc["student_id"] = studentId;
-  doc["item_id"] = "GROUP";
-  doc["group_id"] = groupId;
-  if (from_phase > 0) doc["from_phase"] = from_phase;
-  doc["at"] = "";
-  doc["updated_by"] = studentId;
-
-  String topic;
-  String requestId;
+  static CmdScratch<384> scratch;
+  static char groupTopic[MqttCmdEncoder::kTopicBytes];
+  const MqttCmdEncoder& enc = cmd_topics();
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", "group_transition")
+      .str("academy_id", enc.academy_id())
+      .str("student_id", enc.student_id())
+      .str("item_id", "GROUP")
+      .str("group_id", groupId);
+  if (from_phase > 0) w.num("from_phase", from_phase);
+  w.str("at", "").str("updated_by", enc.student_id());
+
+  const char* topic = nullptr;
+  char requestId[40] = "";
+  uint32_t op = 0;
   if (useV2) {
-    requestId = make_group_transition_request_id(groupId);
-    doc["request_id"] = requestId;
-    doc["idempotency_key"] = requestId;
-    topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
+    make_group_transition_request_id(groupId, requestId, sizeof(requestId));
+    w.str("request_id", requestId).str("idempotency_key", requestId);
+    topic = enc.device_topic(MQTT_DEV_TOPIC_COMMAND);
   } else {
-    doc["idempotency_key"] = String((uint32_t)esp_random(), HEX);
-    topic = String("academies/") + academyId + "/students/" + studentId + "/homework/GROUP/command";
+    // v2는 자체 request_id/잠금/타임아웃이 있어 저널 없이 바로 보낸다. 구 경로만 저널에 남긴다.
+    char key[CmdJournal::kKeyBytes];
+    op = g_cmd_journal.reserve(key);
+    w.str("idempotency_key", key);
+    if (enc.homework_topic("GROUP", groupTopic, sizeof(groupTopic))) topic = groupTopic;
   }
 
-  String payload;
-  serializeJson(doc, payload);
-  uint16_t pkt = mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  const char* payload = w.finish();
+  uint16_t pkt = useV2 ? publish_cmd(topic, payload) : (topic && publish_journaled_cmd(op, topic, payload) ? 1 : 0);
   if (pkt == 0) {
-    Serial.printf("[GROUP_CMD_V2] publish failed group=%s topic=%s\n", groupId, topic.c_str());
+    Serial.printf("[GROUP_CMD_V2] publish failed group=%s topic=%s\n", groupId, topic ? topic : "-");
     return false;
   }
 
@@ -1039,7 +958,7 @@ bool fw_publish_group_transition(const char* groupId, int from_phase) {
     set_group_transition_lock(groupId, nowMs);
     Serial.printf(
         "[GROUP_CMD_V2] sent request_id=%s group=%s phase=%d packet=%u\n",
-        requestId.c_str(),
+        requestId,
         groupId,
         from_phase,
         (unsigned)pkt);
@@ -1050,40 +969,38 @@ bool fw_publish_group_transition(const char* groupId, int from_phase) {
 
 void fw_publish_pause_all() {
   if (!studentId.length()) return;
-  DynamicJsonDocument doc(192);
-  doc["action"] = "pause_all";
-  doc["academy_id"] = academyId;
-  doc["student_id"] = studentId;
-  doc["item_id"] = "ALL";
-  doc["idempotency_key"] = String((uint32_t)esp_random(), HEX);
-  doc["at"] = "";
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/students/" + studentId + "/homework/ALL/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<192> scratch;
+  static char topic[MqttCmdEncoder::kTopicBytes];
+  const MqttCmdEncoder& enc = cmd_topics();
+  if (!enc.homework_topic("ALL", topic, sizeof(topic))) return;
+  char key[CmdJournal::kKeyBytes];
+  const uint32_t op = g_cmd_journal.reserve(key);
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", "pause_all")
+      .str("academy_id", enc.academy_id())
+      .str("student_id", enc.student_id())
+      .str("item_id", "ALL")
+      .str("idempotency_key", key)
+      .str("at", "");
+  publish_journaled_cmd(op, topic, w.finish());
 }
 
 void fw_publish_raise_question() {
   if (!studentId.length()) return;
-  DynamicJsonDocument doc(192);
-  doc["action"] = "raise_question";
-  doc["academy_id"] = academyId;
-  doc["student_id"] = studentId;
-  String payload;
-  serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<192> scratch;
+  const MqttCmdEncoder& enc = cmd_topics();
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", "raise_question").str("academy_id", enc.academy_id()).str("student_id", enc.student_id());
+  publish_cmd(enc.device_topic(MQTT_DEV_TOPIC_COMMAND), w.finish());
 }
 
 void fw_publish_create_descriptive_writing() {
   if (!studentId.length()) return;
-  DynamicJsonDocument doc(192);
-  doc["action"] = "create_descriptive_writing";
-  doc["academy_id"] = academyId;
-  doc["student_id"] = studentId;
-  String payload;
-  serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<192> scratch;
+  const MqttCmdEncoder& enc = cmd_topics();
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", "create_descriptive_writing").str("academy_id", enc.academy_id()).str("student_id", enc.student_id());
+  publish_cmd(enc.device_topic(MQTT_DEV_TOPIC_COMMAND), w.finish());
 }
 
 static void publish_last_homeworks_sync_status(const char* reason) {
@@ -1091,22 +1008,26 @@ static void publish_last_homeworks_sync_status(const char* reason) {
       !g_last_homeworks_sync_fp[0]) {
     return;
   }
-  DynamicJsonDocument doc(320);
-  doc["type"] = "homeworks_apply";
-  doc["ok"] = true;
-  doc["device_id"] = deviceId;
-  doc["student_id"] = studentId;
-  doc["sync_seq"] = g_last_homeworks_sync_seq;
-  doc["sync_fp"] = g_last_homeworks_sync_fp;
-  doc["source"] = g_last_homeworks_sync_source;
-  doc["group_count"] = g_last_homeworks_group_count;
-  doc["report_reason"] = reason ? reason : "status";
-  doc["at"] = "";
-
-  String payload;
-  serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/sync_ack";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  // 주기 보고와 연결 직후(on_mqtt_session_ready) 모두 loop 스레드에서 불린다.
+  CmdScratch<448> scratch;
+  const MqttCmdEncoder& enc = cmd_topics();
+  CmdJsonWriter w = scratch.begin();
+  w.str("type", "homeworks_apply")
+      .boolean("ok", true)
+      .str("device_id", enc.device_id())
+      .str("student_id", enc.student_id())
+      .num("sync_seq", (long)g_last_homeworks_sync_seq)
+      .str("sync_fp", g_last_homeworks_sync_fp)
+      .str("source", g_last_homeworks_sync_source)
+      .num("group_count", (long)g_last_homeworks_group_count)
+      .str("report_reason", reason ? reason : "status")
+      .num("rx_coalesced", (long)(g_rx_queue.stats().coalesced + g_hw_stream.stats().coalesced))
+      .num("rx_dropped", (long)(g_rx_queue.dropped_total() + g_hw_stream.stats().dropped))
+      .num("decode_us", (long)g_hw_stream.stats().last_decode_us)
+      .str("wire", g_last_homeworks_msgpack ? "msgpack" : "json")
+      .num("patch", 1)  // homeworks patch(meta.mode="patch") 적용 가능
+      .str("at", "");
+  publish_cmd(enc.device_topic(MQTT_DEV_TOPIC_SYNC_ACK), w.finish());
   g_last_homeworks_sync_status_ms = millis();
   Serial.printf("[M5SYNC][ack] device=%s student=%s sync_seq=%lu sync_fp=%s groups=%u reason=%s\n",
                 deviceId.c_str(),
@@ -1117,58 +1038,62 @@ static void publish_last_homeworks_sync_status(const char* reason) {
                 reason ? reason : "status");
 }
 
-static void publish_homeworks_sync_ack(JsonObject meta, unsigned int groupCount) {
-  const char* syncFp = meta["sync_fp"] | "";
-  if (!syncFp || !syncFp[0]) return;
-  g_last_homeworks_sync_seq = meta["sync_seq"] | 0;
-  snprintf(g_last_homeworks_sync_fp, sizeof(g_last_homeworks_sync_fp), "%s", syncFp);
-  snprintf(
-      g_last_homeworks_sync_source,
-      sizeof(g_last_homeworks_sync_source),
-      "%s",
-      (const char*)(meta["source"] | ""));
+static void publish_homeworks_sync_ack(const HwSyncMeta& meta, unsigned int groupCount, const char* reason) {
+  if (!meta.sync_fp[0]) return;
+  g_last_homeworks_sync_seq = meta.sync_seq;
+  snprintf(g_last_homeworks_sync_fp, sizeof(g_last_homeworks_sync_fp), "%s", meta.sync_fp);
+  snprintf(g_last_homeworks_sync_source, sizeof(g_last_homeworks_sync_source), "%s", meta.source);
   g_last_homeworks_group_count = groupCount;
   g_has_homeworks_sync_state = true;
-  publish_last_homeworks_sync_status("apply");
+  publish_last_homeworks_sync_status(reason);
 }
 
-// OTA 다운로드는 loop()를 수 분간 점유하므로 그동안 워치독 감시에서 제외한다.
-void fw_watchdog_pause() { esp_task_wdt_delete(NULL); }
-void fw_watchdog_resume() { esp_task_wdt_add(NULL); esp_task_wdt_reset(); }
+// patch 기준(base_fp)이 디코더가 가진 스냅샷과 다르다: 마지막 적용 상태는 그대로 두고
+// ok:false 로 알려 게이트웨이가 전체 스냅샷을 다시 보내게 한다.
+static void publish_homeworks_patch_reject(const HwSyncMeta& meta) {
+  if (!mqtt.connected()) return;
+  static CmdScratch<384> scratch;
+  const MqttCmdEncoder& enc = cmd_topics();
+  CmdJsonWriter w = scratch.begin();
+  w.str("type", "homeworks_apply")
+      .boolean("ok", false)
+      .str("device_id", enc.device_id())
+      .str("student_id", enc.student_id())
+      .num("sync_seq", (long)meta.sync_seq)
+      .str("sync_fp", meta.sync_fp)
+      .str("base_fp", meta.base_fp)
+      .str("report_reason", "patch_base_mismatch")
+      .num("patch", 1)
+      .str("at", "");
+  publish_cmd(enc.device_topic(MQTT_DEV_TOPIC_SYNC_ACK), w.finish());
+  Serial.printf("[M5SYNC][patch-reject] device=%s student=%s sync_seq=%lu base_fp=%s rejects=%lu\n",
+                deviceId.c_str(),
+                studentId.c_str(),
+                meta.sync_seq,
+                meta.base_fp,
+                (unsigned long)g_hw_stream.stats().patch_rejects);
+}
+
+void fw_homeworks_sync_invalidate(void) {
+  g_hw_stream.set_applied("", "");
+}
 
 void fw_publish_check_update() {
-  DynamicJsonDocument doc(64);
-  doc["action"] = "check_update";
-  String payload; serializeJson(doc, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  CmdScratch<48> scratch;
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND), scratch.begin().str("action", "check_update").finish());
 }
 
 void fw_publish_list_today() {
-  DynamicJsonDocument cmd(64);
-  cmd["action"] = "list_today";
-  String payload; serializeJson(cmd, payload);
-  String topic = String("academies/") + academyId + "/devices/" + deviceId + "/command";
-  mqtt.publish(topic.c_str(), 1, false, payload.c_str());
+  static CmdScratch<48> scratch;
+  publish_cmd(cmd_topics().device_topic(MQTT_DEV_TOPIC_COMMAND), scratch.begin().str("action", "list_today").finish());
   Serial.println("[MQTT] Requested list_today (manual)");
 }
 
-void setup() {
-  auto cfg = M5.config(); M5.begin(cfg);
-  M5.Display.setTextSize(2);
-  Serial.begin(115200);
+static void restore_boot_snapshot();  // apply_* 페이로드 처리기 뒤에 정의
 
-  if (g_loop_stage_magic == LOOP_STAGE_MAGIC) {
-    Serial.printf("[WDT] previous run: last loop stage=%lu ui stage=%lu reset_reason=%d\n",
-                  (unsigned long)g_loop_stage, (unsigned long)g_ui_stage,
-                  (int)esp_reset_reason());
-  }
-  g_loop_stage_magic = LOOP_STAGE_MAGIC;
-  g_loop_stage = 0;
-  g_ui_stage = 0;
-  esp_task_wdt_init(LOOP_WDT_TIMEOUT_S, true);
-  esp_task_wdt_add(NULL);
+// ---- 부팅 단계(boot_profile.h). 의존 관계는 boot_profile.cpp의 표에 선언되어 있다. ----
 
+static void boot_stage_nvs() {
   // NVS에서 device_id 로드 (OTA 후에도 유지)
   {
     Preferences prefs;
@@ -1202,104 +1127,46 @@ void setup() {
       Serial.printf("[NVS] restored student_id: %s\n", studentId.c_str());
     }
   }
+}
+
+// 캐시한 AP로 바로 붙거나 백그라운드 스캔을 건다. 접속은 WiFi 드라이버 태스크에서 진행되므로
+// 이어지는 LittleFS/LVGL/UI 구성과 겹친다. 마무리는 loop()의 g_wifi_mgr.poll()이 한다.
+static void boot_stage_wifi_start() {
+  static const char* const kWifiSsids[] = { WIFI_SSID, u8"정현" };  // UTF-8 리터럴(플래그 인코딩 이슈 대비)
+  g_wifi_mgr.begin(kWifiSsids, (uint8_t)(sizeof(kWifiSsids) / sizeof(kWifiSsids[0])), WIFI_PASS, &g_wifi_diag);
+  g_wifi_connect_start_ms = g_wifi_mgr.begin_ms();
+}
 
+static void boot_stage_lvgl() {
   initLvgl();
   ui_port_show_boot_status();
-  ui_port_update_boot_status(u8"WiFi 연결 준비 중...", 10);
+  ui_port_update_boot_status(u8"WiFi 연결 중...", 15);
   lv_timer_handler();
+#if CFG_DISP_BENCH > 0
+  display_flush_bench(CFG_DISP_BENCH);
+#endif
   // 영문 기본 폰트 사용 (한글 비표시 깨짐 방지). 한글 폰트는 추후 내장 폰트로 교체 예정
   M5.Display.setFont(&fonts::Font0);
-  // 2.4GHz만 사용, 채널 자동
-  WiFi.mode(WIFI_STA);
-  WiFi.setSleep(false);
-  WiFi.setAutoReconnect(true);
-  // 채널 12/13 사용을 위해 국가 코드 설정 (KR)
-  wifi_country_t kr = {"KR", 1, 13, WIFI_COUNTRY_POLICY_AUTO};
-  esp_wifi_set_country(&kr);
-  // SSID가 한글인 경우도 안전하게 스캔 후 채널로 접속 시도
-  int targetChannel = 0;
-  const char* configuredSsid = WIFI_SSID;
-  const char* fallbackUtf8Ssid = u8"정현"; // UTF-8 리터럴(플래그 인코딩 이슈 대비)
-  const char* ssidToUse = configuredSsid;
-  bool foundMatch = false;
-  uint8_t targetBssid[6] = {0};
-  g_wifi_connect_start_ms = millis();
-  int targetRssi = 0;
-  {
-    Serial.println("WiFi scanning...");
-    ui_port_update_boot_status(u8"WiFi 검색 중...", 15);
-    lv_timer_handler();
-    int n = WiFi.scanNetworks();
-    g_wifi_diag += "scan_nets=" + String(n) + "\n";
-    for (int i = 0; i < n; ++i) {
-      String s = WiFi.SSID(i);
-      int ch = WiFi.channel(i);
-      int rssi = WiFi.RSSI(i);
-      if (i < 6) { Serial.printf("%d) %s (ch%d rssi%d)\n", i + 1, s.c_str(), ch, rssi); }
-      // 진단: 스캔된 AP 목록(최대 12개) — 단일/다중 AP, 신호세기 확인용
-      if (i < 12) {
-        g_wifi_diag += "ap[" + String(i) + "]=" + s + " ch" + String(ch) + " rssi" + String(rssi) + "\n";
-      }
-      // 같은 SSID가 여러 개여도 RSSI가 가장 강한 AP를 선택(약한 AP 고정으로 인한 첫 연결 실패 방지)
-      if (s == String(configuredSsid) || s == String(fallbackUtf8Ssid)) {
-        if (!foundMatch || rssi > targetRssi) {
-          targetChannel = ch; ssidToUse = (s == String(configuredSsid)) ? configuredSsid : fallbackUtf8Ssid;
-          foundMatch = true; targetRssi = rssi; memcpy(targetBssid, WiFi.BSSID(i), 6);
-        }
-      }
-    }
-    WiFi.scanDelete();
-  }
-  g_wifi_diag += "first_attempt ssid=" + String(ssidToUse) + " ch" + String(targetChannel) + " rssi" + String(targetRssi) + " matched=" + String(foundMatch ? 1 : 0) + "\n";
-  if (targetChannel > 0) {
-    if (foundMatch) {
-      WiFi.begin(ssidToUse, WIFI_PASS, targetChannel, targetBssid);
-    } else {
-      WiFi.begin(ssidToUse, WIFI_PASS, targetChannel);
-    }
-  } else {
-    WiFi.begin(ssidToUse, WIFI_PASS);
-  }
+  screensaver_init(20000);
+  screensaver_attach_activity(lv_scr_act());
+}
 
-  uint32_t start = millis();
-  while (WiFi.status() != WL_CONNECTED && millis() - start < 8000) {
-    update_boot_status_ui(true);
-    lv_timer_handler();
-    delay(200);
-  }
-  g_wifi_diag += "first_result connected=" + String(WiFi.status() == WL_CONNECTED ? 1 : 0) + " elapsed_ms=" + String((unsigned long)(millis() - start)) + " status=" + String((int)WiFi.status()) + "\n";
-
-  // Fallback: SSID 인코딩 문제로 실패 시, 스캔 결과를 이용해 순차 접속 시도
-  if (WiFi.status() != WL_CONNECTED) {
-    g_wifi_diag += "fallback entered=1\n";
-    M5.Display.println("Fallback connect trials...");
-    int n2 = WiFi.scanNetworks();
-    for (int i = 0; i < n2; ++i) {
-      String ss = WiFi.SSID(i);
-      int ch = WiFi.channel(i);
-      const uint8_t* bssid = WiFi.BSSID(i);
-      M5.Display.printf("Try %d: %s (ch%d)\n", i + 1, ss.c_str(), ch);
-      WiFi.begin(ss.c_str(), WIFI_PASS, ch, bssid);
-      uint32_t t0 = millis();
-      while (WiFi.status() != WL_CONNECTED && millis() - t0 < 6000) {
-        update_boot_status_ui(true);
-        lv_timer_handler();
-        delay(200);
-      }
-      g_wifi_diag += "fallback_try[" + String(i) + "]=" + ss + " connected=" + String(WiFi.status() == WL_CONNECTED ? 1 : 0) + "\n";
-      if (WiFi.status() == WL_CONNECTED) break;
-    }
-    WiFi.scanDelete();
-  }
-  g_wifi_connected_ms = millis();
-  if (WiFi.status() == WL_CONNECTED) {
-    g_wifi_diag += "final connected=1 rssi=" + String((int)WiFi.RSSI()) + " total_ms=" + String((unsigned long)(g_wifi_connected_ms - g_wifi_connect_start_ms)) + "\n";
+static void boot_stage_hw_stream() {
+  if (!g_hw_stream.begin()) {
+    Serial.println("[M5SYNC] ERROR: failed to allocate homeworks frames");
   } else {
-    g_wifi_diag += "final connected=0 total_ms=" + String((unsigned long)(g_wifi_connected_ms - g_wifi_connect_start_ms)) + "\n";
+    Serial.printf("[M5SYNC] stream decoder ready footprint=%u\n", (unsigned)g_hw_stream.footprint_bytes());
   }
-  update_boot_status_ui(true);
+}
+
+static void boot_stage_snapshot() {
+  restore_boot_snapshot();
   lv_timer_handler();
-  configureMqttServer();
+  if (g_boot_snapshot_shown) g_boot.mark(BOOT_STAGE_FIRST_SCREEN);
+}
+
+static void boot_stage_mqtt_setup() {
+  g_mqtt_link.begin(&mqtt, kMqttHosts, (uint8_t)(sizeof(kMqttHosts) / sizeof(kMqttHosts[0])), MQTT_PORT);
   mqtt.setKeepAlive(30);
   mqtt.setCleanSession(true);
   mqtt.onConnect(onMqttConnect);
@@ -1321,14 +1188,251 @@ void setup() {
   snprintf(willPayloadBuf, sizeof(willPayloadBuf), "{\"online\":false,\"at\":\"\"}");
   snprintf(willTopicBuf, sizeof(willTopicBuf), "academies/%s/devices/%s/presence", academyId.c_str(), deviceId.c_str());
   mqtt.setWill(willTopicBuf, 1, true, willPayloadBuf, strlen(willPayloadBuf));
-  start_mqtt_connect("setup");
-  update_boot_status_ui(true);
-  Serial.print("WiFi connected, IP: "); Serial.println(WiFi.localIP());
-  configTime(9 * 3600, 0, "pool.ntp.org", "time.google.com");
+  g_mqtt_link.kick("setup", millis(), 0);
   Serial.println("MQTT connecting...");
-  
-  screensaver_init(20000);
-  screensaver_attach_activity(lv_scr_act());
+}
+
+// loop: 비동기 부팅 단계의 완료를 기록한다(MQTT_UP은 onMqttConnect에서).
+static void boot_profile_poll() {
+  if (g_boot.done(BOOT_STAGE_FIRST_DATA)) return;
+  if (g_wifi_mgr.connected()) g_boot.mark(BOOT_STAGE_WIFI_UP);
+  if (!g_boot.done(BOOT_STAGE_TIME_SYNC) && time(nullptr) > 1700000000) g_boot.mark(BOOT_STAGE_TIME_SYNC);
+  if (g_boot_snapshot_shown || g_first_ui_data_ready) g_boot.mark(BOOT_STAGE_FIRST_SCREEN);
+  if (g_first_ui_data_ready) g_boot.mark(BOOT_STAGE_FIRST_DATA);
+}
+
+void setup() {
+  Serial.begin(115200);
+  g_boot.begin();
+  g_boot.run(BOOT_STAGE_HW, [] {
+    auto cfg = M5.config(); M5.begin(cfg);
+    M5.Display.setTextSize(2);
+  });
+
+  if (g_loop_stage_magic == LOOP_STAGE_MAGIC) {
+    Serial.printf("[WDT] previous run: last loop stage=%lu ui stage=%lu reset_reason=%d\n",
+                  (unsigned long)g_loop_stage, (unsigned long)g_ui_stage,
+                  (int)esp_reset_reason());
+  }
+  g_loop_stage_magic = LOOP_STAGE_MAGIC;
+  g_loop_stage = 0;
+  g_ui_stage = 0;
+  esp_task_wdt_init(LOOP_WDT_TIMEOUT_S, true);
+  esp_task_wdt_add(NULL);
+
+  // 네트워크(무선 연결, SNTP)를 먼저 걸어 두고 그동안 파일시스템과 화면을 준비한다.
+  g_boot.run(BOOT_STAGE_NVS, boot_stage_nvs);
+  g_boot.run(BOOT_STAGE_WIFI_START, boot_stage_wifi_start);
+  g_boot.run(BOOT_STAGE_NTP_START, [] { configTime(9 * 3600, 0, "pool.ntp.org", "time.google.com"); });
+  g_boot.run(BOOT_STAGE_FS, [] { g_cmd_journal.begin(); });
+  g_boot.run(BOOT_STAGE_LVGL, boot_stage_lvgl);
+  g_boot.run(BOOT_STAGE_HW_STREAM, boot_stage_hw_stream);
+  g_boot.run(BOOT_STAGE_SNAPSHOT, boot_stage_snapshot);
+  g_boot.run(BOOT_STAGE_MQTT_SETUP, boot_stage_mqtt_setup);
+  update_boot_status_ui(true);
+}
+
+// 게이트웨이에서 새 목록/과제를 받아 반영했다: 부팅 캐시 화면이었다면 배지를 내린다.
+static void mark_fresh_ui_data() {
+  g_first_ui_data_ready = true;
+  if (g_boot_snapshot_shown) {
+    g_boot_snapshot_shown = false;
+    ui_port_set_stale(false);
+    Serial.printf("[SNAP] reconciled with live data after %lums\n", (unsigned long)millis());
+  }
+}
+
+// apply_students/student_info 는 큐 슬롯 버퍼를 그대로 넘겨받아 제자리(zero-copy) 파싱한다.
+// 문자열 값은 버퍼를 가리키므로 release() 전에 UI/상태로 복사가 끝나야 한다.
+static void apply_homeworks_frame(const HwSyncFrame& frame) {
+  g_last_homeworks_msgpack = frame.msgpack;
+  if (frame.patch_rejected) {
+    publish_homeworks_patch_reject(frame.meta);
+    return;
+  }
+  // 이미 화면에 있는 스냅샷(재동기화 폭주 등): UI 비교 없이 ack만 돌려준다.
+  if (frame.unchanged) {
+    Serial.printf("[M5SYNC][skip] device=%s student=%s sync_seq=%lu sync_fp=%s source=%s len=%u decode_us=%lu\n",
+                  deviceId.c_str(),
+                  studentId.c_str(),
+                  frame.meta.sync_seq,
+                  frame.meta.sync_fp,
+                  frame.meta.source,
+                  (unsigned)frame.bytes,
+                  (unsigned long)frame.decode_us);
+    mark_fresh_ui_data();
+    g_restored_binding_guard_active = false;
+    publish_homeworks_sync_ack(frame.meta, g_last_homeworks_group_count, "unchanged");
+    return;
+  }
+  Serial.printf("[M5SYNC][apply] device=%s student=%s meta_student=%s sync_seq=%lu sync_fp=%s source=%s mode=%s wire=%s groups=%u len=%u decode_us=%lu\n",
+                deviceId.c_str(),
+                studentId.c_str(),
+                frame.meta.student_id,
+                frame.meta.sync_seq,
+                frame.meta.sync_fp,
+                frame.meta.source,
+                frame.meta.patch ? "patch" : "full",
+                frame.msgpack ? "msgpack" : "json",
+                (unsigned)frame.group_cnt,
+                (unsigned)frame.bytes,
+                (unsigned long)frame.decode_us);
+  if (ui_port_update_homeworks(frame)) {
+    g_hw_stream.set_applied(frame.meta.student_id, frame.meta.sync_fp);
+    g_boot_snap.commit_homeworks(frame, millis());
+  }
+  mark_fresh_ui_data();
+  g_restored_binding_guard_active = false;
+  publish_homeworks_sync_ack(frame.meta, (unsigned)frame.group_cnt, "apply");
+}
+
+// 게이트웨이는 presence의 wire 값에 따라 JSON 또는 MessagePack으로 보낸다.
+// JSON 본문은 '{'/'['로 시작하고, msgpack map/array 헤더는 0x80 이상이다.
+static bool is_msgpack_payload(const char* body, size_t len) {
+  return len > 0 && (uint8_t)body[0] >= 0x80;
+}
+
+// 문자열은 입력 버퍼를 가리키므로(zero-copy) 문서 용량은 노드 수에 비례한다.
+// msgpack은 같은 노드 수를 더 적은 바이트로 보내므로 본문 길이를 2배로 잡는다.
+static size_t device_payload_capacity(const char* body, size_t len, size_t extra) {
+  return (is_msgpack_payload(body, len) ? len * 2 : len) + extra;
+}
+
+static DeserializationError deserialize_device_payload(JsonDocument& doc, char* body, size_t len) {
+  if (is_msgpack_payload(body, len)) return deserializeMsgPack(doc, body, len);
+  return deserializeJson(doc, body, len);
+}
+
+// from_snapshot: 부팅 캐시에서 다시 그리는 경우. 화면만 바꾸고 수신 상태·진단은 건드리지 않는다.
+static void apply_students_payload(char* json, size_t len, bool from_snapshot = false) {
+  // 파싱이 버퍼를 제자리에서 바꾸므로 캐시용 원본은 먼저 복사해 둔다.
+  if (!from_snapshot) g_boot_snap.stage(BOOT_SNAP_STUDENTS, json, len);
+  DynamicJsonDocument doc(device_payload_capacity(json, len, 2048));
+  DeserializationError err = deserialize_device_payload(doc, json, len);
+  if (err) {
+    Serial.print("students_today parse error: "); Serial.println(err.c_str());
+    return;
+  }
+  JsonArray arr;
+  if (doc.containsKey("students") && doc["students"].is<JsonArray>()) {
+    arr = doc["students"].as<JsonArray>();
+  } else if (doc.is<JsonArray>()) {
+    arr = doc.as<JsonArray>();
+  } else if (doc.containsKey("items") && doc["items"].is<JsonArray>()) {
+    arr = doc["items"].as<JsonArray>();
+  } else if (doc.containsKey("data") && doc["data"].is<JsonArray>()) {
+    arr = doc["data"].as<JsonArray>();
+  }
+  Serial.printf("students_today count=%d wire=%s len=%u doc=%u\n",
+                (int)arr.size(),
+                is_msgpack_payload(json, len) ? "msgpack" : "json",
+                (unsigned)len,
+                (unsigned)doc.memoryUsage());
+  ui_port_update_students(arr);
+  if (from_snapshot) return;
+  g_boot_snap.commit(BOOT_SNAP_STUDENTS, "", "", millis());
+  g_students_received = true;
+  mark_fresh_ui_data();
+  if (!g_list_diag_sent && mqtt.connected()) {
+    g_list_diag_sent = true;
+    String diag;
+    uint32_t nowMs = millis();
+    diag += "list_today_received=1\n";
+    diag += "list_today_count=" + String((int)arr.size()) + "\n";
+    if (g_last_list_request_ms > 0 && nowMs >= g_last_list_request_ms) {
+      diag += "list_today_after_request_ms=" + String((unsigned long)(nowMs - g_last_list_request_ms)) + "\n";
+    }
+    diag += "list_today_after_mqtt_ms=" + String(g_last_mqtt_connect_ms > 0 && nowMs >= g_last_mqtt_connect_ms ? (unsigned long)(nowMs - g_last_mqtt_connect_ms) : 0UL) + "\n";
+    const MqttRxStats& rx = g_rx_queue.stats();
+    diag += "rxq_enqueued=" + String((unsigned long)rx.enqueued) + "\n";
+    diag += "rxq_coalesced=" + String((unsigned long)rx.coalesced) + "\n";
+    diag += "rxq_dropped=" + String((unsigned long)g_rx_queue.dropped_total()) + "\n";
+    diag += "rxq_max_depth=" + String((unsigned long)rx.max_depth) + "\n";
+    for (uint8_t r = MQTT_ROUTE_ACADEMY_ACK; r < MQTT_ROUTE_COUNT; r++) {
+      const MqttRouteStats& rs = g_topic_router.stats((MqttRoute)r);
+      diag += "route_" + String(MqttTopicRouter::name((MqttRoute)r)) + "=msgs:" + String((unsigned long)rs.messages) +
+              " chunks:" + String((unsigned long)rs.chunks) + " bytes:" + String((unsigned long)rs.bytes) +
+              " dropped:" + String((unsigned long)rs.dropped) + "\n";
+    }
+    diag += "route_unmatched=" + String((unsigned long)g_topic_router.unmatched()) + "\n";
+    const CmdJournalStats& js = g_cmd_journal.stats();
+    diag += "cmdj_pending=" + String((unsigned)g_cmd_journal.pending()) + "\n";
+    diag += "cmdj_appended=" + String((unsigned long)js.appended) + "\n";
+    diag += "cmdj_replayed=" + String((unsigned long)js.replayed) + "\n";
+    diag += "cmdj_acked=" + String((unsigned long)js.acked) + "\n";
+    diag += "cmdj_dropped=" + String((unsigned long)(js.dropped_full + js.expired)) + "\n";
+    diag += "cmdj_bytes=" + String((unsigned long)js.file_bytes) + "\n";
+    const HwSyncStats& hs = g_hw_stream.stats();
+    diag += "hw_decode_us_last=" + String((unsigned long)hs.last_decode_us) + "\n";
+    diag += "hw_decode_us_max=" + String((unsigned long)hs.max_decode_us) + "\n";
+    diag += "hw_decode_bytes_last=" + String((unsigned long)hs.last_bytes) + "\n";
+    diag += "hw_decode_footprint=" + String((unsigned long)g_hw_stream.footprint_bytes()) + "\n";
+    diag += "hw_parse_errors=" + String((unsigned long)hs.parse_errors) + "\n";
+    diag += "hw_unchanged=" + String((unsigned long)hs.unchanged) + "\n";
+    diag += "hw_patches=" + String((unsigned long)hs.patches) + "\n";
+    diag += "hw_patch_rejects=" + String((unsigned long)hs.patch_rejects) + "\n";
+    diag += "hw_msgpack_frames=" + String((unsigned long)hs.msgpack_frames) + "\n";
+    const BootSnapStats& ss = g_boot_snap.stats();
+    diag += "snap_restored=" + String((unsigned)ss.restored_mask) + "\n";
+    diag += "snap_restore_ms=" + String((unsigned long)ss.restore_ms) + "\n";
+    diag += "snap_writes=" + String((unsigned long)ss.writes) + " same=" + String((unsigned long)ss.skipped_same) +
+            " fail=" + String((unsigned long)ss.write_fail) + " last_us=" + String((unsigned long)ss.last_write_us) + "\n";
+    g_boot.append_diag(diag);
+    append_lvgl_mem_diag(diag);
+    font_fallback_append_diag(diag);
+    ui_sched_append_diag(diag);
+    ui_port_append_diag(diag);
+    mqtt.publish(cmd_topics().device_topic(MQTT_DEV_TOPIC_DIAG), 1, false, diag.c_str());
+    Serial.println("[LIST-DIAG] published:\n" + diag);
+  }
+}
+
+static void apply_student_info_payload(char* json, size_t len, bool from_snapshot = false) {
+  if (!from_snapshot) g_boot_snap.stage(BOOT_SNAP_INFO, json, len);
+  DynamicJsonDocument doc(device_payload_capacity(json, len, 1024));
+  DeserializationError err = deserialize_device_payload(doc, json, len);
+  if (!err && doc.containsKey("info")) {
+    JsonObject info = doc["info"].as<JsonObject>();
+    ui_port_update_student_info(info);
+    if (from_snapshot) return;
+    g_boot_snap.commit(BOOT_SNAP_INFO, studentId.c_str(), "", millis());
+    // 학생 정보만으로는 과제 캐시가 최신인지 알 수 없으므로 배지는 과제 반영 때 내린다.
+    g_first_ui_data_ready = true;
+    g_restored_binding_guard_active = false;
+  }
+}
+
+// setup: 지난 부팅에서 반영한 화면을 네트워크를 기다리지 않고 그린다.
+// 바인딩이 남아 있으면 그 학생의 과제/학생 정보, 아니면 학생 목록. 다른 학생의 캐시는 쓰지 않는다.
+static void restore_boot_snapshot() {
+  const uint32_t t0 = millis();
+  uint8_t mask = 0;
+  size_t len = 0;
+  if (studentId.length() > 0) {
+    HwSyncFrame* frame = (HwSyncFrame*)heap_caps_malloc(sizeof(HwSyncFrame), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!frame) frame = (HwSyncFrame*)malloc(sizeof(HwSyncFrame));
+    if (frame && g_boot_snap.load_homeworks(studentId.c_str(), frame) && ui_port_update_homeworks(*frame)) {
+      // 같은 sync_fp가 다시 오면 디코더가 groups를 건너뛰고 unchanged로 처리한다.
+      g_hw_stream.set_applied(frame->meta.student_id, frame->meta.sync_fp);
+      mask |= 1 << BOOT_SNAP_HOMEWORKS;
+    }
+    free(frame);
+    if (char* body = g_boot_snap.load(BOOT_SNAP_INFO, studentId.c_str(), &len)) {
+      apply_student_info_payload(body, len, true);
+      free(body);
+      mask |= 1 << BOOT_SNAP_INFO;
+    }
+  } else if (char* body = g_boot_snap.load(BOOT_SNAP_STUDENTS, nullptr, &len)) {
+    apply_students_payload(body, len, true);
+    free(body);
+    mask |= 1 << BOOT_SNAP_STUDENTS;
+  }
+  g_boot_snap.note_restored(mask, millis() - t0);
+  if (mask == 0) return;
+  g_boot_snapshot_shown = true;
+  ui_port_hide_boot_status();
+  ui_port_set_stale(true);
+  Serial.printf("[SNAP] boot screen from cache mask=0x%x in %lums\n", (unsigned)mask, (unsigned long)(millis() - t0));
 }
 
 void loop() {
@@ -1349,17 +1453,30 @@ void loop() {
     static uint32_t s_hb_last = 0;
     if (s_hb_last == 0 || (nowTick - s_hb_last) >= 3000) {
       s_hb_last = nowTick;
-      Serial.printf("[HB] up=%lus heap=%u sid=%d srecv=%d ready=%d mqtt=%d\n",
+      const MqttRxStats& rx = g_rx_queue.stats();
+      Serial.printf("[HB] up=%lus heap=%u sid=%d srecv=%d ready=%d mqtt=%d link=%s rxq=%lu/%lu/%lu/%lu\n",
                     (unsigned long)(nowTick / 1000),
                     (unsigned)esp_get_free_heap_size(),
                     studentId.length() > 0 ? 1 : 0,
                     g_students_received ? 1 : 0,
                     g_first_ui_data_ready ? 1 : 0,
-                    mqtt.connected() ? 1 : 0);
+                    mqtt.connected() ? 1 : 0,
+                    MqttLink::state_name(g_mqtt_link.state()),
+                    (unsigned long)rx.delivered,
+                    (unsigned long)rx.coalesced,
+                    (unsigned long)g_rx_queue.dropped_total(),
+                    (unsigned long)rx.max_depth);
       Serial.flush();
     }
   }
 
+  g_wifi_mgr.poll(nowTick);
+  boot_profile_poll();
+  // 첫 화면 뒤: fallback TTF를 백그라운드로 읽고, 다 읽으면 kakao_kr_*에 건다.
+  if (g_boot.done(BOOT_STAGE_FIRST_SCREEN)) {
+    font_fallback_begin();
+    font_fallback_poll();
+  }
   bool wifiNowConnected = WiFi.status() == WL_CONNECTED;
   if (wifiNowConnected && (!g_wifi_loop_connected || g_wifi_connected_ms == 0)) {
     g_wifi_connected_ms = nowTick;
@@ -1369,56 +1486,42 @@ void loop() {
                   (int)WiFi.RSSI(),
                   WiFi.BSSIDstr().c_str(),
                   WiFi.channel());
-    if (!mqtt.connected() && nextMqttReconnectMs == 0) {
-      nextMqttReconnectMs = nowTick + 1000;
-    }
+    g_mqtt_link.kick("wifi_up", nowTick, 1000);
   } else if (!wifiNowConnected && g_wifi_loop_connected) {
     g_wifi_loop_connected = false;
     g_wifi_connected_ms = 0;
-    g_mqtt_connect_in_flight = false;
-    g_mqtt_connect_attempt_ms = 0;
-    nextMqttReconnectMs = nowTick + 5000;
     Serial.println("[WiFi] loop disconnected -> wait for reconnect");
   }
   LOOP_STAGE(3);
   update_boot_status_ui(false);
 
   LOOP_STAGE(4);
-  // homeworks 토픽은 단일 슬롯에 덮어쓰기 → 처리 중·직후에 또 도착한 페이로드를 같은 루프에서 연속 소비
-  for (int hw_drain = 0; hw_drain < 12 && g_hw_payload.pending(); hw_drain++) {
-    String* taken = g_hw_payload.take();
-    if (!taken) break;
-    String json_copy = *taken;
-    delete taken;
-    if (json_copy.length() == 0) break;
-    DynamicJsonDocument doc(json_copy.length() + 4096);
-    DeserializationError err = deserializeJson(doc, json_copy.c_str(), json_copy.length());
-    if (!err) {
-      JsonArray arr = doc["groups"].as<JsonArray>();
-      JsonObject meta = doc["meta"].as<JsonObject>();
-      const char* syncFp = meta["sync_fp"] | "";
-      const char* source = meta["source"] | "";
-      const char* metaStudentId = meta["student_id"] | "";
-      const unsigned long syncSeq = meta["sync_seq"] | 0;
-      Serial.printf("[M5SYNC][apply] device=%s student=%s meta_student=%s sync_seq=%lu sync_fp=%s source=%s groups=%u len=%u\n",
-                    deviceId.c_str(),
-                    studentId.c_str(),
-                    metaStudentId,
-                    syncSeq,
-                    syncFp,
-                    source,
-                    (unsigned)arr.size(),
-                    (unsigned)json_copy.length());
-      ui_port_update_homeworks(arr);
-      g_first_ui_data_ready = true;
-      g_restored_binding_guard_active = false;
-      publish_homeworks_sync_ack(meta, (unsigned)arr.size());
-    } else {
-      Serial.printf("[M5SYNC][parse_error] device=%s student=%s err=%s len=%u\n",
-                    deviceId.c_str(),
-                    studentId.c_str(),
-                    err.c_str(),
-                    (unsigned)json_copy.length());
+  // homeworks: 디코딩이 끝난 프레임 중 최신 것 하나만 적용한다.
+  if (HwSyncFrame* frame = g_hw_stream.take()) {
+    apply_homeworks_frame(*frame);
+    g_hw_stream.release(frame);
+  }
+
+  // 나머지 토픽: 큐에 쌓인 수신 이벤트를 도착 순서대로 소비한다. 같은 토픽의 더 새 스냅샷이
+  // 뒤에 있으면 큐가 앞 것을 건너뛰므로 최신 상태만 그려진다.
+  {
+    MqttRxEvent ev;
+    const uint32_t drainStartUs = micros();
+    while ((uint32_t)(micros() - drainStartUs) < CFG_RX_DRAIN_BUDGET_US && g_rx_queue.pop(ev)) {
+      char* json = g_rx_queue.data(ev);
+      switch (ev.topic) {
+        case MQTT_RX_STUDENTS_TODAY:
+          LOOP_STAGE(6);
+          apply_students_payload(json, ev.len);
+          break;
+        case MQTT_RX_STUDENT_INFO:
+          LOOP_STAGE(7);
+          apply_student_info_payload(json, ev.len);
+          break;
+        default:
+          break;
+      }
+      g_rx_queue.release(ev);
     }
   }
 
@@ -1436,66 +1539,6 @@ void loop() {
     ui_port_on_bind_ack(ok, reason, attemptsLeft, lockedSeconds);
   }
 
-  LOOP_STAGE(6);
-  if (g_students_payload.pending()) {
-    String* taken = g_students_payload.take();
-    String json_copy;
-    if (taken) { json_copy = *taken; delete taken; }
-    if (json_copy.length() > 0) {
-      DynamicJsonDocument doc(json_copy.length() + 2048);
-      DeserializationError err = deserializeJson(doc, json_copy.c_str(), json_copy.length());
-      if (err) {
-        Serial.print("students_today parse error: "); Serial.println(err.c_str());
-      } else {
-        JsonArray arr;
-        if (doc.containsKey("students") && doc["students"].is<JsonArray>()) {
-          arr = doc["students"].as<JsonArray>();
-        } else if (doc.is<JsonArray>()) {
-          arr = doc.as<JsonArray>();
-        } else if (doc.containsKey("items") && doc["items"].is<JsonArray>()) {
-          arr = doc["items"].as<JsonArray>();
-        } else if (doc.containsKey("data") && doc["data"].is<JsonArray>()) {
-          arr = doc["data"].as<JsonArray>();
-        }
-        Serial.print("students_today count="); Serial.println((int)arr.size());
-        ui_port_update_students(arr);
-        g_students_received = true;
-        g_first_ui_data_ready = true;
-        if (!g_list_diag_sent && mqtt.connected()) {
-          g_list_diag_sent = true;
-          String diag;
-          uint32_t nowMs = millis();
-          diag += "list_today_received=1\n";
-          diag += "list_today_count=" + String((int)arr.size()) + "\n";
-          if (g_last_list_request_ms > 0 && nowMs >= g_last_list_request_ms) {
-            diag += "list_today_after_request_ms=" + String((unsigned long)(nowMs - g_last_list_request_ms)) + "\n";
-          }
-          diag += "list_today_after_mqtt_ms=" + String(g_last_mqtt_connect_ms > 0 && nowMs >= g_last_mqtt_connect_ms ? (unsigned long)(nowMs - g_last_mqtt_connect_ms) : 0UL) + "\n";
-          String diagTopic = String("academies/") + academyId + "/devices/" + deviceId + "/diag";
-          mqtt.publish(diagTopic.c_str(), 1, false, diag.c_str());
-          Serial.println("[LIST-DIAG] published:\n" + diag);
-        }
-      }
-    }
-  }
-
-  LOOP_STAGE(7);
-  if (g_student_info_payload.pending()) {
-    String* taken = g_student_info_payload.take();
-    String json_copy;
-    if (taken) { json_copy = *taken; delete taken; }
-    if (json_copy.length() > 0) {
-      DynamicJsonDocument doc(json_copy.length() + 1024);
-      DeserializationError err = deserializeJson(doc, json_copy.c_str(), json_copy.length());
-      if (!err && doc.containsKey("info")) {
-        JsonObject info = doc["info"].as<JsonObject>();
-        ui_port_update_student_info(info);
-        g_first_ui_data_ready = true;
-        g_restored_binding_guard_active = false;
-      }
-    }
-  }
-
   if (g_force_unbind_pending) {
     portENTER_CRITICAL(&g_hw_mux);
     g_force_unbind_pending = false;
@@ -1527,7 +1570,14 @@ void loop() {
   }
 
   LOOP_STAGE(9);
-  lv_timer_handler();
+  const uint32_t lvDueMs = millis() + lv_timer_handler();
+  display_flush_report(nowTick);
+  if (lvgl_mem_sample(nowTick) && mqtt.connected()) {
+    // LVGL 풀이 바닥나면 lv_timer_handler() 안에서 assert로 재부팅된다. 그 전에 상태를 남긴다.
+    String diag = "lv_mem_low=1\n";
+    append_lvgl_mem_diag(diag);
+    mqtt.publish(cmd_topics().device_topic(MQTT_DEV_TOPIC_DIAG), 1, false, diag.c_str());
+  }
   // 첫 데이터(학생 리스트/학생 정보/과제) 수신 전에는 절전 진입을 막아
   // "연결 중" 상태가 빈 화면/꺼진 화면처럼 보이지 않게 한다.
   // PIN 입력 중에는 세이버 전환이 LVGL 입력 전환과 겹치지 않게 유지한다.
@@ -1560,11 +1610,17 @@ void loop() {
   // Periodic online retained presence
   static uint32_t lastPresence = 0;
   uint32_t now = millis();
-  handle_mqtt_connect_stall(now);
-  if (WiFi.status() == WL_CONNECTED && !mqtt.connected() && nextMqttReconnectMs && now >= nextMqttReconnectMs) {
-    nextMqttReconnectMs = 0;
-    start_mqtt_connect("reconnect_timer");
+  g_mqtt_link.poll(now, WiFi.status() == WL_CONNECTED);
+  {
+    static uint32_t s_session_seen = 0;
+    const uint32_t evt = g_mqtt_session_evt.load(std::memory_order_acquire);
+    if (evt != s_session_seen) {
+      s_session_seen = evt;
+      if (mqtt.connected()) on_mqtt_session_ready();
+    }
   }
+  g_cmd_journal.service(now, mqtt.connected(), publish_journal_entry);
+  g_boot_snap.service(now);
 
   if (is_group_cmd_v2_enabled() && g_group_transition_pending && g_group_transition_pending_since_ms > 0) {
     uint32_t pendingAge = (now >= g_group_transition_pending_since_ms)
@@ -1593,8 +1649,7 @@ void loop() {
       if (staleMs >= MQTT_STALE_HARD_MS && canHardRecover) {
         g_last_watchdog_hard_ms = now;
         Serial.printf("[MQTT][WATCHDOG] hard stale %lu ms -> disconnect/reconnect\n", (unsigned long)staleMs);
-        mqtt.disconnect();
-        nextMqttReconnectMs = now + 500;
+        mqtt.disconnect();  // 끊김 콜백 뒤 g_mqtt_link가 백오프로 다시 붙는다
       } else if (staleMs >= MQTT_STALE_SOFT_MS && canSoftRecover) {
         g_last_watchdog_soft_ms = now;
         Serial.printf("[MQTT][WATCHDOG] soft stale %lu ms -> request student_info + list_homeworks\n", (unsigned long)staleMs);
@@ -1623,13 +1678,11 @@ void loop() {
 
   if (now - lastPresence > 15000) {
     lastPresence = now;
-    DynamicJsonDocument doc(128);
-    doc["online"] = true;
-    doc["at"] = "";
-    String payload; serializeJson(doc, payload);
-    String topic = String("academies/") + academyId + "/devices/" + deviceId + "/presence";
-    mqtt.publish(topic.c_str(), 1, true, payload.c_str());
+    publish_presence();
   }
+
+  // 다음 LVGL 타이머(또는 MQTT 수신)까지 잔다. 예전에는 여기서 쉬지 않고 다시 돌았다.
+  ui_sched_idle(lvDueMs);
 }
 
 
@@ -0,0 +1,136 @@
+#include "mqtt_cmd_encoder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+CmdJsonWriter::CmdJsonWriter(char* buf, size_t cap)
+    : buf_(buf), cap_(cap), len_(0), first_(true), overflow_(cap < 3) {
+  put('{');
+}
+
+void CmdJsonWriter::put(char c) {
+  // 닫는 괄호와 널 자리(2바이트)는 항상 남겨 둔다.
+  if (overflow_ || len_ + 2 >= cap_) {
+    overflow_ = true;
+    return;
+  }
+  buf_[len_++] = c;
+}
+
+void CmdJsonWriter::raw(const char* s) {
+  while (*s) put(*s++);
+}
+
+void CmdJsonWriter::escaped(const char* s) {
+  static const char kHex[] = "0123456789abcdef";
+  put('"');
+  for (; s && *s; ++s) {
+    const uint8_t c = (uint8_t)*s;
+    if (c == '"' || c == '\\') {
+      put('\\');
+      put((char)c);
+    } else if (c < 0x20) {
+      raw("\\u00");
+      put(kHex[c >> 4]);
+      put(kHex[c & 0x0F]);
+    } else {
+      put((char)c);
+    }
+  }
+  put('"');
+}
+
+void CmdJsonWriter::key(const char* k) {
+  if (!first_) put(',');
+  first_ = false;
+  escaped(k);
+  put(':');
+}
+
+CmdJsonWriter& CmdJsonWriter::str(const char* k, const char* val) {
+  key(k);
+  escaped(val ? val : "");
+  return *this;
+}
+
+CmdJsonWriter& CmdJsonWriter::num(const char* k, long val) {
+  char tmp[24];
+  char* p = tmp + sizeof(tmp);
+  *--p = '\0';
+  unsigned long u = val < 0 ? 0UL - (unsigned long)val : (unsigned long)val;
+  do {
+    *--p = (char)('0' + u % 10);
+    u /= 10;
+  } while (u);
+  if (val < 0) *--p = '-';
+  key(k);
+  raw(p);
+  return *this;
+}
+
+CmdJsonWriter& CmdJsonWriter::boolean(const char* k, bool val) {
+  key(k);
+  raw(val ? "true" : "false");
+  return *this;
+}
+
+CmdJsonWriter& CmdJsonWriter::hex32(const char* k, uint32_t val) {
+  static const char kHex[] = "0123456789abcdef";
+  char tmp[9];
+  char* p = tmp + sizeof(tmp);
+  *--p = '\0';
+  do {
+    *--p = kHex[val & 0x0F];
+    val >>= 4;
+  } while (val);
+  return str(k, p);
+}
+
+const char* CmdJsonWriter::finish() {
+  if (overflow_) return nullptr;
+  buf_[len_++] = '}';
+  buf_[len_] = '\0';
+  return buf_;
+}
+
+MqttCmdEncoder::MqttCmdEncoder() : hw_prefix_len_(0), rebinds_(0) {
+  academy_[0] = device_[0] = student_[0] = '\0';
+  memset(dev_topics_, 0, sizeof(dev_topics_));
+  hw_prefix_[0] = '\0';
+}
+
+bool MqttCmdEncoder::copy_id(char* dst, const char* src) {
+  if (!src) src = "";
+  if (strcmp(dst, src) == 0) return false;
+  snprintf(dst, kIdBytes, "%s", src);
+  return true;
+}
+
+bool MqttCmdEncoder::bind(const char* academy_id, const char* device_id, const char* student_id) {
+  bool changed = copy_id(academy_, academy_id);
+  changed = copy_id(device_, device_id) || changed;
+  const bool student_changed = copy_id(student_, student_id);
+  if (!changed && !student_changed && rebinds_ > 0) return false;
+
+  if (changed || rebinds_ == 0) {
+    static const char* const kSuffix[MQTT_DEV_TOPIC_COUNT] = {"command", "sync_ack", "presence", "diag"};
+    for (uint8_t i = 0; i < MQTT_DEV_TOPIC_COUNT; ++i) {
+      snprintf(dev_topics_[i], kTopicBytes, "academies/%s/devices/%s/%s", academy_, device_, kSuffix[i]);
+    }
+  }
+  int n = snprintf(hw_prefix_, sizeof(hw_prefix_), "academies/%s/students/%s/homework/", academy_, student_);
+  hw_prefix_len_ = (n > 0 && (size_t)n < sizeof(hw_prefix_)) ? (size_t)n : 0;
+  rebinds_++;
+  return true;
+}
+
+bool MqttCmdEncoder::homework_topic(const char* item_id, char* out, size_t cap) const {
+  static const char kTail[] = "/command";
+  if (!item_id || hw_prefix_len_ == 0) return false;
+  const size_t item_len = strlen(item_id);
+  if (hw_prefix_len_ + item_len + sizeof(kTail) > cap) return false;
+  memcpy(out, hw_prefix_, hw_prefix_len_);
+  memcpy(out + hw_prefix_len_, item_id, item_len);
+  memcpy(out + hw_prefix_len_ + item_len, kTail, sizeof(kTail));
+  return true;
+}
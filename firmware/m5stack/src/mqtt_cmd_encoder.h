@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 발신 커맨드 인코더: 캐시된 토픽 + 고정 버퍼 JSON 작성.
+//
+// 예전 fw_publish_*는 호출마다 토픽을 String 덧셈으로 만들고, DynamicJsonDocument를 할당해
+// String으로 직렬화했다. 카드 한 번 탭에 작은 malloc/free가 여러 번 일어나 UI 애니메이션 중
+// 힙을 흔들었다.
+//
+// 여기서는 academy/device/student 바인딩이 바뀐 경우에만 토픽을 다시 만들고(bind()),
+// 페이로드는 커맨드마다 둔 고정 스크래치 버퍼(CmdScratch<N>)에 CmdJsonWriter로 바로 쓴다.
+// 인코더 쪽 힙 할당은 0이다(AsyncMqttClient 내부 송신 버퍼는 별개).
+// Arduino 의존이 없어 호스트에서 tools/bench_cmd_encoder.cpp로 따로 잴 수 있다.
+
+// 키 순서대로 한 줄 JSON 객체를 쓴다. 버퍼가 모자라면 이후 쓰기를 무시하고 finish()가 nullptr.
+class CmdJsonWriter {
+ public:
+  CmdJsonWriter(char* buf, size_t cap);
+
+  CmdJsonWriter& str(const char* key, const char* val);
+  CmdJsonWriter& num(const char* key, long val);
+  CmdJsonWriter& boolean(const char* key, bool val);
+  // String(v, HEX)와 같은 소문자·0 채움 없는 16진수 문자열
+  CmdJsonWriter& hex32(const char* key, uint32_t val);
+
+  // 닫는 괄호를 붙이고 널 종료된 본문을 준다. 넘쳤으면 nullptr.
+  const char* finish();
+  size_t length() const { return len_; }
+
+ private:
+  void put(char c);
+  void raw(const char* s);
+  void escaped(const char* s);
+  void key(const char* k);
+
+  char* buf_;
+  size_t cap_;
+  size_t len_;
+  bool first_;
+  bool overflow_;
+};
+
+// 커맨드별 스크래치 버퍼. 호출하는 쪽이 static(fw_publish_* 대부분) 또는 스택에 둔다.
+// 발행은 모두 loop 스레드에서 하므로 static이어도 호출끼리 겹치지 않는다.
+template <size_t N>
+struct CmdScratch {
+  char buf[N];
+  CmdJsonWriter begin() { return CmdJsonWriter(buf, N); }
+};
+
+enum MqttDeviceTopic : uint8_t {
+  MQTT_DEV_TOPIC_COMMAND = 0,  // academies/{a}/devices/{d}/command
+  MQTT_DEV_TOPIC_SYNC_ACK,     // .../sync_ack
+  MQTT_DEV_TOPIC_PRESENCE,     // .../presence
+  MQTT_DEV_TOPIC_DIAG,         // .../diag
+  MQTT_DEV_TOPIC_COUNT
+};
+
+class MqttCmdEncoder {
+ public:
+  static const size_t kIdBytes = 48;
+  static const size_t kTopicBytes = 160;
+
+  MqttCmdEncoder();
+
+  // 저장된 바인딩과 비교해 달라진 경우에만 토픽을 다시 만든다(strcmp 3번, 할당 없음).
+  // 다시 만들었으면 true.
+  bool bind(const char* academy_id, const char* device_id, const char* student_id);
+
+  const char* device_topic(MqttDeviceTopic t) const { return dev_topics_[t < MQTT_DEV_TOPIC_COUNT ? t : 0]; }
+  // academies/{a}/students/{s}/homework/{item}/command 를 out에 쓴다. 잘리면 false.
+  bool homework_topic(const char* item_id, char* out, size_t cap) const;
+
+  const char* academy_id() const { return academy_; }
+  const char* device_id() const { return device_; }
+  const char* student_id() const { return student_; }
+  uint32_t rebinds() const { return rebinds_; }
+
+ private:
+  static bool copy_id(char* dst, const char* src);
+
+  char academy_[kIdBytes];
+  char device_[kIdBytes];
+  char student_[kIdBytes];
+  char dev_topics_[MQTT_DEV_TOPIC_COUNT][kTopicBytes];
+  char hw_prefix_[kTopicBytes];  // academies/{a}/students/{s}/homework/
+  size_t hw_prefix_len_;
+  uint32_t rebinds_;
+};
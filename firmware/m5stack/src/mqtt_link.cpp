@@ -0,0 +1,227 @@
+#include "mqtt_link.h"
+
+#include <WiFi.h>
+#include <esp_system.h>
+
+MqttLink::MqttLink()
+    : mqtt_(nullptr),
+      hosts_(nullptr),
+      host_count_(0),
+      host_idx_(0),
+      port_(0),
+      state_(MQTT_LINK_DOWN),
+      state_ms_(0),
+      next_try_ms_(0),
+      connect_started_ms_(0),
+      fails_(0),
+      host_fails_(0),
+      first_data_warned_(false),
+      seen_connected_(0),
+      seen_disconnected_(0),
+      seen_rx_(0) {
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+const char* MqttLink::state_name(MqttLinkState s) {
+  switch (s) {
+    case MQTT_LINK_DOWN: return "down";
+    case MQTT_LINK_BACKOFF: return "backoff";
+    case MQTT_LINK_PROBE: return "probe";
+    case MQTT_LINK_CONNECT: return "connect";
+    case MQTT_LINK_AWAIT_DATA: return "await_data";
+    case MQTT_LINK_ONLINE: return "online";
+    default: return "?";
+  }
+}
+
+void MqttLink::begin(MqttClient* mqtt, const char* const* hosts, uint8_t host_count, uint16_t port) {
+  mqtt_ = mqtt;
+  hosts_ = hosts;
+  host_count_ = host_count;
+  host_idx_ = 0;
+  port_ = port;
+  // 콜백은 async-tcp 태스크에서 온다. 결과만 남기고 소켓 정리는 poll()이 한다.
+  probe_.onConnect([](void* arg, AsyncClient*) { static_cast<MqttLink*>(arg)->probe_result_.store(1); }, this);
+  probe_.onError([](void* arg, AsyncClient*, int8_t) { static_cast<MqttLink*>(arg)->probe_result_.store(2); }, this);
+  mqtt_->setServer(host(), port_);
+  Serial.printf("MQTT host: %s:%u (hosts=%u)\n", host(), (unsigned)port_, (unsigned)host_count_);
+}
+
+void MqttLink::enter(MqttLinkState s, uint32_t now_ms) {
+  if (s == state_) return;
+  Serial.printf("[MQTT][LINK] %s -> %s after %lums\n",
+                state_name(state_),
+                state_name(s),
+                (unsigned long)(now_ms - state_ms_));
+  state_ = s;
+  state_ms_ = now_ms;
+}
+
+void MqttLink::abort_probe() {
+  probe_.close(true);
+}
+
+void MqttLink::start_probe(uint32_t now_ms) {
+  abort_probe();
+  probe_result_.store(0);
+  stats_.attempts++;
+  enter(MQTT_LINK_PROBE, now_ms);
+  // 호스트가 IP면 바로 SYN, 이름이면 lwIP DNS 콜백 뒤 SYN. 어느 쪽도 여기서 기다리지 않는다.
+  if (!probe_.connect(host(), port_)) probe_result_.store(2);
+}
+
+void MqttLink::fail(const char* why, uint32_t now_ms) {
+  fails_ = fails_ < 250 ? fails_ + 1 : fails_;
+  host_fails_++;
+  connect_started_ms_ = 0;
+  if (host_count_ > 1 && host_fails_ >= kFailsPerHost) {
+    host_idx_ = (uint8_t)((host_idx_ + 1) % host_count_);
+    host_fails_ = 0;
+    stats_.host_rotations++;
+    mqtt_->setServer(host(), port_);
+    Serial.printf("[MQTT][LINK] rotate host -> %s:%u\n", host(), (unsigned)port_);
+  }
+  // 같은 AP의 기기들이 동시에 재시도하지 않도록 [base/2, base] 안에서 고른다.
+  uint32_t base = kBackoffMinMs << (fails_ > 4 ? 3 : fails_ - 1);
+  if (base > kBackoffMaxMs) base = kBackoffMaxMs;
+  const uint32_t delay = base / 2 + esp_random() % (base / 2 + 1);
+  stats_.last_backoff_ms = delay;
+  next_try_ms_ = now_ms + delay;
+  Serial.printf("[MQTT][LINK] %s failed (%s) fails=%u host=%s:%u rssi=%d retry_in=%lums\n",
+                state_name(state_),
+                why,
+                (unsigned)fails_,
+                host(),
+                (unsigned)port_,
+                (int)WiFi.RSSI(),
+                (unsigned long)delay);
+  enter(MQTT_LINK_BACKOFF, now_ms);
+}
+
+void MqttLink::kick(const char* reason, uint32_t now_ms, uint32_t delay_ms) {
+  if (state_ != MQTT_LINK_BACKOFF && state_ != MQTT_LINK_DOWN) return;
+  const uint32_t t = now_ms + delay_ms;
+  if (next_try_ms_ == 0 || (int32_t)(t - next_try_ms_) < 0) next_try_ms_ = t;
+  Serial.printf("[MQTT][LINK] kick (%s) in %lums\n", reason ? reason : "?", (unsigned long)delay_ms);
+}
+
+void MqttLink::poll(uint32_t now_ms, bool wifi_up) {
+  if (!mqtt_) return;
+
+  // 지난 poll 이후 콜백 사건. 상태와 무관하게 매번 소비해 오래된 사건이 다음 시도에 섞이지 않게 한다.
+  const uint32_t c = connected_evt_.load(std::memory_order_acquire);
+  const uint32_t d = disconnected_evt_.load(std::memory_order_acquire);
+  const uint32_t r = rx_evt_.load(std::memory_order_acquire);
+  const bool got_conn = c != seen_connected_;
+  const bool got_disc = d != seen_disconnected_;
+  const bool got_rx = r != seen_rx_;
+  seen_connected_ = c;
+  seen_disconnected_ = d;
+  seen_rx_ = r;
+
+  if (!wifi_up) {
+    if (state_ != MQTT_LINK_DOWN) {
+      abort_probe();
+      connect_started_ms_ = 0;
+      next_try_ms_ = 0;
+      enter(MQTT_LINK_DOWN, now_ms);
+    }
+    return;
+  }
+
+  // WiFi가 잠깐 끊겼다 붙으면 브로커 세션(TCP)은 그대로 살아 있을 때가 많다. 그 상태로 PROBE/CONNECT를
+  // 밟으면 CONNACK이 오지 않아 20초 뒤 멀쩡한 링크를 disconnect(true)로 끊게 되므로 바로 ONLINE으로 잇는다.
+  // CONNECT 단계는 제외한다: 방금 우리가 connect()를 불렀고, 두 클라이언트 모두 on_connected()보다
+  // connected()가 먼저 참이 되므로 정상 연결을 재개로 잘못 셀 수 있다.
+  if (state_ < MQTT_LINK_CONNECT && !got_conn && !got_disc && mqtt_->connected()) {
+    abort_probe();
+    connect_started_ms_ = 0;
+    next_try_ms_ = 0;
+    fails_ = 0;
+    host_fails_ = 0;
+    stats_.resumed++;
+    enter(MQTT_LINK_ONLINE, now_ms);
+    return;
+  }
+
+  const uint32_t age = now_ms - state_ms_;
+  switch (state_) {
+    case MQTT_LINK_DOWN:
+      // DHCP/ARP가 자리 잡을 시간을 조금 둔다(kick으로 더 당길 수 있다).
+      if (next_try_ms_ == 0) next_try_ms_ = now_ms + 1000;
+      enter(MQTT_LINK_BACKOFF, now_ms);
+      break;
+
+    case MQTT_LINK_BACKOFF:
+      if (next_try_ms_ != 0 && (int32_t)(now_ms - next_try_ms_) >= 0) {
+        next_try_ms_ = 0;
+        start_probe(now_ms);
+      }
+      break;
+
+    case MQTT_LINK_PROBE: {
+      const uint8_t res = probe_result_.load();
+      if (res == 1) {
+        stats_.last_probe_ms = age;
+        stats_.last_probe_ok = true;
+        abort_probe();
+        connect_started_ms_ = now_ms;
+        enter(MQTT_LINK_CONNECT, now_ms);
+        mqtt_->connect();
+      } else if (res == 2 || age >= kProbeTimeoutMs) {
+        abort_probe();
+        stats_.last_probe_ms = age;
+        stats_.last_probe_ok = false;
+        stats_.probe_fail++;
+        fail(res == 2 ? "tcp_error" : "tcp_timeout", now_ms);
+      }
+      break;
+    }
+
+    case MQTT_LINK_CONNECT:
+      if (got_conn && !got_disc) {
+        stats_.last_connect_ms = age;
+        fails_ = 0;
+        host_fails_ = 0;
+        first_data_warned_ = false;
+        enter(MQTT_LINK_AWAIT_DATA, now_ms);
+        if (got_rx) {
+          stats_.last_first_data_ms = 0;
+          enter(MQTT_LINK_ONLINE, now_ms);
+        }
+      } else if (got_disc) {
+        stats_.connect_fail++;
+        fail("refused", now_ms);
+      } else if (age >= kConnectTimeoutMs) {
+        // CONNACK 없이 멈춘 세션: 같은 clientId로 겹쳐 붙지 않도록 확실히 끊고 다시 시작한다.
+        stats_.connect_stall++;
+        stats_.last_stall_at_ms = now_ms;
+        mqtt_->disconnect(true);
+        fail("connack_timeout", now_ms);
+      }
+      break;
+
+    case MQTT_LINK_AWAIT_DATA:
+      if (got_disc) {
+        stats_.drops++;
+        fail("dropped", now_ms);
+      } else if (got_rx) {
+        stats_.last_first_data_ms = age;
+        enter(MQTT_LINK_ONLINE, now_ms);
+      } else if (age >= kFirstDataWarnMs && !first_data_warned_) {
+        first_data_warned_ = true;
+        Serial.printf("[MQTT][LINK] no data %lums after connect (subscribed, waiting)\n", (unsigned long)age);
+      }
+      break;
+
+    case MQTT_LINK_ONLINE:
+      if (got_disc) {
+        stats_.drops++;
+        fail("dropped", now_ms);
+      }
+      break;
+
+    default:
+      break;
+  }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncMqttClient.h>
+#include <atomic>
+
+// -D CFG_MQTT_TLS=1: 브로커와 TLS로 통신한다(mqtt_tls_client.h). 상태 기계와 main.cpp는 그대로 둔다.
+#if defined(CFG_MQTT_TLS) && CFG_MQTT_TLS
+#include "mqtt_tls_client.h"
+typedef MqttTlsClient MqttClient;
+#else
+typedef AsyncMqttClient MqttClient;
+#endif
+
+// MQTT 연결 상태 기계(loop()에서 구동, 블로킹 없음).
+//
+// 예전 start_mqtt_connect는 WiFiClient::connect로 브로커에 최대 4초 블로킹 TCP 프로브를 한 뒤
+// mqtt.connect()를 불렀다. 그동안 화면·터치가 멈추고 15초 태스크 워치독을 신경 써야 했다.
+// 여기서는 프로브도 AsyncClient(AsyncTCP) 비동기 connect로 하고, 단계마다 시각만 확인한다.
+//
+//   DOWN ──wifi──▶ BACKOFF ──due──▶ PROBE ──tcp ok──▶ CONNECT ──CONNACK──▶ AWAIT_DATA ──첫 수신──▶ ONLINE
+//                    ▲                 │ fail/4s          │ 끊김/20s               │ 끊김          │ 끊김
+//                    └─────────────────┴──────────────────┴────────────────────────┴───────────────┘
+//
+// 실패하면 지수 백오프(2s→8s 상한)에 ±절반 지터를 섞어 여러 기기가 같은 순간에 몰리지 않게 하고,
+// 같은 호스트에서 연속 3번 실패하면 kMqttHosts의 다음 호스트로 넘어간다.
+// AsyncMqttClient/AsyncClient 콜백(async-tcp 태스크)은 원자 변수에 사건만 남기고,
+// 상태 전환은 모두 poll()(loop 스레드)에서 한다.
+
+enum MqttLinkState : uint8_t {
+  MQTT_LINK_DOWN = 0,     // WiFi 없음
+  MQTT_LINK_BACKOFF,      // 다음 시도 대기
+  MQTT_LINK_PROBE,        // 브로커 TCP 도달 확인(AsyncClient)
+  MQTT_LINK_CONNECT,      // mqtt.connect() 후 CONNACK 대기
+  MQTT_LINK_AWAIT_DATA,   // 연결·구독 완료, 첫 수신 대기
+  MQTT_LINK_ONLINE,
+  MQTT_LINK_STATE_COUNT
+};
+
+struct MqttLinkStats {
+  uint32_t attempts;           // 프로브를 시작한 횟수
+  uint32_t probe_fail;
+  uint32_t connect_stall;      // CONNACK 타임아웃
+  uint32_t connect_fail;       // CONNECT 단계에서 끊김
+  uint32_t drops;              // 연결된 뒤 끊김
+  uint32_t host_rotations;
+  uint32_t resumed;            // WiFi 복귀 때 살아 있던 세션을 그대로 이어 쓴 횟수
+  uint32_t last_probe_ms;      // 마지막 프로브 소요
+  uint32_t last_connect_ms;    // mqtt.connect() → CONNACK
+  uint32_t last_first_data_ms; // CONNACK → 첫 수신
+  uint32_t last_backoff_ms;    // 마지막으로 잡은 대기(지터 포함)
+  uint32_t last_stall_at_ms;   // 마지막 CONNACK 타임아웃 시각
+  bool last_probe_ok;
+};
+
+class MqttLink {
+ public:
+  static const uint32_t kProbeTimeoutMs = 4000;
+  static const uint32_t kConnectTimeoutMs = 20000;
+  static const uint32_t kFirstDataWarnMs = 15000;
+  static const uint32_t kBackoffMinMs = 2000;
+  static const uint32_t kBackoffMaxMs = 8000;  // 안정성 우선: 재시도가 너무 뜸해지지 않게 낮게 둔다
+  static const uint8_t kFailsPerHost = 3;
+
+  MqttLink();
+
+  // setup: hosts 배열은 프로그램 수명 동안 유지되어야 한다(setServer가 포인터만 저장).
+  void begin(MqttClient* mqtt, const char* const* hosts, uint8_t host_count, uint16_t port);
+
+  // loop: 매 프레임 호출. 한 번에 상태 하나만 진행하고 곧바로 돌아온다.
+  void poll(uint32_t now_ms, bool wifi_up);
+  // loop: delay_ms 뒤 시도를 당긴다(이미 더 이르게 잡혀 있거나 연결 중이면 그대로).
+  void kick(const char* reason, uint32_t now_ms, uint32_t delay_ms);
+
+  // async-tcp(TLS면 mqtt_tls 태스크): MQTT 클라이언트 콜백에서 부른다.
+  void on_connected() { connected_evt_.fetch_add(1, std::memory_order_release); }
+  void on_disconnected() { disconnected_evt_.fetch_add(1, std::memory_order_release); }
+  void on_rx() { rx_evt_.fetch_add(1, std::memory_order_release); }
+
+  MqttLinkState state() const { return state_; }
+  static const char* state_name(MqttLinkState s);
+  const char* host() const { return hosts_ ? hosts_[host_idx_] : ""; }
+  uint16_t port() const { return port_; }
+  // 이번 mqtt.connect()를 부른 시각(0: 시도 중 아님). onMqttConnect에서 소요 시간 진단용.
+  uint32_t connect_started_ms() const { return connect_started_ms_; }
+  const MqttLinkStats& stats() const { return stats_; }
+
+ private:
+  void enter(MqttLinkState s, uint32_t now_ms);
+  void fail(const char* why, uint32_t now_ms);
+  void start_probe(uint32_t now_ms);
+  void abort_probe();
+
+  MqttClient* mqtt_;
+  const char* const* hosts_;
+  uint8_t host_count_;
+  uint8_t host_idx_;
+  uint16_t port_;
+  MqttLinkState state_;
+  uint32_t state_ms_;       // 현재 상태에 들어온 시각
+  uint32_t next_try_ms_;
+  uint32_t connect_started_ms_;
+  uint8_t fails_;           // 연속 실패(백오프 지수)
+  uint8_t host_fails_;      // 현재 호스트에서 연속 실패
+  bool first_data_warned_;
+
+  AsyncClient probe_;
+  std::atomic<uint8_t> probe_result_{0};  // 0 대기, 1 성공, 2 실패
+  std::atomic<uint32_t> connected_evt_{0};
+  std::atomic<uint32_t> disconnected_evt_{0};
+  std::atomic<uint32_t> rx_evt_{0};
+  uint32_t seen_connected_;
+  uint32_t seen_disconnected_;
+  uint32_t seen_rx_;
+
+  MqttLinkStats stats_;
+};
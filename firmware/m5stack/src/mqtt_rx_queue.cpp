@@ -0,0 +1,153 @@
+#include "mqtt_rx_queue.h"
+
+#include <esp_heap_caps.h>
+#include <string.h>
+
+MqttRxQueue::MqttRxQueue() {
+  memset(&stats_, 0, sizeof(stats_));
+  for (uint8_t i = 0; i < kSlotCount; ++i) {
+    slots_[i].data = nullptr;
+    slots_[i].cap = 0;
+    free_.push(i);
+  }
+  for (uint8_t t = 0; t < MQTT_RX_TOPIC_COUNT; ++t) {
+    asm_[t].slot = -1;
+    asm_[t].dropping = false;
+    asm_[t].expected = 0;
+    asm_[t].received = 0;
+  }
+}
+
+// 슬롯 버퍼는 줄이지 않고 필요할 때만 키운다(1KB 단위). PSRAM이 있으면 그쪽을 먼저 쓴다.
+bool MqttRxQueue::ensure_capacity(Slot& s, size_t need) {
+  if (s.cap >= need) return true;
+  size_t cap = (need + 1023) & ~(size_t)1023;
+  void* p = heap_caps_realloc(s.data, cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!p) p = heap_caps_realloc(s.data, cap, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!p) return false;
+  s.data = (char*)p;
+  s.cap = cap;
+  return true;
+}
+
+bool MqttRxQueue::acquire_slot(uint8_t& slot) {
+  if (spare_cnt_ > 0) {
+    slot = spare_[--spare_cnt_];
+    return true;
+  }
+  return free_.pop(slot);
+}
+
+void MqttRxQueue::recycle(uint8_t slot) {
+  if (spare_cnt_ < kSlotCount) spare_[spare_cnt_++] = slot;
+}
+
+void MqttRxQueue::abandon(Assembly& a) {
+  if (a.slot >= 0) {
+    recycle((uint8_t)a.slot);
+  }
+  a.slot = -1;
+  a.expected = 0;
+  a.received = 0;
+}
+
+bool MqttRxQueue::on_chunk(MqttRxTopic topic, const char* payload, size_t len, size_t index, size_t total,
+                           uint32_t now_ms) {
+  if (topic >= MQTT_RX_TOPIC_COUNT) return false;
+  Assembly& a = asm_[topic];
+
+  if (index == 0) {
+    // 이전 메시지가 끝나지 않은 채 새 메시지가 시작되면 이전 것은 버린다.
+    abandon(a);
+    a.dropping = false;
+    if (total > kMaxPayloadBytes) {
+      stats_.dropped_oversize++;
+      a.dropping = true;
+      return false;
+    }
+    uint8_t slot = 0;
+    if (!acquire_slot(slot)) {
+      stats_.dropped_no_slot++;
+      a.dropping = true;
+      return false;
+    }
+    if (!ensure_capacity(slots_[slot], total + 1)) {
+      recycle(slot);
+      stats_.dropped_alloc++;
+      a.dropping = true;
+      return false;
+    }
+    a.slot = (int8_t)slot;
+    a.expected = total;
+    a.received = 0;
+  } else if (a.dropping || a.slot < 0 || index != a.received) {
+    // 버리는 중이거나 순서가 어긋난 청크: 조립 중이던 것도 정리한다.
+    abandon(a);
+    return false;
+  }
+
+  Slot& s = slots_[a.slot];
+  if (a.received + len > a.expected) {
+    abandon(a);
+    stats_.dropped_oversize++;
+    a.dropping = true;
+    return false;
+  }
+  memcpy(s.data + a.received, payload, len);
+  a.received += len;
+  if (a.received < a.expected) return false;
+
+  s.data[a.received] = '\0';
+  MqttRxEvent ev;
+  ev.seq = ++next_seq_;
+  ev.rx_ms = now_ms;
+  ev.len = (uint32_t)a.received;
+  ev.topic = (uint8_t)topic;
+  ev.slot = (uint8_t)a.slot;
+  // 큐에 오는 토픽은 모두 전체 스냅샷이라 더 새 것이 있으면 앞 것은 적용할 필요가 없다.
+  ev.coalesce = true;
+  a.slot = -1;
+  a.expected = 0;
+  a.received = 0;
+
+  if (!ready_.push(ev)) {
+    recycle(ev.slot);
+    stats_.dropped_ring_full++;
+    return false;
+  }
+  stats_.enqueued++;
+  stats_.bytes += ev.len;
+  return true;
+}
+
+bool MqttRxQueue::pop(MqttRxEvent& out) {
+  const uint32_t depth = (uint32_t)ready_.size();
+  if (depth > stats_.max_depth) stats_.max_depth = depth;
+
+  while (ready_.pop(out)) {
+    bool superseded = false;
+    if (out.coalesce) {
+      MqttRxEvent next;
+      for (size_t i = 0; ready_.peek(i, next); ++i) {
+        if (next.topic == out.topic) {
+          superseded = true;
+          break;
+        }
+      }
+    }
+    if (!superseded) {
+      stats_.delivered++;
+      return true;
+    }
+    stats_.coalesced++;
+    release(out);
+  }
+  return false;
+}
+
+// 소비자(loop) 전용. free 링의 유일한 생산자다.
+void MqttRxQueue::release(const MqttRxEvent& ev) {
+  if (ev.slot < kSlotCount) {
+    free_.push(ev.slot);
+  }
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+// MQTT 콜백(async-tcp 태스크)과 loop()(LVGL 스레드) 사이의 수신 이벤트 큐.
+//
+// 예전에는 토픽마다 단일 덮어쓰기 슬롯(PendingPayload)을 두고 String을 두 번 복사했다.
+// 그 구조에서는 처리 중에 도착한 중간 페이로드가 조용히 덮어써졌고,
+// 메시지마다 new String/delete가 반복되어 힙 단편화가 쌓였다.
+//
+// 여기서는 단일 생산자/단일 소비자(SPSC) 링 두 개로 락 없이 주고받는다.
+//  - ready 링: 생산자(MQTT) → 소비자(loop). 완성된 이벤트를 넘긴다.
+//  - free  링: 소비자(loop) → 생산자(MQTT). 다 쓴 페이로드 슬롯을 돌려준다.
+//    free 링에 넣는 쪽은 소비자뿐이다. 생산자가 조립을 포기하거나 넘기지 못한 슬롯은
+//    생산자 전용 예비 목록(spare_)에 두었다가 다음 메시지에 먼저 쓴다.
+// 페이로드 버퍼는 슬롯 풀에 고정되어 재사용되므로(용량이 부족할 때만 확장),
+// 평상시에는 메시지당 힙 할당이 없다. 슬롯은 인덱스로만 주고받아 복사도 없다.
+
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+ public:
+  // 생산자 전용
+  bool push(const T& v) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    const uint32_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= N) return false;
+    items_[head & (N - 1)] = v;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 소비자 전용
+  bool pop(T& out) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    const uint32_t head = head_.load(std::memory_order_acquire);
+    if (tail == head) return false;
+    out = items_[tail & (N - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // 소비자 전용: 아직 꺼내지 않은 i번째 항목을 들여다본다(0 = 다음에 pop될 항목).
+  bool peek(size_t i, T& out) const {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    const uint32_t head = head_.load(std::memory_order_acquire);
+    if (i >= (size_t)(head - tail)) return false;
+    out = items_[(tail + i) & (N - 1)];
+    return true;
+  }
+
+  size_t size() const {
+    return (size_t)(head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire));
+  }
+
+  static constexpr size_t capacity() { return N; }
+
+ private:
+  T items_[N];
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+};
+
+// loop()로 넘겨 처리하는 수신 토픽. 순서는 통계 배열 인덱스로도 쓴다.
+// homeworks는 재조립 없이 스트리밍 디코딩하므로 여기 없다(hw_sync.h).
+enum MqttRxTopic : uint8_t {
+  MQTT_RX_STUDENTS_TODAY = 0,
+  MQTT_RX_STUDENT_INFO,
+  MQTT_RX_TOPIC_COUNT
+};
+
+struct MqttRxEvent {
+  uint32_t seq;       // 큐 전체 단조 증가 번호(유실 추적용)
+  uint32_t rx_ms;     // 마지막 청크 수신 시각
+  uint32_t len;       // 페이로드 바이트 수(널 종료 제외)
+  uint8_t topic;      // MqttRxTopic
+  uint8_t slot;       // 페이로드 슬롯 인덱스(소유권은 꺼낸 쪽에 있다)
+  bool coalesce;      // 뒤에 같은 토픽 이벤트가 이미 있으면 건너뛰어도 되는 스냅샷인지
+};
+
+// 카운터는 각각 한쪽(생산자 또는 소비자)만 쓴다. 읽는 쪽은 로그용이라 경합을 허용한다.
+struct MqttRxStats {
+  uint32_t enqueued;          // 생산자: ready 링에 넣은 이벤트 수
+  uint32_t delivered;         // 소비자: 처리하도록 넘긴 이벤트 수
+  uint32_t coalesced;         // 소비자: 더 새 스냅샷이 있어 건너뛴 이벤트 수
+  uint32_t dropped_ring_full; // 생산자: ready 링이 가득 차 버린 메시지 수
+  uint32_t dropped_no_slot;   // 생산자: 빈 슬롯이 없어 버린 메시지 수
+  uint32_t dropped_oversize;  // 생산자: 최대 크기를 넘어 버린 메시지 수
+  uint32_t dropped_alloc;     // 생산자: 슬롯 확장(할당) 실패로 버린 메시지 수
+  uint32_t max_depth;         // 소비자: 관측한 최대 대기 이벤트 수
+  uint32_t bytes;             // 생산자: 완성된 페이로드 누적 바이트
+};
+
+class MqttRxQueue {
+ public:
+  static const uint8_t kSlotCount = 6;
+  static const size_t kMaxPayloadBytes = 48 * 1024;
+
+  MqttRxQueue();
+
+  // 생산자(MQTT 콜백) 전용. AsyncMqttClient의 청크 단위로 그대로 넘긴다.
+  // 마지막 청크까지 모여 이벤트가 큐에 들어가면 true.
+  bool on_chunk(MqttRxTopic topic, const char* payload, size_t len, size_t index, size_t total,
+                uint32_t now_ms);
+
+  // 소비자(loop) 전용. 같은 토픽의 더 새 스냅샷이 뒤에 있으면 앞 것은 건너뛴다.
+  bool pop(MqttRxEvent& out);
+  // 꺼낸 이벤트의 페이로드(널 종료 보장). release() 전까지만 유효하다.
+  char* data(const MqttRxEvent& ev) const { return slots_[ev.slot].data; }
+  void release(const MqttRxEvent& ev);
+
+  bool pending() const { return ready_.size() > 0; }
+  const MqttRxStats& stats() const { return stats_; }
+  uint32_t dropped_total() const {
+    return stats_.dropped_ring_full + stats_.dropped_no_slot + stats_.dropped_oversize + stats_.dropped_alloc;
+  }
+
+ private:
+  struct Slot {
+    char* data;
+    size_t cap;
+  };
+  struct Assembly {
+    int8_t slot;       // 조립 중인 슬롯(-1: 없음)
+    bool dropping;     // 이번 메시지를 버리는 중(남은 청크 무시)
+    size_t expected;
+    size_t received;
+  };
+
+  bool ensure_capacity(Slot& s, size_t need);
+  void abandon(Assembly& a);
+  // 생산자 전용: 예비 목록 → free 링 순으로 빈 슬롯을 얻고, 못 쓴 슬롯은 예비 목록에 되돌린다.
+  bool acquire_slot(uint8_t& slot);
+  void recycle(uint8_t slot);
+
+  Slot slots_[kSlotCount];
+  Assembly asm_[MQTT_RX_TOPIC_COUNT];
+  SpscRing<MqttRxEvent, 8> ready_;
+  SpscRing<uint8_t, 8> free_;
+  uint8_t spare_[kSlotCount];
+  uint8_t spare_cnt_ = 0;
+  uint32_t next_seq_ = 0;
+  MqttRxStats stats_;
+};
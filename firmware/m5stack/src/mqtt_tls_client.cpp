@@ -0,0 +1,920 @@
+#include "mqtt_tls_client.h"
+
+#include <LittleFS.h>
+#include <fcntl.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <lwip/netdb.h>
+#include <lwip/sockets.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/error.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/x509_crt.h>
+
+#include "mqtt_link.h"
+
+#ifndef CFG_MQTT_TLS_TASK_STACK
+#define CFG_MQTT_TLS_TASK_STACK 12288       // 핸드셰이크(ECDHE, X.509)와 onMqttConnect 콜백 포함
+#endif
+#ifndef CFG_MQTT_TLS_TASK_PRIO
+#define CFG_MQTT_TLS_TASK_PRIO 2            // async_tcp(3)보다 낮고 loop(1)보다 높게
+#endif
+#ifndef CFG_MQTT_TLS_TASK_CORE
+#define CFG_MQTT_TLS_TASK_CORE 0            // 핸드셰이크 CPU를 UI 코어(1)에서 떼어 낸다
+#endif
+#ifndef CFG_MQTT_TLS_CONNECT_BUDGET_MS
+#define CFG_MQTT_TLS_CONNECT_BUDGET_MS 18000  // TCP + TLS + CONNACK 합계. 넘기면 이쪽이 먼저 포기한다
+#endif
+#ifndef CFG_MQTT_TLS_TCP_CONNECT_MS
+#define CFG_MQTT_TLS_TCP_CONNECT_MS 5000    // 그중 TCP connect 몫(프로브가 이미 도달성을 확인했다)
+#endif
+#ifndef CFG_MQTT_TLS_SEND_TIMEOUT_MS
+#define CFG_MQTT_TLS_SEND_TIMEOUT_MS 3000   // publish가 loop를 붙잡는 최대 시간
+#endif
+#ifndef CFG_MQTT_TLS_RTC_BYTES
+#define CFG_MQTT_TLS_RTC_BYTES 2048         // 직렬화한 세션(티켓 + 서버 인증서). 넘치면 RAM에만 둔다
+#endif
+#ifndef CFG_MQTT_TLS_INSECURE
+#define CFG_MQTT_TLS_INSECURE 0             // 1: 인증서 검증 생략(시험용)
+#endif
+
+// MqttLink는 CONNECT 단계가 kConnectTimeoutMs를 넘으면 disconnect(true)로 끊고 실패로 센다.
+// 한 번의 시도(TCP + TLS + CONNACK)는 그 안에서 끝나야 실패 사유가 정확히 남는다.
+static_assert(CFG_MQTT_TLS_CONNECT_BUDGET_MS < MqttLink::kConnectTimeoutMs, "TLS connect budget must fit MqttLink CONNECT timeout");
+static_assert(CFG_MQTT_TLS_TCP_CONNECT_MS < CFG_MQTT_TLS_CONNECT_BUDGET_MS, "TCP connect must leave room for TLS");
+
+namespace {
+
+const char* kCaPath = "/mqtt_ca.pem";
+const size_t kCaMaxBytes = 8192;
+const int kReadTimeoutMs = 500;
+const uint32_t kRtcMagic = 0x544C5331;  // "TLS1"
+
+struct RtcSession {
+  uint32_t magic;
+  uint32_t peer;  // host:port 해시. 다른 브로커에 남의 세션을 내밀지 않는다
+  uint32_t len;
+  uint32_t sum;
+  uint8_t data[CFG_MQTT_TLS_RTC_BYTES];
+};
+
+// 소프트 리셋·딥슬립 뒤에도 남는다. 전원 투입 직후에는 쓰레기라 magic/sum으로 거른다.
+RTC_NOINIT_ATTR RtcSession s_rtc;
+// 마지막으로 성공한 세션(mqtt_tls 태스크 전용).
+mbedtls_ssl_session s_session;
+bool s_session_valid = false;
+uint32_t s_session_peer = 0;
+
+uint32_t fnv1a(const uint8_t* p, size_t n, uint32_t h = 2166136261u) {
+  for (size_t i = 0; i < n; ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+uint32_t peer_hash(const char* host, uint16_t port) {
+  const uint32_t h = fnv1a(reinterpret_cast<const uint8_t*>(host), strlen(host));
+  return fnv1a(reinterpret_cast<const uint8_t*>(&port), sizeof(port), h);
+}
+
+uint32_t rtc_sum(const RtcSession& r) {
+  const uint32_t h = fnv1a(reinterpret_cast<const uint8_t*>(&r.peer), sizeof(r.peer) + sizeof(r.len));
+  return fnv1a(r.data, r.len, h);
+}
+
+bool rtc_valid(uint32_t peer) {
+  return s_rtc.magic == kRtcMagic && s_rtc.peer == peer && s_rtc.len <= sizeof(s_rtc.data) && s_rtc.sum == rtc_sum(s_rtc);
+}
+
+void session_forget() {
+  mbedtls_ssl_session_free(&s_session);
+  mbedtls_ssl_session_init(&s_session);
+  s_session_valid = false;
+  s_rtc.magic = 0;
+}
+
+// RAM 사본이 있으면 그것을, 없으면(리셋 직후) RTC 사본을 풀어 쓴다. source: 1 RAM, 2 RTC.
+const mbedtls_ssl_session* session_take(uint32_t peer, uint8_t* source) {
+  if (s_session_valid && s_session_peer == peer) {
+    *source = 1;
+    return &s_session;
+  }
+  if (!rtc_valid(peer)) return nullptr;
+  mbedtls_ssl_session_free(&s_session);
+  mbedtls_ssl_session_init(&s_session);
+  if (mbedtls_ssl_session_load(&s_session, s_rtc.data, s_rtc.len) != 0) {
+    session_forget();
+    return nullptr;
+  }
+  s_session_valid = true;
+  s_session_peer = peer;
+  *source = 2;
+  return &s_session;
+}
+
+void session_store(const mbedtls_ssl_context* ssl, uint32_t peer) {
+  mbedtls_ssl_session_free(&s_session);
+  mbedtls_ssl_session_init(&s_session);
+  s_rtc.magic = 0;
+  s_session_valid = mbedtls_ssl_get_session(ssl, &s_session) == 0;
+  s_session_peer = peer;
+  if (!s_session_valid) return;
+  size_t len = 0;
+  const int ret = mbedtls_ssl_session_save(&s_session, s_rtc.data, sizeof(s_rtc.data), &len);
+  if (ret != 0) {
+    Serial.printf("[MQTT][TLS] session kept in RAM only (needs %u > %u RTC bytes)\n",
+                  (unsigned)len, (unsigned)sizeof(s_rtc.data));
+    return;
+  }
+  s_rtc.peer = peer;
+  s_rtc.len = len;
+  s_rtc.sum = rtc_sum(s_rtc);
+  s_rtc.magic = kRtcMagic;
+}
+
+size_t free_internal() {
+  return heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void log_tls_error(const char* what, int ret) {
+  char msg[96];
+  mbedtls_strerror(ret, msg, sizeof(msg));
+  Serial.printf("[MQTT][TLS] %s failed -0x%04x %s\n", what, (unsigned)-ret, msg);
+}
+
+// mbedtls_net_connect는 lwIP 기본 SYN 재전송(수십 초)까지 막힐 수 있어 기한을 둔 비블로킹 connect를 쓴다.
+// 성공하면 블로킹으로 되돌린 fd, 실패하면 -1.
+int tcp_connect(const char* host, uint16_t port, uint32_t timeout_ms) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  char port_str[8];
+  snprintf(port_str, sizeof(port_str), "%u", (unsigned)port);
+  struct addrinfo* res = nullptr;
+  if (getaddrinfo(host, port_str, &hints, &res) != 0 || !res) return -1;
+  int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+  if (fd >= 0) {
+    const int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    int ret = connect(fd, res->ai_addr, res->ai_addrlen);
+    if (ret != 0 && errno == EINPROGRESS) {
+      fd_set wfds;
+      FD_ZERO(&wfds);
+      FD_SET(fd, &wfds);
+      struct timeval tv;
+      tv.tv_sec = timeout_ms / 1000;
+      tv.tv_usec = (timeout_ms % 1000) * 1000;
+      ret = -1;
+      if (select(fd + 1, nullptr, &wfds, nullptr, &tv) > 0) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) ret = 0;
+      }
+    }
+    if (ret == 0) {
+      fcntl(fd, F_SETFL, flags);
+    } else {
+      close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(res);
+  return fd;
+}
+
+bool load_ca(mbedtls_x509_crt* ca) {
+#ifdef CFG_MQTT_TLS_CA_PEM
+  static const char kPem[] = CFG_MQTT_TLS_CA_PEM;
+  return mbedtls_x509_crt_parse(ca, reinterpret_cast<const unsigned char*>(kPem), sizeof(kPem)) == 0;
+#else
+  if (!LittleFS.begin(true)) return false;
+  File f = LittleFS.open(kCaPath, "r");
+  if (!f) return false;
+  const size_t n = f.size();
+  if (n == 0 || n > kCaMaxBytes) return false;
+  // PEM 파서는 NUL 종료를 요구한다. 파싱이 끝나면 DER만 남으므로 버퍼는 바로 돌려준다.
+  unsigned char* buf = static_cast<unsigned char*>(malloc(n + 1));
+  if (!buf) return false;
+  const bool ok = f.read(buf, n) == n;
+  buf[n] = '\0';
+  const int ret = ok ? mbedtls_x509_crt_parse(ca, buf, n + 1) : -1;
+  free(buf);
+  return ret == 0;
+#endif
+}
+
+void put_u16(uint8_t*& p, uint16_t v) {
+  *p++ = (uint8_t)(v >> 8);
+  *p++ = (uint8_t)(v & 0xFF);
+}
+
+void put_str(uint8_t*& p, const char* s, size_t n) {
+  put_u16(p, (uint16_t)n);
+  memcpy(p, s, n);
+  p += n;
+}
+
+void put_remaining(uint8_t*& p, uint32_t len) {
+  do {
+    uint8_t b = len & 0x7F;
+    len >>= 7;
+    if (len) b |= 0x80;
+    *p++ = b;
+  } while (len);
+}
+
+class TxLock {
+ public:
+  explicit TxLock(void* m) : m_(static_cast<SemaphoreHandle_t>(m)) { xSemaphoreTake(m_, portMAX_DELAY); }
+  ~TxLock() { xSemaphoreGive(m_); }
+
+ private:
+  SemaphoreHandle_t m_;
+};
+
+}  // namespace
+
+struct TlsConn {
+  mbedtls_net_context net;
+  mbedtls_ssl_context ssl;
+  mbedtls_ssl_config conf;
+  mbedtls_x509_crt ca;
+  mbedtls_entropy_context entropy;
+  mbedtls_ctr_drbg_context drbg;
+  bool ssl_live;  // ssl_setup 이후 ssl_free 전
+};
+
+MqttTlsClient::MqttTlsClient()
+    : host_(nullptr),
+      port_(8883),
+      client_id_(""),
+      keep_alive_s_(15),
+      clean_session_(true),
+      will_topic_(nullptr),
+      will_payload_(nullptr),
+      will_len_(0),
+      will_qos_(0),
+      will_retain_(false),
+      conn_(nullptr),
+      task_(nullptr),
+      tx_lock_(xSemaphoreCreateMutex()),
+      packet_id_(0),
+      last_tx_ms_(0),
+      last_rx_ms_(0),
+      ping_sent_ms_(0),
+      attempt_ms_(0),
+      connack_(-1),
+      rx_state_(RX_HEADER),
+      rx_header_(0),
+      rx_len_shift_(0),
+      rx_remaining_(0),
+      rx_var_need_(0),
+      rx_var_got_(0),
+      rx_payload_total_(0),
+      rx_payload_index_(0),
+      rx_packet_id_(0) {
+  memset(&stats_, 0, sizeof(stats_));
+  rx_topic_[0] = '\0';
+}
+
+MqttTlsClient& MqttTlsClient::setServer(const char* host, uint16_t port) {
+  host_ = host;
+  port_ = port;
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::setClientId(const char* client_id) {
+  client_id_ = client_id ? client_id : "";
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::setKeepAlive(uint16_t keep_alive_s) {
+  keep_alive_s_ = keep_alive_s;
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::setCleanSession(bool clean) {
+  clean_session_ = clean;
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::setWill(const char* topic, uint8_t qos, bool retain, const char* payload, size_t length) {
+  will_topic_ = topic;
+  will_qos_ = qos > 1 ? 1 : qos;
+  will_retain_ = retain;
+  will_payload_ = payload;
+  will_len_ = payload && length == 0 ? strlen(payload) : length;
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::onConnect(OnConnectCallback cb) {
+  on_connect_ = cb;
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::onDisconnect(OnDisconnectCallback cb) {
+  on_disconnect_ = cb;
+  return *this;
+}
+
+MqttTlsClient& MqttTlsClient::onMessage(OnMessageCallback cb) {
+  on_message_ = cb;
+  return *this;
+}
+
+void MqttTlsClient::connect() {
+  if (!host_) return;
+  if (!task_) {
+    TaskHandle_t h = nullptr;
+    if (xTaskCreatePinnedToCore(task_entry, "mqtt_tls", CFG_MQTT_TLS_TASK_STACK, this, CFG_MQTT_TLS_TASK_PRIO, &h,
+                                CFG_MQTT_TLS_TASK_CORE) != pdPASS) {
+      Serial.println("[MQTT][TLS] task create failed");
+      if (on_disconnect_) on_disconnect_(AsyncMqttClientDisconnectReason::TCP_DISCONNECTED);
+      return;
+    }
+    task_ = h;
+  }
+  connect_req_.store(true, std::memory_order_release);
+  xTaskNotifyGive(static_cast<TaskHandle_t>(task_));
+}
+
+void MqttTlsClient::disconnect(bool force) {
+  if (!task_) return;
+  disconnect_req_.store(force ? 2 : 1, std::memory_order_release);
+}
+
+uint16_t MqttTlsClient::next_packet_id() {
+  if (++packet_id_ == 0) packet_id_ = 1;
+  return packet_id_;
+}
+
+uint16_t MqttTlsClient::subscribe(const char* topic, uint8_t qos) {
+  if (!topic) return 0;
+  const size_t tl = strlen(topic);
+  if (tl + 16 > kTxBufBytes) return 0;
+  TxLock lock(tx_lock_);
+  if (!connected_.load(std::memory_order_acquire)) return 0;
+  const uint16_t pid = next_packet_id();
+  uint8_t* p = tx_buf_;
+  *p++ = 0x82;
+  put_remaining(p, (uint32_t)(2 + 2 + tl + 1));
+  put_u16(p, pid);
+  put_str(p, topic, tl);
+  *p++ = qos > 1 ? 1 : qos;
+  return flush_tx((size_t)(p - tx_buf_), nullptr, 0) ? pid : 0;
+}
+
+uint16_t MqttTlsClient::publish(const char* topic, uint8_t qos, bool retain, const char* payload, size_t length) {
+  if (!topic) return 0;
+  if (payload && length == 0) length = strlen(payload);
+  const size_t tl = strlen(topic);
+  if (tl + 16 > kTxBufBytes) return 0;
+  qos = qos > 1 ? 1 : qos;
+  TxLock lock(tx_lock_);
+  if (!connected_.load(std::memory_order_acquire)) return 0;
+  const uint16_t pid = qos ? next_packet_id() : 0;
+  uint8_t* p = tx_buf_;
+  *p++ = (uint8_t)(0x30 | (qos << 1) | (retain ? 1 : 0));
+  put_remaining(p, (uint32_t)(2 + tl + (qos ? 2 : 0) + length));
+  put_str(p, topic, tl);
+  if (qos) put_u16(p, pid);
+  if (!flush_tx((size_t)(p - tx_buf_), reinterpret_cast<const uint8_t*>(payload), length)) return 0;
+  return qos ? pid : 1;
+}
+
+// tx_lock_를 잡은 채로 부른다. 헤더는 tx_buf_에 있고, 본문이 같이 들어가면 한 레코드로 보낸다.
+bool MqttTlsClient::flush_tx(size_t head_len, const uint8_t* body, size_t body_len) {
+  if (body_len && head_len + body_len <= kTxBufBytes) {
+    memcpy(tx_buf_ + head_len, body, body_len);
+    head_len += body_len;
+    body_len = 0;
+  }
+  return write_all(tx_buf_, head_len) && (body_len == 0 || write_all(body, body_len));
+}
+
+bool MqttTlsClient::write_all(const uint8_t* data, size_t len) {
+  if (io_error_.load(std::memory_order_acquire)) return false;
+  while (len > 0) {
+    const int ret = mbedtls_ssl_write(&conn_->ssl, data, len);
+    if (ret > 0) {
+      data += ret;
+      len -= (size_t)ret;
+      continue;
+    }
+    if (ret == MBEDTLS_ERR_SSL_WANT_WRITE || ret == MBEDTLS_ERR_SSL_WANT_READ) continue;
+    stats_.last_error = ret;
+    io_error_.store(true, std::memory_order_release);
+    log_tls_error("write", ret);
+    return false;
+  }
+  last_tx_ms_ = millis();
+  return true;
+}
+
+bool MqttTlsClient::send_raw(const uint8_t* data, size_t len) {
+  TxLock lock(tx_lock_);
+  memcpy(tx_buf_, data, len);
+  return flush_tx(len, nullptr, 0);
+}
+
+void MqttTlsClient::task_entry(void* arg) {
+  static_cast<MqttTlsClient*>(arg)->task_loop();
+}
+
+void MqttTlsClient::task_loop() {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (connect_req_.exchange(false, std::memory_order_acq_rel)) run_session();
+  }
+}
+
+// mbedTLS 설정은 처음 한 번만 만든다(CA 파싱, DRBG 시드). 연결마다 바뀌는 건 ssl 컨텍스트뿐이다.
+bool MqttTlsClient::init_tls() {
+  if (conn_) return true;
+  if (stats_.config_error) return false;
+  void* mem = heap_caps_calloc(1, sizeof(TlsConn), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!mem) mem = calloc(1, sizeof(TlsConn));
+  if (!mem) return false;
+  TlsConn* c = static_cast<TlsConn*>(mem);
+  mbedtls_net_init(&c->net);
+  mbedtls_ssl_config_init(&c->conf);
+  mbedtls_x509_crt_init(&c->ca);
+  mbedtls_entropy_init(&c->entropy);
+  mbedtls_ctr_drbg_init(&c->drbg);
+  static const char kPers[] = "ygg-mqtt-tls";
+  int ret = mbedtls_ctr_drbg_seed(&c->drbg, mbedtls_entropy_func, &c->entropy,
+                                  reinterpret_cast<const unsigned char*>(kPers), sizeof(kPers) - 1);
+  if (ret == 0) {
+    ret = mbedtls_ssl_config_defaults(&c->conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                      MBEDTLS_SSL_PRESET_DEFAULT);
+  }
+  if (ret != 0) {
+    log_tls_error("init", ret);
+    mbedtls_ssl_config_free(&c->conf);
+    mbedtls_ctr_drbg_free(&c->drbg);
+    mbedtls_entropy_free(&c->entropy);
+    free(mem);
+    return false;
+  }
+  mbedtls_ssl_conf_rng(&c->conf, mbedtls_ctr_drbg_random, &c->drbg);
+  mbedtls_ssl_conf_read_timeout(&c->conf, kReadTimeoutMs);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+  mbedtls_ssl_conf_session_tickets(&c->conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+  if (load_ca(&c->ca)) {
+    mbedtls_ssl_conf_ca_chain(&c->conf, &c->ca, nullptr);
+    mbedtls_ssl_conf_authmode(&c->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+  } else if (CFG_MQTT_TLS_INSECURE) {
+    Serial.println("[MQTT][TLS] WARNING: no CA, server certificate NOT verified (CFG_MQTT_TLS_INSECURE)");
+    mbedtls_ssl_conf_authmode(&c->conf, MBEDTLS_SSL_VERIFY_NONE);
+  } else {
+    // CA 없이 검증을 끄면 TLS를 쓰는 의미가 없다. 빌드 플래그로 명시했을 때만 허용한다.
+    // 이대로는 어떤 핸드셰이크도 통과할 수 없으니 재시도마다 브로커를 두드리지 않고 설정 오류로 남긴다.
+    Serial.printf("[MQTT][TLS] config error: no CA (%s) and CFG_MQTT_TLS_INSECURE=0 -> not connecting until reboot\n",
+                  kCaPath);
+    stats_.config_error = true;
+    mbedtls_x509_crt_free(&c->ca);
+    mbedtls_ssl_config_free(&c->conf);
+    mbedtls_ctr_drbg_free(&c->drbg);
+    mbedtls_entropy_free(&c->entropy);
+    free(mem);
+    return false;
+  }
+  conn_ = c;
+  return true;
+}
+
+bool MqttTlsClient::open_tls(AsyncMqttClientDisconnectReason* reason) {
+  TlsConn& c = *conn_;
+  const uint32_t t0 = millis();
+  // 도달성은 MqttLink의 프로브가 이미 확인했다. 이 connect가 오래 걸려도 UI 코어는 돌고 있다.
+  c.net.fd = tcp_connect(host_, port_, CFG_MQTT_TLS_TCP_CONNECT_MS);
+  if (c.net.fd < 0) {
+    stats_.last_error = MBEDTLS_ERR_NET_CONNECT_FAILED;
+    Serial.printf("[MQTT][TLS] tcp connect failed after %lums\n", (unsigned long)(millis() - t0));
+    return false;
+  }
+  stats_.tcp_ms = millis() - t0;
+  int ret = 0;
+  struct timeval tv;
+  tv.tv_sec = CFG_MQTT_TLS_SEND_TIMEOUT_MS / 1000;
+  tv.tv_usec = (CFG_MQTT_TLS_SEND_TIMEOUT_MS % 1000) * 1000;
+  setsockopt(c.net.fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+  // ssl_setup이 레코드 버퍼를 잡으므로 측정 기준은 그 직전이다.
+  const size_t heap_base = free_internal();
+  size_t heap_min = heap_base;
+  mbedtls_ssl_init(&c.ssl);
+  c.ssl_live = true;
+  ret = mbedtls_ssl_setup(&c.ssl, &c.conf);
+  if (ret == 0) ret = mbedtls_ssl_set_hostname(&c.ssl, host_);
+  if (ret != 0) {
+    stats_.last_error = ret;
+    log_tls_error("setup", ret);
+    return false;
+  }
+  mbedtls_ssl_set_bio(&c.ssl, &c.net, mbedtls_net_send, nullptr, mbedtls_net_recv_timeout);
+
+  const uint32_t peer = peer_hash(host_, port_);
+  uint8_t source = 0;
+  const mbedtls_ssl_session* cached = session_take(peer, &source);
+  if (cached && mbedtls_ssl_set_session(&c.ssl, cached) != 0) {
+    session_forget();
+    source = 0;
+  }
+  stats_.session_source = source;
+
+  // mbedtls_ssl_handshake()를 풀어 쓴 것. 단계 사이마다 힙을 재고 중단 요청·기한을 본다.
+  // 재개가 받아들여지면 ServerHello 다음이 곧바로 ChangeCipherSpec이라 SERVER_CERTIFICATE를 지나지 않는다.
+  const uint32_t hs0 = millis();
+  bool full = false;
+  while (c.ssl.state != MBEDTLS_SSL_HANDSHAKE_OVER) {
+    if (c.ssl.state == MBEDTLS_SSL_SERVER_CERTIFICATE) full = true;
+    ret = mbedtls_ssl_handshake_step(&c.ssl);
+    const size_t f = free_internal();
+    if (f < heap_min) heap_min = f;
+    if (ret == 0) continue;
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE && ret != MBEDTLS_ERR_SSL_TIMEOUT) break;
+    if (disconnect_req_.load(std::memory_order_acquire) || millis() - attempt_ms_ >= CFG_MQTT_TLS_CONNECT_BUDGET_MS) {
+      ret = MBEDTLS_ERR_SSL_TIMEOUT;
+      break;
+    }
+    ret = 0;
+  }
+  const uint32_t ms = millis() - hs0;
+  if (ret != 0) {
+    stats_.handshake_fail++;
+    stats_.last_error = ret;
+    log_tls_error("handshake", ret);
+    if (ret == MBEDTLS_ERR_X509_CERT_VERIFY_FAILED) {
+      char info[128];
+      mbedtls_x509_crt_verify_info(info, sizeof(info), "", mbedtls_ssl_get_verify_result(&c.ssl));
+      Serial.printf("[MQTT][TLS] certificate: %s", info);
+      *reason = AsyncMqttClientDisconnectReason::TLS_BAD_FINGERPRINT;
+    }
+    // 오래된 티켓 때문에 계속 실패하지 않도록, 재개를 시도했다면 다음은 전체 핸드셰이크로 간다.
+    if (source) session_forget();
+    return false;
+  }
+
+  const uint32_t peak = heap_base > heap_min ? (uint32_t)(heap_base - heap_min) : 0;
+  stats_.last_resumed = !full;
+  if (full) {
+    stats_.handshakes_full++;
+    stats_.full_ms = ms;
+    stats_.full_heap_peak = peak;
+  } else {
+    stats_.handshakes_resumed++;
+    stats_.resumed_ms = ms;
+    stats_.resumed_heap_peak = peak;
+  }
+  session_store(&c.ssl, peer);
+  const size_t after = free_internal();
+  stats_.session_heap = heap_base > after ? (uint32_t)(heap_base - after) : 0;
+  Serial.printf("[MQTT][TLS] handshake %s %lums tcp=%lums heap_peak=%u held=%u offered=%s suite=%s\n",
+                full ? "full" : "resumed",
+                (unsigned long)ms,
+                (unsigned long)stats_.tcp_ms,
+                (unsigned)peak,
+                (unsigned)stats_.session_heap,
+                source == 2 ? "rtc" : (source == 1 ? "ram" : "none"),
+                mbedtls_ssl_get_ciphersuite(&c.ssl));
+  return true;
+}
+
+void MqttTlsClient::close_tls(bool notify) {
+  TlsConn& c = *conn_;
+  if (c.ssl_live) {
+    if (notify) mbedtls_ssl_close_notify(&c.ssl);
+    mbedtls_ssl_free(&c.ssl);
+    c.ssl_live = false;
+  }
+  mbedtls_net_free(&c.net);
+}
+
+bool MqttTlsClient::mqtt_handshake(AsyncMqttClientDisconnectReason* reason, bool* session_present) {
+  const size_t cid_len = strlen(client_id_);
+  const bool will = will_topic_ != nullptr;
+  const size_t wt_len = will ? strlen(will_topic_) : 0;
+  const size_t wp_len = will ? will_len_ : 0;
+  const uint32_t rem = 10 + 2 + cid_len + (will ? 2 + wt_len + 2 + wp_len : 0);
+  if (rem + 5 > kTxBufBytes) {
+    Serial.println("[MQTT][TLS] CONNECT too large");
+    return false;
+  }
+  uint8_t flags = clean_session_ ? 0x02 : 0x00;
+  if (will) flags |= (uint8_t)(0x04 | (will_qos_ << 3) | (will_retain_ ? 0x20 : 0));
+  {
+    TxLock lock(tx_lock_);
+    uint8_t* p = tx_buf_;
+    *p++ = 0x10;
+    put_remaining(p, rem);
+    put_str(p, "MQTT", 4);
+    *p++ = 0x04;  // 3.1.1
+    *p++ = flags;
+    put_u16(p, keep_alive_s_);
+    put_str(p, client_id_, cid_len);
+    if (will) {
+      put_str(p, will_topic_, wt_len);
+      put_u16(p, (uint16_t)wp_len);
+      memcpy(p, will_payload_, wp_len);
+      p += wp_len;
+    }
+    if (!flush_tx((size_t)(p - tx_buf_), nullptr, 0)) return false;
+  }
+
+  connack_ = -1;
+  const uint32_t t0 = millis();
+  while (connack_ < 0) {
+    if (disconnect_req_.load(std::memory_order_acquire) || millis() - attempt_ms_ >= CFG_MQTT_TLS_CONNECT_BUDGET_MS) {
+      Serial.printf("[MQTT][TLS] no CONNACK in %lums\n", (unsigned long)(millis() - t0));
+      return false;
+    }
+    const int n = read_some(rx_buf_, sizeof(rx_buf_), 100);
+    if (n < 0) return false;
+    if (n > 0) feed(rx_buf_, (size_t)n);
+    if (io_error_.load(std::memory_order_acquire)) return false;
+  }
+  const uint8_t rc = (uint8_t)(connack_ & 0xFF);
+  *session_present = (connack_ >> 8) & 1;
+  if (rc != 0) {
+    Serial.printf("[MQTT][TLS] CONNACK refused rc=%u\n", (unsigned)rc);
+    if (rc <= 5) *reason = (AsyncMqttClientDisconnectReason)rc;
+    return false;
+  }
+  return true;
+}
+
+// 0: 읽을 것 없음, <0: 연결 끝. select는 잠금 밖에서 기다리므로 그동안 publish가 막히지 않는다.
+int MqttTlsClient::read_some(uint8_t* buf, size_t len, uint32_t wait_ms) {
+  TlsConn& c = *conn_;
+  if (mbedtls_ssl_get_bytes_avail(&c.ssl) == 0) {
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    FD_SET(c.net.fd, &rfds);
+    struct timeval tv;
+    tv.tv_sec = wait_ms / 1000;
+    tv.tv_usec = (wait_ms % 1000) * 1000;
+    const int s = select(c.net.fd + 1, &rfds, nullptr, nullptr, &tv);
+    if (s < 0) return -1;
+    if (s == 0) return 0;
+  }
+  int ret;
+  {
+    TxLock lock(tx_lock_);
+    ret = mbedtls_ssl_read(&c.ssl, buf, len);
+  }
+  if (ret > 0) {
+    last_rx_ms_ = millis();
+    return ret;
+  }
+  if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE || ret == MBEDTLS_ERR_SSL_TIMEOUT) return 0;
+  if (ret == 0 || ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+    Serial.println("[MQTT][TLS] closed by broker");
+  } else {
+    stats_.last_error = ret;
+    log_tls_error("read", ret);
+  }
+  return -1;
+}
+
+void MqttTlsClient::reset_rx() {
+  rx_state_ = RX_HEADER;
+  rx_remaining_ = 0;
+  rx_var_need_ = 0;
+  rx_var_got_ = 0;
+}
+
+void MqttTlsClient::begin_body() {
+  const uint8_t type = rx_header_ >> 4;
+  rx_var_got_ = 0;
+  if (type == 3) {
+    // PUBLISH: 토픽 길이(2바이트)부터 읽고 가변 헤더 전체 길이를 정한다.
+    rx_var_need_ = 2;
+    rx_state_ = rx_remaining_ >= 2 ? RX_VAR : (rx_remaining_ ? RX_SKIP : RX_HEADER);
+  } else if (rx_remaining_ <= sizeof(rx_var_)) {
+    rx_var_need_ = rx_remaining_;
+    rx_state_ = RX_VAR;
+    if (rx_var_need_ == 0) on_packet_done();
+  } else {
+    rx_state_ = RX_SKIP;
+  }
+}
+
+// PUBLISH 가변 헤더가 다 모였다: 토픽을 NUL 종료 사본으로 두고 페이로드 전달을 시작한다.
+void MqttTlsClient::begin_payload() {
+  const uint8_t qos = (rx_header_ >> 1) & 0x03;
+  const size_t tl = ((size_t)rx_var_[0] << 8) | rx_var_[1];
+  memcpy(rx_topic_, rx_var_ + 2, tl);
+  rx_topic_[tl] = '\0';
+  rx_packet_id_ = qos ? (uint16_t)(((uint16_t)rx_var_[2 + tl] << 8) | rx_var_[3 + tl]) : 0;
+  rx_payload_total_ = rx_remaining_;
+  rx_payload_index_ = 0;
+  if (rx_payload_total_ == 0) {
+    deliver(nullptr, 0);
+    return;
+  }
+  rx_state_ = RX_PAYLOAD;
+}
+
+void MqttTlsClient::deliver(const uint8_t* data, size_t len) {
+  if (on_message_) {
+    AsyncMqttClientMessageProperties props;
+    props.qos = (rx_header_ >> 1) & 0x03;
+    props.dup = (rx_header_ & 0x08) != 0;
+    props.retain = (rx_header_ & 0x01) != 0;
+    // AsyncMqttClient와 같이 수신 버퍼를 그대로 넘긴다(NUL 종료 아님, len 만큼만 유효).
+    on_message_(rx_topic_, reinterpret_cast<char*>(const_cast<uint8_t*>(data)), props, len, rx_payload_index_,
+                rx_payload_total_);
+  }
+  rx_payload_index_ += (uint32_t)len;
+  if (rx_payload_index_ >= rx_payload_total_) {
+    if (rx_packet_id_) send_puback(rx_packet_id_);
+    rx_state_ = RX_HEADER;
+  }
+}
+
+void MqttTlsClient::on_packet_done() {
+  const uint8_t type = rx_header_ >> 4;
+  switch (type) {
+    case 2:  // CONNACK
+      if (rx_var_need_ >= 2) connack_ = (int16_t)(((rx_var_[0] & 1) << 8) | rx_var_[1]);
+      break;
+    case 9:  // SUBACK
+      if (rx_var_need_ >= 3 && rx_var_[2] == 0x80) {
+        Serial.printf("[MQTT][TLS] subscribe rejected pid=%u\n", (unsigned)(((uint16_t)rx_var_[0] << 8) | rx_var_[1]));
+      }
+      break;
+    case 13:  // PINGRESP
+      ping_sent_ms_ = 0;
+      break;
+    default:  // PUBACK/UNSUBACK 등: 재전송을 하지 않으므로 볼 것이 없다
+      break;
+  }
+  rx_state_ = RX_HEADER;
+}
+
+void MqttTlsClient::feed(const uint8_t* p, size_t n) {
+  while (n > 0) {
+    switch (rx_state_) {
+      case RX_HEADER:
+        rx_header_ = *p++;
+        --n;
+        rx_remaining_ = 0;
+        rx_len_shift_ = 0;
+        rx_state_ = RX_LENGTH;
+        break;
+
+      case RX_LENGTH: {
+        const uint8_t b = *p++;
+        --n;
+        rx_remaining_ |= (uint32_t)(b & 0x7F) << rx_len_shift_;
+        rx_len_shift_ += 7;
+        if (!(b & 0x80)) {
+          begin_body();
+        } else if (rx_len_shift_ > 21) {
+          Serial.println("[MQTT][TLS] malformed remaining length");
+          io_error_.store(true, std::memory_order_release);
+          return;
+        }
+        break;
+      }
+
+      case RX_VAR: {
+        size_t take = rx_var_need_ - rx_var_got_;
+        if (take > n) take = n;
+        memcpy(rx_var_ + rx_var_got_, p, take);
+        rx_var_got_ += (uint32_t)take;
+        p += take;
+        n -= take;
+        if (rx_var_got_ < rx_var_need_) break;
+        if ((rx_header_ >> 4) != 3) {
+          on_packet_done();
+          break;
+        }
+        if (rx_var_need_ == 2) {
+          const size_t tl = ((size_t)rx_var_[0] << 8) | rx_var_[1];
+          const size_t need = 2 + tl + ((rx_header_ & 0x06) ? 2 : 0);
+          if (tl > kMaxTopicBytes || need > rx_remaining_) {
+            Serial.printf("[MQTT][TLS] drop publish (topic %u bytes)\n", (unsigned)tl);
+            rx_remaining_ -= 2;
+            rx_state_ = rx_remaining_ ? RX_SKIP : RX_HEADER;
+            break;
+          }
+          if (need > 2) {
+            rx_var_need_ = (uint32_t)need;
+            break;
+          }
+        }
+        rx_remaining_ -= rx_var_need_;
+        begin_payload();
+        break;
+      }
+
+      case RX_PAYLOAD: {
+        size_t take = rx_payload_total_ - rx_payload_index_;
+        if (take > n) take = n;
+        deliver(p, take);
+        p += take;
+        n -= take;
+        break;
+      }
+
+      case RX_SKIP: {
+        size_t take = rx_remaining_;
+        if (take > n) take = n;
+        rx_remaining_ -= (uint32_t)take;
+        p += take;
+        n -= take;
+        if (rx_remaining_ == 0) rx_state_ = RX_HEADER;
+        break;
+      }
+    }
+  }
+}
+
+void MqttTlsClient::send_puback(uint16_t packet_id) {
+  const uint8_t pkt[4] = {0x40, 0x02, (uint8_t)(packet_id >> 8), (uint8_t)(packet_id & 0xFF)};
+  send_raw(pkt, sizeof(pkt));
+}
+
+void MqttTlsClient::run_session() {
+  AsyncMqttClientDisconnectReason reason = AsyncMqttClientDisconnectReason::TCP_DISCONNECTED;
+  bool session_present = false;
+  disconnect_req_.store(0, std::memory_order_release);
+  io_error_.store(false, std::memory_order_release);
+  reset_rx();
+  ping_sent_ms_ = 0;
+  attempt_ms_ = millis();
+
+  if (!init_tls()) {
+    if (on_disconnect_) on_disconnect_(reason);
+    return;
+  }
+
+  uint8_t dreq = 0;
+  if (open_tls(&reason) && mqtt_handshake(&reason, &session_present)) {
+    last_rx_ms_ = millis();
+    connected_.store(true, std::memory_order_release);
+    if (on_connect_) on_connect_(session_present);
+    const uint32_t ka_ms = (uint32_t)keep_alive_s_ * 1000u;
+    for (;;) {
+      dreq = disconnect_req_.load(std::memory_order_acquire);
+      if (dreq == 1) {
+        const uint8_t pkt[2] = {0xE0, 0x00};
+        send_raw(pkt, sizeof(pkt));
+      }
+      if (dreq || io_error_.load(std::memory_order_acquire)) break;
+      const int n = read_some(rx_buf_, sizeof(rx_buf_), 50);
+      if (n < 0) break;
+      if (n > 0) feed(rx_buf_, (size_t)n);
+      if (ka_ms == 0) continue;
+      // AsyncMqttClient와 같은 규칙: 어느 쪽이든 keepalive만큼 조용하면 PINGREQ,
+      // 응답이 keepalive의 70% 안에 없으면 죽은 연결로 본다(브로커의 1.5배 기한보다 먼저).
+      const uint32_t now = millis();
+      if (ping_sent_ms_ != 0) {
+        if (now - ping_sent_ms_ >= ka_ms * 7 / 10) {
+          stats_.ping_timeouts++;
+          Serial.printf("[MQTT][TLS] no PINGRESP in %lums\n", (unsigned long)(now - ping_sent_ms_));
+          break;
+        }
+      } else if (now - last_tx_ms_ >= ka_ms || now - last_rx_ms_ >= ka_ms) {
+        const uint8_t pkt[2] = {0xC0, 0x00};
+        if (!send_raw(pkt, sizeof(pkt))) break;
+        ping_sent_ms_ = now ? now : 1;
+      }
+    }
+  }
+
+  {
+    TxLock lock(tx_lock_);
+    connected_.store(false, std::memory_order_release);
+    close_tls(dreq == 1);
+  }
+  if (on_disconnect_) on_disconnect_(reason);
+}
+
+void MqttTlsClient::append_diag(String& out) const {
+  const uint8_t src = stats_.session_source;
+  out += "mqtt_tls=1 hs_full=" + String((unsigned long)stats_.handshakes_full) +
+         " hs_resumed=" + String((unsigned long)stats_.handshakes_resumed) +
+         " hs_fail=" + String((unsigned long)stats_.handshake_fail) +
+         " offered=" + String(src == 2 ? "rtc" : (src == 1 ? "ram" : "none")) +
+         " last=" + String(stats_.last_resumed ? "resumed" : "full") + "\n";
+  out += "mqtt_tls_full_ms=" + String((unsigned long)stats_.full_ms) +
+         " heap_peak=" + String((unsigned long)stats_.full_heap_peak) + "\n";
+  out += "mqtt_tls_resumed_ms=" + String((unsigned long)stats_.resumed_ms) +
+         " heap_peak=" + String((unsigned long)stats_.resumed_heap_peak) + "\n";
+  out += "mqtt_tls_tcp_ms=" + String((unsigned long)stats_.tcp_ms) +
+         " held_heap=" + String((unsigned long)stats_.session_heap) +
+         " ping_timeouts=" + String((unsigned long)stats_.ping_timeouts) +
+         " last_err=" + String((long)stats_.last_error) + "\n";
+  if (stats_.config_error) out += "mqtt_tls_config_error=no_ca\n";
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncMqttClient.h>  // 콜백 인자 타입(DisconnectReason, MessageProperties)을 그대로 쓴다
+#include <atomic>
+#include <functional>
+
+// MQTT 3.1.1 over TLS(mbedTLS, lwIP 소켓) 클라이언트. -D CFG_MQTT_TLS=1 일 때 AsyncMqttClient 대신 쓴다.
+//
+// 스톡 AsyncTCP에는 TLS가 없고, IDF esp-mqtt는 세션 재개 상태를 밖으로 꺼내 주지 않는다.
+// 그래서 main.cpp가 쓰는 AsyncMqttClient 부분집합(setServer/connect/publish/subscribe/콜백)만
+// 같은 모양으로 구현하고, 핸드셰이크는 전용 태스크(core 0)에서 돌려 UI 루프(core 1)를 막지 않는다.
+//
+// 세션 재개: 핸드셰이크가 끝날 때마다 mbedtls_ssl_get_session으로 세션(ID + 티켓)을 RAM에 보관하고,
+// 직렬화한 사본을 RTC_NOINIT 메모리에 남긴다. 다음 연결은 set_session으로 재개를 시도하므로
+// 재연결(RAM)과 소프트 리셋·딥슬립 복귀(RTC) 모두 ECDHE·인증서 검증 없이 끝난다.
+// 브로커가 재개를 거절하면 mbedTLS가 알아서 전체 핸드셰이크로 넘어간다.
+//
+// 측정: 핸드셰이크를 한 단계씩 돌리며 소요 시간과 내부 힙 최저점을 잰다(전체/재개 따로). append_diag()로
+// WIFI-DIAG에 싣는다. 힙 수치는 다른 태스크의 할당이 섞인 근사치다.
+//
+// 스레드: 콜백은 mqtt_tls 태스크에서 불린다(AsyncMqttClient의 async-tcp 태스크와 같은 위치).
+// publish/subscribe는 어느 태스크에서 불러도 되고 mutex로 송신을 직렬화한다.
+// QoS1 발행은 패킷 ID만 돌려주고 재전송하지 않는다(clean session, 앱 레벨 ack는 cmd_journal).
+//
+// 신뢰: LittleFS /mqtt_ca.pem(또는 -D CFG_MQTT_TLS_CA_PEM)의 CA로 브로커 인증서를 검증한다.
+// CA가 없으면 연결하지 않는다(설정 오류, 진단에 mqtt_tls_config_error). 시험용으로 -D CFG_MQTT_TLS_INSECURE=1 이면 검증을 건너뛴다. 로컬 브로커는 tools/mqtt_tls_broker.sh.
+
+struct TlsConn;  // mbedTLS 상태(.cpp)
+
+struct MqttTlsStats {
+  uint32_t handshakes_full;
+  uint32_t handshakes_resumed;
+  uint32_t handshake_fail;
+  uint32_t full_ms;            // 마지막 전체 핸드셰이크(TCP connect 제외)
+  uint32_t resumed_ms;         // 마지막 재개 핸드셰이크
+  uint32_t full_heap_peak;     // 핸드셰이크 동안 내부 힙 최대 사용량(ssl_setup 직전 대비)
+  uint32_t resumed_heap_peak;
+  uint32_t session_heap;       // 연결을 유지하는 동안 TLS가 잡고 있는 내부 힙
+  uint32_t tcp_ms;             // 마지막 TCP connect
+  uint32_t ping_timeouts;      // PINGRESP가 오지 않아 끊은 횟수
+  int32_t last_error;          // 마지막 mbedTLS 오류 코드(0: 없음)
+  uint8_t session_source;      // 마지막 시도에 넣은 세션: 0 없음, 1 RAM, 2 RTC
+  bool last_resumed;
+  bool config_error;           // CA 없음(검증 불가): 재부팅 전까지 연결을 시도하지 않는다
+};
+
+class MqttTlsClient {
+ public:
+  typedef std::function<void(bool session_present)> OnConnectCallback;
+  typedef std::function<void(AsyncMqttClientDisconnectReason reason)> OnDisconnectCallback;
+  typedef std::function<void(char* topic, char* payload, AsyncMqttClientMessageProperties properties,
+                             size_t len, size_t index, size_t total)>
+      OnMessageCallback;
+
+  static const size_t kMaxTopicBytes = 192;
+  static const size_t kRxChunkBytes = 1024;
+  static const size_t kTxBufBytes = 1024;
+
+  MqttTlsClient();
+
+  // AsyncMqttClient와 같게 문자열은 포인터만 저장한다(수명은 호출자 책임).
+  MqttTlsClient& setServer(const char* host, uint16_t port);
+  MqttTlsClient& setClientId(const char* client_id);
+  MqttTlsClient& setKeepAlive(uint16_t keep_alive_s);
+  MqttTlsClient& setCleanSession(bool clean);
+  MqttTlsClient& setWill(const char* topic, uint8_t qos, bool retain, const char* payload = nullptr, size_t length = 0);
+  MqttTlsClient& onConnect(OnConnectCallback cb);
+  MqttTlsClient& onDisconnect(OnDisconnectCallback cb);
+  MqttTlsClient& onMessage(OnMessageCallback cb);
+
+  bool connected() const { return connected_.load(std::memory_order_acquire); }
+  // 비블로킹: 태스크에 연결을 요청하고 바로 돌아온다. 결과는 onConnect/onDisconnect로 온다.
+  void connect();
+  // force=false면 DISCONNECT를 보내고 닫는다(LWT 없음). true면 소켓만 닫는다.
+  void disconnect(bool force = false);
+  // 0: 실패(연결 없음/송신 오류). QoS0 발행은 1, QoS1은 패킷 ID.
+  uint16_t subscribe(const char* topic, uint8_t qos);
+  uint16_t publish(const char* topic, uint8_t qos, bool retain, const char* payload = nullptr, size_t length = 0);
+
+  const MqttTlsStats& stats() const { return stats_; }
+  void append_diag(String& out) const;
+
+ private:
+  enum RxState : uint8_t { RX_HEADER, RX_LENGTH, RX_VAR, RX_PAYLOAD, RX_SKIP };
+
+  static void task_entry(void* arg);
+  void task_loop();
+  void run_session();
+  bool init_tls();
+  bool open_tls(AsyncMqttClientDisconnectReason* reason);
+  void close_tls(bool notify);
+  bool mqtt_handshake(AsyncMqttClientDisconnectReason* reason, bool* session_present);
+  bool write_all(const uint8_t* data, size_t len);
+  bool flush_tx(size_t head_len, const uint8_t* body, size_t body_len);
+  bool send_raw(const uint8_t* data, size_t len);
+  void send_puback(uint16_t packet_id);
+  uint16_t next_packet_id();
+  int read_some(uint8_t* buf, size_t len, uint32_t wait_ms);
+  void reset_rx();
+  void feed(const uint8_t* data, size_t len);
+  void begin_body();
+  void begin_payload();
+  void deliver(const uint8_t* data, size_t len);
+  void on_packet_done();
+
+  const char* host_;
+  uint16_t port_;
+  const char* client_id_;
+  uint16_t keep_alive_s_;
+  bool clean_session_;
+  const char* will_topic_;
+  const char* will_payload_;
+  size_t will_len_;
+  uint8_t will_qos_;
+  bool will_retain_;
+  OnConnectCallback on_connect_;
+  OnDisconnectCallback on_disconnect_;
+  OnMessageCallback on_message_;
+
+  TlsConn* conn_;
+  void* task_;             // TaskHandle_t
+  void* tx_lock_;          // SemaphoreHandle_t
+  std::atomic<bool> connected_{false};
+  std::atomic<bool> connect_req_{false};
+  std::atomic<uint8_t> disconnect_req_{0};  // 0 없음, 1 정상 종료, 2 강제
+  std::atomic<bool> io_error_{false};
+  uint16_t packet_id_;
+  uint32_t last_tx_ms_;
+  uint32_t last_rx_ms_;
+  uint32_t ping_sent_ms_;  // 0: 대기 중인 PINGREQ 없음
+  uint32_t attempt_ms_;    // 이번 연결 시도 시작(TCP + TLS + CONNACK 예산 기준)
+  int16_t connack_;        // -1: 대기, 그 외 (session_present << 8) | return code
+
+  // 수신 파서(태스크 전용)
+  RxState rx_state_;
+  uint8_t rx_header_;
+  uint8_t rx_len_shift_;
+  uint32_t rx_remaining_;
+  uint32_t rx_var_need_;
+  uint32_t rx_var_got_;
+  uint32_t rx_payload_total_;
+  uint32_t rx_payload_index_;
+  uint16_t rx_packet_id_;
+  uint8_t rx_var_[kMaxTopicBytes + 4];
+  char rx_topic_[kMaxTopicBytes + 1];
+  uint8_t rx_buf_[kRxChunkBytes];
+  uint8_t tx_buf_[kTxBufBytes];  // tx_lock_ 아래에서만
+
+  MqttTlsStats stats_;
+};
@@ -0,0 +1,146 @@
+#include "mqtt_topic_router.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+static const uint32_t kFnvOffset = 2166136261u;
+static const uint32_t kFnvPrime = 16777619u;
+
+MqttTopicRouter::MqttTopicRouter() : dev_len_(0), ack_len_(0) {
+  dev_prefix_[0] = '\0';
+  ack_prefix_[0] = '\0';
+  memset(table_, 0, sizeof(table_));
+  memset(stats_, 0, sizeof(stats_));
+  for (uint8_t i = 0; i < kAssemblers; ++i) {
+    asm_[i].expected = 0;
+    asm_[i].received = 0;
+    asm_[i].dropping = false;
+  }
+}
+
+uint32_t MqttTopicRouter::hash_suffix(const char* s, size_t* len_out) {
+  uint32_t h = kFnvOffset;
+  size_t n = 0;
+  for (; s[n]; ++n) {
+    h ^= (uint8_t)s[n];
+    h *= kFnvPrime;
+  }
+  *len_out = n;
+  return h;
+}
+
+const char* MqttTopicRouter::suffix_of(MqttRoute route) {
+  switch (route) {
+    case MQTT_ROUTE_DEVICE_ACK: return "ack";
+    case MQTT_ROUTE_STUDENTS_TODAY: return "students_today";
+    case MQTT_ROUTE_HOMEWORKS: return "homeworks";
+    case MQTT_ROUTE_STUDENT_INFO: return "student_info";
+    case MQTT_ROUTE_UNBOUND: return "unbound";
+    case MQTT_ROUTE_UPDATE: return "update";
+    default: return nullptr;
+  }
+}
+
+const char* MqttTopicRouter::name(MqttRoute route) {
+  if (route == MQTT_ROUTE_ACADEMY_ACK) return "academy_ack";
+  if (route == MQTT_ROUTE_DEVICE_ACK) return "device_ack";
+  const char* s = suffix_of(route);
+  return s ? s : "unmatched";
+}
+
+int8_t MqttTopicRouter::assembler_of(MqttRoute route) {
+  if (route == MQTT_ROUTE_DEVICE_ACK) return 0;
+  if (route == MQTT_ROUTE_UPDATE) return 1;
+  return -1;
+}
+
+void MqttTopicRouter::configure(const char* academy_id, const char* device_id) {
+  int n = snprintf(dev_prefix_, sizeof(dev_prefix_), "academies/%s/devices/%s/", academy_id, device_id);
+  dev_len_ = (n > 0 && (size_t)n < sizeof(dev_prefix_)) ? (uint8_t)n : 0;
+  n = snprintf(ack_prefix_, sizeof(ack_prefix_), "academies/%s/ack/", academy_id);
+  ack_len_ = (n > 0 && (size_t)n < sizeof(ack_prefix_)) ? (uint8_t)n : 0;
+  if (dev_len_ == 0 || ack_len_ == 0) {
+    Serial.printf("[MQTT] router prefix too long (academy=%s device=%s)\n", academy_id, device_id);
+  }
+
+  memset(table_, 0, sizeof(table_));
+  for (uint8_t r = MQTT_ROUTE_DEVICE_ACK; r < MQTT_ROUTE_COUNT; ++r) {
+    size_t len = 0;
+    const uint32_t h = hash_suffix(suffix_of((MqttRoute)r), &len);
+    uint8_t b = h & (kBuckets - 1);
+    while (table_[b].route != MQTT_ROUTE_NONE) b = (b + 1) & (kBuckets - 1);
+    table_[b].hash = h;
+    table_[b].len = (uint8_t)len;
+    table_[b].route = r;
+  }
+  // 재연결 도중 끊긴 조립은 버린다.
+  for (uint8_t i = 0; i < kAssemblers; ++i) {
+    asm_[i].expected = 0;
+    asm_[i].received = 0;
+    asm_[i].dropping = false;
+  }
+}
+
+bool MqttTopicRouter::topic(MqttRoute route, char* out, size_t cap) const {
+  int n = -1;
+  if (route == MQTT_ROUTE_ACADEMY_ACK) {
+    n = snprintf(out, cap, "%s+", ack_prefix_);
+  } else if (const char* s = suffix_of(route)) {
+    n = snprintf(out, cap, "%s%s", dev_prefix_, s);
+  }
+  return n > 0 && (size_t)n < cap;
+}
+
+MqttRoute MqttTopicRouter::match(const char* topic) {
+  MqttRoute route = MQTT_ROUTE_NONE;
+  if (topic && dev_len_ > 0 && strncmp(topic, dev_prefix_, dev_len_) == 0) {
+    const char* suffix = topic + dev_len_;
+    size_t len = 0;
+    const uint32_t h = hash_suffix(suffix, &len);
+    uint8_t b = h & (kBuckets - 1);
+    for (uint8_t probe = 0; probe < kBuckets && table_[b].route != MQTT_ROUTE_NONE; ++probe) {
+      const Bucket& e = table_[b];
+      if (e.hash == h && e.len == len && memcmp(suffix, suffix_of((MqttRoute)e.route), len) == 0) {
+        route = (MqttRoute)e.route;
+        break;
+      }
+      b = (b + 1) & (kBuckets - 1);
+    }
+  } else if (topic && ack_len_ > 0 && strncmp(topic, ack_prefix_, ack_len_) == 0) {
+    route = MQTT_ROUTE_ACADEMY_ACK;
+  }
+  return route;
+}
+
+bool MqttTopicRouter::on_chunk(MqttRoute route, size_t len, size_t index, size_t total) {
+  MqttRouteStats& st = stats_[route < MQTT_ROUTE_COUNT ? route : MQTT_ROUTE_NONE];
+  const size_t want = total ? total : len;
+  st.chunks++;
+  st.bytes += len;
+  const bool last = index + len >= want;
+  if (last) st.messages++;
+  return last;
+}
+
+const char* MqttTopicRouter::assemble(MqttRoute route, const char* payload, size_t len, size_t index, size_t total) {
+  const int8_t ai = assembler_of(route);
+  if (ai < 0) return nullptr;
+  Assembly& a = asm_[ai];
+  const size_t want = total ? total : len;
+  if (index == 0) {
+    a.expected = want;
+    a.received = 0;
+    a.dropping = want >= kAssembleBytes || len > want;
+    if (a.dropping) stats_[route].dropped++;
+  } else if (index != a.received || a.expected != want || a.received + len > a.expected) {
+    // 중간부터 들어온 청크(앞 청크 유실): 이번 메시지는 버린다.
+    if (!a.dropping) stats_[route].dropped++;
+    a.dropping = true;
+  }
+  if (a.dropping) return nullptr;
+  if (len > 0 && payload) memcpy(a.buf + a.received, payload, len);
+  a.received += len;
+  if (a.received < a.expected) return nullptr;
+  a.buf[a.received] = '\0';
+  return a.buf;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 구독 토픽 → 라우트 번호 디스패치 테이블.
+//
+// 예전 onMqttMessage는 콜백마다 String(topic)을 만들고 토픽 String 7개와 차례로 비교했다.
+// async-tcp 태스크 안에서 힙 할당과 선형 비교가 매번 일어나 그만큼 네트워크 스택이 멈췄다.
+//
+// 여기서는 구독 시점(configure)에 academies/{a}/devices/{d}/ 접두사와 academies/{a}/ack/ 접두사를
+// 고정 버퍼에 한 번 만들어 두고, 장치 토픽의 접미사(students_today, homeworks, ...)는
+// FNV-1a 해시로 8칸 오픈 어드레싱 테이블에 넣는다. 수신 시에는
+//  1) 접두사 memcmp 한 번, 2) 접미사 해시 + 테이블 한 칸(충돌 시 다음 칸), 3) 같은 칸이면 길이·바이트 확인
+// 으로 끝나며 할당은 없다. 라우트별 메시지/청크/바이트 카운터와, 작은 토픽(장치 ack, update)용
+// 고정 버퍼 청크 조립도 여기서 맡는다(큰 토픽은 MqttRxQueue / HwSyncStream이 조립한다).
+
+enum MqttRoute : uint8_t {
+  MQTT_ROUTE_NONE = 0,
+  MQTT_ROUTE_ACADEMY_ACK,     // academies/{a}/ack/+
+  MQTT_ROUTE_DEVICE_ACK,      // .../devices/{d}/ack
+  MQTT_ROUTE_STUDENTS_TODAY,  // .../devices/{d}/students_today
+  MQTT_ROUTE_HOMEWORKS,       // .../devices/{d}/homeworks
+  MQTT_ROUTE_STUDENT_INFO,    // .../devices/{d}/student_info
+  MQTT_ROUTE_UNBOUND,         // .../devices/{d}/unbound
+  MQTT_ROUTE_UPDATE,          // .../devices/{d}/update
+  MQTT_ROUTE_COUNT
+};
+
+// 카운터는 생산자(MQTT 콜백)만 쓴다. diag에서 읽는 쪽은 경합을 허용한다.
+struct MqttRouteStats {
+  uint32_t messages;  // 마지막 청크까지 받은 메시지 수
+  uint32_t chunks;    // 콜백 호출 수
+  uint32_t bytes;     // 누적 페이로드 바이트
+  uint32_t dropped;   // 조립 버퍼를 넘겨 버린 메시지 수(조립 라우트만)
+};
+
+class MqttTopicRouter {
+ public:
+  static const size_t kMaxPrefixBytes = 112;
+  static const size_t kAssembleBytes = 1024;
+
+  MqttTopicRouter();
+
+  // onMqttConnect에서 구독 직전에 호출한다. 이후 match()는 같은 태스크(async-tcp)에서만 부른다.
+  void configure(const char* academy_id, const char* device_id);
+  bool configured() const { return dev_len_ > 0; }
+
+  // 라우트의 구독 토픽 문자열을 out에 쓴다(ACADEMY_ACK는 와일드카드 +까지). 잘리면 false.
+  bool topic(MqttRoute route, char* out, size_t cap) const;
+
+  // 할당 없이 토픽을 라우트로 바꾼다. 모르는 토픽은 MQTT_ROUTE_NONE.
+  MqttRoute match(const char* topic);
+
+  // 청크 하나를 카운터에 반영한다. 메시지의 마지막 청크면 true.
+  bool on_chunk(MqttRoute route, size_t len, size_t index, size_t total);
+
+  // 조립 라우트(DEVICE_ACK, UPDATE) 전용. 마지막 청크까지 모이면 널 종료된 본문을,
+  // 아직이거나 버퍼를 넘겼으면 nullptr를 준다. 반환 포인터는 같은 라우트의 다음 청크 전까지 유효하다.
+  const char* assemble(MqttRoute route, const char* payload, size_t len, size_t index, size_t total);
+
+  const MqttRouteStats& stats(MqttRoute route) const { return stats_[route < MQTT_ROUTE_COUNT ? route : 0]; }
+  uint32_t unmatched() const { return stats_[MQTT_ROUTE_NONE].messages; }
+  static const char* name(MqttRoute route);
+
+ private:
+  static const uint8_t kBuckets = 8;  // 장치 접미사 6개를 담는 2의 거듭제곱
+  static const uint8_t kAssemblers = 2;
+
+  struct Bucket {
+    uint32_t hash;
+    uint8_t len;
+    uint8_t route;  // 0이면 빈 칸
+  };
+  struct Assembly {
+    char buf[kAssembleBytes];
+    size_t expected;
+    size_t received;
+    bool dropping;
+  };
+
+  static uint32_t hash_suffix(const char* s, size_t* len_out);
+  static const char* suffix_of(MqttRoute route);
+  static int8_t assembler_of(MqttRoute route);
+
+  char dev_prefix_[kMaxPrefixBytes];
+  uint8_t dev_len_;
+  char ack_prefix_[kMaxPrefixBytes];
+  uint8_t ack_len_;
+  Bucket table_[kBuckets];
+  Assembly asm_[kAssemblers];
+  MqttRouteStats stats_[MQTT_ROUTE_COUNT];
+};
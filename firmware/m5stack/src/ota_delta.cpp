@@ -0,0 +1,217 @@
+#include "ota_delta.h"
+
+#include <string.h>
+
+static const uint8_t kMagic[4] = {'Y', 'D', 'P', '1'};
+
+enum : uint8_t { OP_END = 0x00, OP_DIFF = 0x01, OP_INSERT = 0x02, OP_SEEK = 0x03 };
+
+static uint32_t rd32(const uint8_t* p) {
+  return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+bool OtaDelta::parse_header(const uint8_t* p, size_t len, Header* out) {
+  if (len < kHeaderBytes || memcmp(p, kMagic, 4) != 0) return false;
+  out->old_size = rd32(p + 4);
+  out->new_size = rd32(p + 8);
+  out->flags = rd32(p + 12);
+  memcpy(out->old_sha256, p + 16, 32);
+  memcpy(out->new_sha256, p + 48, 32);
+  return out->flags == 0 && out->old_size > 0 && out->new_size > 0;
+}
+
+void OtaDelta::begin(const Header& h, uint8_t* work, size_t work_len, ReadOldFn read_old, WriteFn write, void* ctx) {
+  h_ = h;
+  read_old_ = read_old;
+  write_ = write;
+  ctx_ = ctx;
+  old_cap_ = work_len / 2;
+  old_buf_ = work;
+  out_buf_ = work + old_cap_;
+  out_cap_ = work_len - old_cap_;
+  old_base_ = 0;
+  old_len_ = 0;
+  out_fill_ = 0;
+  out_pos_ = 0;
+  old_pos_ = 0;
+  remain_ = 0;
+  run_ = 0;
+  varint_ = 0;
+  shift_ = 0;
+  op_ = OP_END;
+  error_ = nullptr;
+  state_ = ST_OP;
+  if (!work || old_cap_ < 256) fail("work buffer");
+}
+
+bool OtaDelta::fail(const char* why) {
+  if (state_ != ST_ERROR) error_ = why;
+  state_ = ST_ERROR;
+  return false;
+}
+
+void OtaDelta::expect_varint(State s) {
+  varint_ = 0;
+  shift_ = 0;
+  state_ = s;
+}
+
+bool OtaDelta::flush() {
+  if (out_fill_ == 0) return true;
+  if (!write_(ctx_, out_buf_, out_fill_)) return fail("write");
+  out_pos_ += (uint32_t)out_fill_;
+  out_fill_ = 0;
+  return true;
+}
+
+bool OtaDelta::emit(const uint8_t* p, size_t len) {
+  while (len > 0) {
+    size_t n = out_cap_ - out_fill_;
+    if (n > len) n = len;
+    memcpy(out_buf_ + out_fill_, p, n);
+    out_fill_ += n;
+    p += n;
+    len -= n;
+    if (out_fill_ == out_cap_ && !flush()) return false;
+  }
+  return true;
+}
+
+// old[old_pos_..+len) (+ delta)를 출력한다. delta가 nullptr이면 그대로 복사.
+bool OtaDelta::emit_old(uint32_t len, const uint8_t* delta) {
+  while (len > 0) {
+    if (old_pos_ < old_base_ || old_pos_ >= old_base_ + old_len_) {
+      size_t n = h_.old_size - old_pos_;
+      if (n > old_cap_) n = old_cap_;
+      if (!read_old_(ctx_, old_pos_, old_buf_, n)) return fail("read old");
+      old_base_ = old_pos_;
+      old_len_ = n;
+    }
+    const uint8_t* src = old_buf_ + (old_pos_ - old_base_);
+    size_t n = old_base_ + old_len_ - old_pos_;
+    if (n > len) n = len;
+    if (n > out_cap_ - out_fill_) n = out_cap_ - out_fill_;
+    uint8_t* dst = out_buf_ + out_fill_;
+    if (delta) {
+      for (size_t i = 0; i < n; ++i) dst[i] = (uint8_t)(src[i] + delta[i]);
+      delta += n;
+    } else {
+      memcpy(dst, src, n);
+    }
+    out_fill_ += n;
+    old_pos_ += (uint32_t)n;
+    len -= (uint32_t)n;
+    if (out_fill_ == out_cap_ && !flush()) return false;
+  }
+  return true;
+}
+
+bool OtaDelta::on_len() {
+  const uint32_t v = varint_;
+  if (op_ == OP_SEEK) {
+    const int32_t d = (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+    const int64_t pos = (int64_t)old_pos_ + d;
+    if (pos < 0 || pos > (int64_t)h_.old_size) return fail("seek range");
+    old_pos_ = (uint32_t)pos;
+    state_ = ST_OP;
+    return true;
+  }
+  if ((uint64_t)out_bytes() + v > h_.new_size) return fail("output overrun");
+  remain_ = v;
+  if (op_ == OP_DIFF) {
+    if ((uint64_t)old_pos_ + v > h_.old_size) return fail("diff range");
+    if (v) {
+      expect_varint(ST_TOKEN);
+    } else {
+      state_ = ST_OP;
+    }
+  } else {
+    state_ = v ? ST_INSERT : ST_OP;
+  }
+  return true;
+}
+
+bool OtaDelta::on_token() {
+  const uint32_t k = varint_ >> 1;
+  if (k == 0 || k > remain_) return fail("bad token");
+  if (varint_ & 1) {
+    run_ = k;
+    state_ = ST_LIT;
+    return true;
+  }
+  if (!emit_old(k, nullptr)) return false;
+  remain_ -= k;
+  if (remain_) {
+    expect_varint(ST_TOKEN);
+  } else {
+    state_ = ST_OP;
+  }
+  return true;
+}
+
+bool OtaDelta::feed(const uint8_t* p, size_t len) {
+  while (len > 0) {
+    switch (state_) {
+      case ST_OP:
+        op_ = *p++;
+        len--;
+        if (op_ == OP_END) {
+          state_ = ST_DONE;
+        } else if (op_ == OP_DIFF || op_ == OP_INSERT || op_ == OP_SEEK) {
+          expect_varint(ST_LEN);
+        } else {
+          return fail("bad op");
+        }
+        break;
+      case ST_LEN:
+      case ST_TOKEN: {
+        const uint8_t b = *p++;
+        len--;
+        if (shift_ > 28) return fail("varint");
+        varint_ |= (uint32_t)(b & 0x7F) << shift_;
+        shift_ += 7;
+        if (b & 0x80) break;
+        if (!(state_ == ST_LEN ? on_len() : on_token())) return false;
+        break;
+      }
+      case ST_LIT: {
+        const uint32_t n = run_ < len ? run_ : (uint32_t)len;
+        if (!emit_old(n, p)) return false;
+        p += n;
+        len -= n;
+        run_ -= n;
+        remain_ -= n;
+        if (run_ == 0) {
+          if (remain_) {
+            expect_varint(ST_TOKEN);
+          } else {
+            state_ = ST_OP;
+          }
+        }
+        break;
+      }
+      case ST_INSERT: {
+        const uint32_t n = remain_ < len ? remain_ : (uint32_t)len;
+        if (!emit(p, n)) return false;
+        p += n;
+        len -= n;
+        remain_ -= n;
+        if (remain_ == 0) state_ = ST_OP;
+        break;
+      }
+      case ST_DONE:
+        return fail("trailing data");
+      case ST_ERROR:
+        return false;
+    }
+  }
+  return state_ != ST_ERROR;
+}
+
+bool OtaDelta::finish() {
+  if (state_ == ST_ERROR) return false;
+  if (state_ != ST_DONE) return fail("truncated");
+  if (!flush()) return false;
+  if (out_pos_ != h_.new_size) return fail("size mismatch");
+  return true;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 델타 OTA 패치(YDP1) 스트리밍 적용기.
+//
+// 릴리스마다 3MB 가까운 전체 이미지를 받는 대신, 지금 돌고 있는 app 파티션(old)을 기준으로 한
+// bsdiff 방식 패치를 받아 새 이미지를 비활성 슬롯에 바로 써 나간다. 패치는 tools/ota_delta.py가 만든다.
+//
+// 형식(리틀 엔디언):
+//   헤더 80바이트: "YDP1" | old_size u32 | new_size u32 | flags u32 | old_sha256[32] | new_sha256[32]
+//   본문: 명령의 나열
+//     0x01 DIFF   len:varint  이어서 토큰들. 출력 len바이트 = old[old_pos..] + delta (바이트별 mod 256)
+//                             토큰 t:varint — t&1: (t>>1)바이트 delta가 뒤따름 / 아니면 (t>>1)바이트 delta=0
+//                             old_pos += len
+//     0x02 INSERT len:varint  이어서 새 바이트 len개
+//     0x03 SEEK   d:zigzag varint  old_pos += d
+//     0x00 END
+// 코드가 조금 밀린 빌드끼리는 DIFF의 delta가 대부분 0이라 토큰 몇 개로 줄어든다.
+// 압축 라이브러리 없이 풀 수 있게 0 구간만 줄였다(펌웨어에서 기존 전체 이미지도 무압축으로 받는다).
+//
+// 입력은 아무 크기로 잘라 feed()에 넣어도 된다. Arduino 의존이 없어 호스트에서
+// tools/check_ota_delta.cpp로 같은 코드를 검증한다.
+
+class OtaDelta {
+ public:
+  static const size_t kHeaderBytes = 80;
+
+  struct Header {
+    uint32_t old_size;
+    uint32_t new_size;
+    uint32_t flags;
+    uint8_t old_sha256[32];
+    uint8_t new_sha256[32];
+  };
+
+  // old 이미지에서 읽기 / 새 이미지 쓰기. false면 적용을 멈춘다.
+  typedef bool (*ReadOldFn)(void* ctx, uint32_t offset, uint8_t* dst, size_t len);
+  typedef bool (*WriteFn)(void* ctx, const uint8_t* src, size_t len);
+
+  static bool parse_header(const uint8_t* p, size_t len, Header* out);
+
+  // work: old 읽기 캐시와 출력 버퍼로 반씩 나눠 쓴다(각 256바이트 이상).
+  void begin(const Header& h, uint8_t* work, size_t work_len, ReadOldFn read_old, WriteFn write, void* ctx);
+  // 헤더 뒤 본문 바이트를 넣는다. 형식 오류나 콜백 실패면 false(이후 계속 false).
+  bool feed(const uint8_t* p, size_t len);
+  // END까지 받았고 크기가 맞으면 남은 출력을 내보내고 true.
+  bool finish();
+
+  uint32_t out_bytes() const { return out_pos_ + (uint32_t)out_fill_; }
+  const char* error() const { return error_; }
+
+ private:
+  enum State : uint8_t { ST_OP, ST_LEN, ST_TOKEN, ST_LIT, ST_INSERT, ST_DONE, ST_ERROR };
+
+  bool fail(const char* why);
+  void expect_varint(State s);
+  bool on_len();
+  bool on_token();
+  bool emit_old(uint32_t len, const uint8_t* delta);
+  bool emit(const uint8_t* p, size_t len);
+  bool flush();
+
+  Header h_;
+  ReadOldFn read_old_;
+  WriteFn write_;
+  void* ctx_;
+  uint8_t* old_buf_;
+  size_t old_cap_;
+  uint32_t old_base_;  // old_buf_[0]의 old 오프셋
+  size_t old_len_;     // 캐시에 든 바이트
+  uint8_t* out_buf_;
+  size_t out_cap_;
+  size_t out_fill_;
+  uint32_t out_pos_;   // write로 내보낸 바이트
+  uint32_t old_pos_;
+  uint32_t remain_;    // 현재 DIFF/INSERT에서 남은 출력 바이트
+  uint32_t run_;       // 현재 delta 리터럴 토큰에서 남은 바이트
+  uint32_t varint_;
+  uint8_t shift_;
+  uint8_t op_;
+  State state_;
+  const char* error_;
+};
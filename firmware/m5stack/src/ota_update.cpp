@@ -1,191 +1,750 @@
 #include "ota_update.h"
 #include "version.h"
+#include "mqtt_rx_queue.h"
+#include "ota_delta.h"
 #include <HTTPClient.h>
 #include <Update.h>
 #include <ArduinoJson.h>
 #include <WiFi.h>
+#include <Preferences.h>
+#include <esp_heap_caps.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <mbedtls/sha256.h>
+#include <atomic>
 
-bool checkForUpdate(String& outLatestVersion, String& outDownloadUrl) {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("[OTA] WiFi not connected");
-    return false;
+#ifndef CFG_OTA_BUF_BYTES
+#define CFG_OTA_BUF_BYTES (16 * 1024)   // 읽기/쓰기 단위(PSRAM). Update가 4KB 섹터로 나눠 쓴다.
+#endif
+#ifndef CFG_OTA_TASK_STACK
+#define CFG_OTA_TASK_STACK 12288        // TLS 핸드셰이크 포함
+#endif
+#ifndef CFG_OTA_TASK_PRIO
+#define CFG_OTA_TASK_PRIO 1             // loop(1)과 같거나 낮게: UI가 밀리지 않게
+#endif
+#ifndef CFG_OTA_STALL_MS
+#define CFG_OTA_STALL_MS 15000          // 이만큼 한 바이트도 안 오면 끊긴 것으로 본다
+#endif
+#ifndef CFG_OTA_MAX_RETRIES
+#define CFG_OTA_MAX_RETRIES 6           // 진전 없는 연속 재시도 한도(진전이 있으면 0으로)
+#endif
+#ifndef CFG_OTA_WIFI_WAIT_MS
+#define CFG_OTA_WIFI_WAIT_MS 30000      // 재시도 전에 WiFi 복구를 기다리는 최대 시간
+#endif
+
+static const char* kUserAgent = "M5Stack-OTA";
+
+static SpscRing<OtaEvent, 16> s_events;  // ota 태스크 → loop
+static std::atomic<bool> s_running{false};
+
+static void post_event(uint8_t phase, int percent, uint32_t bytes, uint32_t total, uint32_t rate, const char* text) {
+  OtaEvent ev;
+  ev.phase = phase;
+  ev.percent = (int8_t)percent;
+  ev.bytes = bytes;
+  ev.total = total;
+  ev.rate_bps = rate;
+  strncpy(ev.text, text ? text : "", sizeof(ev.text) - 1);
+  ev.text[sizeof(ev.text) - 1] = '\0';
+  const bool terminal = phase == OTA_PHASE_UP_TO_DATE || phase == OTA_PHASE_DONE || phase == OTA_PHASE_FAILED;
+  // 진행률은 UI가 못 따라오면 버려도 되지만 종료 이벤트는 꼭 전달한다.
+  for (int i = 0; !s_events.push(ev); ++i) {
+    if (!terminal || i >= 50) return;
+    vTaskDelay(pdMS_TO_TICKS(100));
   }
+}
 
-  HTTPClient http;
-  String apiUrl = String("https://api.github.com/repos/") + GITHUB_OWNER + "/" + GITHUB_REPO + "/releases/latest";
-  
-  Serial.printf("[OTA] Checking: %s\n", apiUrl.c_str());
-  http.begin(apiUrl);
-  http.setUserAgent("M5Stack-OTA");
-  http.addHeader("Accept", "application/vnd.github.v3+json");
-  
-  int httpCode = http.GET();
-  if (httpCode != 200) {
-    Serial.printf("[OTA] HTTP error: %d\n", httpCode);
+static bool is_redirect(int code) {
+  return code == 301 || code == 302 || code == 303 || code == 307 || code == 308;
+}
+
+// GET을 보내고 리다이렉트를 직접 따라간다(최대 5번). Range/If-None-Match는 매 홉마다 다시 붙인다.
+// GitHub 다운로드 URL은 만료되는 서명 URL로 넘어가므로 재시도 때도 원래 URL에서 다시 시작한다.
+static int http_open(HTTPClient& http, const String& url, uint32_t range_from, const String* etag = nullptr) {
+  static const char* kCollect[] = {"Content-Range", "ETag"};
+  String cur = url;
+  int code = -1;
+  for (int hop = 0; hop <= 5; ++hop) {
+    http.begin(cur);
+    http.setUserAgent(kUserAgent);
+    http.setTimeout(CFG_OTA_STALL_MS);
+    http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+    http.collectHeaders(kCollect, 2);
+    if (range_from > 0) http.addHeader("Range", "bytes=" + String((unsigned long)range_from) + "-");
+    if (etag && etag->length()) http.addHeader("If-None-Match", *etag);
+    if (cur.startsWith("https://api.github.com/")) http.addHeader("Accept", "application/vnd.github.v3+json");
+    code = http.GET();
+    if (!is_redirect(code)) return code;
+    String next = http.getLocation();
+    Serial.printf("[OTA] Redirect(%d) -> %s\n", code, next.c_str());
     http.end();
-    return false;
+    if (next.length() == 0) return code;
+    cur = next;
   }
+  return code;
+}
 
-  String payload = http.getString();
+// 작은 텍스트 응답(.sha256 파일 등)을 받는다.
+static bool http_get_small(const String& url, String& out) {
+  HTTPClient http;
+  const int code = http_open(http, url, 0);
+  if (code == 200) out = http.getString();
   http.end();
+  return code == 200;
+}
 
-  DynamicJsonDocument doc(8192);
-  DeserializationError error = deserializeJson(doc, payload);
-  if (error) {
-    Serial.printf("[OTA] JSON parse error: %s\n", error.c_str());
-    return false;
+// "sha256:<hex>" 또는 sha256sum 출력("<hex>  name")에서 64자 hex만 뽑는다.
+static String parse_sha256(const String& s) {
+  String t = s;
+  t.trim();
+  if (t.startsWith("sha256:")) t = t.substring(7);
+  if (t.length() < 64) return String();
+  t = t.substring(0, 64);
+  t.toLowerCase();
+  for (size_t i = 0; i < t.length(); ++i) {
+    if (!isxdigit((unsigned char)t[i])) return String();
   }
+  return t;
+}
 
-  String tagName = doc["tag_name"].as<String>();
-  outLatestVersion = tagName;
-  
-  // 현재 버전과 비교 (v 제거 후 비교)
-  String currentVer = String(FIRMWARE_VERSION);
-  String latestVer = tagName;
-  if (latestVer.startsWith("v")) latestVer = latestVer.substring(1);
-  if (currentVer.startsWith("v")) currentVer = currentVer.substring(1);
-  
-  Serial.printf("[OTA] Current: %s, Latest: %s\n", currentVer.c_str(), latestVer.c_str());
-  
-  if (latestVer == currentVer) {
-    Serial.println("[OTA] Already up to date");
-    return false;
+int ota_version_cmp(const char* a, const char* b) {
+  if (*a == 'v' || *a == 'V') a++;
+  if (*b == 'v' || *b == 'V') b++;
+  while (*a || *b) {
+    char* ea;
+    char* eb;
+    const long x = strtol(a, &ea, 10);
+    const long y = strtol(b, &eb, 10);
+    if (x != y) return x > y ? 1 : -1;
+    a = *ea == '.' ? ea + 1 : ea + strlen(ea);
+    b = *eb == '.' ? eb + 1 : eb + strlen(eb);
   }
+  return 0;
+}
+
+// 업데이트 소스. MQTT update 토픽(async-tcp 태스크)에서 쓰고 ota 태스크에서 읽는다.
+static portMUX_TYPE s_source_mux = portMUX_INITIALIZER_UNLOCKED;
+static char s_mirror_url[160] = {0};
+// 이번 부팅에 게이트웨이가 소스를 알려 왔는지. 빈 값도 "미러 없음"이라는 답이다.
+static bool s_source_set = false;
+
+void ota_set_source(const char* manifest_url) {
+  portENTER_CRITICAL(&s_source_mux);
+  s_source_set = true;
+  strncpy(s_mirror_url, manifest_url ? manifest_url : "", sizeof(s_mirror_url) - 1);
+  s_mirror_url[sizeof(s_mirror_url) - 1] = '\0';
+  portEXIT_CRITICAL(&s_source_mux);
+}
+
+// 게이트웨이가 아직 아무 말도 안 했으면 false(저장한 미러를 쓴다).
+static bool mirror_url(String& out) {
+  char buf[sizeof(s_mirror_url)];
+  portENTER_CRITICAL(&s_source_mux);
+  const bool set = s_source_set;
+  memcpy(buf, s_mirror_url, sizeof(buf));
+  portEXIT_CRITICAL(&s_source_mux);
+  out = buf;
+  return set;
+}
+
+// 매니페스트 캐시(NVS "m5ota"): 소스 URL, ETag, 간결 매니페스트 JSON.
+//   {"v":"1.1.1.5","size":N,"sha256":"…","url":"…","deltas":{"1.1.1.4":"…"}}
+// 게이트웨이 미러는 이 형식을 그대로 주고, GitHub 응답은 받은 쪽에서 이 형식으로 줄여 저장한다.
+// 다음 확인 때 If-None-Match를 보내 바뀌지 않았으면 304(본문 없음)로 끝난다.
+struct ManifestCache {
+  String src;
+  String etag;
+  String body;
+};
+
+static void load_cache(ManifestCache& c, String& saved_mirror) {
+  Preferences prefs;
+  prefs.begin("m5ota", true);
+  c.src = prefs.getString("src", "");
+  c.etag = prefs.getString("etag", "");
+  c.body = prefs.getString("mf", "");
+  saved_mirror = prefs.getString("mirror", "");
+  prefs.end();
+}
 
-  // assets에서 m5stack_firmware.bin 찾기
+static void save_cache(const ManifestCache& c, const String& mirror) {
+  Preferences prefs;
+  prefs.begin("m5ota", false);
+  prefs.putString("src", c.src);
+  prefs.putString("etag", c.etag);
+  prefs.putString("mf", c.body);
+  if (mirror.length()) {
+    prefs.putString("mirror", mirror);
+  } else {
+    prefs.remove("mirror");
+  }
+  prefs.end();
+}
+
+// 상대 URL은 매니페스트 위치 기준으로 푼다.
+static String resolve_url(const String& base, const String& ref) {
+  if (ref.indexOf("://") > 0) return ref;
+  const int scheme = base.indexOf("://");
+  if (ref.startsWith("/")) {
+    const int path = base.indexOf('/', scheme + 3);
+    return (path > 0 ? base.substring(0, path) : base) + ref;
+  }
+  const int slash = base.lastIndexOf('/');
+  return (slash > scheme + 2 ? base.substring(0, slash + 1) : base + "/") + ref;
+}
+
+// GitHub releases/latest 응답 → 간결 매니페스트. 실패하면 빈 문자열.
+static String compact_github_release(const String& payload) {
+  // asset마다 uploader 객체가 붙어 응답이 크다. 필요한 필드만 남긴다.
+  StaticJsonDocument<256> filter;
+  filter["tag_name"] = true;
+  filter["assets"][0]["name"] = true;
+  filter["assets"][0]["browser_download_url"] = true;
+  filter["assets"][0]["digest"] = true;
+  filter["assets"][0]["size"] = true;
+  DynamicJsonDocument doc(8192);
+  DeserializationError error = deserializeJson(doc, payload, DeserializationOption::Filter(filter));
+  if (error) {
+    Serial.printf("[OTA] JSON parse error: %s\n", error.c_str());
+    return String();
+  }
+  // assets에서 m5stack_firmware.bin 찾기. 델타는 m5stack_firmware.from-<기준 버전>.ydp
   JsonArray assets = doc["assets"];
+  JsonObject bin;
   for (JsonObject asset : assets) {
-    String name = asset["name"].as<String>();
+    const String name = asset["name"].as<String>();
     if (name.indexOf("m5stack") >= 0 && name.endsWith(".bin")) {
-      outDownloadUrl = asset["browser_download_url"].as<String>();
-      Serial.printf("[OTA] Found update: %s → %s\n", name.c_str(), outDownloadUrl.c_str());
-      return true;
+      bin = asset;
+      break;
+    }
+  }
+  if (bin.isNull()) {
+    Serial.println("[OTA] No m5stack firmware found in release");
+    return String();
+  }
+  const String binName = bin["name"].as<String>();
+  String sha = parse_sha256(bin["digest"] | "");
+  DynamicJsonDocument out(2048);
+  out["v"] = doc["tag_name"].as<const char*>();
+  out["size"] = bin["size"] | 0;
+  out["url"] = bin["browser_download_url"].as<const char*>();
+  JsonObject deltas = out.createNestedObject("deltas");
+  for (JsonObject asset : assets) {
+    const String name = asset["name"].as<String>();
+    const int from = name.indexOf(".from-");
+    if (name.indexOf("m5stack") >= 0 && from >= 0 && name.endsWith(".ydp")) {
+      deltas[name.substring(from + 6, name.length() - 4)] = asset["browser_download_url"].as<const char*>();
+    } else if (sha.length() == 0 && name == binName + ".sha256") {
+      // digest가 없는 릴리스는 같은 이름의 .sha256 asset을 본다.
+      String body;
+      if (http_get_small(asset["browser_download_url"].as<String>(), body)) sha = parse_sha256(body);
     }
   }
+  out["sha256"] = sha;
+  String compact;
+  serializeJson(out, compact);
+  return compact;
+}
 
-  Serial.println("[OTA] No m5stack firmware found in release");
-  return false;
+// 소스 하나를 조건부 요청으로 확인한다. 반환: 매니페스트 본문(실패면 빈 문자열).
+static String fetch_manifest(const String& src, bool github, ManifestCache& cache, bool& changed) {
+  const bool have = cache.src == src && cache.body.length() > 0;
+  HTTPClient http;
+  const uint32_t t0 = millis();
+  const int code = http_open(http, src, 0, have ? &cache.etag : nullptr);
+  if (code == 304 && have) {
+    http.end();
+    Serial.printf("[OTA] manifest 304 %s (%lums)\n", github ? "github" : "mirror", (unsigned long)(millis() - t0));
+    return cache.body;
+  }
+  if (code != 200) {
+    Serial.printf("[OTA] manifest HTTP %d from %s\n", code, src.c_str());
+    http.end();
+    return String();
+  }
+  const String etag = http.header("ETag");
+  String body = http.getString();
+  http.end();
+  Serial.printf("[OTA] manifest 200 %s bytes=%u (%lums)\n", github ? "github" : "mirror", (unsigned)body.length(),
+                (unsigned long)(millis() - t0));
+  if (github) body = compact_github_release(body);
+  if (body.length() == 0) return body;
+  cache.src = src;
+  cache.etag = etag;
+  cache.body = body;
+  changed = true;
+  return body;
 }
 
-bool performOtaUpdate(const String& downloadUrl, OtaProgressCallback progressCallback) {
+OtaCheckResult checkForUpdate(OtaRelease& out) {
+  out = OtaRelease();
   if (WiFi.status() != WL_CONNECTED) {
     Serial.println("[OTA] WiFi not connected");
-    if (progressCallback) progressCallback(0, "WiFi disconnected");
+    return OTA_CHECK_FAILED;
+  }
+
+  ManifestCache cache;
+  String savedMirror;
+  load_cache(cache, savedMirror);
+  // 게이트웨이가 빈 소스를 보냈으면 저장한 미러도 버린다(옮겨졌거나 더 이상 광고하지 않는 미러에
+  // 매번 CFG_OTA_STALL_MS씩 묶이지 않게). 아직 소식이 없을 때만 저장한 미러를 쓴다.
+  String mirror;
+  if (!mirror_url(mirror)) mirror = savedMirror;
+  const String githubUrl = String("https://api.github.com/repos/") + GITHUB_OWNER + "/" + GITHUB_REPO + "/releases/latest";
+
+  // 게이트웨이 LAN 미러가 있으면 먼저, 닿지 않으면 GitHub.
+  bool changed = false;
+  String src = mirror;
+  String body;
+  if (mirror.length()) body = fetch_manifest(mirror, false, cache, changed);
+  if (body.length() == 0) {
+    src = githubUrl;
+    Serial.printf("[OTA] Checking: %s\n", githubUrl.c_str());
+    body = fetch_manifest(githubUrl, true, cache, changed);
+  }
+  if (changed || mirror != savedMirror) save_cache(cache, mirror);
+  if (body.length() == 0) return OTA_CHECK_FAILED;
+
+  DynamicJsonDocument doc(2048);
+  if (deserializeJson(doc, body)) {
+    Serial.println("[OTA] manifest parse error");
+    return OTA_CHECK_FAILED;
+  }
+  const char* currentVer = FIRMWARE_VERSION;
+  if (*currentVer == 'v') currentVer++;
+  out.version = doc["v"] | "";
+  if (out.version.startsWith("v")) out.version = out.version.substring(1);
+  out.url = resolve_url(src, doc["url"] | "");
+  out.sha256 = parse_sha256(doc["sha256"] | "");
+  out.size = doc["size"] | 0;
+  const char* delta = doc["deltas"][currentVer] | "";
+  if (*delta) out.delta_url = resolve_url(src, delta);
+
+  Serial.printf("[OTA] Current: %s, Latest: %s\n", currentVer, out.version.c_str());
+  if (out.version.length() == 0 || !doc["url"].is<const char*>()) return OTA_CHECK_FAILED;
+  if (ota_version_cmp(out.version.c_str(), currentVer) <= 0) {
+    Serial.println("[OTA] Already up to date");
+    return OTA_CHECK_CURRENT;
+  }
+  Serial.printf("[OTA] Found update: %s sha256=%s delta=%s\n", out.url.c_str(),
+                out.sha256.length() ? out.sha256.c_str() : "-", out.delta_url.length() ? "yes" : "no");
+  return OTA_CHECK_AVAILABLE;
+}
+
+static bool wait_wifi(uint32_t max_ms) {
+  const uint32_t t0 = millis();
+  while (WiFi.status() != WL_CONNECTED) {
+    if (millis() - t0 >= max_ms) return false;
+    vTaskDelay(pdMS_TO_TICKS(250));
+  }
+  return true;
+}
+
+struct OtaDownload {
+  uint8_t* buf;
+  size_t cap;
+  uint32_t total;
+  uint32_t written;   // Update에 넘긴(= 파티션에 이어 쓸 위치) 바이트
+  int last_percent;
+  uint32_t rate_t0;
+  uint32_t rate_b0;
+  uint32_t rate_bps;
+  const char* version;
+  mbedtls_sha256_context sha;
+};
+
+// 새 이미지 바이트를 Update(비활성 app 슬롯)에 이어 쓰고 해시/진행률을 갱신한다.
+static bool put_image(OtaDownload& d, const uint8_t* p, size_t len) {
+  if (Update.write((uint8_t*)p, len) != len) {
+    Serial.printf("[OTA] Update.write failed: %s\n", Update.errorString());
     return false;
   }
+  mbedtls_sha256_update(&d.sha, p, len);
+  d.written += len;
 
+  const uint32_t now = millis();
+  if (now - d.rate_t0 >= 1000) {
+    d.rate_bps = (uint32_t)((uint64_t)(d.written - d.rate_b0) * 1000 / (now - d.rate_t0));
+    d.rate_t0 = now;
+    d.rate_b0 = d.written;
+  }
+  const int percent = (int)((uint64_t)d.written * 100 / d.total);
+  if (percent != d.last_percent) {
+    d.last_percent = percent;
+    if (percent % 10 == 0) Serial.printf("[OTA] Progress: %d%% %lu B/s\n", percent, (unsigned long)d.rate_bps);
+    post_event(OTA_PHASE_DOWNLOADING, percent, d.written, d.total, d.rate_bps, d.version);
+  }
+  return true;
+}
+
+static bool flush_buf(OtaDownload& d, size_t& fill) {
+  if (fill == 0) return true;
+  if (!put_image(d, d.buf, fill)) return false;
+  fill = 0;
+  return true;
+}
+
+// 연결 한 번 분량을 받는다. 반환: 1 = 완료, 0 = 끊김(재시도 가능), -1 = 치명적 실패.
+static int download_pass(OtaDownload& d, const String& url, String& err) {
   HTTPClient http;
-  http.begin(downloadUrl);
-  http.setUserAgent("M5Stack-OTA");
-  http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  
-  Serial.printf("[OTA] Downloading: %s\n", downloadUrl.c_str());
-  if (progressCallback) progressCallback(0, "Connecting...");
-  
-  int httpCode = http.GET();
-  Serial.printf("[OTA] Initial response: %d\n", httpCode);
-  
-  // 수동 리다이렉트 처리 (최대 5번)
-  int redirectCount = 0;
-  while ((httpCode == 301 || httpCode == 302 || httpCode == 303 || httpCode == 307 || httpCode == 308) && redirectCount < 5) {
-    String newUrl = http.getLocation();
-    Serial.printf("[OTA] Redirect(%d) Location header: %s\n", httpCode, newUrl.c_str());
-    
-    if (newUrl.length() == 0) {
-      Serial.println("[OTA] Empty redirect location");
-      break;
+  const int code = http_open(http, url, d.written);
+  Serial.printf("[OTA] GET from=%lu -> %d\n", (unsigned long)d.written, code);
+  if (code <= 0 || code >= 500) {
+    err = "HTTP " + String(code);
+    http.end();
+    return 0;
+  }
+  const int len = http.getSize();
+  uint32_t skip = 0;
+  if (d.total == 0) {
+    // 첫 연결: 전체 크기를 알아야 Update.begin을 할 수 있다.
+    if (code != 200 || len <= 0) {
+      err = code != 200 ? "HTTP " + String(code) : String("no length");
+      http.end();
+      return -1;
+    }
+    if (!Update.begin((size_t)len)) {
+      Serial.printf("[OTA] Not enough space: %d\n", len);
+      err = "no space";
+      http.end();
+      return -1;
     }
-    
+    d.total = (uint32_t)len;
+    Serial.printf("[OTA] Content-Length: %d bytes\n", len);
+  } else if (code == 206) {
+    // Content-Range: bytes <from>-<to>/<total>
+    const String cr = http.header("Content-Range");
+    const int sp = cr.indexOf(' '), dash = cr.indexOf('-'), slash = cr.indexOf('/');
+    const uint32_t from = sp >= 0 && dash > sp ? (uint32_t)cr.substring(sp + 1, dash).toInt() : d.written;
+    const uint32_t total = slash >= 0 ? (uint32_t)cr.substring(slash + 1).toInt() : d.written + (uint32_t)len;
+    if (from != d.written || total != d.total) {
+      Serial.printf("[OTA] Content-Range mismatch: %s (have %lu/%lu)\n", cr.c_str(), (unsigned long)d.written, (unsigned long)d.total);
+      err = "range mismatch";
+      http.end();
+      return -1;
+    }
+    Serial.printf("[OTA] Resumed at %lu\n", (unsigned long)d.written);
+  } else if (code == 200 && (uint32_t)len == d.total) {
+    // Range를 무시하는 서버: 이미 받은 앞부분은 읽어서 버린다.
+    skip = d.written;
+    Serial.printf("[OTA] Server ignored Range, skipping %lu bytes\n", (unsigned long)skip);
+  } else {
+    err = "HTTP " + String(code);
     http.end();
-    delay(100);
-    
-    Serial.printf("[OTA] Following redirect to: %s\n", newUrl.c_str());
-    http.begin(newUrl);
-    http.setUserAgent("M5Stack-OTA");
-    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-    httpCode = http.GET();
-    Serial.printf("[OTA] Redirected response: %d\n", httpCode);
-    redirectCount++;
-  }
-  
-  if (httpCode != 200) {
-    Serial.printf("[OTA] Download error: %d\n", httpCode);
-    if (progressCallback) progressCallback(0, "Download failed");
+    return -1;
+  }
+
+  WiFiClient* stream = http.getStreamPtr();
+  size_t fill = 0;
+  uint32_t last_rx = millis();
+  int result = 1;
+  while (d.written + fill < d.total) {
+    const size_t avail = stream->available();
+    if (avail == 0) {
+      if (!http.connected() || millis() - last_rx >= CFG_OTA_STALL_MS) {
+        err = http.connected() ? "stalled" : "disconnected";
+        result = 0;
+        break;
+      }
+      vTaskDelay(pdMS_TO_TICKS(2));
+      continue;
+    }
+    size_t want = skip ? (skip < d.cap ? skip : d.cap) : d.cap - fill;
+    if (want > avail) want = avail;
+    if (!skip && want > d.total - d.written - fill) want = d.total - d.written - fill;
+    const int n = stream->read(d.buf + (skip ? 0 : fill), want);
+    if (n <= 0) continue;
+    last_rx = millis();
+    if (skip) {
+      skip -= (uint32_t)n;
+      continue;
+    }
+    fill += (size_t)n;
+    if (fill == d.cap && !flush_buf(d, fill)) {
+      err = "flash write";
+      http.end();
+      return -1;
+    }
+  }
+  // 끊겨도 받은 데까지는 써 두고 그 위치부터 이어 받는다.
+  if (!flush_buf(d, fill)) {
+    err = "flash write";
+    result = -1;
+  }
+  http.end();
+  return result;
+}
+
+static void hex_digest(const uint8_t* digest, char* hex) {
+  for (int i = 0; i < 32; ++i) snprintf(hex + i * 2, 3, "%02x", digest[i]);
+}
+
+static void reset_download(OtaDownload& d) {
+  d.total = 0;
+  d.written = 0;
+  d.last_percent = -1;
+  d.rate_t0 = millis();
+  d.rate_b0 = 0;
+  d.rate_bps = 0;
+  mbedtls_sha256_free(&d.sha);
+  mbedtls_sha256_init(&d.sha);
+  mbedtls_sha256_starts(&d.sha, 0);
+}
+
+static bool partition_sha256(const esp_partition_t* part, uint32_t len, uint8_t* buf, size_t cap, uint8_t* out) {
+  mbedtls_sha256_context c;
+  mbedtls_sha256_init(&c);
+  mbedtls_sha256_starts(&c, 0);
+  bool ok = true;
+  for (uint32_t off = 0; ok && off < len;) {
+    const size_t n = len - off < cap ? len - off : cap;
+    ok = esp_partition_read(part, off, buf, n) == ESP_OK;
+    if (ok) mbedtls_sha256_update(&c, buf, n);
+    off += n;
+  }
+  mbedtls_sha256_finish(&c, out);
+  mbedtls_sha256_free(&c);
+  return ok;
+}
+
+struct DeltaCtx {
+  OtaDownload* d;
+  const esp_partition_t* base;
+};
+
+static bool delta_read_old(void* ctx, uint32_t off, uint8_t* dst, size_t len) {
+  return esp_partition_read(((DeltaCtx*)ctx)->base, off, dst, len) == ESP_OK;
+}
+
+static bool delta_write(void* ctx, const uint8_t* src, size_t len) {
+  return put_image(*((DeltaCtx*)ctx)->d, src, len);
+}
+
+// 지금 돌고 있는 파티션을 기준으로 델타 패치를 받아 새 이미지를 비활성 슬롯에 쓴다.
+// true: 다 썼다(해시 대조는 호출 측). false: 전체 이미지로 넘어간다(Update는 정리된 상태).
+// 패치는 보통 수십 KB라 끊기면 Range 재개 대신 전체 이미지 경로가 이어 받는다.
+static bool delta_download(OtaDownload& d, const String& url, String& expectedSha) {
+  HTTPClient http;
+  const int code = http_open(http, url, 0);
+  const int len = http.getSize();
+  if (code != 200 || len <= (int)OtaDelta::kHeaderBytes) {
+    Serial.printf("[OTA] delta GET -> %d len=%d, full image\n", code, len);
     http.end();
     return false;
   }
-
-  int contentLength = http.getSize();
-  if (contentLength <= 0) {
-    Serial.println("[OTA] Invalid content length");
-    if (progressCallback) progressCallback(0, "Invalid file size");
+  WiFiClient* stream = http.getStreamPtr();
+  uint8_t raw[OtaDelta::kHeaderBytes];
+  OtaDelta::Header h;
+  if (stream->readBytes(raw, sizeof(raw)) != sizeof(raw) || !OtaDelta::parse_header(raw, sizeof(raw), &h)) {
+    Serial.println("[OTA] delta header invalid, full image");
     http.end();
     return false;
   }
-
-  Serial.printf("[OTA] Content-Length: %d bytes\n", contentLength);
-  
-  if (!Update.begin(contentLength)) {
-    Serial.printf("[OTA] Not enough space: %d\n", contentLength);
-    if (progressCallback) progressCallback(0, "Not enough space");
+  char target[65];
+  hex_digest(h.new_sha256, target);
+  if (expectedSha.length() && expectedSha != target) {
+    Serial.printf("[OTA] delta target %s is not the release image, full image\n", target);
+    http.end();
+    return false;
+  }
+  // 기준 이미지 확인: 로컬 빌드 등 릴리스와 다른 바이너리면 패치가 맞지 않는다.
+  const esp_partition_t* base = esp_ota_get_running_partition();
+  uint8_t have[32];
+  const uint32_t t0 = millis();
+  if (!base || h.old_size > base->size || !partition_sha256(base, h.old_size, d.buf, d.cap, have) ||
+      memcmp(have, h.old_sha256, sizeof(have)) != 0) {
+    Serial.println("[OTA] delta base mismatch, full image");
     http.end();
     return false;
   }
+  Serial.printf("[OTA] delta base ok (%lu bytes hashed in %lums), patch %d bytes -> image %lu bytes\n",
+                (unsigned long)h.old_size, (unsigned long)(millis() - t0), len, (unsigned long)h.new_size);
+  if (!Update.begin(h.new_size)) {
+    Serial.printf("[OTA] Not enough space: %lu\n", (unsigned long)h.new_size);
+    http.end();
+    return false;
+  }
+  d.total = h.new_size;
 
-  WiFiClient* stream = http.getStreamPtr();
-  uint8_t buff[512];
-  int written = 0;
-  int lastPercent = -1;
-
-  if (progressCallback) progressCallback(0, "Downloading...");
-
-  while (http.connected() && (written < contentLength)) {
-    size_t available = stream->available();
-    if (available) {
-      int c = stream->readBytes(buff, min(available, sizeof(buff)));
-      if (c > 0) {
-        Update.write(buff, c);
-        written += c;
-        
-        int percent = (written * 100) / contentLength;
-        if (percent != lastPercent && percent % 5 == 0) {
-          Serial.printf("[OTA] Progress: %d%%\n", percent);
-          if (progressCallback) progressCallback(percent, "Downloading...");
-          lastPercent = percent;
-        }
-      }
+  // d.buf 앞 절반: 수신 / 뒤 절반: 적용기 작업 영역(old 캐시 + 출력)
+  DeltaCtx ctx{&d, base};
+  OtaDelta delta;
+  const size_t in_cap = d.cap / 2;
+  delta.begin(h, d.buf + in_cap, d.cap - in_cap, delta_read_old, delta_write, &ctx);
+  uint32_t left = (uint32_t)len - OtaDelta::kHeaderBytes;
+  uint32_t last_rx = millis();
+  const char* why = nullptr;
+  while (left > 0 && !why) {
+    size_t n = stream->available();
+    if (n == 0) {
+      if (!http.connected() || millis() - last_rx >= CFG_OTA_STALL_MS) why = "stream interrupted";
+      else vTaskDelay(pdMS_TO_TICKS(2));
+      continue;
     }
-    delay(1);
+    if (n > in_cap) n = in_cap;
+    if (n > left) n = left;
+    const int r = stream->read(d.buf, n);
+    if (r <= 0) continue;
+    last_rx = millis();
+    left -= (uint32_t)r;
+    if (!delta.feed(d.buf, (size_t)r)) why = delta.error();
   }
-
   http.end();
-
-  if (written != contentLength) {
-    Serial.printf("[OTA] Write mismatch: %d != %d\n", written, contentLength);
-    if (progressCallback) progressCallback(0, "Download incomplete");
+  if (!why && !delta.finish()) why = delta.error();
+  if (why) {
+    Serial.printf("[OTA] delta failed at %lu/%lu (%s), full image\n", (unsigned long)delta.out_bytes(),
+                  (unsigned long)h.new_size, why);
     Update.abort();
     return false;
   }
+  if (expectedSha.length() == 0) expectedSha = target;
+  return true;
+}
+
+static void ota_run() {
+  post_event(OTA_PHASE_CHECKING, 0, 0, 0, 0, nullptr);
+
+  OtaRelease rel;
+#ifdef CFG_OTA_TEST_URL
+  // 로컬 테스트 서버(tools/ota_test_server.py): 버전 확인 없이 받는다. 패치는 URL.ydp(--patch).
+  rel.version = "test";
+  rel.url = CFG_OTA_TEST_URL;
+  rel.delta_url = rel.url + ".ydp";
+  String sumBody;
+  if (wait_wifi(CFG_OTA_WIFI_WAIT_MS) && http_get_small(rel.url + ".sha256", sumBody)) rel.sha256 = parse_sha256(sumBody);
+#else
+  const OtaCheckResult check = checkForUpdate(rel);
+  if (check == OTA_CHECK_CURRENT) {
+    post_event(OTA_PHASE_UP_TO_DATE, 100, 0, 0, 0, FIRMWARE_VERSION);
+    return;
+  }
+  if (check != OTA_CHECK_AVAILABLE) {
+    post_event(OTA_PHASE_FAILED, 0, 0, 0, 0, WiFi.status() != WL_CONNECTED ? "WiFi disconnected" : "check failed");
+    return;
+  }
+#endif
+  const String& downloadUrl = rel.url;
+  const String& deltaUrl = rel.delta_url;
+  String& expectedSha = rel.sha256;
+
+  OtaDownload d;
+  memset(&d, 0, sizeof(d));
+  d.cap = CFG_OTA_BUF_BYTES;
+  d.buf = (uint8_t*)heap_caps_malloc(d.cap, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!d.buf) {
+    d.cap = 4096;
+    d.buf = (uint8_t*)heap_caps_malloc(d.cap, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  if (!d.buf) {
+    post_event(OTA_PHASE_FAILED, 0, 0, 0, 0, "out of memory");
+    return;
+  }
+  d.version = rel.version.c_str();
+  mbedtls_sha256_init(&d.sha);
+  reset_download(d);
+  post_event(OTA_PHASE_DOWNLOADING, 0, 0, 0, 0, d.version);
+
+  const uint32_t t0 = millis();
+  String err;
+  int result = 0;
+  uint8_t retries = 0;
+  if (deltaUrl.length() && wait_wifi(CFG_OTA_WIFI_WAIT_MS)) {
+    Serial.printf("[OTA] Delta: %s\n", deltaUrl.c_str());
+    if (delta_download(d, deltaUrl, expectedSha)) {
+      result = 1;
+    } else {
+      reset_download(d);
+    }
+  }
+  if (result == 0) Serial.printf("[OTA] Downloading: %s buf=%u\n", downloadUrl.c_str(), (unsigned)d.cap);
+  while (result == 0) {
+    const uint32_t before = d.written;
+    result = download_pass(d, downloadUrl, err);
+    if (result != 0) break;
+    retries = d.written > before ? 0 : retries + 1;
+    if (retries > CFG_OTA_MAX_RETRIES) {
+      err = "retry limit (" + err + ")";
+      result = -1;
+      break;
+    }
+    const uint32_t backoff_ms = 2000u << (retries > 3 ? 3 : retries);
+    Serial.printf("[OTA] Interrupted at %lu/%lu (%s), retry %u in %lums\n",
+                  (unsigned long)d.written, (unsigned long)d.total, err.c_str(), retries, (unsigned long)backoff_ms);
+    post_event(OTA_PHASE_RETRYING, d.last_percent < 0 ? 0 : d.last_percent, d.written, d.total, 0, err.c_str());
+    vTaskDelay(pdMS_TO_TICKS(backoff_ms));
+    if (!wait_wifi(CFG_OTA_WIFI_WAIT_MS)) err = "WiFi disconnected";
+  }
+
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&d.sha, digest);
+  mbedtls_sha256_free(&d.sha);
+  heap_caps_free(d.buf);
+
+  if (result < 0) {
+    Serial.printf("[OTA] Failed: %s\n", err.c_str());
+    if (d.total) Update.abort();
+    post_event(OTA_PHASE_FAILED, 0, d.written, d.total, 0, err.c_str());
+    return;
+  }
+
+  const uint32_t secs = (millis() - t0) / 1000;
+  Serial.printf("[OTA] Downloaded %lu bytes in %lus\n", (unsigned long)d.written, (unsigned long)secs);
+  post_event(OTA_PHASE_VERIFYING, 100, d.written, d.total, 0, nullptr);
+
+  char hex[65];
+  hex_digest(digest, hex);
+  if (expectedSha.length() == 0) {
+    Serial.printf("[OTA] No published sha256, image sha256=%s\n", hex);
+  } else if (expectedSha != hex) {
+    Serial.printf("[OTA] sha256 mismatch: got %s want %s\n", hex, expectedSha.c_str());
+    Update.abort();
+    post_event(OTA_PHASE_FAILED, 0, d.written, d.total, 0, "sha256 mismatch");
+    return;
+  } else {
+    Serial.println("[OTA] sha256 OK");
+  }
 
-  if (progressCallback) progressCallback(100, "Verifying...");
-  
   if (!Update.end()) {
     Serial.printf("[OTA] Update.end() failed: %s\n", Update.errorString());
-    if (progressCallback) progressCallback(0, "Verification failed");
-    return false;
+    post_event(OTA_PHASE_FAILED, 0, d.written, d.total, 0, Update.errorString());
+    return;
   }
-
   if (!Update.isFinished()) {
     Serial.println("[OTA] Update not finished");
-    if (progressCallback) progressCallback(0, "Update failed");
-    return false;
+    post_event(OTA_PHASE_FAILED, 0, d.written, d.total, 0, "not finished");
+    return;
   }
 
   Serial.println("[OTA] Update successful! Rebooting...");
-  if (progressCallback) progressCallback(100, "Success! Rebooting...");
-  
-  delay(1000);
+  post_event(OTA_PHASE_DONE, 100, d.written, d.total, 0, nullptr);
+  vTaskDelay(pdMS_TO_TICKS(1500));  // UI가 완료 문구를 그릴 시간
   ESP.restart();
+}
+
+static void ota_task(void*) {
+  ota_run();  // String 등 지역 객체는 여기서 모두 정리된다
+  s_running.store(false);
+  vTaskDelete(NULL);
+}
+
+bool ota_start_update() {
+  bool expected = false;
+  if (!s_running.compare_exchange_strong(expected, true)) return false;
+  OtaEvent stale;
+  while (s_events.pop(stale)) {
+  }
+  // 코어 0: WiFi/lwIP와 같은 코어에서 받고, 코어 1의 loop()/LVGL은 계속 돈다.
+  if (xTaskCreatePinnedToCore(ota_task, "ota", CFG_OTA_TASK_STACK, nullptr, CFG_OTA_TASK_PRIO, nullptr, 0) != pdPASS) {
+    s_running.store(false);
+    return false;
+  }
   return true;
 }
 
+bool ota_poll_event(OtaEvent* out) {
+  return s_events.pop(*out);
+}
+
+bool ota_in_progress() {
+  return s_running.load();
+}
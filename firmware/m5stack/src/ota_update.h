@@ -3,18 +3,65 @@
 
 #include <Arduino.h>
 
-// OTA 업데이트 상태 콜백
-typedef void (*OtaProgressCallback)(int percent, const char* status);
+// OTA 업데이트는 전용 FreeRTOS 태스크("ota", 코어 0)에서 돈다.
+// 예전에는 UI 스레드에서 워치독을 끈 채 512바이트씩 읽고, 진행률 콜백이 lv_timer_handler()를
+// 재진입 호출해 팝업을 살렸다. WiFi가 잠깐 끊기면 받은 것을 모두 버렸다.
+//  - 다운로드는 PSRAM의 큰 버퍼(CFG_OTA_BUF_BYTES)로 읽어 Update.write에 넘긴다.
+//  - 연결이 끊기면 이미 쓴 바이트 위치부터 HTTP Range로 이어 받는다(같은 app 파티션 오프셋에 이어 씀).
+//  - 릴리스가 SHA-256(asset digest 또는 <파일>.sha256)을 주면 Update.end() 전에 대조한다.
+//  - 진행 상황은 큐로 UI에 넘기고, UI는 lv_timer에서 ota_poll_event()로 꺼내 그린다.
+//  - 업데이트 확인은 간결 매니페스트(버전, 크기, sha256, url, deltas)로 한다. 게이트웨이가 MQTT update 토픽으로
+//    LAN 미러 주소를 알려 주면 미러를, 아니면 GitHub Releases를 본다. ETag를 NVS에 두고 If-None-Match로
+//    물어 바뀐 게 없으면 304로 끝난다. 이미지도 미러에서 받으므로 한 교실의 기기들이 업링크를 한 번만 쓴다.
+//  - 릴리스에 지금 버전 기준 델타 패치(m5stack_firmware.from-<버전>.ydp, ota_delta.h)가 있으면 먼저 그것을
+//    돌고 있는 파티션에 적용해 비활성 슬롯에 쓴다. 기준 해시가 다르거나 실패하면 전체 이미지로 받는다.
 
-// GitHub Releases에서 최신 버전 확인
-// 반환: 새 버전이 있으면 true
-bool checkForUpdate(String& outLatestVersion, String& outDownloadUrl);
+enum OtaPhase : uint8_t {
+  OTA_PHASE_CHECKING = 0,
+  OTA_PHASE_UP_TO_DATE,   // 종료
+  OTA_PHASE_DOWNLOADING,
+  OTA_PHASE_RETRYING,     // 끊김 → Range로 재개 대기
+  OTA_PHASE_VERIFYING,
+  OTA_PHASE_DONE,         // 종료(곧 재부팅)
+  OTA_PHASE_FAILED,       // 종료
+};
 
-// OTA 업데이트 수행
-// downloadUrl: firmware.bin 직접 다운로드 URL
-// progressCallback: 진행률 콜백 (0-100%, 상태 메시지)
-// 반환: 성공 시 true (자동 재부팅)
-bool performOtaUpdate(const String& downloadUrl, OtaProgressCallback progressCallback = nullptr);
+struct OtaEvent {
+  uint8_t phase;        // OtaPhase
+  int8_t percent;       // 0-100
+  uint32_t bytes;       // 받은 바이트
+  uint32_t total;
+  uint32_t rate_bps;    // 최근 구간 속도
+  char text[64];        // 사용자 표시용(영문/버전)
+};
 
-#endif // OTA_UPDATE_H
+struct OtaRelease {
+  String version;    // "1.1.1.5"(v 없음)
+  String url;        // 전체 이미지
+  String sha256;     // 64자 hex, 없으면 빈 문자열
+  String delta_url;  // 현재 버전 기준 델타 패치, 없으면 빈 문자열
+  uint32_t size = 0;
+};
+
+enum OtaCheckResult : uint8_t {
+  OTA_CHECK_FAILED = 0,
+  OTA_CHECK_CURRENT,    // 최신(또는 더 새 버전)
+  OTA_CHECK_AVAILABLE,
+};
+
+// 최신 버전 확인(미러 → GitHub). 블로킹: ota 태스크에서 부른다.
+OtaCheckResult checkForUpdate(OtaRelease& out);
+// MQTT update 토픽에서 받은 미러 매니페스트 URL(어느 태스크에서나). 다음 확인 때 NVS에도 남는다.
+// 빈 문자열이면 저장해 둔 미러를 지운다.
+void ota_set_source(const char* manifest_url);
+// 점으로 나눈 숫자 버전 비교("1.1.1.10" > "1.1.1.9"). 앞의 v는 무시한다.
+int ota_version_cmp(const char* a, const char* b);
 
+// UI: 확인 + 다운로드 태스크 시작. 이미 진행 중이면 false.
+// CFG_OTA_TEST_URL이 정의되어 있으면 릴리스 확인 없이 그 URL(과 URL.sha256, URL.ydp)을 받는다.
+bool ota_start_update();
+// UI(loop 스레드): 쌓인 진행 이벤트를 하나 꺼낸다. 없으면 false.
+bool ota_poll_event(OtaEvent* out);
+bool ota_in_progress();
+
+#endif // OTA_UPDATE_H
@@ -2,12 +2,17 @@
 #include <M5Unified.h>
 #include <lvgl.h>
 #include "screensaver.h"
+#include "hw_sync.h"
+#include "lvgl_mem.h"
+#include "ui_theme.h"
 #include <LittleFS.h>
 #include <cstring>
 #include <cctype>
 #include <ctime>
 #include "ota_update.h"
 #include "version.h"
+#include "font_fallback.h"
+#include "ui_sched.h"
 
 // main.cpp에 정의된 전역 변수 (바인딩 추적용)
 extern String studentId;
@@ -73,7 +78,7 @@ static lv_obj_t* s_entry_name_label = nullptr;
 static lv_obj_t* s_hub_clock_label = nullptr;
 static lv_obj_t* s_hub_battery_widget = nullptr;
 static lv_obj_t* s_hub_battery_label = nullptr;
-static lv_timer_t* s_hub_clock_timer = nullptr;
+static UiSchedTask* s_hub_clock_timer = nullptr;
 static lv_obj_t* s_student_info_screen = nullptr;
 static lv_obj_t* s_stopwatch_screen = nullptr;
 static lv_obj_t* s_sw_time_label = nullptr;
@@ -83,7 +88,7 @@ static lv_obj_t* s_sw_right_btn = nullptr;
 static lv_obj_t* s_sw_left_lbl = nullptr;
 static lv_obj_t* s_sw_right_lbl = nullptr;
 static lv_obj_t* s_sw_lap_list = nullptr;
-static lv_timer_t* s_sw_timer = nullptr;
+static UiSchedTask* s_sw_timer = nullptr;
 static uint32_t s_sw_start_tick = 0;
 static uint32_t s_sw_elapsed_ms = 0;
 static bool s_sw_running = false;
@@ -102,6 +107,7 @@ static lv_obj_t* s_ota_progress_bar = nullptr;
 static lv_obj_t* s_ota_status_label = nullptr;
 static lv_obj_t* s_boot_status_overlay = nullptr;
 static lv_obj_t* s_boot_status_label = nullptr;
+static lv_obj_t* s_stale_badge = nullptr;  // 부팅 캐시로 그린 화면 표시(boot_snapshot.h)
 static lv_obj_t* s_boot_progress_bar = nullptr;
 static uint32_t s_last_refresh_ms = 0;
 static String s_pending_bind_student_id = "";
@@ -117,7 +123,7 @@ static uint8_t s_pin_len = 0;
 static bool s_pin_setup_mode = false;        // true: 최초 설정, false: 입력 검증
 static bool s_pin_locked = false;
 static int s_pin_lock_seconds = 0;
-static lv_timer_t* s_pin_lock_timer = nullptr;
+static UiSchedTask* s_pin_lock_timer = nullptr;
 static String s_pin_student_id = "";
 static String s_pin_student_name = "";
 static bool s_student_list_stale = false;
@@ -139,7 +145,7 @@ static lv_timer_t* s_complete_timeout_timer = nullptr;
 static lv_obj_t* s_test_perform_screen = nullptr;
 static lv_obj_t* s_test_perform_arc = nullptr;
 static lv_obj_t* s_test_perform_time_lbl = nullptr;
-static lv_timer_t* s_test_perform_timer = nullptr;
+static UiSchedTask* s_test_perform_timer = nullptr;
 static uint32_t s_test_perform_epoch = 0;
 static int s_test_perform_group_idx = -1;
 static char s_test_perform_group_id[40] = {0};
@@ -177,7 +183,6 @@ static bool s_sheet_dragging = false;
 static bool s_sheet_drag_moved = false;
 static lv_coord_t s_drag_start_touch_y = 0;
 static lv_coord_t s_drag_start_sheet_y = 240;
-static const uint8_t HW_MAX_GROUPS = 8;
 static const uint8_t HW_MAIN_GROUP_COUNT = 2;
 static uint8_t s_homework_page_idx = 0; // 0: main, 1: waiting
 static lv_coord_t s_hw_swipe_press_x = 0;
@@ -215,53 +220,52 @@ struct HwCacheEntry {
 static HwCacheEntry s_hw_cache[16];
 static uint8_t s_hw_cache_cnt = 0;
 
+// 카드 클릭 핸들러 user_data. 제자리 갱신 때 group_idx/phase 등을 새 값으로 덮는다.
+struct HwCardData {
+  int group_idx;
+  char group_id[40];
+  int phase;
+  bool is_homework;
+  lv_coord_t press_x;
+  lv_coord_t press_y;
+  bool dragged;
+  bool breath;  // 확인(phase 4) 숨쉬기 테두리를 DRAW_POST에서 직접 그린다
+};
+
+// 그룹 순서(=s_groups 인덱스)대로 들고 있는 카드 객체. 순서·구성이 같으면 이걸로 바뀐 카드만 다시 칠한다.
+struct HwCardRefs {
+  lv_obj_t* card;
+  lv_obj_t* title;
+  lv_obj_t* arc;
+  lv_obj_t* ring_lbl;
+  lv_obj_t* line2;
+  lv_obj_t* line3;
+  HwCardData* data;
+};
+static HwCardRefs s_hw_cards[HW_MAX_GROUPS];
+
+// 같은 글자면 건드리지 않는다(lv_label_set_text는 같은 값이어도 재할당·무효화를 한다).
+static void hw_label_set_text_if_changed(lv_obj_t* lbl, const char* text) {
+  if (!lbl) return;
+  const char* cur = lv_label_get_text(lbl);
+  if (cur && strcmp(cur, text) == 0) return;
+  lv_label_set_text(lbl, text);
+}
+
 static void hw_invalidate_cache(void) {
   s_hw_cache_cnt = 0;
   memset(s_hw_cache, 0, sizeof(s_hw_cache));
+  memset(s_hw_cards, 0, sizeof(s_hw_cards));
+  // 화면을 새로 그려야 하므로 같은 sync_fp라도 다음 페이로드는 건너뛰지 않게 한다.
+  fw_homeworks_sync_invalidate();
 }
 static volatile bool s_hw_updating = false;
 static bool s_hw_refresh_pending = false;
 
-// 그룹 과제 children 메모리 저장 (상세 페이지용)
-struct HwChildEntry {
-  char item_id[40];
-  char title[32];
-  char page[16];
-  char memo[64];
-  int16_t count;
-  int16_t check_count;
-  int8_t phase;
-  int32_t accumulated;
-};
 struct ConfirmToWaitCtx {
   char group_id[40];
 };
 
-struct HwGroupData {
-  char group_id[40];
-  char group_title[40];
-  char book_name[64];
-  char m5_wait_title[128];
-  char page_summary[32];
-  char item_type[24];
-  int16_t order_index;
-  bool is_homework;   // 하원 시 배정된 take-home 숙제 그룹(읽기 전용, 원에 "숙제" 표시)
-  bool is_test;       // 테스트 플로우 소속 (수행 시 테스트 카운트다운 화면)
-  bool is_naesin;     // 내신기출 (1열에 "내신기출" 표기)
-  bool pending_complete; // '완료' 예약 (확인 phase=4에서 4칸; 단순 확인은 3칸)
-  int8_t phase; int32_t accumulated; int32_t cycle_elapsed; int16_t check_count; int16_t total_count;
-  int16_t time_limit_minutes;
-  uint32_t color;
-  int64_t run_start_epoch;
-  /** 서버 run_start 기준 1회 정렬 + lv_tick 모노토닉 표시용 (목록/상세 공통) */
-  bool display_anchor_valid;
-  int64_t display_anchor_run_start;
-  uint32_t display_anchor_tick;
-  int32_t display_segment0_sec;
-  HwChildEntry children[8];
-  uint8_t child_cnt;
-};
-
 static inline bool hw_is_test_group(const HwGroupData& g) {
   // 신규 테스트는 type='프린트'+테스트 플로우로 저장되므로 서버 플래그(is_test) 우선.
   // 레거시 데이터 호환을 위해 type=='테스트'도 함께 인정.
@@ -364,7 +368,7 @@ static uint32_t s_detail_run_start_tick = 0;
 static int8_t s_detail_last_phase_seen = -1;
 static uint32_t s_detail_manual_override_until_ms = 0;
 static bool s_detail_manual_override_playing = false;
-static lv_timer_t* s_detail_timer = nullptr;
+static UiSchedTask* s_detail_timer = nullptr;
 static uint32_t s_detail_timer_epoch = 0;
 
 // Phase 2 실시간 시간 & Phase 4 깜빡임: 글로벌 단일 타이머로 관리
@@ -376,8 +380,13 @@ static lv_obj_t* s_p4_cards[8];
 static uint8_t s_p4_cnt = 0;
 static uint32_t s_p4_colors[8];
 static uint8_t s_p4_breath_step = 0;
+static lv_opa_t s_p4_breath_opa = 0;
+// 숨쉬기 한 번에 무효화한 넓이. card_px는 예전처럼 카드 전체(테두리 포함)를 무효화했다면의 넓이.
+static uint32_t s_breath_ticks = 0;
+static uint64_t s_breath_inv_px = 0;
+static uint64_t s_breath_card_px = 0;
 
-static lv_timer_t* s_hw_global_timer = nullptr;
+static UiSchedTask* s_hw_global_timer = nullptr;
 static uint32_t s_hw_timer_epoch = 0;
 
 static const lv_opa_t BREATH_LUT[] = {
@@ -391,9 +400,84 @@ static void fmt_time_hms(int secs, char* buf, size_t sz);
 // 화면 비종속 시험 종료(제한시간 소진) 감지/알람. 정의는 하단(팝업 정의 이후).
 static void test_end_global_check(void);
 
-static void hw_global_timer_cb(lv_timer_t* timer) {
+// 확인 카드 숨쉬기 테두리.
+// outline_opa를 바꾸면 LVGL이 카드 전체(제목·링·2/3열 포함)를 다시 그린다. 대신 카드 스타일의
+// outline은 투명으로 두고(색·두께·간격만 씀) DRAW_POST에서 지금 opa로 직접 그린 뒤,
+// 틱마다 테두리 띠(바깥 네 변 + 둥근 모서리 안쪽 정사각형)만 무효화한다.
+static void hw_card_breath_event_cb(lv_event_t* e) {
+  HwCardData* dd = (HwCardData*)lv_event_get_user_data(e);
+  if (!dd || !dd->breath) return;
+  lv_obj_t* card = lv_event_get_target(e);
+  const lv_coord_t ow = lv_obj_get_style_outline_width(card, LV_PART_MAIN);
+  const lv_coord_t op = lv_obj_get_style_outline_pad(card, LV_PART_MAIN);
+  if (lv_event_get_code(e) == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+    // opa가 투명이면 LVGL은 outline 몫의 확장 영역을 잡지 않는다.
+    lv_event_set_ext_draw_size(e, ow + op);
+    return;
+  }
+  if (ow <= 0 || s_p4_breath_opa <= LV_OPA_MIN) return;
+  lv_draw_rect_dsc_t dsc;
+  lv_draw_rect_dsc_init(&dsc);
+  dsc.bg_opa = LV_OPA_TRANSP;
+  dsc.border_opa = LV_OPA_TRANSP;
+  dsc.shadow_opa = LV_OPA_TRANSP;
+  dsc.radius = lv_obj_get_style_radius(card, LV_PART_MAIN);
+  dsc.outline_color = lv_obj_get_style_outline_color(card, LV_PART_MAIN);
+  dsc.outline_width = ow;
+  dsc.outline_pad = op;
+  dsc.outline_opa = s_p4_breath_opa;
+  lv_draw_rect(lv_event_get_draw_ctx(e), &dsc, &card->coords);
+}
+
+static void hw_breath_invalidate(lv_obj_t* card) {
+  const lv_coord_t band = lv_obj_get_style_outline_width(card, LV_PART_MAIN) +
+                          lv_obj_get_style_outline_pad(card, LV_PART_MAIN);
+  if (band <= 0) return;
+  lv_area_t c;
+  lv_obj_get_coords(card, &c);
+  const lv_coord_t w = lv_area_get_width(&c);
+  const lv_coord_t h = lv_area_get_height(&c);
+  lv_coord_t rad = lv_obj_get_style_radius(card, LV_PART_MAIN);
+  rad = LV_MIN(rad, LV_MIN(w, h) / 2);
+  lv_area_t a[8];
+  uint8_t n = 0;
+  a[n++] = {(lv_coord_t)(c.x1 - band), (lv_coord_t)(c.y1 - band), (lv_coord_t)(c.x2 + band), (lv_coord_t)(c.y1 - 1)};
+  a[n++] = {(lv_coord_t)(c.x1 - band), (lv_coord_t)(c.y2 + 1), (lv_coord_t)(c.x2 + band), (lv_coord_t)(c.y2 + band)};
+  a[n++] = {(lv_coord_t)(c.x1 - band), c.y1, (lv_coord_t)(c.x1 - 1), c.y2};
+  a[n++] = {(lv_coord_t)(c.x2 + 1), c.y1, (lv_coord_t)(c.x2 + band), c.y2};
+  if (rad > 0) {
+    // 둥근 모서리에서는 테두리가 카드 안쪽으로 rad까지 들어온다.
+    a[n++] = {c.x1, c.y1, (lv_coord_t)(c.x1 + rad - 1), (lv_coord_t)(c.y1 + rad - 1)};
+    a[n++] = {(lv_coord_t)(c.x2 - rad + 1), c.y1, c.x2, (lv_coord_t)(c.y1 + rad - 1)};
+    a[n++] = {c.x1, (lv_coord_t)(c.y2 - rad + 1), (lv_coord_t)(c.x1 + rad - 1), c.y2};
+    a[n++] = {(lv_coord_t)(c.x2 - rad + 1), (lv_coord_t)(c.y2 - rad + 1), c.x2, c.y2};
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    lv_obj_invalidate_area(card, &a[i]);
+    s_breath_inv_px += lv_area_get_size(&a[i]);
+  }
+  s_breath_card_px += (uint32_t)(w + 2 * band) * (uint32_t)(h + 2 * band);
+}
+
+static void hw_breath_tick(void) {
+  s_p4_breath_step = (s_p4_breath_step + 1) % BREATH_STEPS;
+  const lv_opa_t opa = BREATH_LUT[s_p4_breath_step];
+  if (opa == s_p4_breath_opa) return;
+  s_p4_breath_opa = opa;
+  s_breath_ticks++;
+  for (uint8_t i = 0; i < s_p4_cnt; i++) {
+    if (!s_p4_cards[i] || !lv_obj_is_valid(s_p4_cards[i])) continue;
+    hw_breath_invalidate(s_p4_cards[i]);
+  }
+}
+
+static void hw_global_timer_cb(UiSchedTask* timer) {
   uint32_t epoch = (uint32_t)(uintptr_t)timer->user_data;
-  if (epoch != s_hw_timer_epoch) { lv_timer_del(timer); return; }
+  if (epoch != s_hw_timer_epoch) {
+    if (s_hw_global_timer == timer) s_hw_global_timer = nullptr;
+    ui_sched_del(timer);
+    return;
+  }
 
   // 매 호출(≈100ms)마다 제한시간 소진을 감지해 알람을 띄운다(화면 무관).
   test_end_global_check();
@@ -416,12 +500,7 @@ static void hw_global_timer_cb(lv_timer_t* timer) {
     }
   }
 
-  s_p4_breath_step = (s_p4_breath_step + 1) % BREATH_STEPS;
-  lv_opa_t opa = BREATH_LUT[s_p4_breath_step];
-  for (uint8_t i = 0; i < s_p4_cnt; i++) {
-    if (!s_p4_cards[i] || !lv_obj_is_valid(s_p4_cards[i])) continue;
-    lv_obj_set_style_outline_opa(s_p4_cards[i], opa, 0);
-  }
+  hw_breath_tick();
 }
 
 bool g_bottom_sheet_open = false;
@@ -685,7 +764,7 @@ void ui_port_show_boot_status(void) {
 
   s_boot_status_label = lv_label_create(s_boot_status_overlay);
   lv_obj_set_style_text_color(s_boot_status_label, lv_color_hex(0xB8C0C2), 0);
-  lv_obj_set_style_text_font(s_boot_status_label, &kakao_kr_16, 0);
+  ui_theme_add(s_boot_status_label, UI_STYLE_TEXT_BODY);
   lv_label_set_long_mode(s_boot_status_label, LV_LABEL_LONG_WRAP);
   lv_obj_set_width(s_boot_status_label, 280);
   lv_obj_set_style_text_align(s_boot_status_label, LV_TEXT_ALIGN_CENTER, 0);
@@ -716,6 +795,31 @@ void ui_port_hide_boot_status(void) {
   s_boot_status_label = nullptr;
   s_boot_progress_bar = nullptr;
 }
+
+void ui_port_set_stale(bool stale) {
+  const bool valid = s_stale_badge && lv_obj_is_valid(s_stale_badge);
+  if (!stale) {
+    if (valid) lv_obj_del(s_stale_badge);
+    s_stale_badge = nullptr;
+    return;
+  }
+  if (valid) {
+    lv_obj_move_foreground(s_stale_badge);
+    return;
+  }
+  // 터치를 막지 않도록 클릭 불가 라벨 하나만 둔다.
+  s_stale_badge = lv_label_create(lv_scr_act());
+  ui_theme_add(s_stale_badge, UI_STYLE_TEXT_MUTED);
+  lv_obj_set_style_bg_color(s_stale_badge, lv_color_hex(0x202020), 0);
+  lv_obj_set_style_bg_opa(s_stale_badge, LV_OPA_80, 0);
+  lv_obj_set_style_radius(s_stale_badge, 10, 0);
+  lv_obj_set_style_pad_hor(s_stale_badge, 10, 0);
+  lv_obj_set_style_pad_ver(s_stale_badge, 2, 0);
+  lv_obj_clear_flag(s_stale_badge, LV_OBJ_FLAG_CLICKABLE);
+  lv_label_set_text(s_stale_badge, u8"저장된 화면 · 동기화 중");
+  lv_obj_align(s_stale_badge, LV_ALIGN_BOTTOM_MID, 0, -4);
+  lv_obj_move_foreground(s_stale_badge);
+}
 static void show_complete_overlay(void);
 static void close_complete_overlay(void);
 static void hw_perform_card_action(int group_idx);
@@ -735,7 +839,7 @@ static void close_homework_child_list_page(bool animated);
 static void bottom_sheet_drag_cb(lv_event_t* e);
 static void update_battery_widget(void);
 static void update_hub_battery(void);
-static void hub_clock_timer_cb(lv_timer_t* timer);
+static void hub_clock_timer_cb(UiSchedTask* timer);
 static void hide_snackbar(void);
 static void show_hw_add_menu_page(void);
 static void close_hw_add_menu_page(void);
@@ -1177,6 +1281,7 @@ static void close_hw_add_menu_page_animated(void) {
 static void show_hw_add_menu_page(void) {
   if (!s_stage || !lv_obj_is_valid(s_stage)) return;
   if (!s_homeworks_mode) return;
+  lvgl_mem_mark_screen("hw_add_menu");
   if (s_hw_add_menu_screen && lv_obj_is_valid(s_hw_add_menu_screen)) {
     lv_obj_move_foreground(s_hw_add_menu_screen);
     return;
@@ -1196,9 +1301,7 @@ static void show_hw_add_menu_page(void) {
   lv_obj_t* header = lv_obj_create(s_hw_add_menu_screen);
   lv_obj_set_size(header, 320, 40);
   lv_obj_set_pos(header, 0, 0);
-  lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(header, 0, 0);
-  lv_obj_set_style_pad_all(header, 0, 0);
+  ui_theme_add(header, UI_STYLE_BARE);
 
   lv_obj_t* back_btn = lv_btn_create(header);
   lv_obj_set_size(back_btn, 38, 38);
@@ -1208,7 +1311,7 @@ static void show_hw_add_menu_page(void) {
   lv_obj_set_style_border_width(back_btn, 0, 0);
   lv_obj_set_style_shadow_width(back_btn, 0, 0);
   lv_obj_t* back_lbl = lv_label_create(back_btn);
-  lv_obj_set_style_text_font(back_lbl, &kakao_kr_16, 0);
+  ui_theme_add(back_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(back_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(back_lbl, "<");
   lv_obj_center(back_lbl);
@@ -1218,7 +1321,7 @@ static void show_hw_add_menu_page(void) {
   }, LV_EVENT_CLICKED, NULL);
 
   lv_obj_t* title = lv_label_create(header);
-  lv_obj_set_style_text_font(title, &kakao_kr_16, 0);
+  ui_theme_add(title, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(title, lv_color_hex(0xFFFFFF), 0);
   lv_label_set_text(title, u8"과제추가");
   lv_obj_align(title, LV_ALIGN_LEFT_MID, 56, 1);
@@ -1226,9 +1329,7 @@ static void show_hw_add_menu_page(void) {
   lv_obj_t* grid = lv_obj_create(s_hw_add_menu_screen);
   lv_obj_set_size(grid, 320, 200);
   lv_obj_set_pos(grid, 0, 40);
-  lv_obj_set_style_bg_opa(grid, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(grid, 0, 0);
-  lv_obj_set_style_pad_all(grid, 0, 0);
+  ui_theme_add(grid, UI_STYLE_BARE);
   lv_obj_clear_flag(grid, LV_OBJ_FLAG_SCROLLABLE);
 
   const lv_coord_t r = 37;
@@ -1253,7 +1354,7 @@ static void show_hw_add_menu_page(void) {
         lv_obj_set_style_border_width(b, 0, 0);
         lv_obj_set_style_shadow_width(b, 0, 0);
         lv_obj_t* lb = lv_label_create(b);
-        lv_obj_set_style_text_font(lb, &kakao_kr_16, 0);
+        ui_theme_add(lb, UI_STYLE_TEXT_BODY);
         lv_obj_set_style_text_color(lb, lv_color_hex(0xE6E6E6), 0);
         lv_label_set_text(lb, u8"서술");
         lv_obj_center(lb);
@@ -1382,31 +1483,21 @@ static void show_raise_question_confirm_popup(void) {
   s_raise_question_confirm_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_raise_question_confirm_popup, 276, 148);
   lv_obj_center(s_raise_question_confirm_popup);
-  lv_obj_set_style_bg_color(s_raise_question_confirm_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_raise_question_confirm_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_raise_question_confirm_popup, 1, 0);
-  lv_obj_set_style_border_color(s_raise_question_confirm_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_raise_question_confirm_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_raise_question_confirm_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_raise_question_confirm_popup, 10, 0);
+  ui_theme_add(s_raise_question_confirm_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_raise_question_confirm_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_raise_question_confirm_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_raise_question_confirm_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_raise_question_confirm_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   lv_label_set_text(msg, u8"질문 하고 싶어요.");
 
   lv_obj_t* row = lv_obj_create(s_raise_question_confirm_popup);
   lv_obj_set_width(row, lv_pct(100));
   lv_obj_set_height(row, 50);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_style_pad_all(row, 0, 0);
+  ui_theme_add(row, UI_STYLE_BARE);
   lv_obj_set_style_pad_column(row, 12, 0);
   lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
@@ -1415,11 +1506,9 @@ static void show_raise_question_confirm_popup(void) {
 
   lv_obj_t* cancel_btn = lv_btn_create(row);
   lv_obj_set_size(cancel_btn, 118, 40);
-  lv_obj_set_style_radius(cancel_btn, 10, 0);
-  lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(cancel_btn, 0, 0);
+  ui_theme_add(cancel_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* cancel_lbl = lv_label_create(cancel_btn);
-  lv_obj_set_style_text_font(cancel_lbl, &kakao_kr_16, 0);
+  ui_theme_add(cancel_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(cancel_lbl, u8"취소");
   lv_obj_center(cancel_lbl);
   lv_obj_add_event_cb(cancel_btn, [](lv_event_t* e) {
@@ -1429,11 +1518,9 @@ static void show_raise_question_confirm_popup(void) {
 
   lv_obj_t* confirm_btn = lv_btn_create(row);
   lv_obj_set_size(confirm_btn, 118, 40);
-  lv_obj_set_style_radius(confirm_btn, 10, 0);
-  lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(confirm_btn, 0, 0);
+  ui_theme_add(confirm_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* confirm_lbl = lv_label_create(confirm_btn);
-  lv_obj_set_style_text_font(confirm_lbl, &kakao_kr_16, 0);
+  ui_theme_add(confirm_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(confirm_lbl, u8"확인");
   lv_obj_center(confirm_lbl);
   lv_obj_add_event_cb(confirm_btn, [](lv_event_t* e) {
@@ -1461,31 +1548,21 @@ static void show_test_start_confirm_popup(int group_idx) {
   s_test_start_confirm_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_test_start_confirm_popup, 276, 148);
   lv_obj_center(s_test_start_confirm_popup);
-  lv_obj_set_style_bg_color(s_test_start_confirm_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_test_start_confirm_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_test_start_confirm_popup, 1, 0);
-  lv_obj_set_style_border_color(s_test_start_confirm_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_test_start_confirm_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_test_start_confirm_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_test_start_confirm_popup, 10, 0);
+  ui_theme_add(s_test_start_confirm_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_test_start_confirm_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_test_start_confirm_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_test_start_confirm_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_test_start_confirm_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   lv_label_set_text(msg, msgbuf);
 
   lv_obj_t* row = lv_obj_create(s_test_start_confirm_popup);
   lv_obj_set_width(row, lv_pct(100));
   lv_obj_set_height(row, 50);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_style_pad_all(row, 0, 0);
+  ui_theme_add(row, UI_STYLE_BARE);
   lv_obj_set_style_pad_column(row, 12, 0);
   lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
@@ -1494,11 +1571,9 @@ static void show_test_start_confirm_popup(int group_idx) {
 
   lv_obj_t* cancel_btn = lv_btn_create(row);
   lv_obj_set_size(cancel_btn, 118, 40);
-  lv_obj_set_style_radius(cancel_btn, 10, 0);
-  lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(cancel_btn, 0, 0);
+  ui_theme_add(cancel_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* cancel_lbl = lv_label_create(cancel_btn);
-  lv_obj_set_style_text_font(cancel_lbl, &kakao_kr_16, 0);
+  ui_theme_add(cancel_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(cancel_lbl, u8"취소");
   lv_obj_center(cancel_lbl);
   lv_obj_add_event_cb(cancel_btn, [](lv_event_t* e) {
@@ -1508,11 +1583,9 @@ static void show_test_start_confirm_popup(int group_idx) {
 
   lv_obj_t* confirm_btn = lv_btn_create(row);
   lv_obj_set_size(confirm_btn, 118, 40);
-  lv_obj_set_style_radius(confirm_btn, 10, 0);
-  lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(confirm_btn, 0, 0);
+  ui_theme_add(confirm_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* confirm_lbl = lv_label_create(confirm_btn);
-  lv_obj_set_style_text_font(confirm_lbl, &kakao_kr_16, 0);
+  ui_theme_add(confirm_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(confirm_lbl, u8"확인");
   lv_obj_center(confirm_lbl);
   lv_obj_add_event_cb(confirm_btn, [](lv_event_t* e) {
@@ -1538,31 +1611,21 @@ static void show_test_abort_confirm_popup(void) {
   s_test_abort_confirm_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_test_abort_confirm_popup, 276, 148);
   lv_obj_center(s_test_abort_confirm_popup);
-  lv_obj_set_style_bg_color(s_test_abort_confirm_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_test_abort_confirm_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_test_abort_confirm_popup, 1, 0);
-  lv_obj_set_style_border_color(s_test_abort_confirm_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_test_abort_confirm_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_test_abort_confirm_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_test_abort_confirm_popup, 10, 0);
+  ui_theme_add(s_test_abort_confirm_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_test_abort_confirm_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_test_abort_confirm_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_test_abort_confirm_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_test_abort_confirm_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   lv_label_set_text(msg, u8"중단하면 자동 제출 단계로\n이동합니다. 계속할까요?");
 
   lv_obj_t* row = lv_obj_create(s_test_abort_confirm_popup);
   lv_obj_set_width(row, lv_pct(100));
   lv_obj_set_height(row, 50);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_style_pad_all(row, 0, 0);
+  ui_theme_add(row, UI_STYLE_BARE);
   lv_obj_set_style_pad_column(row, 12, 0);
   lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
@@ -1571,11 +1634,9 @@ static void show_test_abort_confirm_popup(void) {
 
   lv_obj_t* cancel_btn = lv_btn_create(row);
   lv_obj_set_size(cancel_btn, 118, 40);
-  lv_obj_set_style_radius(cancel_btn, 10, 0);
-  lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(cancel_btn, 0, 0);
+  ui_theme_add(cancel_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* cancel_lbl = lv_label_create(cancel_btn);
-  lv_obj_set_style_text_font(cancel_lbl, &kakao_kr_16, 0);
+  ui_theme_add(cancel_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(cancel_lbl, u8"취소");
   lv_obj_center(cancel_lbl);
   lv_obj_add_event_cb(cancel_btn, [](lv_event_t* e) {
@@ -1585,11 +1646,9 @@ static void show_test_abort_confirm_popup(void) {
 
   lv_obj_t* confirm_btn = lv_btn_create(row);
   lv_obj_set_size(confirm_btn, 118, 40);
-  lv_obj_set_style_radius(confirm_btn, 10, 0);
-  lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(confirm_btn, 0, 0);
+  ui_theme_add(confirm_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* confirm_lbl = lv_label_create(confirm_btn);
-  lv_obj_set_style_text_font(confirm_lbl, &kakao_kr_16, 0);
+  ui_theme_add(confirm_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(confirm_lbl, u8"확인");
   lv_obj_center(confirm_lbl);
   lv_obj_add_event_cb(confirm_btn, [](lv_event_t* e) {
@@ -1648,7 +1707,7 @@ void show_complete_overlay(void) {
   lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
 
   lv_obj_t* l = lv_label_create(card);
-  lv_obj_set_style_text_font(l, &kakao_kr_16, 0);
+  ui_theme_add(l, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(l, lv_color_hex(0xE6E6E6), 0);
   lv_obj_set_width(l, 220);
   lv_obj_set_style_text_align(l, LV_TEXT_ALIGN_CENTER, 0);
@@ -1682,22 +1741,14 @@ static void show_confirm_phase_to_waiting_popup(const char* group_id, int group_
   s_confirm_to_wait_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_confirm_to_wait_popup, 276, 168);
   lv_obj_center(s_confirm_to_wait_popup);
-  lv_obj_set_style_bg_color(s_confirm_to_wait_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_confirm_to_wait_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_confirm_to_wait_popup, 1, 0);
-  lv_obj_set_style_border_color(s_confirm_to_wait_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_confirm_to_wait_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_confirm_to_wait_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_confirm_to_wait_popup, 10, 0);
+  ui_theme_add(s_confirm_to_wait_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_confirm_to_wait_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_confirm_to_wait_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_confirm_to_wait_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_confirm_to_wait_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   char msgbuf[160];
   snprintf(msgbuf, sizeof(msgbuf), u8"%.*s\n과제를 찾아왔나요?", 32, line1);
@@ -1706,9 +1757,7 @@ static void show_confirm_phase_to_waiting_popup(const char* group_id, int group_
   lv_obj_t* row = lv_obj_create(s_confirm_to_wait_popup);
   lv_obj_set_width(row, lv_pct(100));
   lv_obj_set_height(row, 50);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_style_pad_all(row, 0, 0);
+  ui_theme_add(row, UI_STYLE_BARE);
   lv_obj_set_style_pad_column(row, 12, 0);
   lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
@@ -1717,11 +1766,9 @@ static void show_confirm_phase_to_waiting_popup(const char* group_id, int group_
 
   lv_obj_t* cancel_btn = lv_btn_create(row);
   lv_obj_set_size(cancel_btn, 118, 40);
-  lv_obj_set_style_radius(cancel_btn, 10, 0);
-  lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(cancel_btn, 0, 0);
+  ui_theme_add(cancel_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* cancel_lbl = lv_label_create(cancel_btn);
-  lv_obj_set_style_text_font(cancel_lbl, &kakao_kr_16, 0);
+  ui_theme_add(cancel_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(cancel_lbl, u8"취소");
   lv_obj_center(cancel_lbl);
   lv_obj_add_event_cb(cancel_btn, [](lv_event_t* e) {
@@ -1731,11 +1778,9 @@ static void show_confirm_phase_to_waiting_popup(const char* group_id, int group_
 
   lv_obj_t* confirm_btn = lv_btn_create(row);
   lv_obj_set_size(confirm_btn, 118, 40);
-  lv_obj_set_style_radius(confirm_btn, 10, 0);
-  lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(confirm_btn, 0, 0);
+  ui_theme_add(confirm_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* confirm_lbl = lv_label_create(confirm_btn);
-  lv_obj_set_style_text_font(confirm_lbl, &kakao_kr_16, 0);
+  ui_theme_add(confirm_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(confirm_lbl, u8"확인");
   lv_obj_center(confirm_lbl);
   lv_obj_add_event_cb(confirm_btn, [](lv_event_t* e) {
@@ -1782,9 +1827,7 @@ static void populate_student_info_container(lv_obj_t* target, bool include_back_
     lv_obj_t* header = lv_obj_create(target);
     lv_obj_set_width(header, lv_pct(100));
     lv_obj_set_height(header, 44);
-    lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(header, 0, 0);
-    lv_obj_set_style_pad_all(header, 0, 0);
+    ui_theme_add(header, UI_STYLE_BARE);
     lv_obj_set_flex_flow(header, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(header, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
@@ -1905,7 +1948,7 @@ static void sw_update_display(void) {
   d[0] = '0' + cs % 10;          lv_label_set_text(s_sw_digits[7], d);
 }
 
-static void sw_timer_cb(lv_timer_t* t) {
+static void sw_timer_cb(UiSchedTask* t) {
   (void)t;
   sw_update_display();
 }
@@ -1916,8 +1959,8 @@ static void sw_start(void) {
   s_sw_start_tick = lv_tick_get();
   s_sw_running = true;
   if (!s_sw_timer) {
-    s_sw_timer = lv_timer_create(sw_timer_cb, 50, NULL);
-    lv_timer_set_repeat_count(s_sw_timer, -1);
+    // 프레임 작업: 따로 깨지 않고 매 프레임 그리기 직전에 숫자를 바꾼다.
+    s_sw_timer = ui_sched_add(sw_timer_cb, 0, nullptr, "stopwatch");
   }
   sw_update_buttons();
 }
@@ -1935,7 +1978,7 @@ static void sw_reset(void) {
   s_sw_elapsed_ms = 0;
   s_sw_running = false;
   s_sw_lap_count = 0;
-  if (s_sw_timer) { lv_timer_del(s_sw_timer); s_sw_timer = nullptr; }
+  if (s_sw_timer) { ui_sched_del(s_sw_timer); s_sw_timer = nullptr; }
   sw_update_display();
   if (s_sw_lap_list && lv_obj_is_valid(s_sw_lap_list)) lv_obj_clean(s_sw_lap_list);
   sw_update_buttons();
@@ -1979,7 +2022,7 @@ static void sw_update_buttons(void) {
 }
 
 static void close_stopwatch_screen(bool show_hub) {
-  if (s_sw_timer) { lv_timer_del(s_sw_timer); s_sw_timer = nullptr; }
+  if (s_sw_timer) { ui_sched_del(s_sw_timer); s_sw_timer = nullptr; }
   s_sw_running = false;
   s_sw_elapsed_ms = 0;
   s_sw_lap_count = 0;
@@ -1999,6 +2042,7 @@ static void close_stopwatch_screen(bool show_hub) {
 
 static void show_stopwatch_screen(void) {
   if (!s_stage || !lv_obj_is_valid(s_stage)) return;
+  lvgl_mem_mark_screen("stopwatch");
   if (s_entry_hub && lv_obj_is_valid(s_entry_hub)) {
     lv_obj_add_flag(s_entry_hub, LV_OBJ_FLAG_HIDDEN);
   }
@@ -2096,7 +2140,7 @@ static void show_stopwatch_screen(void) {
   lv_obj_set_style_border_width(s_sw_left_btn, 0, 0);
   lv_obj_set_style_shadow_width(s_sw_left_btn, 0, 0);
   s_sw_left_lbl = lv_label_create(s_sw_left_btn);
-  lv_obj_set_style_text_font(s_sw_left_lbl, &kakao_kr_16, 0);
+  ui_theme_add(s_sw_left_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(s_sw_left_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(s_sw_left_lbl, u8"재설정");
   lv_obj_center(s_sw_left_lbl);
@@ -2115,7 +2159,7 @@ static void show_stopwatch_screen(void) {
   lv_obj_set_style_border_width(s_sw_right_btn, 0, 0);
   lv_obj_set_style_shadow_width(s_sw_right_btn, 0, 0);
   s_sw_right_lbl = lv_label_create(s_sw_right_btn);
-  lv_obj_set_style_text_font(s_sw_right_lbl, &kakao_kr_16, 0);
+  ui_theme_add(s_sw_right_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(s_sw_right_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(s_sw_right_lbl, u8"시작");
   lv_obj_center(s_sw_right_lbl);
@@ -2146,6 +2190,7 @@ static void show_stopwatch_screen(void) {
 
 static void show_student_info_screen(void) {
   if (!s_stage || !lv_obj_is_valid(s_stage)) return;
+  lvgl_mem_mark_screen("student_info");
   if (s_entry_hub && lv_obj_is_valid(s_entry_hub)) {
     lv_obj_add_flag(s_entry_hub, LV_OBJ_FLAG_HIDDEN);
   }
@@ -2199,7 +2244,7 @@ static void show_entry_hub_overlay(void) {
     s_entry_name_label = lv_label_create(s_entry_hub);
     lv_obj_set_width(s_entry_name_label, 120);
     lv_obj_set_style_text_color(s_entry_name_label, lv_color_hex(0xE6E6E6), 0);
-    lv_obj_set_style_text_font(s_entry_name_label, &kakao_kr_16, 0);
+    ui_theme_add(s_entry_name_label, UI_STYLE_TEXT_BODY);
     lv_label_set_long_mode(s_entry_name_label, LV_LABEL_LONG_DOT);
     lv_label_set_text(s_entry_name_label, s_student_name_cache.c_str());
     lv_obj_align(s_entry_name_label, LV_ALIGN_TOP_LEFT, 14, 8);
@@ -2218,9 +2263,7 @@ static void show_entry_hub_overlay(void) {
 
     s_hub_battery_widget = lv_obj_create(s_entry_hub);
     lv_obj_set_size(s_hub_battery_widget, 84, 28);
-    lv_obj_set_style_bg_opa(s_hub_battery_widget, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(s_hub_battery_widget, 0, 0);
-    lv_obj_set_style_pad_all(s_hub_battery_widget, 0, 0);
+    ui_theme_add(s_hub_battery_widget, UI_STYLE_BARE);
     lv_obj_set_flex_flow(s_hub_battery_widget, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(s_hub_battery_widget, LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     lv_obj_align(s_hub_battery_widget, LV_ALIGN_TOP_RIGHT, -8, 4);
@@ -2262,7 +2305,7 @@ static void show_entry_hub_overlay(void) {
         lv_obj_set_style_img_recolor_opa(img, LV_OPA_COVER, 0);
         lv_obj_align(img, LV_ALIGN_CENTER, 0, -8);
         lv_obj_t* lbl = lv_label_create(btn);
-        lv_obj_set_style_text_font(lbl, &kakao_kr_16, 0);
+        ui_theme_add(lbl, UI_STYLE_TEXT_BODY);
         lv_obj_set_style_text_color(lbl, lv_color_hex(0xA0A0A0), 0);
         lv_label_set_text(lbl, text);
         lv_obj_align(lbl, LV_ALIGN_BOTTOM_MID, 0, 2);
@@ -2280,7 +2323,7 @@ static void show_entry_hub_overlay(void) {
                                       &format_list_bulleted_90dp_999999_FILL0_wght400_GRAD0_opsz48);
     lv_obj_add_event_cb(hw_btn, [](lv_event_t* e) {
       (void)e;
-      if (s_hub_clock_timer) { lv_timer_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
+      if (s_hub_clock_timer) { ui_sched_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
       if (s_entry_hub && lv_obj_is_valid(s_entry_hub)) {
         lv_obj_add_flag(s_entry_hub, LV_OBJ_FLAG_HIDDEN);
       }
@@ -2313,9 +2356,8 @@ static void show_entry_hub_overlay(void) {
     }, LV_EVENT_CLICKED, NULL);
 
     // Clock + battery refresh timer (30s interval)
-    if (s_hub_clock_timer) { lv_timer_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
-    s_hub_clock_timer = lv_timer_create(hub_clock_timer_cb, 30000, NULL);
-    lv_timer_set_repeat_count(s_hub_clock_timer, -1);
+    if (s_hub_clock_timer) { ui_sched_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
+    s_hub_clock_timer = ui_sched_add(hub_clock_timer_cb, 30000, nullptr, "hub_clock");
   }
 
   if (s_entry_name_label && lv_obj_is_valid(s_entry_name_label)) {
@@ -2335,8 +2377,7 @@ static void show_entry_hub_overlay(void) {
   update_hub_battery();
   hub_clock_timer_cb(nullptr);
   if (!s_hub_clock_timer) {
-    s_hub_clock_timer = lv_timer_create(hub_clock_timer_cb, 30000, NULL);
-    lv_timer_set_repeat_count(s_hub_clock_timer, -1);
+    s_hub_clock_timer = ui_sched_add(hub_clock_timer_cb, 30000, nullptr, "hub_clock");
   }
   screensaver_attach_activity(s_entry_hub);
 }
@@ -2350,22 +2391,14 @@ static void show_bind_confirm_popup(const char* student_id, const char* student_
   s_bind_confirm_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_bind_confirm_popup, 276, 148);
   lv_obj_center(s_bind_confirm_popup);
-  lv_obj_set_style_bg_color(s_bind_confirm_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_bind_confirm_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_bind_confirm_popup, 1, 0);
-  lv_obj_set_style_border_color(s_bind_confirm_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_bind_confirm_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_bind_confirm_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_bind_confirm_popup, 10, 0);
+  ui_theme_add(s_bind_confirm_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_bind_confirm_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_bind_confirm_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_bind_confirm_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_bind_confirm_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   String message;
   message = s_pending_bind_student_name + u8" 학생으로 로그인할까요?";
@@ -2374,9 +2407,7 @@ static void show_bind_confirm_popup(const char* student_id, const char* student_
   lv_obj_t* row = lv_obj_create(s_bind_confirm_popup);
   lv_obj_set_width(row, lv_pct(100));
   lv_obj_set_height(row, 50);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_style_pad_all(row, 0, 0);
+  ui_theme_add(row, UI_STYLE_BARE);
   lv_obj_set_style_pad_column(row, 12, 0);
   lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
@@ -2385,11 +2416,9 @@ static void show_bind_confirm_popup(const char* student_id, const char* student_
 
   lv_obj_t* cancel_btn = lv_btn_create(row);
   lv_obj_set_size(cancel_btn, 118, 40);
-  lv_obj_set_style_radius(cancel_btn, 10, 0);
-  lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(cancel_btn, 0, 0);
+  ui_theme_add(cancel_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* cancel_lbl = lv_label_create(cancel_btn);
-  lv_obj_set_style_text_font(cancel_lbl, &kakao_kr_16, 0);
+  ui_theme_add(cancel_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(cancel_lbl, u8"취소");
   lv_obj_center(cancel_lbl);
   lv_obj_add_event_cb(cancel_btn, [](lv_event_t* e) {
@@ -2399,11 +2428,9 @@ static void show_bind_confirm_popup(const char* student_id, const char* student_
 
   lv_obj_t* confirm_btn = lv_btn_create(row);
   lv_obj_set_size(confirm_btn, 118, 40);
-  lv_obj_set_style_radius(confirm_btn, 10, 0);
-  lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(confirm_btn, 0, 0);
+  ui_theme_add(confirm_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* confirm_lbl = lv_label_create(confirm_btn);
-  lv_obj_set_style_text_font(confirm_lbl, &kakao_kr_16, 0);
+  ui_theme_add(confirm_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(confirm_lbl, u8"확인");
   lv_obj_center(confirm_lbl);
   lv_obj_add_event_cb(confirm_btn, [](lv_event_t* e) {
@@ -2443,12 +2470,12 @@ static void set_pin_title_for_mode(void) {
   lv_label_set_text(s_pin_title_lbl, t.c_str());
 }
 
-static void pin_lock_timer_cb(lv_timer_t* t) {
+static void pin_lock_timer_cb(UiSchedTask* t) {
   (void)t;
   s_pin_lock_seconds--;
   if (s_pin_lock_seconds <= 0) {
     s_pin_locked = false;
-    if (s_pin_lock_timer) { lv_timer_del(s_pin_lock_timer); s_pin_lock_timer = nullptr; }
+    if (s_pin_lock_timer) { ui_sched_del(s_pin_lock_timer); s_pin_lock_timer = nullptr; }
     set_pin_hint(u8"다시 시도해 주세요", 0x33A373);
     return;
   }
@@ -2462,9 +2489,8 @@ static void start_pin_lock_countdown(int seconds) {
   if (seconds <= 0) seconds = 300;
   s_pin_locked = true;
   s_pin_lock_seconds = seconds;
-  if (s_pin_lock_timer) { lv_timer_del(s_pin_lock_timer); s_pin_lock_timer = nullptr; }
-  s_pin_lock_timer = lv_timer_create(pin_lock_timer_cb, 1000, nullptr);
-  lv_timer_set_repeat_count(s_pin_lock_timer, -1);
+  if (s_pin_lock_timer) { ui_sched_del(s_pin_lock_timer); s_pin_lock_timer = nullptr; }
+  s_pin_lock_timer = ui_sched_add(pin_lock_timer_cb, 1000, nullptr, "pin_lock");
   char buf[64];
   int m = seconds / 60, s = seconds % 60;
   snprintf(buf, sizeof(buf), u8"잠금됨 · %d:%02d 후 재시도", m, s);
@@ -2505,7 +2531,7 @@ static lv_obj_t* pin_make_btn(lv_obj_t* parent, const char* text, lv_coord_t x_o
   lv_obj_set_style_shadow_width(b, 0, 0);
   lv_obj_align(b, LV_ALIGN_TOP_MID, x_ofs, y);
   lv_obj_t* l = lv_label_create(b);
-  lv_obj_set_style_text_font(l, &kakao_kr_16, 0);
+  ui_theme_add(l, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(l, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(l, text);
   lv_obj_center(l);
@@ -2513,7 +2539,7 @@ static lv_obj_t* pin_make_btn(lv_obj_t* parent, const char* text, lv_coord_t x_o
 }
 
 static void close_pin_page(void) {
-  if (s_pin_lock_timer) { lv_timer_del(s_pin_lock_timer); s_pin_lock_timer = nullptr; }
+  if (s_pin_lock_timer) { ui_sched_del(s_pin_lock_timer); s_pin_lock_timer = nullptr; }
   if (s_pin_page && lv_obj_is_valid(s_pin_page)) lv_obj_del(s_pin_page);
   s_pin_page = nullptr;
   for (int i = 0; i < PIN_LEN; i++) s_pin_dots[i] = nullptr;
@@ -2535,6 +2561,7 @@ bool ui_port_is_pin_entry_active(void) {
 
 static void show_pin_page(const char* student_id, const char* student_name, bool pin_set) {
   if (!student_id || !*student_id) return;
+  lvgl_mem_mark_screen("pin");
   fw_mark_ui_stage(20);
   close_pin_page();
   fw_mark_ui_stage(21);
@@ -2555,7 +2582,7 @@ static void show_pin_page(const char* student_id, const char* student_name, bool
   lv_obj_clear_flag(s_pin_page, LV_OBJ_FLAG_SCROLLABLE);
 
   s_pin_title_lbl = lv_label_create(s_pin_page);
-  lv_obj_set_style_text_font(s_pin_title_lbl, &kakao_kr_16, 0);
+  ui_theme_add(s_pin_title_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(s_pin_title_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_obj_set_width(s_pin_title_lbl, 300);
   lv_obj_set_style_text_align(s_pin_title_lbl, LV_TEXT_ALIGN_CENTER, 0);
@@ -2575,7 +2602,7 @@ static void show_pin_page(const char* student_id, const char* student_name, bool
   update_pin_dots();
 
   s_pin_hint_lbl = lv_label_create(s_pin_page);
-  lv_obj_set_style_text_font(s_pin_hint_lbl, &kakao_kr_16, 0);
+  ui_theme_add(s_pin_hint_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(s_pin_hint_lbl, lv_color_hex(0x909090), 0);
   lv_obj_set_width(s_pin_hint_lbl, 300);
   lv_obj_set_style_text_align(s_pin_hint_lbl, LV_TEXT_ALIGN_CENTER, 0);
@@ -2665,7 +2692,7 @@ static void show_center_toast(const char* msg, uint32_t ms) {
   lv_obj_set_style_border_color(o, lv_color_hex(0x3A3A3A), 0);
   lv_obj_clear_flag(o, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_t* l = lv_label_create(o);
-  lv_obj_set_style_text_font(l, &kakao_kr_16, 0);
+  ui_theme_add(l, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(l, lv_color_hex(0xE6E6E6), 0);
   lv_obj_set_width(l, 234);
   lv_obj_set_style_text_align(l, LV_TEXT_ALIGN_CENTER, 0);
@@ -2787,7 +2814,7 @@ static void build_student_list_ui() {
   close_test_start_confirm_popup();
   close_test_abort_confirm_popup();
   close_confirm_to_wait_popup();
-  if (s_hub_clock_timer) { lv_timer_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
+  if (s_hub_clock_timer) { ui_sched_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
   if (s_entry_hub && lv_obj_is_valid(s_entry_hub)) { lv_obj_del(s_entry_hub); s_entry_hub = nullptr; s_entry_name_label = nullptr; s_hub_clock_label = nullptr; s_hub_battery_widget = nullptr; s_hub_battery_label = nullptr; }
   if (s_student_info_screen && lv_obj_is_valid(s_student_info_screen)) { lv_obj_del(s_student_info_screen); s_student_info_screen = nullptr; }
   if (s_bottom_handle && lv_obj_is_valid(s_bottom_handle)) { lv_obj_del(s_bottom_handle); s_bottom_handle = nullptr; }
@@ -2855,7 +2882,7 @@ static void build_homeworks_ui_internal() {
   close_test_start_confirm_popup();
   close_test_abort_confirm_popup();
   close_confirm_to_wait_popup();
-  if (s_hub_clock_timer) { lv_timer_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
+  if (s_hub_clock_timer) { ui_sched_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
   if (s_entry_hub && lv_obj_is_valid(s_entry_hub)) { lv_obj_del(s_entry_hub); s_entry_hub = nullptr; s_entry_name_label = nullptr; s_hub_clock_label = nullptr; s_hub_battery_widget = nullptr; s_hub_battery_label = nullptr; }
   if (s_student_info_screen && lv_obj_is_valid(s_student_info_screen)) { lv_obj_del(s_student_info_screen); s_student_info_screen = nullptr; }
   if (s_bottom_handle && lv_obj_is_valid(s_bottom_handle)) { lv_obj_del(s_bottom_handle); s_bottom_handle = nullptr; }
@@ -2895,7 +2922,7 @@ static void build_homeworks_ui_internal() {
   {
     extern const lv_font_t kakao_kr_16;
     s_refresh_hint = lv_label_create(s_pages);
-    lv_obj_set_style_text_font(s_refresh_hint, &kakao_kr_16, 0);
+    ui_theme_add(s_refresh_hint, UI_STYLE_TEXT_BODY);
     lv_obj_set_style_text_color(s_refresh_hint, lv_color_hex(0x8A8A8A), 0);
     lv_label_set_text(s_refresh_hint, u8"당겨서 새로고침");
     lv_obj_align(s_refresh_hint, LV_ALIGN_TOP_MID, 0, 4);
@@ -3060,7 +3087,7 @@ static void build_homeworks_ui_internal() {
   lv_obj_add_flag(s_snackbar_dot, LV_OBJ_FLAG_HIDDEN);
 
   s_snackbar_lbl = lv_label_create(s_snackbar);
-  lv_obj_set_style_text_font(s_snackbar_lbl, &kakao_kr_16, 0);
+  ui_theme_add(s_snackbar_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(s_snackbar_lbl, lv_color_white(), 0);
   lv_label_set_text(s_snackbar_lbl, "");
   lv_obj_align(s_snackbar_lbl, LV_ALIGN_LEFT_MID, 12, 0);
@@ -3085,14 +3112,38 @@ static void on_screensaver_wake(void) {
     hub_clock_timer_cb(nullptr);
     Serial.println("[SS-DIAG] wake_cb: after hub_clock_timer_cb"); Serial.flush();
     if (!s_hub_clock_timer) {
-      s_hub_clock_timer = lv_timer_create(hub_clock_timer_cb, 30000, NULL);
-      lv_timer_set_repeat_count(s_hub_clock_timer, -1);
+      s_hub_clock_timer = ui_sched_add(hub_clock_timer_cb, 30000, nullptr, "hub_clock");
     }
   }
   Serial.println("[SS-DIAG] wake_cb: done"); Serial.flush();
 }
 
+void ui_port_append_diag(String& out) {
+  const uint32_t ticks = s_breath_ticks ? s_breath_ticks : 1;
+  out += "ui_breath cards=" + String((unsigned)s_p4_cnt) + " ticks=" + String((unsigned long)s_breath_ticks) +
+         " inv_px_per_tick=" + String((unsigned long)(s_breath_inv_px / ticks)) +
+         " card_px_per_tick=" + String((unsigned long)(s_breath_card_px / ticks)) + "\n";
+}
+
+// ui_sched 화면별 깨움 통계용 이름. 위에 덮인 화면부터 본다.
+static bool screen_shown(lv_obj_t* obj) {
+  return obj && lv_obj_is_valid(obj) && !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+static const char* ui_port_screen_name() {
+  if (screen_shown(s_ota_popup)) return "ota";
+  if (screen_shown(s_pin_page)) return "pin";
+  if (screen_shown(s_test_perform_screen)) return "test_perform";
+  if (screen_shown(s_stopwatch_screen)) return "stopwatch";
+  if (screen_shown(s_hw_detail_screen)) return "hw_detail";
+  if (screen_shown(s_student_info_screen)) return "student_info";
+  if (s_homeworks_mode) return "homeworks";
+  if (screen_shown(s_entry_hub)) return "hub";
+  return "students";
+}
+
 void ui_port_init() {
+  ui_sched_set_screen_fn(ui_port_screen_name);
   // Load saved brightness/volume/student_id from LittleFS
   String savedStudentId = "";
   if (LittleFS.begin(true)) {
@@ -3137,7 +3188,6 @@ void ui_port_init() {
       f.close();
       Serial.printf("[INIT] Loaded student_id: %s\n", savedStudentId.c_str());
     }
-    LittleFS.end();
   }
   
   // 바인딩된 학생이 있으면 과제 데이터를 준비하고 홈 허브부터 노출
@@ -3146,7 +3196,7 @@ void ui_port_init() {
     build_homeworks_ui_internal();
     show_entry_hub_overlay();
     Serial.printf("[INIT] Starting in homework mode for student: %s\n", studentId.c_str());
-    // MQTT 연결 후 student_info와 homeworks는 onMqttConnect에서 자동 요청됨
+    // MQTT 연결 후 student_info와 homeworks는 loop의 on_mqtt_session_ready()에서 자동 요청됨
   } else {
     studentId = "";
     build_student_list_ui();
@@ -3176,7 +3226,7 @@ void ui_before_screen_change(void) {
   close_student_info_screen(false);
   close_stopwatch_screen(false);
   close_hw_add_menu_page();
-  if (s_hub_clock_timer) { lv_timer_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
+  if (s_hub_clock_timer) { ui_sched_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
   close_volume_popup();
   close_brightness_popup();
 }
@@ -3195,7 +3245,7 @@ void ui_before_screensaver(void) {
   close_confirm_to_wait_popup();
   close_volume_popup();
   close_brightness_popup();
-  if (s_hub_clock_timer) { lv_timer_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
+  if (s_hub_clock_timer) { ui_sched_del(s_hub_clock_timer); s_hub_clock_timer = nullptr; }
   s_screensaver_hid_student_info = false;
   s_screensaver_hid_stopwatch = false;
   if (s_student_info_screen && lv_obj_is_valid(s_student_info_screen)) {
@@ -3256,7 +3306,6 @@ static void volume_slider_cb(lv_event_t* e) {
   if (LittleFS.begin(true)) {
     File f = LittleFS.open("/volume.txt", "w");
     if (f) { f.printf("%d", s_current_volume); f.close(); }
-    LittleFS.end();
   }
 }
 
@@ -3269,7 +3318,6 @@ static void brightness_slider_cb(lv_event_t* e) {
   if (LittleFS.begin(true)) {
     File f = LittleFS.open("/brightness.txt", "w");
     if (f) { f.printf("%d", s_current_brightness); f.close(); }
-    LittleFS.end();
   }
 }
 
@@ -3287,17 +3335,6 @@ static void close_brightness_popup(void) {
   }
 }
 
-static void ota_progress_callback(int percent, const char* status) {
-  if (!s_ota_popup || !lv_obj_is_valid(s_ota_popup)) return;
-  if (s_ota_progress_bar && lv_obj_is_valid(s_ota_progress_bar)) {
-    lv_bar_set_value(s_ota_progress_bar, percent, LV_ANIM_ON);
-  }
-  if (s_ota_status_label && lv_obj_is_valid(s_ota_status_label)) {
-    lv_label_set_text(s_ota_status_label, status);
-  }
-  lv_timer_handler(); // UI 즉시 갱신
-}
-
 static void show_ota_popup(void) {
   if (s_ota_popup) return;
   
@@ -3343,47 +3380,75 @@ static void close_ota_popup(void) {
   }
 }
 
+static void ota_set_status(const char* text) {
+  if (s_ota_status_label && lv_obj_is_valid(s_ota_status_label)) lv_label_set_text(s_ota_status_label, text);
+}
+
+// ota 태스크가 올린 진행 이벤트를 loop 스레드에서 꺼내 팝업에 반영한다.
+static void ota_event_timer_cb(UiSchedTask* t) {
+  OtaEvent ev;
+  bool finished = false;
+  while (ota_poll_event(&ev)) {
+    char buf[96];
+    switch (ev.phase) {
+      case OTA_PHASE_CHECKING:
+        ota_set_status(u8"확인 중...");
+        break;
+      case OTA_PHASE_UP_TO_DATE:
+        snprintf(buf, sizeof(buf), u8"최신 버전입니다\n(v%s)", FIRMWARE_VERSION);
+        ota_set_status(buf);
+        finished = true;
+        break;
+      case OTA_PHASE_DOWNLOADING:
+        snprintf(buf, sizeof(buf), u8"v%s → v%s\n%d%%  %lu KB/s", FIRMWARE_VERSION, ev.text, ev.percent,
+                 (unsigned long)(ev.rate_bps / 1024));
+        ota_set_status(buf);
+        break;
+      case OTA_PHASE_RETRYING:
+        snprintf(buf, sizeof(buf), u8"연결 재시도 중... %d%%", ev.percent);
+        ota_set_status(buf);
+        break;
+      case OTA_PHASE_VERIFYING:
+        ota_set_status(u8"검증 중...");
+        break;
+      case OTA_PHASE_DONE:
+        ota_set_status(u8"완료! 재부팅 중...");
+        break;
+      default:
+        snprintf(buf, sizeof(buf), u8"업데이트 실패\n%s", ev.text);
+        ota_set_status(buf);
+        finished = true;
+        break;
+    }
+    if (s_ota_progress_bar && lv_obj_is_valid(s_ota_progress_bar)) {
+      lv_bar_set_value(s_ota_progress_bar, ev.percent, LV_ANIM_ON);
+    }
+  }
+  if (!finished) return;
+  ui_sched_del(t);
+  // 3초 후 자동 닫기
+  lv_timer_t* close_timer = lv_timer_create([](lv_timer_t* ct){
+    close_ota_popup();
+    lv_timer_del(ct);
+  }, 3000, NULL);
+  lv_timer_set_repeat_count(close_timer, 1);
+}
+
 static void start_ota_update(void) {
   Serial.println("[OTA] User requested update check");
-  fw_watchdog_pause();
+  if (ota_in_progress()) return;
   show_ota_popup();
-  
-  String latestVersion, downloadUrl;
-  bool updateAvailable = checkForUpdate(latestVersion, downloadUrl);
-  
-  if (!updateAvailable) {
-    if (s_ota_status_label && lv_obj_is_valid(s_ota_status_label)) {
-      lv_label_set_text_fmt(s_ota_status_label, u8"최신 버전입니다\n(v%s)", FIRMWARE_VERSION);
-    }
-    // 3초 후 자동 닫기
-    lv_timer_t* close_timer = lv_timer_create([](lv_timer_t* t){ 
-      close_ota_popup(); 
+  // 확인/다운로드는 ota 태스크에서 돈다. UI는 이벤트만 받아 그린다.
+  if (!ota_start_update()) {
+    ota_set_status(u8"업데이트 실패");
+    lv_timer_t* close_timer = lv_timer_create([](lv_timer_t* t){
+      close_ota_popup();
       lv_timer_del(t);
     }, 3000, NULL);
     lv_timer_set_repeat_count(close_timer, 1);
-    fw_watchdog_resume();
     return;
   }
-  
-  if (s_ota_status_label && lv_obj_is_valid(s_ota_status_label)) {
-    lv_label_set_text_fmt(s_ota_status_label, u8"v%s → v%s", FIRMWARE_VERSION, latestVersion.c_str());
-  }
-  
-  // OTA 업데이트 시작
-  bool success = performOtaUpdate(downloadUrl, ota_progress_callback);
-  if (!success) {
-    if (s_ota_status_label && lv_obj_is_valid(s_ota_status_label)) {
-      lv_label_set_text(s_ota_status_label, u8"업데이트 실패");
-    }
-    // 3초 후 자동 닫기
-    lv_timer_t* close_timer = lv_timer_create([](lv_timer_t* t){ 
-      close_ota_popup(); 
-      lv_timer_del(t);
-    }, 3000, NULL);
-    lv_timer_set_repeat_count(close_timer, 1);
-    fw_watchdog_resume();
-  }
-  // 성공 시 자동 재부팅
+  ui_sched_add(ota_event_timer_cb, 100, nullptr, "ota");
 }
 
 static void show_brightness_popup(void) {
@@ -3504,7 +3569,7 @@ static void update_hub_battery(void) {
   lv_obj_set_style_img_recolor_opa(bat_img, LV_OPA_COVER, 0);
 }
 
-static void hub_clock_timer_cb(lv_timer_t* timer) {
+static void hub_clock_timer_cb(UiSchedTask* timer) {
   (void)timer;
   if (s_hub_clock_label && lv_obj_is_valid(s_hub_clock_label)) {
     struct tm ti;
@@ -3594,6 +3659,7 @@ void ui_port_update_students(const JsonArray& students) {
     // 학생 리스트 모드가 아니면 학생 목록 갱신은 무시
     return;
   }
+  lvgl_mem_mark_screen("students");
   if (s_pin_page && lv_obj_is_valid(s_pin_page)) {
     // PIN 입력 중 목록 전체를 다시 그리면 그동안 터치 입력이 밀린다.
     // 갱신은 PIN 화면을 닫은 뒤 새 목록을 받아 반영한다.
@@ -3659,7 +3725,7 @@ void ui_port_update_students(const JsonArray& students) {
     if (meta.length() > 0) {
       lv_obj_t* meta_lbl = lv_label_create(card);
       lv_obj_set_style_text_color(meta_lbl, lv_color_hex(0xA0A0A0), 0);
-      lv_obj_set_style_text_font(meta_lbl, &kakao_kr_16, 0);
+      ui_theme_add(meta_lbl, UI_STYLE_TEXT_BODY);
       lv_label_set_text(meta_lbl, meta.c_str());
       lv_obj_align(meta_lbl, LV_ALIGN_RIGHT_MID, -6, -14);
     }
@@ -3668,7 +3734,7 @@ void ui_port_update_students(const JsonArray& students) {
       snprintf(time_buf, sizeof(time_buf), "%d:%02d %s", sh, sm, u8"수업");
       lv_obj_t* time_lbl = lv_label_create(card);
       lv_obj_set_style_text_color(time_lbl, lv_color_hex(0x707070), 0);
-      lv_obj_set_style_text_font(time_lbl, &kakao_kr_16, 0);
+      ui_theme_add(time_lbl, UI_STYLE_TEXT_BODY);
       lv_label_set_text(time_lbl, time_buf);
       lv_obj_align(time_lbl, LV_ALIGN_RIGHT_MID, -6, 12);
     }
@@ -3709,110 +3775,6 @@ static const uint32_t HOMEWORK_UPDATE_DEBOUNCE_MS = 0;
 static uint32_t s_last_card_click_ms = 0;
 static const uint32_t CARD_CLICK_DEBOUNCE_MS = 500;
 
-static void extract_content_marker_value(const char* content, const char* marker, char* out, size_t out_sz) {
-  if (!out || out_sz == 0) return;
-  out[0] = '\0';
-  if (!content || !*content || !marker || !*marker) return;
-  const char* pos = strstr(content, marker);
-  if (!pos) return;
-  const char* start = pos + strlen(marker);
-  while (*start == ' ' || *start == '\t') start++;
-  const char* end = strchr(start, '\n');
-  size_t len = end ? (size_t)(end - start) : strlen(start);
-  while (len > 0 && (start[len - 1] == ' ' || start[len - 1] == '\r' || start[len - 1] == '\t')) len--;
-  if (len > out_sz - 1) len = out_sz - 1;
-  memcpy(out, start, len);
-  out[len] = '\0';
-}
-
-// 과정명 약어: 공통수학1→공수1, 미적분2→미적2, 확률과 통계→확통 등
-static void abbreviate_course(char* buf, size_t buf_sz) {
-  if (!buf || !buf[0]) return;
-  static const char* const kFull[] = {
-    u8"공통수학1", u8"공통수학2", u8"미적분1", u8"미적분2", u8"확률과 통계", u8"확률과통계"
-  };
-  static const char* const kAbbr[] = {
-    u8"공수1", u8"공수2", u8"미적1", u8"미적2", u8"확통", u8"확통"
-  };
-  for (size_t i = 0; i < sizeof(kFull) / sizeof(kFull[0]); ++i) {
-    if (strcmp(buf, kFull[i]) == 0) {
-      strncpy(buf, kAbbr[i], buf_sz - 1);
-      buf[buf_sz - 1] = '\0';
-      return;
-    }
-  }
-}
-
-static void extract_book_name(const char* content, const char* title, const char* book_id, const char* grade_label, const char* hw_type, bool is_naesin, char* out, size_t out_sz) {
-  (void)hw_type;
-  out[0] = '\0';
-  char book_buf[96] = {0};
-  char course_buf[32] = {0};
-  const bool has_linked_book = (book_id && *book_id);
-
-  // 과정: grade_label 우선 → content "과정:" → title "·" 뒤
-  if (grade_label && *grade_label) {
-    strncpy(course_buf, grade_label, sizeof(course_buf) - 1);
-    course_buf[sizeof(course_buf) - 1] = '\0';
-  } else {
-    extract_content_marker_value(content, u8"과정:", course_buf, sizeof(course_buf));
-  }
-  if (!course_buf[0] && title && *title) {
-    const char* dot = strstr(title, u8"·");
-    if (dot) {
-      const char* start = dot + strlen(u8"·");
-      while (*start == ' ' || *start == '\t') start++;
-      size_t len = strlen(start);
-      while (len > 0 && (start[len - 1] == ' ' || start[len - 1] == '\t')) len--;
-      if (len > sizeof(course_buf) - 1) len = sizeof(course_buf) - 1;
-      memcpy(course_buf, start, len);
-      course_buf[len] = '\0';
-    }
-  }
-  abbreviate_course(course_buf, sizeof(course_buf));
-
-  // 교재명: 내신기출이면 "내신기출"; 연결된 교재가 없는 문제은행이면 생략.
-  if (is_naesin) {
-    strncpy(book_buf, u8"내신기출", sizeof(book_buf) - 1);
-    book_buf[sizeof(book_buf) - 1] = '\0';
-  } else if (has_linked_book) {
-    extract_content_marker_value(content, u8"교재:", book_buf, sizeof(book_buf));
-    if (!book_buf[0] && title && *title) {
-      const char* dot = strstr(title, u8"·");
-      if (dot) {
-        size_t len = (size_t)(dot - title);
-        while (len > 0 && (title[len - 1] == ' ' || title[len - 1] == '\t')) len--;
-        if (len > sizeof(book_buf) - 1) len = sizeof(book_buf) - 1;
-        memcpy(book_buf, title, len);
-        book_buf[len] = '\0';
-      }
-    }
-  }
-  // else(연결 교재 없음): 교재명 생략
-
-  // 최종 1열: "교재명 · 과정"
-  if (book_buf[0] && course_buf[0]) {
-    if (strstr(book_buf, course_buf)) {
-      strncpy(out, book_buf, out_sz - 1);
-      out[out_sz - 1] = '\0';
-    } else {
-      snprintf(out, out_sz, "%s · %s", book_buf, course_buf);
-    }
-    return;
-  }
-  if (book_buf[0]) {
-    strncpy(out, book_buf, out_sz - 1);
-    out[out_sz - 1] = '\0';
-    return;
-  }
-  if (course_buf[0]) {
-    strncpy(out, course_buf, out_sz - 1);
-    out[out_sz - 1] = '\0';
-    return;
-  }
-  // 비워둠: 연결 교재 없는 문제은행은 1열 교재명 생략(호출부에서 상황에 따라 보완)
-}
-
 static void fmt_time_static(int secs, char* buf, size_t sz) {
   int h = secs / 3600; int m = (secs % 3600) / 60;
   if (h > 0) snprintf(buf, sz, "%dh %dm", h, m);
@@ -3826,55 +3788,6 @@ static void fmt_time_hms(int secs, char* buf, size_t sz) {
   else snprintf(buf, sz, "%ds", s);
 }
 
-static int64_t days_from_civil_utc(int y, unsigned m, unsigned d) {
-  y -= (m <= 2) ? 1 : 0;
-  const int era = (y >= 0 ? y : y - 399) / 400;
-  const unsigned yoe = (unsigned)(y - era * 400);                       // [0, 399]
-  const int mp = (int)m + (m > 2 ? -3 : 9);
-  const unsigned doy = (153u * (unsigned)mp + 2) / 5 + d - 1; // [0, 365]
-  const unsigned doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;        // [0, 146096]
-  return (int64_t)era * 146097 + (int64_t)doe - 719468;                 // days since 1970-01-01
-}
-
-static int64_t parse_iso8601_epoch(const char* iso) {
-  if (!iso || !*iso) return 0;
-  int y = 0, mon = 0, day = 0, hh = 0, mm = 0, ss = 0;
-  int n = 0;
-  if (sscanf(iso, "%4d-%2d-%2dT%2d:%2d:%2d%n", &y, &mon, &day, &hh, &mm, &ss, &n) < 6) {
-    return 0;
-  }
-
-  const char* p = iso + n;
-  if (*p == '.') {
-    p++;
-    while (*p && isdigit((unsigned char)*p)) p++;
-  }
-
-  int tz_sign = 0;
-  int tz_h = 0;
-  int tz_m = 0;
-  if (*p == '+' || *p == '-') {
-    tz_sign = (*p == '-') ? -1 : 1;
-    p++;
-    if (isdigit((unsigned char)p[0]) && isdigit((unsigned char)p[1])) {
-      tz_h = (p[0] - '0') * 10 + (p[1] - '0');
-      p += 2;
-    }
-    if (*p == ':') p++;
-    if (isdigit((unsigned char)p[0]) && isdigit((unsigned char)p[1])) {
-      tz_m = (p[0] - '0') * 10 + (p[1] - '0');
-    }
-  }
-
-  int64_t epoch =
-      days_from_civil_utc(y, (unsigned)mon, (unsigned)day) * 86400LL +
-      (int64_t)hh * 3600LL + (int64_t)mm * 60LL + (int64_t)ss;
-  if (tz_sign != 0) {
-    epoch -= (int64_t)tz_sign * ((int64_t)tz_h * 3600LL + (int64_t)tz_m * 60LL);
-  }
-  return epoch;
-}
-
 static void fmt_time_cycle_clock(int secs, char* buf, size_t sz) {
   if (secs < 0) secs = 0;
   int h = secs / 3600;
@@ -3932,11 +3845,10 @@ static inline bool hw_is_homework_group(const HwGroupData& g) {
 //  - 메인(1·2번) 과제: 숫자 "1"/"2"
 //  - 그 외 대기 과제: "대기"
 static const lv_coord_t HW_RING_D = 46;       // 원 지름 (1~2번째 줄에 걸침)
-static void create_hw_phase_indicator(lv_obj_t* card, const HwGroupData& g, int display_idx, uint32_t srv_color) {
-  extern const lv_font_t kakao_kr_16;
-  const bool homework = hw_is_homework_group(g);
-  const int active_step = homework ? 0 : hw_phase_indicator_step(g.phase, g.pending_complete);
+static void apply_hw_phase_indicator(lv_obj_t* arc, lv_obj_t* cl, const HwGroupData& g, int display_idx, uint32_t srv_color);
 
+static lv_obj_t* create_hw_phase_indicator(lv_obj_t* card, lv_obj_t** out_center, uint32_t srv_color) {
+  extern const lv_font_t kakao_kr_16;
   lv_obj_t* arc = lv_arc_create(card);
   lv_obj_set_size(arc, HW_RING_D, HW_RING_D);
   lv_obj_align(arc, LV_ALIGN_TOP_RIGHT, 0, 4);
@@ -3953,6 +3865,19 @@ static void create_hw_phase_indicator(lv_obj_t* card, const HwGroupData& g, int
   lv_obj_set_style_bg_opa(arc, LV_OPA_TRANSP, LV_PART_KNOB);
   lv_obj_set_style_pad_all(arc, 0, LV_PART_KNOB);
   lv_obj_set_style_bg_opa(arc, LV_OPA_TRANSP, LV_PART_MAIN);
+
+  lv_obj_t* cl = lv_label_create(arc);
+  ui_theme_add(cl, UI_STYLE_TEXT_BODY);
+  lv_obj_set_style_text_align(cl, LV_TEXT_ALIGN_CENTER, 0);
+  lv_obj_add_flag(cl, LV_OBJ_FLAG_EVENT_BUBBLE);
+  *out_center = cl;
+  return arc;
+}
+
+// 진행 채움과 가운데 라벨만 다시 칠한다(카드 제자리 갱신에서도 호출).
+static void apply_hw_phase_indicator(lv_obj_t* arc, lv_obj_t* cl, const HwGroupData& g, int display_idx, uint32_t srv_color) {
+  const bool homework = hw_is_homework_group(g);
+  const int active_step = homework ? 0 : hw_phase_indicator_step(g.phase, g.pending_complete);
   // 진행 채움 (빈틈 없이 연속): 12시에서 시계방향으로 step/4 (확인=4/4 전체)
   if (active_step <= 0) {
     lv_arc_set_angles(arc, 0, 0);
@@ -3974,12 +3899,8 @@ static void create_hw_phase_indicator(lv_obj_t* card, const HwGroupData& g, int
     snprintf(center, sizeof(center), u8"대기");
     center_color = 0x8A8A8A;
   }
-  lv_obj_t* cl = lv_label_create(arc);
-  lv_obj_set_style_text_font(cl, &kakao_kr_16, 0);
   lv_obj_set_style_text_color(cl, lv_color_hex(center_color), 0);
-  lv_obj_set_style_text_align(cl, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_add_flag(cl, LV_OBJ_FLAG_EVENT_BUBBLE);
-  lv_label_set_text(cl, center);
+  hw_label_set_text_if_changed(cl, center);
   lv_obj_center(cl);
 }
 
@@ -4034,31 +3955,21 @@ void show_main_first_popup(int group_idx) {
   s_main_first_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_main_first_popup, 276, 152);
   lv_obj_center(s_main_first_popup);
-  lv_obj_set_style_bg_color(s_main_first_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_main_first_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_main_first_popup, 1, 0);
-  lv_obj_set_style_border_color(s_main_first_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_main_first_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_main_first_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_main_first_popup, 10, 0);
+  ui_theme_add(s_main_first_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_main_first_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_main_first_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_main_first_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_main_first_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   lv_label_set_text(msg, u8"메인 과제를 먼저 하세요.");
 
   lv_obj_t* row = lv_obj_create(s_main_first_popup);
   lv_obj_set_width(row, lv_pct(100));
   lv_obj_set_height(row, 50);
-  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(row, 0, 0);
-  lv_obj_set_style_pad_all(row, 0, 0);
+  ui_theme_add(row, UI_STYLE_BARE);
   lv_obj_set_style_pad_column(row, 12, 0);
   lv_obj_set_scrollbar_mode(row, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
@@ -4067,22 +3978,18 @@ void show_main_first_popup(int group_idx) {
 
   lv_obj_t* cancel_btn = lv_btn_create(row);
   lv_obj_set_size(cancel_btn, 118, 40);
-  lv_obj_set_style_radius(cancel_btn, 10, 0);
-  lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(cancel_btn, 0, 0);
+  ui_theme_add(cancel_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* cancel_lbl = lv_label_create(cancel_btn);
-  lv_obj_set_style_text_font(cancel_lbl, &kakao_kr_16, 0);
+  ui_theme_add(cancel_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(cancel_lbl, u8"취소");
   lv_obj_center(cancel_lbl);
   lv_obj_add_event_cb(cancel_btn, [](lv_event_t* e){ (void)e; close_main_first_popup(); }, LV_EVENT_CLICKED, NULL);
 
   lv_obj_t* go_btn = lv_btn_create(row);
   lv_obj_set_size(go_btn, 118, 40);
-  lv_obj_set_style_radius(go_btn, 10, 0);
-  lv_obj_set_style_bg_color(go_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(go_btn, 0, 0);
+  ui_theme_add(go_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* go_lbl = lv_label_create(go_btn);
-  lv_obj_set_style_text_font(go_lbl, &kakao_kr_16, 0);
+  ui_theme_add(go_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(go_lbl, u8"진행");
   lv_obj_center(go_lbl);
   lv_obj_add_event_cb(go_btn, [](lv_event_t* e){
@@ -4103,32 +4010,22 @@ void show_homework_check_first_popup(void) {
   s_hw_check_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_hw_check_popup, 276, 152);
   lv_obj_center(s_hw_check_popup);
-  lv_obj_set_style_bg_color(s_hw_check_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_hw_check_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_hw_check_popup, 1, 0);
-  lv_obj_set_style_border_color(s_hw_check_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_hw_check_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_hw_check_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_hw_check_popup, 10, 0);
+  ui_theme_add(s_hw_check_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_hw_check_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_hw_check_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_hw_check_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
 
   lv_obj_t* msg = lv_label_create(s_hw_check_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   lv_label_set_text(msg, u8"숙제 검사를 먼저 받으세요.");
 
   lv_obj_t* close_btn = lv_btn_create(s_hw_check_popup);
   lv_obj_set_size(close_btn, 140, 40);
-  lv_obj_set_style_radius(close_btn, 10, 0);
-  lv_obj_set_style_bg_color(close_btn, lv_color_hex(0x323232), 0);
-  lv_obj_set_style_border_width(close_btn, 0, 0);
+  ui_theme_add(close_btn, UI_STYLE_BTN_SECONDARY);
   lv_obj_t* close_lbl = lv_label_create(close_btn);
-  lv_obj_set_style_text_font(close_lbl, &kakao_kr_16, 0);
+  ui_theme_add(close_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(close_lbl, u8"닫기");
   lv_obj_center(close_lbl);
   lv_obj_add_event_cb(close_btn, [](lv_event_t* e){ (void)e; close_homework_check_first_popup(); }, LV_EVENT_CLICKED, NULL);
@@ -4136,56 +4033,50 @@ void show_homework_check_first_popup(void) {
   screensaver_attach_activity(s_hw_check_popup);
 }
 
-static lv_obj_t* create_hw_card(lv_obj_t* parent, int group_idx) {
-  extern const lv_font_t kakao_kr_16;
-  if (group_idx < 0 || group_idx >= s_group_cnt) return nullptr;
+static void hw_card_clear_emphasis(lv_obj_t* card) {
+  lv_obj_remove_local_style_prop(card, LV_STYLE_BG_COLOR, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_OUTLINE_COLOR, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_OUTLINE_WIDTH, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_OUTLINE_PAD, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_OUTLINE_OPA, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_SHADOW_WIDTH, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_SHADOW_COLOR, 0);
+  lv_obj_remove_local_style_prop(card, LV_STYLE_SHADOW_OPA, 0);
+}
+
+// 카드 내용(제목·링·2열·3열·phase 강조)을 s_groups[group_idx]에 맞춘다.
+// 새 카드와 제자리 갱신이 같은 경로를 타므로 두 경우의 모양이 같다.
+static void apply_hw_card(int group_idx) {
+  if (group_idx < 0 || group_idx >= s_group_cnt) return;
+  HwCardRefs& r = s_hw_cards[group_idx];
+  if (!r.card || !lv_obj_is_valid(r.card)) return;
   HwGroupData& g = s_groups[group_idx];
-  int phase = g.phase;
+  const int phase = g.phase;
   static const uint32_t srv_color = 0x33A373;
-
-  lv_obj_t* card = lv_obj_create(parent);
-  lv_obj_set_width(card, lv_pct(100));
-  lv_obj_set_height(card, 101);  // +2pt 추가 (1·2줄 사이 간격 확보)
-  lv_obj_set_style_radius(card, 20, 0);
-  lv_obj_set_style_bg_color(card, lv_color_hex(0x1A1A1A), 0);
-  lv_obj_set_style_border_color(card, lv_color_hex(0x2C2C2C), 0);
-  lv_obj_set_style_border_width(card, 1, 0);
-  lv_obj_set_style_pad_top(card, 9, 0);
-  lv_obj_set_style_pad_bottom(card, 7, 0);
-  lv_obj_set_style_pad_left(card, 22, 0);
-  lv_obj_set_style_pad_right(card, 22, 0);
-  lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
-  lv_obj_add_flag(card, LV_OBJ_FLAG_CLICKABLE);
-  lv_obj_add_flag(card, LV_OBJ_FLAG_EVENT_BUBBLE);
-
   const bool is_test_card = hw_should_treat_as_test(g);
 
   // 1열 좌: 내신기출/교재명; 테스트(비내신)는 「테스트」(24pt). 연결 교재 없으면 비어있을 수 있음.
-  lv_obj_t* title_lbl = lv_label_create(card);
-  lv_obj_set_style_text_font(title_lbl, &kakao_kr_24, 0);
-  lv_obj_set_style_text_color(title_lbl, lv_color_hex(0xE6E6E6), 0);
-  lv_label_set_text(title_lbl, (is_test_card && !g.is_naesin) ? u8"테스트" : g.book_name);
-  lv_label_set_long_mode(title_lbl, LV_LABEL_LONG_DOT);
-  lv_obj_set_width(title_lbl, 168);
-  lv_obj_align(title_lbl, LV_ALIGN_TOP_LEFT, 0, 3);
-  lv_obj_add_flag(title_lbl, LV_OBJ_FLAG_EVENT_BUBBLE);
-  create_hw_phase_indicator(card, g, group_idx, srv_color);
+  hw_label_set_text_if_changed(r.title, (is_test_card && !g.is_naesin) ? u8"테스트" : g.book_name);
+  apply_hw_phase_indicator(r.arc, r.ring_lbl, g, group_idx, srv_color);
 
   // phase별 카드 강조 스타일
+  // 기본 모양은 UI_STYLE_CARD. 강조는 로컬 스타일로 덮고, 풀 때는 로컬 값을 지워 테마로 돌아간다.
+  if (r.data) r.data->breath = (phase == 4);
+  hw_card_clear_emphasis(r.card);
   if (phase == 2) {
-    lv_obj_set_style_outline_color(card, lv_color_hex(srv_color), 0);
-    lv_obj_set_style_outline_width(card, 2, 0);
-    lv_obj_set_style_outline_pad(card, 1, 0);
-    lv_obj_set_style_shadow_width(card, 10, 0);
-    lv_obj_set_style_shadow_color(card, lv_color_hex(srv_color), 0);
-    lv_obj_set_style_shadow_opa(card, LV_OPA_20, 0);
+    lv_obj_set_style_outline_color(r.card, lv_color_hex(srv_color), 0);
+    lv_obj_set_style_outline_width(r.card, 2, 0);
+    lv_obj_set_style_outline_pad(r.card, 1, 0);
+    lv_obj_set_style_shadow_width(r.card, 10, 0);
+    lv_obj_set_style_shadow_color(r.card, lv_color_hex(srv_color), 0);
+    lv_obj_set_style_shadow_opa(r.card, LV_OPA_20, 0);
   } else if (phase == 4) {
-    lv_obj_set_style_bg_color(card, lv_color_hex(0x303030), 0);
-    lv_obj_set_style_outline_color(card, lv_color_hex(srv_color), 0);
-    lv_obj_set_style_outline_width(card, 2, 0);
-    lv_obj_set_style_outline_pad(card, 1, 0);
-    lv_obj_set_style_outline_opa(card, LV_OPA_TRANSP, 0);
-    if (s_p4_cnt < 8) { s_p4_cards[s_p4_cnt] = card; s_p4_colors[s_p4_cnt] = srv_color; s_p4_cnt++; }
+    lv_obj_set_style_bg_color(r.card, lv_color_hex(0x303030), 0);
+    lv_obj_set_style_outline_color(r.card, lv_color_hex(srv_color), 0);
+    lv_obj_set_style_outline_width(r.card, 2, 0);
+    lv_obj_set_style_outline_pad(r.card, 1, 0);
+    // 테두리는 숨쉬기 opa로 DRAW_POST에서 그린다(hw_card_breath_event_cb).
+    lv_obj_set_style_outline_opa(r.card, LV_OPA_TRANSP, 0);
   }
 
   // 3열 문자열: 유형(교재/프린트/문제집) + 페이지 + 문항수
@@ -4205,68 +4096,97 @@ static lv_obj_t* create_hw_card(lv_obj_t* parent, int group_idx) {
 
   // 2열: 제출(phase 3) = 이번 회차 수행시간(총 시간 아님); 그 외(대기/수행/확인) = 그룹 과제명
   bool line2_used_pagecount = false;
+  bool line2_visible = true;
   if (phase == 3) {
     int cyc = (int)g.cycle_elapsed; if (cyc < 0) cyc = 0;
     char tb[32]; fmt_time_hms(cyc, tb, sizeof(tb));
     char l2buf[64];
     snprintf(l2buf, sizeof(l2buf), u8"%s 걸림 · 채점중", tb);
-    lv_obj_t* l2 = lv_label_create(card);
-    lv_obj_set_style_text_font(l2, &kakao_kr_16, 0);
-    lv_obj_set_style_text_color(l2, lv_color_hex(srv_color), 0);
-    lv_label_set_text(l2, l2buf);
-    lv_label_set_long_mode(l2, LV_LABEL_LONG_DOT);
-    lv_obj_set_width(l2, 214);
-    lv_obj_align(l2, LV_ALIGN_TOP_LEFT, 0, 44);
-    lv_obj_add_flag(l2, LV_OBJ_FLAG_EVENT_BUBBLE);
+    lv_obj_set_style_text_color(r.line2, lv_color_hex(srv_color), 0);
+    hw_label_set_text_if_changed(r.line2, l2buf);
   } else {
     const char* nm = g.group_title[0] ? g.group_title : page_count_buf;
     if (nm[0]) {
-      lv_obj_t* l2 = lv_label_create(card);
-      lv_obj_set_style_text_font(l2, &kakao_kr_16, 0);
-      lv_obj_set_style_text_color(l2, lv_color_hex(0x9A9A9A), 0);
-      lv_label_set_text(l2, nm);
-      lv_label_set_long_mode(l2, LV_LABEL_LONG_DOT);
-      // 원형 인디케이터 직전까지 최대한 길게 (줄바꿈 없이 말줄임)
-      lv_obj_set_width(l2, 214);
-      lv_obj_align(l2, LV_ALIGN_TOP_LEFT, 0, 44);
-      lv_obj_add_flag(l2, LV_OBJ_FLAG_EVENT_BUBBLE);
+      lv_obj_set_style_text_color(r.line2, lv_color_hex(0x9A9A9A), 0);
+      hw_label_set_text_if_changed(r.line2, nm);
       if (!g.group_title[0]) line2_used_pagecount = true;  // 폴백으로 page_count 사용 → 3열 중복 방지
+    } else {
+      line2_visible = false;
     }
   }
+  if (line2_visible) lv_obj_clear_flag(r.line2, LV_OBJ_FLAG_HIDDEN);
+  else lv_obj_add_flag(r.line2, LV_OBJ_FLAG_HIDDEN);
 
   // 3열: 유형+페이지·문항 정보 — 오른쪽 정렬 (원 아래라 전체 폭 사용 가능)
   if (page_count_buf[0] && !line2_used_pagecount) {
-    lv_obj_t* l3 = lv_label_create(card);
-    lv_obj_set_style_text_font(l3, &kakao_kr_16, 0);
-    lv_obj_set_style_text_color(l3, lv_color_hex(0x707070), 0);
-    lv_label_set_text(l3, page_count_buf);
-    lv_label_set_long_mode(l3, LV_LABEL_LONG_DOT);
-    lv_obj_set_width(l3, 272);
-    lv_obj_set_style_text_align(l3, LV_TEXT_ALIGN_RIGHT, 0);
-    lv_obj_align(l3, LV_ALIGN_TOP_RIGHT, 0, 64);
-    lv_obj_add_flag(l3, LV_OBJ_FLAG_EVENT_BUBBLE);
+    hw_label_set_text_if_changed(r.line3, page_count_buf);
+    lv_obj_clear_flag(r.line3, LV_OBJ_FLAG_HIDDEN);
+  } else {
+    lv_obj_add_flag(r.line3, LV_OBJ_FLAG_HIDDEN);
+  }
+
+  if (r.data) {
+    r.data->group_idx = group_idx;
+    strncpy(r.data->group_id, g.group_id, sizeof(r.data->group_id)-1);
+    r.data->group_id[sizeof(r.data->group_id)-1] = '\0';
+    r.data->phase = phase;
+    r.data->is_homework = g.is_homework;
   }
+}
+
+static lv_obj_t* create_hw_card(lv_obj_t* parent, int group_idx) {
+  if (group_idx < 0 || group_idx >= s_group_cnt) return nullptr;
+  static const uint32_t srv_color = 0x33A373;
+  HwCardRefs& r = s_hw_cards[group_idx];
+  memset(&r, 0, sizeof(r));
+
+  lv_obj_t* card = lv_obj_create(parent);
+  lv_obj_set_width(card, lv_pct(100));
+  lv_obj_set_height(card, 101);  // +2pt 추가 (1·2줄 사이 간격 확보)
+  ui_theme_add(card, UI_STYLE_CARD);
+  lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_flag(card, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_flag(card, LV_OBJ_FLAG_EVENT_BUBBLE);
+  r.card = card;
+
+  lv_obj_t* title_lbl = lv_label_create(card);
+  ui_theme_add(title_lbl, UI_STYLE_TEXT_TITLE);
+  lv_label_set_long_mode(title_lbl, LV_LABEL_LONG_DOT);
+  lv_obj_set_width(title_lbl, 168);
+  lv_obj_align(title_lbl, LV_ALIGN_TOP_LEFT, 0, 3);
+  lv_obj_add_flag(title_lbl, LV_OBJ_FLAG_EVENT_BUBBLE);
+  r.title = title_lbl;
+  r.arc = create_hw_phase_indicator(card, &r.ring_lbl, srv_color);
+
+  // 2열/3열은 항상 만들어 두고 내용이 없으면 숨긴다(제자리 갱신 때 생성/삭제 없이 토글).
+  lv_obj_t* l2 = lv_label_create(card);
+  ui_theme_add(l2, UI_STYLE_TEXT_BODY);
+  lv_label_set_long_mode(l2, LV_LABEL_LONG_DOT);
+  // 원형 인디케이터 직전까지 최대한 길게 (줄바꿈 없이 말줄임)
+  lv_obj_set_width(l2, 214);
+  lv_obj_align(l2, LV_ALIGN_TOP_LEFT, 0, 44);
+  lv_obj_add_flag(l2, LV_OBJ_FLAG_EVENT_BUBBLE);
+  r.line2 = l2;
+
+  lv_obj_t* l3 = lv_label_create(card);
+  ui_theme_add(l3, UI_STYLE_TEXT_DIM);
+  lv_label_set_long_mode(l3, LV_LABEL_LONG_DOT);
+  lv_obj_set_width(l3, 272);
+  lv_obj_set_style_text_align(l3, LV_TEXT_ALIGN_RIGHT, 0);
+  lv_obj_align(l3, LV_ALIGN_TOP_RIGHT, 0, 64);
+  lv_obj_add_flag(l3, LV_OBJ_FLAG_EVENT_BUBBLE);
+  r.line3 = l3;
 
   // 클릭 핸들러
-  struct HwCardData {
-    int group_idx;
-    char group_id[40];
-    int phase;
-    bool is_homework;
-    lv_coord_t press_x;
-    lv_coord_t press_y;
-    bool dragged;
-  };
   HwCardData* d = (HwCardData*)malloc(sizeof(HwCardData));
   if (d) {
-    d->group_idx = group_idx;
-    strncpy(d->group_id, g.group_id, sizeof(d->group_id)-1);
-    d->group_id[sizeof(d->group_id)-1] = '\0';
-    d->phase = phase;
-    d->is_homework = g.is_homework;
     d->press_x = 0;
     d->press_y = 0;
     d->dragged = false;
+    d->breath = false;
+    r.data = d;
+    lv_obj_add_event_cb(card, hw_card_breath_event_cb, LV_EVENT_REFR_EXT_DRAW_SIZE, d);
+    lv_obj_add_event_cb(card, hw_card_breath_event_cb, LV_EVENT_DRAW_POST, d);
     lv_obj_add_event_cb(card, [](lv_event_t* e){
       HwCardData* dd = (HwCardData*)lv_event_get_user_data(e);
       if (!dd) return;
@@ -4316,17 +4236,23 @@ static lv_obj_t* create_hw_card(lv_obj_t* parent, int group_idx) {
       hw_perform_card_action(dd->group_idx);
     }, LV_EVENT_CLICKED, d);
     lv_obj_add_event_cb(card, [](lv_event_t* e){
-      if (lv_event_get_code(e) == LV_EVENT_DELETE) { void* ud = lv_event_get_user_data(e); if (ud) free(ud); }
+      if (lv_event_get_code(e) != LV_EVENT_DELETE) return;
+      HwCardData* dd = (HwCardData*)lv_event_get_user_data(e);
+      if (!dd) return;
+      if (dd->group_idx >= 0 && dd->group_idx < HW_MAX_GROUPS && s_hw_cards[dd->group_idx].data == dd) {
+        memset(&s_hw_cards[dd->group_idx], 0, sizeof(HwCardRefs));
+      }
+      free(dd);
     }, LV_EVENT_DELETE, d);
   }
+  apply_hw_card(group_idx);
   return card;
 }
 
 static void restart_hw_timer() {
   if (s_p2_cnt > 0 || s_p4_cnt > 0) {
     uint32_t interval = s_p4_cnt > 0 ? 100 : 1000;
-    s_hw_global_timer = lv_timer_create(hw_global_timer_cb, interval, (void*)(uintptr_t)s_hw_timer_epoch);
-    lv_timer_set_repeat_count(s_hw_global_timer, -1);
+    s_hw_global_timer = ui_sched_add(hw_global_timer_cb, interval, (void*)(uintptr_t)s_hw_timer_epoch, "hw");
   }
 }
 
@@ -4416,132 +4342,100 @@ static void hw_apply_display_anchors_after_parse(const HwDisplayAnchorSnap* snap
   }
 }
 
-static void parse_groups_from_json(const JsonArray& groups) {
+// 스트리밍 디코더가 채워 둔 프레임을 그대로 옮긴다(정렬·book_name 계산은 디코더에서 끝남).
+// 표시 앵커 필드는 직후 hw_apply_display_anchors_after_parse()가 다시 채운다.
+static void load_groups_from_frame(const HwSyncFrame& frame) {
   if (!ensure_hw_groups_allocated()) return;
-  s_group_cnt = 0;
-  for (JsonObject grp : groups) {
-    if (s_group_cnt >= HW_MAX_GROUPS) break;
-    HwGroupData& g = s_groups[s_group_cnt];
-    const char* gid = grp["group_id"] | "";
-    strncpy(g.group_id, gid, sizeof(g.group_id)-1); g.group_id[sizeof(g.group_id)-1] = '\0';
-    const char* gt = grp["group_title"] | u8"과제 그룹";
-    strncpy(g.group_title, gt, sizeof(g.group_title)-1); g.group_title[sizeof(g.group_title)-1] = '\0';
-    const char* ps = grp["page_summary"] | "";
-    strncpy(g.page_summary, ps, sizeof(g.page_summary)-1); g.page_summary[sizeof(g.page_summary)-1] = '\0';
-    g.order_index = grp.containsKey("order_index") ? (int)grp["order_index"] : (int)s_group_cnt;
-    g.is_homework = grp["is_homework"] | false;
-    g.is_test = grp["is_test"] | false;
-    g.is_naesin = grp["is_naesin"] | false;
-    g.pending_complete = grp["pending_complete"] | false;
-    g.phase = grp.containsKey("phase") ? (int)grp["phase"] : 1;
-    g.accumulated = grp.containsKey("accumulated") ? (int)grp["accumulated"] : 0;
-    g.cycle_elapsed = grp.containsKey("cycle_elapsed") ? (int)grp["cycle_elapsed"] : 0;
-    g.check_count = grp.containsKey("check_count") ? (int)grp["check_count"] : 0;
-    g.total_count = grp.containsKey("total_count") ? (int)grp["total_count"] : 0;
-    g.time_limit_minutes = 0;
-    if (grp.containsKey("time_limit_minutes") && !grp["time_limit_minutes"].isNull()) {
-      int tlm = (int)grp["time_limit_minutes"];
-      if (tlm < 0) tlm = 0;
-      if (tlm > 24 * 60) tlm = 24 * 60;
-      g.time_limit_minutes = (int16_t)tlm;
-    }
-    g.color = 0x1E88E5;
-    if (grp.containsKey("color")) { double v = grp["color"]; if (v > 0) g.color = ((uint32_t)v) & 0xFFFFFFu; }
-    g.run_start_epoch = 0;
-    if (grp.containsKey("run_start") && !grp["run_start"].isNull()) {
-      const char* rs = grp["run_start"] | "";
-      if (*rs) {
-        g.run_start_epoch = parse_iso8601_epoch(rs);
-      }
-    }
-    const char* content = grp["content"] | "";
-    const char* hw_type = grp["type"] | "";
-    strncpy(g.item_type, hw_type, sizeof(g.item_type) - 1);
-    g.item_type[sizeof(g.item_type) - 1] = '\0';
-    const char* book_id = grp["book_id"] | "";
-    const char* grade_label = grp["grade_label"] | "";
-    extract_book_name(content, gt, book_id, grade_label, hw_type, g.is_naesin, g.book_name, sizeof(g.book_name));
-    // 연결 교재가 있거나 내신기출인데 파싱 실패한 경우에만 그룹명으로 보완.
-    // 연결 교재 없는 문제은행은 1열 교재명을 의도적으로 비워둔다.
-    if (!g.book_name[0] && ((book_id && *book_id) || g.is_naesin)) {
-      strncpy(g.book_name, gt, sizeof(g.book_name)-1);
-      g.book_name[sizeof(g.book_name)-1] = '\0';
-    }
-
-    g.m5_wait_title[0] = '\0';
-    if (grp.containsKey("m5_wait_title") && !grp["m5_wait_title"].isNull()) {
-      const char* wt = grp["m5_wait_title"] | "";
-      if (*wt) {
-        strncpy(g.m5_wait_title, wt, sizeof(g.m5_wait_title) - 1);
-        g.m5_wait_title[sizeof(g.m5_wait_title) - 1] = '\0';
-      }
-    }
-
-    // children
-    g.child_cnt = 0;
-    if (grp.containsKey("children")) {
-      JsonArray ch = grp["children"].as<JsonArray>();
-      for (JsonObject c : ch) {
-        if (g.child_cnt >= 8) break;
-        HwChildEntry& ce = g.children[g.child_cnt];
-        const char* cid = c["item_id"] | "";
-        strncpy(ce.item_id, cid, sizeof(ce.item_id)-1); ce.item_id[sizeof(ce.item_id)-1] = '\0';
-        const char* ct = c["title"] | "";
-        strncpy(ce.title, ct, sizeof(ce.title)-1); ce.title[sizeof(ce.title)-1] = '\0';
-        const char* cp = c["page"] | "";
-        strncpy(ce.page, cp, sizeof(ce.page)-1); ce.page[sizeof(ce.page)-1] = '\0';
-        const char* cm = c["memo"] | "";
-        strncpy(ce.memo, cm, sizeof(ce.memo)-1); ce.memo[sizeof(ce.memo)-1] = '\0';
-        ce.count = c.containsKey("count") ? (int)c["count"] : 0;
-        ce.check_count = c.containsKey("check_count") ? (int)c["check_count"] : 0;
-        ce.phase = c.containsKey("phase") ? (int)c["phase"] : 1;
-        ce.accumulated = c.containsKey("accumulated") ? (int)c["accumulated"] : 0;
-        g.child_cnt++;
-      }
-    }
-    s_group_cnt++;
-  }
-  // 정렬: order_index → group_id (학습앱과 동일 순서). 숙제도 뒤로 밀지 않는다.
-  for (uint8_t i = 1; i < s_group_cnt; i++) {
-    HwGroupData key = s_groups[i];
-    int j = (int)i - 1;
-    while (j >= 0 &&
-           (s_groups[j].order_index > key.order_index ||
-            (s_groups[j].order_index == key.order_index &&
-             strcmp(s_groups[j].group_id, key.group_id) > 0))) {
-      s_groups[j + 1] = s_groups[j];
-      j--;
-    }
-    s_groups[j + 1] = key;
+  s_group_cnt = frame.group_cnt > HW_MAX_GROUPS ? HW_MAX_GROUPS : frame.group_cnt;
+  memcpy(s_groups, frame.groups, sizeof(HwGroupData) * s_group_cnt);
+  // 카드 제목(24)과 상세·대기 문구(16)의 서브셋 밖 글자를 스크롤 전에 캐시에 그려 둔다.
+  for (uint8_t i = 0; i < s_group_cnt; i++) {
+    font_fallback_warm(&kakao_kr_24, s_groups[i].book_name);
+    font_fallback_warm(&kakao_kr_24, s_groups[i].group_title);
+    font_fallback_warm(&kakao_kr_16, s_groups[i].m5_wait_title);
+  }
+}
+
+static bool hw_cache_entry_changed(const HwCacheEntry& a, const HwCacheEntry& b) {
+  return a.phase != b.phase ||
+         a.run_start_epoch != b.run_start_epoch ||
+         a.accumulated != b.accumulated || a.cycle_elapsed != b.cycle_elapsed ||
+         a.check_count != b.check_count || a.total_count != b.total_count ||
+         a.time_limit_minutes != b.time_limit_minutes ||
+         a.order_index != b.order_index ||
+         a.children_fp != b.children_fp ||
+         strcmp(a.group_title, b.group_title) != 0 ||
+         strcmp(a.page_summary, b.page_summary) != 0 ||
+         strcmp(a.book_name, b.book_name) != 0 ||
+         strcmp(a.m5_wait_title, b.m5_wait_title) != 0 ||
+         strcmp(a.item_type, b.item_type) != 0 ||
+         a.is_homework != b.is_homework ||
+         a.is_test != b.is_test ||
+         a.is_naesin != b.is_naesin ||
+         a.pending_complete != b.pending_complete;
+}
+
+// 카드에 실제로 그려지는 필드만 본다. accumulated·run_start 등 매 틱 바뀌는 값은
+// 카드에 나오지 않으므로(상세 페이지가 s_groups에서 직접 읽음) 다시 칠하지 않는다.
+// cycle_elapsed는 제출(phase 3) 카드의 2열에만 나온다.
+static bool hw_card_visual_changed(const HwCacheEntry& a, const HwCacheEntry& b) {
+  return a.phase != b.phase ||
+         a.pending_complete != b.pending_complete ||
+         a.is_homework != b.is_homework ||
+         a.is_test != b.is_test ||
+         a.is_naesin != b.is_naesin ||
+         (a.check_count <= 0) != (b.check_count <= 0) ||  // 테스트 카드 여부(hw_should_treat_as_test)
+         a.total_count != b.total_count ||
+         strcmp(a.group_title, b.group_title) != 0 ||
+         strcmp(a.page_summary, b.page_summary) != 0 ||
+         strcmp(a.book_name, b.book_name) != 0 ||
+         strcmp(a.item_type, b.item_type) != 0 ||
+         (a.phase == 3 && a.cycle_elapsed != b.cycle_elapsed);
+}
+
+// 확인(phase 4) 카드 숨쉬기 대상 목록을 현재 카드에서 다시 모은다.
+static void hw_collect_phase4_cards(void) {
+  static const uint32_t srv_color = 0x33A373;
+  s_p4_cnt = 0;
+  for (uint8_t i = 0; i < s_group_cnt && s_p4_cnt < 8; i++) {
+    if (s_groups[i].phase != 4) continue;
+    lv_obj_t* card = s_hw_cards[i].card;
+    if (!card || !lv_obj_is_valid(card)) continue;
+    s_p4_cards[s_p4_cnt] = card;
+    s_p4_colors[s_p4_cnt] = srv_color;
+    s_p4_cnt++;
   }
 }
 
-void ui_port_update_homeworks(const JsonArray& groups) {
-  if (studentId.length() == 0) return;
-  if (!ensure_hw_groups_allocated()) return;
+bool ui_port_update_homeworks(const HwSyncFrame& frame) {
+  if (studentId.length() == 0) return false;
+  if (!ensure_hw_groups_allocated()) return false;
   if (s_hw_updating) {
     s_hw_refresh_pending = true;
-    return;
+    return false;
   }
   uint32_t now = millis();
   if (HOMEWORK_UPDATE_DEBOUNCE_MS > 0 &&
-      now - s_last_homework_update_ms < HOMEWORK_UPDATE_DEBOUNCE_MS) return;
+      now - s_last_homework_update_ms < HOMEWORK_UPDATE_DEBOUNCE_MS) return false;
   s_last_homework_update_ms = now;
   s_hw_updating = true;
 
-  if (!s_homeworks_mode) build_homeworks_ui_internal();
+  if (!s_homeworks_mode) {
+    build_homeworks_ui_internal();
+    lvgl_mem_mark_screen("homeworks");
+  }
   if (!s_list || !lv_obj_is_valid(s_list) ||
       !s_waiting_list || !lv_obj_is_valid(s_waiting_list)) {
     s_hw_updating = false;
     Serial.println("[HW] ERROR: homework lists invalid");
-    return;
+    return false;
   }
 
   HwDisplayAnchorSnap anchor_snaps[HW_MAX_GROUPS];
   uint8_t anchor_snap_cnt = 0;
   hw_snapshot_display_anchors(anchor_snaps, &anchor_snap_cnt);
 
-  parse_groups_from_json(groups);
+  load_groups_from_frame(frame);
   hw_apply_display_anchors_after_parse(anchor_snaps, anchor_snap_cnt);
 
   HwCacheEntry new_cache[16];
@@ -4575,80 +4469,84 @@ void ui_port_update_homeworks(const JsonArray& groups) {
     new_cnt++;
   }
 
+  // group_id 순서가 그대로면 카드 객체를 유지하고 모양이 바뀐 카드만 다시 칠한다.
+  // 전체 재구성(lv_obj_clean + 모든 카드 생성)은 추가·삭제·순서 변경일 때만 한다.
+  const uint32_t apply_t0 = micros();
   bool need_full = (new_cnt != s_hw_cache_cnt);
+  for (uint8_t i = 0; i < new_cnt && !need_full; i++) {
+    if (strcmp(new_cache[i].id, s_hw_cache[i].id) != 0) need_full = true;
+    else if (!s_hw_cards[i].card || !lv_obj_is_valid(s_hw_cards[i].card)) need_full = true;
+  }
+  bool any_change = need_full;
+  uint8_t patch_idx[HW_MAX_GROUPS];
+  uint8_t patch_cnt = 0;
   if (!need_full) {
     for (uint8_t i = 0; i < new_cnt; i++) {
-      const HwCacheEntry& a = new_cache[i];
-      const HwCacheEntry& b = s_hw_cache[i];
-      if (strcmp(a.id, b.id) != 0 || a.phase != b.phase ||
-          a.run_start_epoch != b.run_start_epoch ||
-          a.accumulated != b.accumulated || a.cycle_elapsed != b.cycle_elapsed ||
-          a.check_count != b.check_count || a.total_count != b.total_count ||
-          a.time_limit_minutes != b.time_limit_minutes ||
-          a.order_index != b.order_index ||
-          a.children_fp != b.children_fp ||
-          strcmp(a.group_title, b.group_title) != 0 ||
-          strcmp(a.page_summary, b.page_summary) != 0 ||
-          strcmp(a.book_name, b.book_name) != 0 ||
-          strcmp(a.m5_wait_title, b.m5_wait_title) != 0 ||
-          strcmp(a.item_type, b.item_type) != 0 ||
-          a.is_homework != b.is_homework ||
-          a.is_test != b.is_test ||
-          a.is_naesin != b.is_naesin ||
-          a.pending_complete != b.pending_complete) {
-        need_full = true;
-        break;
+      if (!hw_cache_entry_changed(new_cache[i], s_hw_cache[i])) continue;
+      any_change = true;
+      if (hw_card_visual_changed(new_cache[i], s_hw_cache[i]) && patch_cnt < HW_MAX_GROUPS) {
+        patch_idx[patch_cnt++] = i;
       }
     }
   }
-  if (!need_full) {
+  if (!any_change) {
     ui_port_try_open_pending_homework_detail();
     s_hw_updating = false;
-    return;
+    return true;
   }
 
   s_hw_timer_epoch++;
-  if (s_hw_global_timer) { lv_timer_del(s_hw_global_timer); s_hw_global_timer = nullptr; }
-  s_p2_cnt = 0; s_p4_cnt = 0; s_p4_breath_step = 0;
+  if (s_hw_global_timer) { ui_sched_del(s_hw_global_timer); s_hw_global_timer = nullptr; }
+  s_p2_cnt = 0; s_p4_cnt = 0; s_p4_breath_step = 0; s_p4_breath_opa = BREATH_LUT[0];
   g_should_vibrate_phase4 = false;
 
-  lv_coord_t prev_main_scroll_y = 0;
-  lv_coord_t prev_waiting_scroll_y = 0;
-  if (s_list && lv_obj_is_valid(s_list)) {
-    prev_main_scroll_y = lv_obj_get_scroll_y(s_list);
-  }
-  if (s_waiting_list && lv_obj_is_valid(s_waiting_list)) {
-    prev_waiting_scroll_y = lv_obj_get_scroll_y(s_waiting_list);
-  }
+  if (need_full) {
+    lv_coord_t prev_main_scroll_y = 0;
+    lv_coord_t prev_waiting_scroll_y = 0;
+    if (s_list && lv_obj_is_valid(s_list)) {
+      prev_main_scroll_y = lv_obj_get_scroll_y(s_list);
+    }
+    if (s_waiting_list && lv_obj_is_valid(s_waiting_list)) {
+      prev_waiting_scroll_y = lv_obj_get_scroll_y(s_waiting_list);
+    }
 
-  lv_obj_add_flag(s_list, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(s_waiting_list, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_clean(s_list);
-  lv_obj_clean(s_waiting_list);
-  uint8_t main_cnt = 0;
-  uint8_t waiting_cnt = 0;
-  for (uint8_t i = 0; i < s_group_cnt; i++) {
-    if (i < HW_MAIN_GROUP_COUNT) {
-      create_hw_card(s_list, i);
-      main_cnt++;
-    } else {
-      create_hw_card(s_waiting_list, i);
-      waiting_cnt++;
+    lv_obj_add_flag(s_list, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(s_waiting_list, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clean(s_list);
+    lv_obj_clean(s_waiting_list);
+    uint8_t main_cnt = 0;
+    uint8_t waiting_cnt = 0;
+    for (uint8_t i = 0; i < s_group_cnt; i++) {
+      if (i < HW_MAIN_GROUP_COUNT) {
+        create_hw_card(s_list, i);
+        main_cnt++;
+      } else {
+        create_hw_card(s_waiting_list, i);
+        waiting_cnt++;
+      }
     }
+    if (main_cnt == 0) append_homework_empty_message(s_list, u8"진행할 과제가 없습니다.");
+    if (waiting_cnt == 0) append_homework_empty_message(s_waiting_list, u8"대기 과제가 없습니다.");
+    lv_obj_clear_flag(s_list, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(s_waiting_list, LV_OBJ_FLAG_HIDDEN);
+    switch_homework_page(s_homework_page_idx, false);
+    lv_obj_update_layout(s_list);
+    lv_obj_update_layout(s_waiting_list);
+    if (prev_main_scroll_y != 0) {
+      lv_obj_scroll_to_y(s_list, prev_main_scroll_y, LV_ANIM_OFF);
+    }
+    if (prev_waiting_scroll_y != 0) {
+      lv_obj_scroll_to_y(s_waiting_list, prev_waiting_scroll_y, LV_ANIM_OFF);
+    }
+  } else {
+    for (uint8_t k = 0; k < patch_cnt; k++) apply_hw_card(patch_idx[k]);
   }
-  if (main_cnt == 0) append_homework_empty_message(s_list, u8"진행할 과제가 없습니다.");
-  if (waiting_cnt == 0) append_homework_empty_message(s_waiting_list, u8"대기 과제가 없습니다.");
-  lv_obj_clear_flag(s_list, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_clear_flag(s_waiting_list, LV_OBJ_FLAG_HIDDEN);
-  switch_homework_page(s_homework_page_idx, false);
-  lv_obj_update_layout(s_list);
-  lv_obj_update_layout(s_waiting_list);
-  if (prev_main_scroll_y != 0) {
-    lv_obj_scroll_to_y(s_list, prev_main_scroll_y, LV_ANIM_OFF);
-  }
-  if (prev_waiting_scroll_y != 0) {
-    lv_obj_scroll_to_y(s_waiting_list, prev_waiting_scroll_y, LV_ANIM_OFF);
-  }
+  hw_collect_phase4_cards();
+  Serial.printf("[HW] cards %s groups=%u repainted=%u us=%lu\n",
+                need_full ? "rebuild" : "patch",
+                (unsigned)s_group_cnt,
+                (unsigned)(need_full ? s_group_cnt : patch_cnt),
+                (unsigned long)(micros() - apply_t0));
 
   // 완료 감지: 직전 목록에 있던 비숙제 그룹이 사라지면 채점자가 완료 처리한 것.
   // 완료(complete)는 확인(phase 4)→대기(phase 1)로 내려간 뒤 기록·종료되며 사라진다.
@@ -4742,6 +4640,7 @@ void ui_port_update_homeworks(const JsonArray& groups) {
       fw_publish_list_homeworks(studentId.c_str());
     }
   }
+  return true;
 }
 
 // ========== 수행 상세 페이지 (음악 앱 스타일) ==========
@@ -4787,9 +4686,13 @@ static bool detail_test_effective_running(const HwGroupData& g) {
   return effective_running;
 }
 
-static void detail_timer_cb(lv_timer_t* timer) {
+static void detail_timer_cb(UiSchedTask* timer) {
   uint32_t epoch = (uint32_t)(uintptr_t)timer->user_data;
-  if (epoch != s_detail_timer_epoch) { lv_timer_del(timer); return; }
+  if (epoch != s_detail_timer_epoch) {
+    if (s_detail_timer == timer) s_detail_timer = nullptr;
+    ui_sched_del(timer);
+    return;
+  }
   if (s_detail_group_idx < 0 || s_detail_group_idx >= s_group_cnt) return;
   HwGroupData& g = s_groups[s_detail_group_idx];
 
@@ -4892,6 +4795,7 @@ static void close_homework_child_list_page(bool animated) {
 static void show_homework_child_list_page(int group_idx) {
   if (group_idx < 0 || group_idx >= s_group_cnt) return;
   if (!s_stage || !lv_obj_is_valid(s_stage)) return;
+  lvgl_mem_mark_screen("hw_child_list");
 
   close_homework_child_list_page(false);
   HwGroupData& g = s_groups[group_idx];
@@ -4909,9 +4813,7 @@ static void show_homework_child_list_page(int group_idx) {
 
   lv_obj_t* header = lv_obj_create(s_hw_list_screen);
   lv_obj_set_size(header, 320, 46);
-  lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(header, 0, 0);
-  lv_obj_set_style_pad_all(header, 0, 0);
+  ui_theme_add(header, UI_STYLE_BARE);
   lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
 
   lv_obj_t* back_btn = lv_btn_create(header);
@@ -4922,14 +4824,14 @@ static void show_homework_child_list_page(int group_idx) {
   lv_obj_set_style_border_width(back_btn, 0, 0);
   lv_obj_set_style_shadow_width(back_btn, 0, 0);
   lv_obj_t* back_lbl = lv_label_create(back_btn);
-  lv_obj_set_style_text_font(back_lbl, &kakao_kr_16, 0);
+  ui_theme_add(back_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(back_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(back_lbl, "<");
   lv_obj_center(back_lbl);
   lv_obj_add_event_cb(back_btn, [](lv_event_t* e){ (void)e; close_homework_child_list_page(true); }, LV_EVENT_CLICKED, NULL);
 
   lv_obj_t* title = lv_label_create(header);
-  lv_obj_set_style_text_font(title, &kakao_kr_16, 0);
+  ui_theme_add(title, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(title, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(title, u8"상세 과제 리스트");
   lv_obj_align(title, LV_ALIGN_LEFT_MID, 50, 5);
@@ -4996,7 +4898,7 @@ static void show_homework_child_list_page(int group_idx) {
     }
 
     lv_obj_t* r1 = lv_label_create(row);
-    lv_obj_set_style_text_font(r1, &kakao_kr_16, 0);
+    ui_theme_add(r1, UI_STYLE_TEXT_BODY);
     lv_obj_set_style_text_color(r1, lv_color_hex(0xDCDCDC), 0);
     lv_label_set_long_mode(r1, LV_LABEL_LONG_DOT);
     lv_obj_set_width(r1, text_w);
@@ -5011,7 +4913,7 @@ static void show_homework_child_list_page(int group_idx) {
     else snprintf(page_count, sizeof(page_count), "-");
 
     lv_obj_t* r2 = lv_label_create(row);
-    lv_obj_set_style_text_font(r2, &kakao_kr_16, 0);
+    ui_theme_add(r2, UI_STYLE_TEXT_BODY);
     lv_obj_set_style_text_color(r2, lv_color_hex(0xAAAAAA), 0);
     lv_label_set_long_mode(r2, LV_LABEL_LONG_DOT);
     lv_obj_set_width(r2, text_w);
@@ -5020,7 +4922,7 @@ static void show_homework_child_list_page(int group_idx) {
     lv_obj_add_flag(r2, LV_OBJ_FLAG_EVENT_BUBBLE);
 
     lv_obj_t* r3 = lv_label_create(row);
-    lv_obj_set_style_text_font(r3, &kakao_kr_16, 0);
+    ui_theme_add(r3, UI_STYLE_TEXT_BODY);
     lv_obj_set_style_text_color(r3, lv_color_hex(0x8F8F8F), 0);
     lv_obj_set_style_text_align(r3, LV_TEXT_ALIGN_RIGHT, 0);
     lv_label_set_long_mode(r3, LV_LABEL_LONG_DOT);
@@ -5041,10 +4943,11 @@ static void show_homework_child_list_page(int group_idx) {
 }
 
 static void close_homework_detail_page(void) {
+  lvgl_mem_mark_screen("homeworks");
   close_test_abort_confirm_popup();
   s_detail_timer_epoch++;
   close_homework_child_list_page(false);
-  if (s_detail_timer) { lv_timer_del(s_detail_timer); s_detail_timer = nullptr; }
+  if (s_detail_timer) { ui_sched_del(s_detail_timer); s_detail_timer = nullptr; }
   if (s_hw_detail_screen && lv_obj_is_valid(s_hw_detail_screen)) {
     lv_obj_del(s_hw_detail_screen);
   }
@@ -5073,7 +4976,7 @@ static void close_homework_detail_page(void) {
 // ===== 테스트 수행화면 (줄어드는 도넛 + 그룹명 + 남은시간) =====
 static void close_test_perform_screen(void) {
   s_test_perform_epoch++;
-  if (s_test_perform_timer) { lv_timer_del(s_test_perform_timer); s_test_perform_timer = nullptr; }
+  if (s_test_perform_timer) { ui_sched_del(s_test_perform_timer); s_test_perform_timer = nullptr; }
   if (s_test_perform_screen && lv_obj_is_valid(s_test_perform_screen)) {
     lv_obj_del(s_test_perform_screen);
   }
@@ -5106,13 +5009,7 @@ static void show_test_end_popup(void) {
   s_test_end_popup = lv_obj_create(lv_scr_act());
   lv_obj_set_size(s_test_end_popup, 276, 156);
   lv_obj_center(s_test_end_popup);
-  lv_obj_set_style_bg_color(s_test_end_popup, lv_color_hex(0x202020), 0);
-  lv_obj_set_style_bg_opa(s_test_end_popup, LV_OPA_COVER, 0);
-  lv_obj_set_style_border_width(s_test_end_popup, 1, 0);
-  lv_obj_set_style_border_color(s_test_end_popup, lv_color_hex(0x3A3A3A), 0);
-  lv_obj_set_style_radius(s_test_end_popup, 14, 0);
-  lv_obj_set_style_pad_all(s_test_end_popup, 12, 0);
-  lv_obj_set_style_pad_row(s_test_end_popup, 10, 0);
+  ui_theme_add(s_test_end_popup, UI_STYLE_POPUP);
   lv_obj_clear_flag(s_test_end_popup, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_set_flex_flow(s_test_end_popup, LV_FLEX_FLOW_COLUMN);
   lv_obj_set_flex_align(s_test_end_popup, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
@@ -5124,19 +5021,15 @@ static void show_test_end_popup(void) {
 
   lv_obj_t* msg = lv_label_create(s_test_end_popup);
   lv_obj_set_width(msg, 248);
-  lv_obj_set_style_text_align(msg, LV_TEXT_ALIGN_CENTER, 0);
-  lv_obj_set_style_text_font(msg, &kakao_kr_16, 0);
-  lv_obj_set_style_text_color(msg, lv_color_hex(0xD0D0D0), 0);
+  ui_theme_add(msg, UI_STYLE_TEXT_MSG);
   lv_label_set_long_mode(msg, LV_LABEL_LONG_WRAP);
   lv_label_set_text(msg, u8"제한 시간이 종료되어\n자동 제출됩니다.");
 
   lv_obj_t* confirm_btn = lv_btn_create(s_test_end_popup);
   lv_obj_set_size(confirm_btn, 200, 40);
-  lv_obj_set_style_radius(confirm_btn, 10, 0);
-  lv_obj_set_style_bg_color(confirm_btn, lv_color_hex(0x1FA95B), 0);
-  lv_obj_set_style_border_width(confirm_btn, 0, 0);
+  ui_theme_add(confirm_btn, UI_STYLE_BTN_PRIMARY);
   lv_obj_t* confirm_lbl = lv_label_create(confirm_btn);
-  lv_obj_set_style_text_font(confirm_lbl, &kakao_kr_16, 0);
+  ui_theme_add(confirm_lbl, UI_STYLE_TEXT_BODY);
   lv_label_set_text(confirm_lbl, u8"확인");
   lv_obj_center(confirm_lbl);
   lv_obj_add_event_cb(confirm_btn, [](lv_event_t* e) {
@@ -5267,9 +5160,13 @@ static void test_perform_format_remaining(int secs, char* buf, size_t sz) {
   else snprintf(buf, sz, "%02d:%02d", m, s);
 }
 
-static void test_perform_timer_cb(lv_timer_t* timer) {
+static void test_perform_timer_cb(UiSchedTask* timer) {
   uint32_t epoch = (uint32_t)(uintptr_t)timer->user_data;
-  if (epoch != s_test_perform_epoch) { lv_timer_del(timer); return; }
+  if (epoch != s_test_perform_epoch) {
+    if (s_test_perform_timer == timer) s_test_perform_timer = nullptr;
+    ui_sched_del(timer);
+    return;
+  }
   // 목록 갱신으로 인덱스가 바뀔 수 있으므로 group_id로 매번 재해석
   int idx = -1;
   for (uint8_t i = 0; i < s_group_cnt; i++) {
@@ -5328,6 +5225,7 @@ static void show_test_perform_screen(int group_idx) {
     Serial.println("[TEST] perform abort: stage invalid");
     return;
   }
+  lvgl_mem_mark_screen("test_perform");
   Serial.printf("[TEST] perform open idx=%d phase=%d tlim=%d\n",
                 group_idx, (int)s_groups[group_idx].phase, (int)s_groups[group_idx].time_limit_minutes);
 
@@ -5364,7 +5262,7 @@ static void show_test_perform_screen(int group_idx) {
   lv_obj_set_style_border_width(back_btn, 0, 0);
   lv_obj_set_style_shadow_width(back_btn, 0, 0);
   lv_obj_t* back_lbl = lv_label_create(back_btn);
-  lv_obj_set_style_text_font(back_lbl, &kakao_kr_16, 0);
+  ui_theme_add(back_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(back_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(back_lbl, "<");
   lv_obj_center(back_lbl);
@@ -5403,7 +5301,7 @@ static void show_test_perform_screen(int group_idx) {
   // 가운데: 그룹 과제명 (도넛 중심 위쪽)
   const char* title = g.group_title[0] ? g.group_title : (g.book_name[0] ? g.book_name : u8"테스트");
   lv_obj_t* name_lbl = lv_label_create(s_test_perform_screen);
-  lv_obj_set_style_text_font(name_lbl, &kakao_kr_16, 0);
+  ui_theme_add(name_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(name_lbl, lv_color_hex(0xB8B8B8), 0);
   lv_obj_set_style_text_align(name_lbl, LV_TEXT_ALIGN_CENTER, 0);
   lv_obj_set_width(name_lbl, 150);
@@ -5421,15 +5319,15 @@ static void show_test_perform_screen(int group_idx) {
   s_test_perform_time_lbl = time_lbl;
 
   s_test_perform_epoch++;
-  s_test_perform_timer = lv_timer_create(test_perform_timer_cb, 250, (void*)(uintptr_t)s_test_perform_epoch);
-  lv_timer_set_repeat_count(s_test_perform_timer, -1);
-  test_perform_timer_cb(s_test_perform_timer);
+  s_test_perform_timer = ui_sched_add(test_perform_timer_cb, 250, (void*)(uintptr_t)s_test_perform_epoch, "test_perform");
+  if (s_test_perform_timer) test_perform_timer_cb(s_test_perform_timer);
 }
 
 static void show_homework_detail_page(int group_idx) {
   extern const lv_font_t kakao_kr_16;
   if (group_idx < 0 || group_idx >= s_group_cnt) return;
   if (!s_stage || !lv_obj_is_valid(s_stage)) return;
+  lvgl_mem_mark_screen("hw_detail");
 
   close_homework_detail_page();
   s_detail_group_idx = group_idx;
@@ -5469,9 +5367,7 @@ static void show_homework_detail_page(int group_idx) {
   // -- 뒤로가기 헤더 (36px) --
   lv_obj_t* header = lv_obj_create(s_hw_detail_screen);
   lv_obj_set_size(header, 320, 36);
-  lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(header, 0, 0);
-  lv_obj_set_style_pad_all(header, 0, 0);
+  ui_theme_add(header, UI_STYLE_BARE);
   lv_obj_add_flag(header, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
   lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
 
@@ -5483,7 +5379,7 @@ static void show_homework_detail_page(int group_idx) {
   lv_obj_set_style_border_width(back_btn, 0, 0);
   lv_obj_set_style_shadow_width(back_btn, 0, 0);
   lv_obj_t* back_lbl = lv_label_create(back_btn);
-  lv_obj_set_style_text_font(back_lbl, &kakao_kr_16, 0);
+  ui_theme_add(back_lbl, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(back_lbl, lv_color_hex(0xE6E6E6), 0);
   lv_label_set_text(back_lbl, "<");
   lv_obj_center(back_lbl);
@@ -5512,7 +5408,7 @@ static void show_homework_detail_page(int group_idx) {
 
   // -- 2열: 그룹 과제명 (가운데) --
   lv_obj_t* row2 = lv_label_create(s_hw_detail_screen);
-  lv_obj_set_style_text_font(row2, &kakao_kr_16, 0);
+  ui_theme_add(row2, UI_STYLE_TEXT_BODY);
   lv_obj_set_style_text_color(row2, lv_color_hex(0xB0B0B0), 0);
   lv_obj_set_style_text_align(row2, LV_TEXT_ALIGN_CENTER, 0);
   lv_obj_set_width(row2, 300);
@@ -5525,7 +5421,7 @@ static void show_homework_detail_page(int group_idx) {
     char pg_buf[80];
     snprintf(pg_buf, sizeof(pg_buf), "p.%s", g.page_summary);
     lv_obj_t* row3 = lv_label_create(s_hw_detail_screen);
-    lv_obj_set_style_text_font(row3, &kakao_kr_16, 0);
+    ui_theme_add(row3, UI_STYLE_TEXT_BODY);
     lv_obj_set_style_text_color(row3, lv_color_hex(0x808080), 0);
     lv_obj_set_style_text_align(row3, LV_TEXT_ALIGN_CENTER, 0);
     lv_obj_set_width(row3, 300);
@@ -5618,7 +5514,7 @@ static void show_homework_detail_page(int group_idx) {
     clear_container_visuals(block);
     for (int i = 0; i < 10; i++) {
       lv_obj_t* ch = lv_label_create(block);
-      lv_obj_set_style_text_font(ch, &kakao_kr_16, 0);
+      ui_theme_add(ch, UI_STYLE_TEXT_BODY);
       lv_obj_set_style_text_color(ch, lv_color_hex(color_hex), 0);
       lv_obj_set_style_bg_opa(ch, LV_OPA_TRANSP, 0);
       lv_obj_set_style_pad_all(ch, 0, 0);
@@ -5659,9 +5555,7 @@ static void show_homework_detail_page(int group_idx) {
   // we grew time_row by 5px above. Net flex offset for buttons: unchanged.
   lv_obj_t* btn_row = lv_obj_create(s_hw_detail_screen);
   lv_obj_set_size(btn_row, 300, 88);
-  lv_obj_set_style_bg_opa(btn_row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(btn_row, 0, 0);
-  lv_obj_set_style_pad_all(btn_row, 0, 0);
+  ui_theme_add(btn_row, UI_STYLE_BARE);
   lv_obj_clear_flag(btn_row, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_add_flag(btn_row, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
   lv_obj_set_style_pad_top(btn_row, 1, 0);
@@ -5809,9 +5703,8 @@ static void show_homework_detail_page(int group_idx) {
 
   // 타이머 시작
   s_detail_timer_epoch++;
-  s_detail_timer = lv_timer_create(detail_timer_cb, 1000, (void*)(uintptr_t)s_detail_timer_epoch);
-  lv_timer_set_repeat_count(s_detail_timer, -1);
-  detail_timer_cb(s_detail_timer);
+  s_detail_timer = ui_sched_add(detail_timer_cb, 1000, (void*)(uintptr_t)s_detail_timer_epoch, "detail");
+  if (s_detail_timer) detail_timer_cb(s_detail_timer);
 }
 
 static void ui_port_try_open_pending_homework_detail(void) {
@@ -5855,6 +5748,8 @@ void ui_port_update_student_info(const JsonObject& info) {
   s_student_name_cache = name;
   s_student_school_cache = school;
   s_student_grade_cache = grade;
+  font_fallback_warm(&kakao_kr_16, name);
+  font_fallback_warm(&kakao_kr_24, name);
 
   if (s_info_panel && lv_obj_is_valid(s_info_panel)) {
     populate_student_info_container(s_info_panel, false);
@@ -5879,9 +5774,7 @@ void ui_port_show_settings(const char* appVersion) {
     // Battery widget container (top-right)
     s_battery_widget = lv_obj_create(s_settings_scr);
     lv_obj_set_size(s_battery_widget, 80, 32);
-    lv_obj_set_style_bg_opa(s_battery_widget, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(s_battery_widget, 0, 0);
-    lv_obj_set_style_pad_all(s_battery_widget, 0, 0);
+    ui_theme_add(s_battery_widget, UI_STYLE_BARE);
     lv_obj_set_flex_flow(s_battery_widget, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(s_battery_widget, LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
     lv_obj_align(s_battery_widget, LV_ALIGN_TOP_RIGHT, -10, 20);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Arduino.h>
 #include <ArduinoJson.h>
 #include <lvgl.h>
 
@@ -18,9 +19,12 @@ void toggle_bottom_sheet(void);
 #endif
 
 // C++ 인터페이스 (ArduinoJson 연계)
+struct HwSyncFrame;
 void ui_port_init();
 void ui_port_update_students(const JsonArray& students);
-void ui_port_update_homeworks(const JsonArray& items);
+// homeworks는 MQTT 태스크에서 스트리밍 디코딩된 프레임(hw_sync.h)을 받는다.
+// 화면 상태(s_groups)에 반영했으면 true (갱신 중 재진입 등으로 미룬 경우 false).
+bool ui_port_update_homeworks(const HwSyncFrame& frame);
 void ui_port_update_student_info(const JsonObject& info);
 void ui_port_show_settings(const char* appVersion);
 void ui_port_set_global_font(const lv_font_t* font);
@@ -32,10 +36,14 @@ void ui_port_on_device_ack_json(const char* body);
 void ui_port_show_boot_status(void);
 void ui_port_update_boot_status(const char* status, int progress);
 void ui_port_hide_boot_status(void);
+// 부팅 캐시로 그린 화면이면 true: 새 데이터가 올 때까지 "동기화 중" 배지를 띄운다.
+void ui_port_set_stale(bool stale);
 // PIN 입력 중에는 화면보호기 진입을 막기 위한 상태 조회
 bool ui_port_is_pin_entry_active(void);
 // bind ack 결과 처리 (메인 deviceAck 핸들러에서 호출)
 void ui_port_on_bind_ack(bool ok, const char* reason, int attempts_left, int locked_seconds);
+// LIST-DIAG: 확인 카드 숨쉬기 테두리가 틱마다 무효화한 넓이
+void ui_port_append_diag(String& out);
 
 // 펌웨어 측 MQTT publish 콜백(메인에서 구현)
 void fw_publish_bind(const char* studentId);
@@ -52,10 +60,10 @@ void fw_publish_pause_all();
 void fw_publish_raise_question();
 void fw_publish_create_descriptive_writing(void);
 void fw_publish_check_update();
-void fw_watchdog_pause();
-void fw_watchdog_resume();
 void fw_mark_ui_stage(uint32_t stage);
 void fw_publish_list_today();
 void fw_publish_list_homeworks(const char* studentIdArg);
+// 과제 화면 캐시가 비워질 때 호출: 다음 homeworks 페이로드를 sync_fp와 무관하게 다시 적용한다.
+void fw_homeworks_sync_invalidate(void);
 
 
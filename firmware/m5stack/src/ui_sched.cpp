@@ -0,0 +1,285 @@
+#include "ui_sched.h"
+
+#include <string.h>
+#include <sys/time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#ifndef CFG_UI_REFR_IDLE_MS
+#define CFG_UI_REFR_IDLE_MS 100     // 움직이는 것이 없을 때 리프레시 주기
+#endif
+#ifndef CFG_UI_REFR_ANIM_MS
+#define CFG_UI_REFR_ANIM_MS LV_DISP_DEF_REFR_PERIOD  // 애니메이션·프레임 작업
+#endif
+#ifndef CFG_UI_REFR_GESTURE_MS
+#define CFG_UI_REFR_GESTURE_MS 16   // 누르고 있거나 스크롤(관성 포함) 중
+#endif
+#ifndef CFG_UI_INDEV_IDLE_MS
+#define CFG_UI_INDEV_IDLE_MS 50     // 쉬는 동안 터치 읽기 주기(첫 터치 지연 상한)
+#endif
+#ifndef CFG_UI_LOOP_MAX_SLEEP_MS
+#define CFG_UI_LOOP_MAX_SLEEP_MS 50 // loop 한 번에 자는 최대 시간(loop의 폴링 작업 지연 상한)
+#endif
+
+namespace {
+
+const uint8_t kMaxTasks = 12;
+const uint8_t kMaxScreens = 12;
+// 모든 주기(100, 250, 1000, 30000 …)가 나누어떨어지는 길이. 시간축 위상은 이 길이로 잡는다.
+const uint32_t kGridMs = 60000;
+
+enum GovLevel : uint8_t { GOV_IDLE = 0, GOV_ANIM, GOV_GESTURE, GOV_COUNT };
+const uint32_t kRefrMs[GOV_COUNT] = {CFG_UI_REFR_IDLE_MS, CFG_UI_REFR_ANIM_MS, CFG_UI_REFR_GESTURE_MS};
+const uint32_t kIndevMs[GOV_COUNT] = {CFG_UI_INDEV_IDLE_MS, LV_INDEV_DEF_READ_PERIOD, CFG_UI_REFR_GESTURE_MS};
+const char* const kGovName[GOV_COUNT] = {"idle", "anim", "gesture"};
+
+struct ScreenStat {
+  const char* name;
+  uint32_t wakeups;
+  uint32_t ms;
+  int32_t ma_sum;
+  uint32_t ma_samples;
+};
+
+UiSchedTask s_tasks[kMaxTasks];
+lv_timer_t* s_tick = nullptr;
+lv_timer_t* s_refr = nullptr;
+lv_timer_cb_t s_refr_cb = nullptr;  // 원래 리프레시 콜백(_lv_disp_refr_timer)
+lv_indev_t* s_indev = nullptr;
+TaskHandle_t s_loop_task = nullptr;
+uint8_t s_frame_tasks = 0;
+uint32_t s_grid_off = 0;            // lv_tick + off 가 벽시계(ms) mod kGridMs
+uint32_t s_grid_checked_ms = 0;
+bool s_grid_wall = false;
+
+GovLevel s_level = GOV_ANIM;
+uint32_t s_level_since = 0;
+uint32_t s_level_ms[GOV_COUNT] = {};
+uint32_t s_level_switches = 0;
+
+const char* (*s_screen_fn)() = nullptr;
+ScreenStat s_screens[kMaxScreens];
+uint8_t s_screen_cnt = 0;
+ScreenStat* s_cur_screen = nullptr;
+uint32_t s_last_wake_ms = 0;
+uint32_t s_wakeups = 0;
+uint32_t s_task_runs = 0;
+uint32_t s_pulled_refr = 0;         // 작업 뒤 리프레시를 당긴 횟수
+
+// now 이후(초과) 첫 P 경계.
+uint32_t next_boundary(uint32_t now, uint32_t period) {
+  return now + period - ((now + s_grid_off) % period);
+}
+
+// SNTP가 잡히면 시간축을 벽시계에 맞춘다. 드리프트·재동기를 따라가도록 1분마다 다시 잰다.
+void update_grid(uint32_t now) {
+  if (s_grid_checked_ms && now - s_grid_checked_ms < kGridMs) return;
+  s_grid_checked_ms = now ? now : 1;
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  if (tv.tv_sec < 1700000000) return;
+  const uint64_t wall = (uint64_t)tv.tv_sec * 1000ull + (uint64_t)(tv.tv_usec / 1000);
+  s_grid_off = (uint32_t)((wall - (uint64_t)now) % kGridMs);
+  s_grid_wall = true;
+}
+
+void rearm(uint32_t now) {
+  if (!s_tick) return;
+  uint32_t wait = UINT32_MAX;
+  for (const UiSchedTask& t : s_tasks) {
+    if (!t.used || t.period_ms == 0) continue;
+    const int32_t d = (int32_t)(t.next_due - now);
+    const uint32_t w = d > 0 ? (uint32_t)d : 0;
+    if (w < wait) wait = w;
+  }
+  if (wait == UINT32_MAX) {
+    lv_timer_pause(s_tick);
+    return;
+  }
+  lv_timer_reset(s_tick);
+  lv_timer_set_period(s_tick, wait);
+  lv_timer_resume(s_tick);
+}
+
+bool gesture_active() {
+  if (!s_indev) return false;
+  return s_indev->proc.state == LV_INDEV_STATE_PRESSED || s_indev->proc.types.pointer.scroll_obj != nullptr;
+}
+
+void governor_update(uint32_t now) {
+  GovLevel level = GOV_IDLE;
+  if (gesture_active()) level = GOV_GESTURE;
+  else if (s_frame_tasks > 0 || lv_anim_count_running() > 0) level = GOV_ANIM;
+  if (level == s_level) return;
+  s_level_ms[s_level] += now - s_level_since;
+  s_level_since = now;
+  s_level = level;
+  s_level_switches++;
+  if (s_refr) lv_timer_set_period(s_refr, kRefrMs[level]);
+  if (s_indev && s_indev->driver && s_indev->driver->read_timer) {
+    lv_timer_set_period(s_indev->driver->read_timer, kIndevMs[level]);
+  }
+}
+
+void run_due(uint32_t now, bool frame) {
+  for (uint8_t i = 0; i < kMaxTasks; ++i) {
+    UiSchedTask& t = s_tasks[i];
+    if (!t.used) continue;
+    if (frame) {
+      if (t.period_ms != 0) continue;
+    } else {
+      if (t.period_ms == 0 || (int32_t)(now - t.next_due) < 0) continue;
+      t.next_due = next_boundary(now, t.period_ms);
+    }
+    s_task_runs++;
+    t.cb(&t);  // 안에서 ui_sched_del/add가 불려도 슬롯 배열은 그대로다
+  }
+}
+
+void tick_cb(lv_timer_t* timer) {
+  (void)timer;
+  const uint32_t now = lv_tick_get();
+  update_grid(now);
+  run_due(now, false);
+  // 작업이 화면을 바꿨으면 리프레시를 이번 회차에 당긴다(리프레시 타이머가 목록에서 뒤에 있다).
+  lv_disp_t* disp = lv_disp_get_default();
+  if (s_refr && disp && disp->inv_p > 0) {
+    lv_timer_ready(s_refr);
+    s_pulled_refr++;
+  }
+  rearm(now);
+}
+
+void refr_cb(lv_timer_t* timer) {
+  const uint32_t now = lv_tick_get();
+  if (s_frame_tasks) run_due(now, true);
+  governor_update(now);
+  s_refr_cb(timer);
+  // LVGL 8.3 리프레시 타이머는 돌 때마다 스스로 멈추고 무효화가 생기면 다시 켜진다.
+  // 프레임 작업이 있으면 계속 돌게 둔다.
+  if (s_frame_tasks) lv_timer_resume(timer);
+}
+
+ScreenStat* screen_stat(const char* name) {
+  for (uint8_t i = 0; i < s_screen_cnt; ++i) {
+    if (s_screens[i].name == name || strcmp(s_screens[i].name, name) == 0) return &s_screens[i];
+  }
+  if (s_screen_cnt == kMaxScreens) return &s_screens[kMaxScreens - 1];
+  ScreenStat& s = s_screens[s_screen_cnt++];
+  memset(&s, 0, sizeof(s));
+  s.name = name;
+  return &s;
+}
+
+}  // namespace
+
+void ui_sched_init() {
+  s_loop_task = xTaskGetCurrentTaskHandle();
+  lv_disp_t* disp = lv_disp_get_default();
+  if (disp && disp->refr_timer) {
+    s_refr = disp->refr_timer;
+    s_refr_cb = s_refr->timer_cb;
+    s_refr->timer_cb = refr_cb;
+  }
+  for (lv_indev_t* i = lv_indev_get_next(nullptr); i; i = lv_indev_get_next(i)) {
+    if (lv_indev_get_type(i) == LV_INDEV_TYPE_POINTER) {
+      s_indev = i;
+      break;
+    }
+  }
+  // 나중에 만든 타이머가 목록 앞에 들어가므로 리프레시보다 먼저 돈다(tick_cb의 당김이 같은 회차에 걸린다).
+  s_tick = lv_timer_create(tick_cb, 1000, nullptr);
+  lv_timer_pause(s_tick);
+  const uint32_t now = lv_tick_get();
+  update_grid(now);
+  s_level_since = now;
+  s_last_wake_ms = millis();
+  governor_update(now);
+}
+
+UiSchedTask* ui_sched_add(UiSchedCb cb, uint32_t period_ms, void* user_data, const char* name) {
+  if (!cb) return nullptr;
+  for (UiSchedTask& t : s_tasks) {
+    if (t.used) continue;
+    const uint32_t now = lv_tick_get();
+    t.cb = cb;
+    t.user_data = user_data;
+    t.name = name ? name : "?";
+    t.period_ms = period_ms;
+    t.next_due = period_ms ? next_boundary(now, period_ms) : now;
+    t.used = true;
+    if (period_ms == 0) {
+      s_frame_tasks++;
+      governor_update(now);
+      if (s_refr) lv_timer_resume(s_refr);
+    } else {
+      rearm(now);
+    }
+    return &t;
+  }
+  Serial.printf("[UI] sched full, task %s dropped\n", name ? name : "?");
+  return nullptr;
+}
+
+void ui_sched_del(UiSchedTask* task) {
+  if (!task || !task->used) return;
+  task->used = false;
+  task->cb = nullptr;
+  task->user_data = nullptr;
+  if (task->period_ms == 0 && s_frame_tasks > 0) s_frame_tasks--;
+  rearm(lv_tick_get());
+}
+
+void ui_sched_set_screen_fn(const char* (*fn)()) {
+  s_screen_fn = fn;
+}
+
+void ui_sched_idle(uint32_t lv_due_ms) {
+  const uint32_t now = millis();
+  governor_update(lv_tick_get());
+
+  s_wakeups++;
+  if (s_cur_screen) s_cur_screen->ms += now - s_last_wake_ms;
+  s_last_wake_ms = now;
+  s_cur_screen = screen_stat(s_screen_fn ? s_screen_fn() : "-");
+  s_cur_screen->wakeups++;
+
+  const int32_t left = (int32_t)(lv_due_ms - now);
+  uint32_t wait = left > 0 ? (uint32_t)left : 0;
+  if (wait > CFG_UI_LOOP_MAX_SLEEP_MS) wait = CFG_UI_LOOP_MAX_SLEEP_MS;
+  // 깨움 알림이 먼저 와 있으면 바로 돌아온다.
+  ulTaskNotifyTake(pdTRUE, wait ? pdMS_TO_TICKS(wait) : 0);
+}
+
+void ui_sched_wake() {
+  if (s_loop_task) xTaskNotifyGive(s_loop_task);
+}
+
+void ui_sched_note_current(int32_t ma) {
+  if (!s_cur_screen) return;
+  s_cur_screen->ma_sum += ma;
+  s_cur_screen->ma_samples++;
+}
+
+void ui_sched_append_diag(String& out) {
+  const uint32_t now = lv_tick_get();
+  uint32_t level_ms[GOV_COUNT];
+  memcpy(level_ms, s_level_ms, sizeof(level_ms));
+  level_ms[s_level] += now - s_level_since;
+  out += "ui_refr level=" + String(kGovName[s_level]) + " idle_ms=" + String((unsigned long)level_ms[GOV_IDLE]) +
+         " anim_ms=" + String((unsigned long)level_ms[GOV_ANIM]) +
+         " gesture_ms=" + String((unsigned long)level_ms[GOV_GESTURE]) +
+         " switches=" + String((unsigned long)s_level_switches) + "\n";
+  uint8_t used = 0;
+  for (const UiSchedTask& t : s_tasks) used += t.used ? 1 : 0;
+  out += "ui_sched tasks=" + String((unsigned)used) + " runs=" + String((unsigned long)s_task_runs) +
+         " pulled_refr=" + String((unsigned long)s_pulled_refr) + " wall_grid=" + String(s_grid_wall ? 1 : 0) +
+         " wakeups=" + String((unsigned long)s_wakeups) + "\n";
+  for (uint8_t i = 0; i < s_screen_cnt; ++i) {
+    const ScreenStat& s = s_screens[i];
+    const uint32_t ms = s.ms ? s.ms : 1;
+    out += "ui_screen_" + String(s.name) + "=wake_per_s:" + String((float)s.wakeups * 1000.0f / (float)ms, 1) +
+           " ms:" + String((unsigned long)s.ms) +
+           " ma:" + String((long)(s.ma_samples ? s.ma_sum / (int32_t)s.ma_samples : 0)) + "\n";
+  }
+}
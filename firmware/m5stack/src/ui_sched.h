@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// UI 주기 작업 스케줄러 + 리프레시 주기 거버너.
+//
+// 예전에는 화면마다 lv_timer를 따로 만들어(100ms 과제 타이머, 50ms 스톱워치, 250ms 시험 남은 시간,
+// 1s 상세, 30s 허브 시계 …) 서로 무관한 위상으로 깨웠고, loop()는 쉬지 않고 돌았다.
+//  - 주기 작업은 하나의 lv_timer가 돌린다. 주기 P인 작업은 공통 시간축에서 P의 배수 시각에 실행되므로
+//    1초 작업들은 같은 순간에, 100ms·250ms 작업도 초 경계에 맞물려 한 번에 깬다. 시간축은 SNTP가 잡히면
+//    벽시계 초(분)에 맞춘다(시계가 정확히 분이 바뀔 때 넘어간다).
+//  - period 0 작업은 프레임 작업이다. 디스플레이 리프레시 타이머 안에서 그리기 직전에 돈다(추가 깨움 없음).
+//  - 작업이 화면을 무효화했으면 리프레시를 같은 lv_timer_handler 회차에 당겨 그린다.
+//  - 거버너: 터치/스크롤 중이면 리프레시·입력 주기를 짧게(CFG_UI_REFR_GESTURE_MS), 애니메이션이나
+//    프레임 작업이 있으면 기본(CFG_UI_REFR_ANIM_MS), 그 외에는 길게(CFG_UI_REFR_IDLE_MS) 둔다.
+//    LVGL 리프레시 타이머는 무효화가 있을 때만 돌기 때문에 이 주기는 연이은 프레임 사이 간격의 하한이다.
+//    조용하다가 생긴 변화는 바로 그리고, 숨쉬기 테두리·초 단위 갱신 같은 잦은 변화만 묶인다.
+//  - loop() 끝의 ui_sched_idle()이 다음 LVGL 타이머까지 잔다(MQTT 수신은 ui_sched_wake()로 바로 깨운다).
+//    깨움 수와 배터리 전류를 화면별로 세어 LIST-DIAG에 싣는다.
+// 모든 함수는 loop(LVGL) 스레드 전용이다. ui_sched_wake()만 어느 태스크에서나 부를 수 있다.
+
+struct UiSchedTask;
+typedef void (*UiSchedCb)(UiSchedTask* task);
+
+struct UiSchedTask {
+  UiSchedCb cb;
+  void* user_data;
+  const char* name;
+  uint32_t period_ms;  // 0: 매 프레임
+  uint32_t next_due;   // lv_tick 기준
+  bool used;
+};
+
+// 디스플레이·입력 드라이버 등록 뒤 한 번.
+void ui_sched_init();
+// 첫 실행은 다음 경계(곧바로 한 번 그리려면 호출 측이 콜백을 직접 부른다). 자리가 없으면 nullptr.
+UiSchedTask* ui_sched_add(UiSchedCb cb, uint32_t period_ms, void* user_data, const char* name);
+// 콜백 안에서 자기 자신을 지워도 된다. nullptr이면 무시.
+void ui_sched_del(UiSchedTask* task);
+// 지금 화면 이름(정적 문자열)을 돌려주는 함수. 깨움 수를 화면별로 나눈다.
+void ui_sched_set_screen_fn(const char* (*fn)());
+
+// loop 끝: lv_due_ms(millis 기준, lv_timer_handler가 알려 준 다음 타이머 시각)까지 잔다.
+void ui_sched_idle(uint32_t lv_due_ms);
+// 다른 태스크(async-tcp 등): 자고 있는 loop를 깨운다.
+void ui_sched_wake();
+// 배터리 전류 샘플(mA, 방전이 음수). 화면별 평균에 더한다.
+void ui_sched_note_current(int32_t ma);
+void ui_sched_append_diag(String& out);
@@ -0,0 +1,77 @@
+#include "ui_theme.h"
+
+extern const lv_font_t kakao_kr_16;
+extern const lv_font_t kakao_kr_24;
+
+static lv_style_t s_styles[UI_STYLE_COUNT];
+static bool s_ready = false;
+
+static void init_styles() {
+  for (uint8_t i = 0; i < UI_STYLE_COUNT; i++) lv_style_init(&s_styles[i]);
+
+  lv_style_t* st = &s_styles[UI_STYLE_POPUP];
+  lv_style_set_bg_color(st, lv_color_hex(0x202020));
+  lv_style_set_bg_opa(st, LV_OPA_COVER);
+  lv_style_set_border_width(st, 1);
+  lv_style_set_border_color(st, lv_color_hex(0x3A3A3A));
+  lv_style_set_radius(st, 14);
+  lv_style_set_pad_all(st, 12);
+  lv_style_set_pad_row(st, 10);
+
+  st = &s_styles[UI_STYLE_BARE];
+  lv_style_set_bg_opa(st, LV_OPA_TRANSP);
+  lv_style_set_border_width(st, 0);
+  lv_style_set_pad_all(st, 0);
+
+  st = &s_styles[UI_STYLE_BTN_PRIMARY];
+  lv_style_set_radius(st, 10);
+  lv_style_set_bg_color(st, lv_color_hex(0x1FA95B));
+  lv_style_set_border_width(st, 0);
+
+  st = &s_styles[UI_STYLE_BTN_SECONDARY];
+  lv_style_set_radius(st, 10);
+  lv_style_set_bg_color(st, lv_color_hex(0x323232));
+  lv_style_set_border_width(st, 0);
+
+  st = &s_styles[UI_STYLE_CARD];
+  lv_style_set_radius(st, 20);
+  lv_style_set_bg_color(st, lv_color_hex(0x1A1A1A));
+  lv_style_set_border_color(st, lv_color_hex(0x2C2C2C));
+  lv_style_set_border_width(st, 1);
+  lv_style_set_pad_top(st, 9);
+  lv_style_set_pad_bottom(st, 7);
+  lv_style_set_pad_left(st, 22);
+  lv_style_set_pad_right(st, 22);
+
+  st = &s_styles[UI_STYLE_TEXT_TITLE];
+  lv_style_set_text_font(st, &kakao_kr_24);
+  lv_style_set_text_color(st, lv_color_hex(0xE6E6E6));
+
+  st = &s_styles[UI_STYLE_TEXT_BODY];
+  lv_style_set_text_font(st, &kakao_kr_16);
+
+  st = &s_styles[UI_STYLE_TEXT_MSG];
+  lv_style_set_text_font(st, &kakao_kr_16);
+  lv_style_set_text_color(st, lv_color_hex(0xD0D0D0));
+  lv_style_set_text_align(st, LV_TEXT_ALIGN_CENTER);
+
+  st = &s_styles[UI_STYLE_TEXT_MUTED];
+  lv_style_set_text_font(st, &kakao_kr_16);
+  lv_style_set_text_color(st, lv_color_hex(0x9A9A9A));
+
+  st = &s_styles[UI_STYLE_TEXT_DIM];
+  lv_style_set_text_font(st, &kakao_kr_16);
+  lv_style_set_text_color(st, lv_color_hex(0x707070));
+
+  s_ready = true;
+}
+
+lv_style_t* ui_theme_style(UiStyleId id) {
+  if (!s_ready) init_styles();
+  return &s_styles[id < UI_STYLE_COUNT ? id : UI_STYLE_BARE];
+}
+
+void ui_theme_add(lv_obj_t* obj, UiStyleId id) {
+  if (!obj) return;
+  lv_obj_add_style(obj, ui_theme_style(id), 0);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <lvgl.h>
+
+// 화면 빌더가 공유하는 정적 lv_style_t 모음.
+//
+// lv_obj_set_style_*는 객체마다 로컬 스타일 저장소를 할당한다. 같은 모양(팝업, 버튼, 카드, 글자 단계)은
+// 여기 스타일 하나를 lv_obj_add_style로 붙여 객체당 포인터 한 칸만 쓰게 하고, 색·여백은 이 파일에서만 바꾼다.
+// 객체별로 달라지는 값(크기, 위치, 상태색)은 계속 로컬 스타일로 덮어쓴다(로컬이 우선).
+
+enum UiStyleId : uint8_t {
+  UI_STYLE_POPUP = 0,       // 확인/안내 다이얼로그 상자(0x202020, 테두리 1, 둥글기 14, 여백 12)
+  UI_STYLE_BARE,            // 헤더·버튼 줄 등 투명 컨테이너(배경·테두리·여백 없음)
+  UI_STYLE_BTN_PRIMARY,     // 초록 주 버튼
+  UI_STYLE_BTN_SECONDARY,   // 회색 보조(취소/닫기) 버튼
+  UI_STYLE_CARD,            // 과제 카드
+  UI_STYLE_TEXT_TITLE,      // 24pt, 밝은 회색
+  UI_STYLE_TEXT_BODY,       // 16pt, 색은 부모/테마를 따름(버튼 라벨 등)
+  UI_STYLE_TEXT_MSG,        // 16pt, 0xD0D0D0, 가운데 정렬(다이얼로그 본문)
+  UI_STYLE_TEXT_MUTED,      // 16pt, 0x9A9A9A
+  UI_STYLE_TEXT_DIM,        // 16pt, 0x707070
+  UI_STYLE_COUNT
+};
+
+// 처음 호출될 때 스타일을 한 번 초기화한다(lv_init() 이후).
+void ui_theme_add(lv_obj_t* obj, UiStyleId id);
+lv_style_t* ui_theme_style(UiStyleId id);
@@ -0,0 +1,480 @@
+#include "wifi_manager.h"
+
+#include <Preferences.h>
+#include <esp_attr.h>
+#include <esp_wifi.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef CFG_WIFI_FAST_MS
+#define CFG_WIFI_FAST_MS 3000  // 캐시 BSSID/채널 접속 대기(보통 1초 안에 붙는다)
+#endif
+#ifndef CFG_WIFI_JOIN_MS
+#define CFG_WIFI_JOIN_MS 6000  // 스캔 후보 하나당 대기
+#endif
+#ifndef CFG_WIFI_LOST_GRACE_MS
+#define CFG_WIFI_LOST_GRACE_MS 8000  // 끊긴 뒤 드라이버 자동 재접속을 기다리는 시간
+#endif
+#ifndef CFG_WIFI_RESCAN_MS
+#define CFG_WIFI_RESCAN_MS 5000  // 후보를 모두 실패한 뒤 다음 스캔까지
+#endif
+#ifndef CFG_WIFI_ROAM_RSSI
+#define CFG_WIFI_ROAM_RSSI -72
+#endif
+#ifndef CFG_WIFI_ROAM_DELTA
+#define CFG_WIFI_ROAM_DELTA 8
+#endif
+#ifndef CFG_WIFI_ROAM_HOLD_MS
+#define CFG_WIFI_ROAM_HOLD_MS 10000  // 평균 RSSI가 이만큼 계속 약해야 로밍 스캔
+#endif
+#ifndef CFG_WIFI_ROAM_SCAN_MS
+#define CFG_WIFI_ROAM_SCAN_MS 60000  // 로밍 스캔 최소 간격
+#endif
+
+namespace {
+
+const uint32_t kCacheMagic = 0x57464332;  // "WFC2"(IP 필드를 뺀 배치)
+const uint32_t kRssiSampleMs = 2000;
+const uint32_t kScanTimeoutMs = 15000;
+
+struct WifiCache {
+  uint32_t magic;
+  char ssid[33];
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t sum;
+};
+
+// 소프트 리셋(OTA, 워치독, esp_restart)은 RTC 메모리가 살아 있어 NVS 읽기도 건너뛴다.
+RTC_DATA_ATTR WifiCache s_rtc_cache;
+
+uint32_t cache_sum(const WifiCache& c) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(&c);
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < offsetof(WifiCache, sum); ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+bool cache_valid(const WifiCache& c) {
+  return c.magic == kCacheMagic && c.channel > 0 && c.ssid[0] && c.sum == cache_sum(c);
+}
+
+uint8_t load_cache(WifiCache& out) {
+  if (cache_valid(s_rtc_cache)) {
+    out = s_rtc_cache;
+    return 1;
+  }
+  Preferences prefs;
+  prefs.begin("m5wifi", true);
+  const size_t n = prefs.getBytes("cache", &out, sizeof(out));
+  prefs.end();
+  if (n == sizeof(out) && cache_valid(out)) {
+    s_rtc_cache = out;
+    return 2;
+  }
+  memset(&out, 0, sizeof(out));
+  return 0;
+}
+
+void store_cache(WifiCache& c) {
+  c.magic = kCacheMagic;
+  c.sum = cache_sum(c);
+  s_rtc_cache = c;
+  Preferences prefs;
+  prefs.begin("m5wifi", false);
+  prefs.putBytes("cache", &c, sizeof(c));
+  prefs.end();
+}
+
+bool wifi_failed(wl_status_t st) {
+  return st == WL_NO_SSID_AVAIL || st == WL_CONNECT_FAILED;
+}
+
+}  // namespace
+
+WifiManager::WifiManager()
+    : ssids_(nullptr),
+      ssid_count_(0),
+      pass_(""),
+      diag_(nullptr),
+      state_(WIFI_MGR_IDLE),
+      state_ms_(0),
+      begin_ms_(0),
+      scan_started_ms_(0),
+      next_scan_ms_(0),
+      next_rssi_ms_(0),
+      weak_since_ms_(0),
+      last_roam_scan_ms_(0),
+      roam_scan_(false),
+      booted_(false),
+      join_path_(WIFI_PATH_NONE),
+      roam_from_channel_(0),
+      roam_ssid_idx_(0),
+      cand_count_(0),
+      cand_next_(0) {
+  memset(cand_, 0, sizeof(cand_));
+  memset(roam_from_bssid_, 0, sizeof(roam_from_bssid_));
+  memset(fallback_ssid_, 0, sizeof(fallback_ssid_));
+  memset(&stats_, 0, sizeof(stats_));
+}
+
+const char* WifiManager::state_name(WifiMgrState s) {
+  switch (s) {
+    case WIFI_MGR_IDLE: return "idle";
+    case WIFI_MGR_FAST: return "fast";
+    case WIFI_MGR_SCAN: return "scan";
+    case WIFI_MGR_JOIN: return "join";
+    case WIFI_MGR_WAIT: return "wait";
+    case WIFI_MGR_CONNECTED: return "connected";
+    case WIFI_MGR_LOST: return "lost";
+    default: return "?";
+  }
+}
+
+const char* WifiManager::path_name(uint8_t p) {
+  switch (p) {
+    case WIFI_PATH_FAST: return "fast";
+    case WIFI_PATH_SCAN: return "scan";
+    case WIFI_PATH_FALLBACK: return "fallback";
+    case WIFI_PATH_AUTO: return "auto";
+    case WIFI_PATH_ROAM: return "roam";
+    default: return "none";
+  }
+}
+
+void WifiManager::begin(const char* const* ssids, uint8_t ssid_count, const char* pass, String* diag) {
+  ssids_ = ssids;
+  ssid_count_ = ssid_count > kMaxSsids ? kMaxSsids : ssid_count;
+  pass_ = pass ? pass : "";
+  diag_ = diag;
+  begin_ms_ = millis();
+
+  // 접속 설정은 우리가 캐시하므로 드라이버가 begin마다 NVS에 다시 쓰지 않게 한다.
+  WiFi.persistent(false);
+  // 2.4GHz만 사용, 채널 자동
+  WiFi.mode(WIFI_STA);
+  WiFi.setSleep(false);
+  WiFi.setAutoReconnect(true);
+  // 채널 12/13 사용을 위해 국가 코드 설정 (KR)
+  wifi_country_t kr = {"KR", 1, 13, WIFI_COUNTRY_POLICY_AUTO};
+  esp_wifi_set_country(&kr);
+
+  if (!start_fast(begin_ms_)) start_scan(begin_ms_, false);
+}
+
+void WifiManager::enter(WifiMgrState s, uint32_t now_ms) {
+  if (s == state_) return;
+  Serial.printf("[WiFi][MGR] %s -> %s after %lums\n", state_name(state_), state_name(s), (unsigned long)(now_ms - state_ms_));
+  state_ = s;
+  state_ms_ = now_ms;
+}
+
+bool WifiManager::start_fast(uint32_t now_ms) {
+  WifiCache c;
+  stats_.cache_source = load_cache(c);
+  if (!stats_.cache_source) return false;
+  bool known = false;
+  for (uint8_t i = 0; i < ssid_count_; ++i) {
+    if (strcmp(ssids_[i], c.ssid) == 0) known = true;
+  }
+  if (!known) return false;  // 설정 SSID가 바뀐 펌웨어: 스캔부터
+
+  Serial.printf("[WiFi][MGR] fast connect ssid=%s bssid=%02x:%02x:%02x:%02x:%02x:%02x ch=%u src=%s\n",
+                c.ssid,
+                c.bssid[0], c.bssid[1], c.bssid[2], c.bssid[3], c.bssid[4], c.bssid[5],
+                (unsigned)c.channel,
+                stats_.cache_source == 1 ? "rtc" : "nvs");
+  if (diag_) *diag_ += "fast_attempt ch" + String(c.channel) + "\n";
+  WiFi.begin(c.ssid, pass_, c.channel, c.bssid);
+  enter(WIFI_MGR_FAST, now_ms);
+  return true;
+}
+
+void WifiManager::start_scan(uint32_t now_ms, bool roam) {
+  if (roam) last_roam_scan_ms_ = now_ms;  // 시작 실패도 간격에 넣어 매 샘플마다 다시 걸지 않게 한다
+  // 연결 시도 중에는 ESP-IDF가 스캔을 거부하므로 미연결 스캔 전에는 시도를 멈춘다.
+  if (!roam) WiFi.disconnect();
+  // 로밍 스캔은 연결을 유지한 채 채널을 잠깐씩 떠나므로 채널당 체류를 짧게 둔다.
+  const int16_t r = WiFi.scanNetworks(true, false, false, roam ? 120 : 300);
+  if (r == WIFI_SCAN_FAILED) {
+    Serial.println("[WiFi][MGR] scan start failed");
+    if (!roam) {
+      next_scan_ms_ = now_ms + CFG_WIFI_RESCAN_MS;
+      enter(WIFI_MGR_WAIT, now_ms);
+    }
+    return;
+  }
+  roam_scan_ = roam;
+  scan_started_ms_ = now_ms;
+  if (roam) {
+    stats_.roam_scans++;
+  } else {
+    enter(WIFI_MGR_SCAN, now_ms);
+  }
+}
+
+void WifiManager::collect_scan(int n, uint32_t now_ms) {
+  stats_.scans++;
+  stats_.last_scan_ms = now_ms - scan_started_ms_;
+  stats_.last_scan_count = (int16_t)n;
+  cand_count_ = 0;
+  cand_next_ = 0;
+  const bool first_diag = diag_ && !booted_ && stats_.scans == 1;
+  if (first_diag) *diag_ += "scan_nets=" + String(n) + " scan_ms=" + String((unsigned long)stats_.last_scan_ms) + "\n";
+
+  // 설정한 SSID의 AP를 RSSI 내림차순으로 상위 kMaxCandidates개만 남긴다(같은 SSID 여러 AP 포함).
+  for (int i = 0; i < n; ++i) {
+    const String s = WiFi.SSID(i);
+    const int rssi = WiFi.RSSI(i);
+    if (first_diag && i < 12) {
+      *diag_ += "ap[" + String(i) + "]=" + s + " ch" + String(WiFi.channel(i)) + " rssi" + String(rssi) + "\n";
+    }
+    uint8_t idx = 0xFF;
+    for (uint8_t k = 0; k < ssid_count_; ++k) {
+      if (s == ssids_[k]) {
+        idx = k;
+        break;
+      }
+    }
+    if (idx == 0xFF) continue;
+    uint8_t pos = cand_count_;
+    while (pos > 0 && cand_[pos - 1].rssi < rssi) --pos;
+    if (pos >= kMaxCandidates) continue;
+    const uint8_t last = cand_count_ < kMaxCandidates ? cand_count_ : kMaxCandidates - 1;
+    memmove(&cand_[pos + 1], &cand_[pos], sizeof(Candidate) * (last - pos));
+    memcpy(cand_[pos].bssid, WiFi.BSSID(i), 6);
+    cand_[pos].channel = (uint8_t)WiFi.channel(i);
+    cand_[pos].rssi = (int8_t)rssi;
+    cand_[pos].ssid_idx = idx;
+    if (cand_count_ < kMaxCandidates) cand_count_++;
+  }
+  join_path_ = WIFI_PATH_SCAN;
+
+  // 설정 SSID가 안 보이면(한글 SSID 인코딩 차이 등) 스캔 순서(드라이버가 RSSI순으로 준다)대로 몇 개를 시도한다.
+  if (cand_count_ == 0 && !roam_scan_) {
+    for (int i = 0; i < n && cand_count_ < kMaxCandidates; ++i) {
+      const String s = WiFi.SSID(i);
+      if (s.length() == 0 || s.length() > 32) continue;
+      Candidate& c = cand_[cand_count_];
+      memcpy(c.bssid, WiFi.BSSID(i), 6);
+      c.channel = (uint8_t)WiFi.channel(i);
+      c.rssi = (int8_t)WiFi.RSSI(i);
+      c.ssid_idx = 0xFF;
+      memcpy(fallback_ssid_[cand_count_], s.c_str(), s.length() + 1);
+      cand_count_++;
+    }
+    join_path_ = WIFI_PATH_FALLBACK;
+    if (first_diag) *diag_ += "fallback entered=1\n";
+  }
+}
+
+bool WifiManager::join_next(uint32_t now_ms) {
+  if (cand_next_ >= cand_count_) return false;
+  const uint8_t i = cand_next_++;
+  const Candidate& c = cand_[i];
+  const char* ssid = c.ssid_idx == 0xFF ? fallback_ssid_[i] : ssids_[c.ssid_idx];
+  stats_.joins++;
+  Serial.printf("[WiFi][MGR] join[%u/%u] %s ch=%u rssi=%d (%s)\n",
+                (unsigned)(i + 1), (unsigned)cand_count_, ssid, (unsigned)c.channel, (int)c.rssi, path_name(join_path_));
+  if (diag_ && !booted_) {
+    *diag_ += "join[" + String(i) + "]=" + String(ssid) + " ch" + String(c.channel) + " rssi" + String(c.rssi) + "\n";
+  }
+  WiFi.begin(ssid, pass_, c.channel, c.bssid);
+  enter(WIFI_MGR_JOIN, now_ms);
+  state_ms_ = now_ms;  // 후보마다 타이머를 새로 잡는다
+  return true;
+}
+
+void WifiManager::on_connected(uint32_t now_ms, uint8_t path) {
+  const int rssi = WiFi.RSSI();
+  const uint32_t took = now_ms - (booted_ ? state_ms_ : begin_ms_);
+  stats_.rssi_avg = (int16_t)rssi;
+  weak_since_ms_ = 0;
+  next_rssi_ms_ = now_ms + kRssiSampleMs;
+  enter(WIFI_MGR_CONNECTED, now_ms);
+  Serial.printf("[WiFi][MGR] connected via %s in %lums ssid=%s bssid=%s ch=%d ip=%s rssi=%d\n",
+                path_name(path),
+                (unsigned long)took,
+                WiFi.SSID().c_str(),
+                WiFi.BSSIDstr().c_str(),
+                WiFi.channel(),
+                WiFi.localIP().toString().c_str(),
+                rssi);
+  if (!booted_) {
+    booted_ = true;
+    stats_.boot_connect_ms = now_ms - begin_ms_;
+    stats_.boot_path = path;
+    if (diag_) {
+      *diag_ += "final connected=1 path=" + String(path_name(path)) + " rssi=" + String(rssi) +
+                " total_ms=" + String((unsigned long)stats_.boot_connect_ms) + "\n";
+    }
+  }
+  save_cache();
+}
+
+void WifiManager::save_cache() {
+  // 연결 정보가 바뀐 경우에만 쓴다(재접속마다 플래시를 쓰지 않게).
+  WifiCache c;
+  memset(&c, 0, sizeof(c));
+  const String ssid = WiFi.SSID();
+  if (ssid.length() == 0 || ssid.length() > 32) return;
+  memcpy(c.ssid, ssid.c_str(), ssid.length() + 1);
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid) memcpy(c.bssid, bssid, 6);
+  c.channel = (uint8_t)WiFi.channel();
+
+  WifiCache old;
+  if (load_cache(old) && strcmp(old.ssid, c.ssid) == 0 && memcmp(old.bssid, c.bssid, 6) == 0 &&
+      old.channel == c.channel) {
+    return;
+  }
+  store_cache(c);
+  Serial.printf("[WiFi][MGR] cache saved ch=%u\n", (unsigned)c.channel);
+}
+
+// 로밍 대상 AP에 못 붙었다. 원래 AP에 그대로 붙어 있으면 그걸로 끝이고, 아니면 원래 AP로 다시 접속을
+// 걸어 LOST 유예 동안 기다린다. 그래도 안 되면 LOST가 전체 스캔으로 넘긴다.
+void WifiManager::roam_back(uint32_t now_ms, wl_status_t st) {
+  stats_.roam_fail++;
+  if (st == WL_CONNECTED) {
+    Serial.printf("[WiFi][MGR] roam failed, still on bssid=%s\n", WiFi.BSSIDstr().c_str());
+    on_connected(now_ms, WIFI_PATH_AUTO);
+    return;
+  }
+  Serial.printf("[WiFi][MGR] roam failed status=%d -> back to previous AP ch=%u\n", (int)st, (unsigned)roam_from_channel_);
+  WiFi.begin(ssids_[roam_ssid_idx_], pass_, roam_from_channel_, roam_from_bssid_);
+  enter(WIFI_MGR_LOST, now_ms);
+}
+
+void WifiManager::poll(uint32_t now_ms) {
+  const wl_status_t st = WiFi.status();
+  const uint32_t age = now_ms - state_ms_;
+  switch (state_) {
+    case WIFI_MGR_IDLE:
+      break;
+
+    case WIFI_MGR_FAST:
+      if (st == WL_CONNECTED) {
+        on_connected(now_ms, WIFI_PATH_FAST);
+      } else if (wifi_failed(st) || age >= CFG_WIFI_FAST_MS) {
+        stats_.fast_fail++;
+        Serial.printf("[WiFi][MGR] fast connect failed status=%d after %lums -> scan\n", (int)st, (unsigned long)age);
+        if (diag_) *diag_ += "fast_result connected=0 status=" + String((int)st) + " elapsed_ms=" + String((unsigned long)age) + "\n";
+        start_scan(now_ms, false);
+      }
+      break;
+
+    case WIFI_MGR_SCAN: {
+      const int16_t n = WiFi.scanComplete();
+      if (n == WIFI_SCAN_RUNNING && age < kScanTimeoutMs) break;
+      if (n >= 0) collect_scan(n, now_ms);
+      WiFi.scanDelete();
+      if (n < 0 || !join_next(now_ms)) {
+        Serial.printf("[WiFi][MGR] scan gave no candidate (n=%d) -> retry in %lums\n", (int)n, (unsigned long)CFG_WIFI_RESCAN_MS);
+        next_scan_ms_ = now_ms + CFG_WIFI_RESCAN_MS;
+        enter(WIFI_MGR_WAIT, now_ms);
+      }
+      break;
+    }
+
+    case WIFI_MGR_JOIN: {
+      // 로밍은 연결된 채로 begin하므로 새 AP에 붙었는지 BSSID로 확인한다.
+      const uint8_t* want = cand_next_ > 0 ? cand_[cand_next_ - 1].bssid : nullptr;
+      const uint8_t* cur = WiFi.BSSID();
+      const bool on_target = join_path_ != WIFI_PATH_ROAM || (want && cur && memcmp(want, cur, 6) == 0);
+      if (st == WL_CONNECTED && on_target) {
+        on_connected(now_ms, join_path_);
+      } else if (wifi_failed(st) || age >= CFG_WIFI_JOIN_MS) {
+        if (join_path_ == WIFI_PATH_ROAM) {
+          roam_back(now_ms, st);
+        } else if (!join_next(now_ms)) {
+          next_scan_ms_ = now_ms + CFG_WIFI_RESCAN_MS;
+          enter(WIFI_MGR_WAIT, now_ms);
+        }
+      }
+      break;
+    }
+
+    case WIFI_MGR_WAIT:
+      if (st == WL_CONNECTED) {
+        on_connected(now_ms, WIFI_PATH_AUTO);
+      } else if ((int32_t)(now_ms - next_scan_ms_) >= 0) {
+        start_scan(now_ms, false);
+      }
+      break;
+
+    case WIFI_MGR_LOST:
+      if (st == WL_CONNECTED) {
+        on_connected(now_ms, WIFI_PATH_AUTO);
+      } else if (age >= CFG_WIFI_LOST_GRACE_MS) {
+        start_scan(now_ms, false);
+      }
+      break;
+
+    case WIFI_MGR_CONNECTED: {
+      if (st != WL_CONNECTED) {
+        stats_.disconnects++;
+        if (roam_scan_) {
+          WiFi.scanDelete();
+          roam_scan_ = false;
+        }
+        Serial.printf("[WiFi][MGR] link lost status=%d rssi_avg=%d\n", (int)st, (int)stats_.rssi_avg);
+        enter(WIFI_MGR_LOST, now_ms);
+        break;
+      }
+      if (roam_scan_) {
+        const int16_t n = WiFi.scanComplete();
+        if (n == WIFI_SCAN_RUNNING && now_ms - scan_started_ms_ < kScanTimeoutMs) break;
+        if (n >= 0) collect_scan(n, now_ms);
+        WiFi.scanDelete();
+        roam_scan_ = false;
+        const uint8_t* cur = WiFi.BSSID();
+        const int cur_rssi = WiFi.RSSI();
+        for (uint8_t i = 0; n >= 0 && i < cand_count_; ++i) {
+          if (cur && memcmp(cand_[i].bssid, cur, 6) == 0) continue;
+          if (cand_[i].rssi < cur_rssi + CFG_WIFI_ROAM_DELTA) break;  // RSSI 내림차순
+          Serial.printf("[WiFi][MGR] roam %d dBm -> %d dBm ch=%u\n", cur_rssi, (int)cand_[i].rssi, (unsigned)cand_[i].channel);
+          stats_.roams++;
+          if (cur) memcpy(roam_from_bssid_, cur, 6);
+          roam_from_channel_ = (uint8_t)WiFi.channel();
+          roam_ssid_idx_ = cand_[i].ssid_idx;
+          join_path_ = WIFI_PATH_ROAM;
+          cand_next_ = i;
+          join_next(now_ms);
+          return;
+        }
+        break;
+      }
+      if ((int32_t)(now_ms - next_rssi_ms_) < 0) break;
+      next_rssi_ms_ = now_ms + kRssiSampleMs;
+      stats_.rssi_avg = (int16_t)((stats_.rssi_avg * 3 + WiFi.RSSI()) / 4);
+      if (stats_.rssi_avg >= CFG_WIFI_ROAM_RSSI) {
+        weak_since_ms_ = 0;
+      } else if (weak_since_ms_ == 0) {
+        weak_since_ms_ = now_ms;
+      } else if (now_ms - weak_since_ms_ >= CFG_WIFI_ROAM_HOLD_MS &&
+                 (last_roam_scan_ms_ == 0 || now_ms - last_roam_scan_ms_ >= CFG_WIFI_ROAM_SCAN_MS)) {
+        Serial.printf("[WiFi][MGR] weak signal rssi_avg=%d for %lums -> roam scan\n",
+                      (int)stats_.rssi_avg, (unsigned long)(now_ms - weak_since_ms_));
+        start_scan(now_ms, true);
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void WifiManager::append_diag(String& out) const {
+  out += "wifi_connect_ms=" + String((unsigned long)stats_.boot_connect_ms) + "\n";
+  out += "wifi_path=" + String(path_name(stats_.boot_path)) + "\n";
+  out += "wifi_cache=" + String(stats_.cache_source == 1 ? "rtc" : (stats_.cache_source == 2 ? "nvs" : "none")) + "\n";
+  out += "wifi_fast_fail=" + String((unsigned)stats_.fast_fail) + " scans=" + String((unsigned)stats_.scans) +
+         " joins=" + String((unsigned)stats_.joins) + " last_scan_ms=" + String((unsigned long)stats_.last_scan_ms) + "\n";
+  out += "wifi_disconnects=" + String((unsigned)stats_.disconnects) + " roam_scans=" + String((unsigned)stats_.roam_scans) +
+         " roams=" + String((unsigned)stats_.roams) + " roam_fail=" + String((unsigned)stats_.roam_fail) + " rssi_avg=" + String((int)stats_.rssi_avg) + "\n";
+}
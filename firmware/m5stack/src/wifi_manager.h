@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+// WiFi 접속/로밍 관리(loop()에서 구동, 블로킹 없음).
+//
+// 예전 setup()은 WiFi.scanNetworks(동기, 수 초) → 가장 강한 BSSID에 8초 대기 →
+// 스캔된 네트워크마다 6초씩 순차 시도를 했다. AP가 많은 학원에서는 첫 화면까지 수십 초가 걸렸다.
+// 여기서는
+//  1) 마지막으로 붙었던 SSID/BSSID/채널(RTC 메모리, 없으면 NVS "m5wifi")로 바로 접속한다.
+//     채널을 알면 전 채널 스캔을 건너뛴다. 주소는 매번 DHCP로 받는다(지난 임대를 고정 IP로 쓰면
+//     임대가 끝나 다른 기기에 넘어간 주소와 충돌할 수 있다).
+//  2) 실패하면 비동기 스캔(WiFi.scanNetworks(true))을 걸고 scanComplete()만 확인한다.
+//     설정한 SSID 중 가장 강한 AP부터, 없으면 스캔 목록 상위 몇 개를 차례로 시도한다.
+//  3) 연결된 뒤에는 RSSI 평균이 CFG_WIFI_ROAM_RSSI 아래로 계속 머물 때만 백그라운드 스캔을 하고,
+//     같은 SSID의 다른 AP가 CFG_WIFI_ROAM_DELTA dB 이상 강할 때만 옮긴다.
+//     옮기기에 실패하면 원래 AP로 다시 붙어 보고(LOST 유예), 그래도 안 될 때만 전체 스캔으로 간다.
+//
+//   IDLE ─begin─▶ FAST ──실패──▶ SCAN ──결과──▶ JOIN ──▶ CONNECTED ──끊김──▶ LOST ──시간 초과──▶ SCAN
+//                  │ 성공                       │ 후보 소진 → WAIT → SCAN      ▲  │ RSSI 약함
+//                  └──────────────▶ CONNECTED   └───────────────────────────────┘  └─▶ 로밍 스캔(연결 유지)
+//
+// 부팅마다 접속까지 걸린 시간과 경로(fast/scan/fallback)를 stats()로 남겨 WIFI-DIAG에 싣는다.
+
+enum WifiMgrState : uint8_t {
+  WIFI_MGR_IDLE = 0,
+  WIFI_MGR_FAST,       // 캐시한 BSSID/채널로 바로 접속 중
+  WIFI_MGR_SCAN,       // 비동기 스캔 중(미연결)
+  WIFI_MGR_JOIN,       // 스캔 후보에 접속 중
+  WIFI_MGR_WAIT,       // 후보 소진, 다음 스캔 대기
+  WIFI_MGR_CONNECTED,
+  WIFI_MGR_LOST,       // 연결이 끊김, 드라이버 자동 재접속을 잠시 기다린다
+  WIFI_MGR_STATE_COUNT
+};
+
+enum WifiConnectPath : uint8_t {
+  WIFI_PATH_NONE = 0,
+  WIFI_PATH_FAST,      // 캐시로 접속
+  WIFI_PATH_SCAN,      // 스캔에서 설정 SSID를 찾아 접속
+  WIFI_PATH_FALLBACK,  // 설정 SSID가 스캔에 안 보여 목록 순서대로 시도(한글 SSID 인코딩 문제 대비)
+  WIFI_PATH_AUTO,      // 끊긴 뒤 드라이버 자동 재접속
+  WIFI_PATH_ROAM,
+};
+
+struct WifiMgrStats {
+  uint32_t boot_connect_ms;   // begin() → 이번 부팅 첫 연결(0: 아직)
+  uint8_t boot_path;          // WifiConnectPath
+  uint8_t cache_source;       // 0 없음, 1 RTC, 2 NVS
+  uint16_t fast_fail;
+  uint16_t scans;
+  uint16_t joins;             // 스캔 후보 접속 시도 수
+  uint16_t disconnects;
+  uint16_t roam_scans;
+  uint16_t roams;
+  uint16_t roam_fail;         // 새 AP에 못 붙어 원래 AP로 되돌아간 횟수
+  uint32_t last_scan_ms;      // 마지막 스캔 소요
+  int16_t last_scan_count;
+  int16_t rssi_avg;           // 연결 중 RSSI 지수 평균(dBm)
+};
+
+class WifiManager {
+ public:
+  static const uint8_t kMaxSsids = 2;
+  static const uint8_t kMaxCandidates = 6;
+
+  WifiManager();
+
+  // setup: ssids는 우선순위 순(프로그램 수명 동안 유지). 라디오를 켜고 첫 시도를 건다.
+  void begin(const char* const* ssids, uint8_t ssid_count, const char* pass, String* diag);
+  // loop: 매 프레임 호출. 상태 하나만 진행하고 곧바로 돌아온다.
+  void poll(uint32_t now_ms);
+
+  bool connected() const { return state_ == WIFI_MGR_CONNECTED; }
+  WifiMgrState state() const { return state_; }
+  static const char* state_name(WifiMgrState s);
+  static const char* path_name(uint8_t p);
+  const WifiMgrStats& stats() const { return stats_; }
+  uint32_t begin_ms() const { return begin_ms_; }
+
+  // 진단 문자열에 통계를 덧붙인다(loop 스레드 또는 첫 연결 이후 읽기 전용 시점).
+  void append_diag(String& out) const;
+
+ private:
+  struct Candidate {
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;
+    uint8_t ssid_idx;  // ssids_ 인덱스, 0xFF면 스캔 목록의 다른 SSID(fallback_ssid_)
+  };
+
+  void enter(WifiMgrState s, uint32_t now_ms);
+  bool start_fast(uint32_t now_ms);
+  void start_scan(uint32_t now_ms, bool roam);
+  void collect_scan(int n, uint32_t now_ms);
+  bool join_next(uint32_t now_ms);
+  void on_connected(uint32_t now_ms, uint8_t path);
+  void save_cache();
+  void roam_back(uint32_t now_ms, wl_status_t st);
+
+  const char* const* ssids_;
+  uint8_t ssid_count_;
+  const char* pass_;
+  String* diag_;
+
+  WifiMgrState state_;
+  uint32_t state_ms_;
+  uint32_t begin_ms_;
+  uint32_t scan_started_ms_;
+  uint32_t next_scan_ms_;
+  uint32_t next_rssi_ms_;
+  uint32_t weak_since_ms_;
+  uint32_t last_roam_scan_ms_;
+  bool roam_scan_;
+  bool booted_;
+  uint8_t join_path_;
+  uint8_t roam_from_bssid_[6];  // 로밍 직전 AP(실패하면 여기로 다시 붙는다)
+  uint8_t roam_from_channel_;
+  uint8_t roam_ssid_idx_;
+
+  Candidate cand_[kMaxCandidates];
+  uint8_t cand_count_;
+  uint8_t cand_next_;
+  char fallback_ssid_[kMaxCandidates][33];
+
+  WifiMgrStats stats_;
+};
@@ -0,0 +1,134 @@
+// 발신 커맨드 인코더(src/mqtt_cmd_encoder.*) 호스트 벤치마크.
+//
+// 커맨드마다 힙 할당 횟수와 µs/건을 잰다. 비교용으로 예전 방식(토픽 String 덧셈 + 문자열 직렬화)을
+// std::string으로 흉내 낸 경로도 같이 돈다. 할당은 malloc/free를 가로채 세므로 Linux(glibc) 전용.
+//
+// 사용:
+//   g++ -O2 -std=c++17 -I src tools/bench_cmd_encoder.cpp src/mqtt_cmd_encoder.cpp -o /tmp/bench_cmd
+//   /tmp/bench_cmd [반복 횟수=200000]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "mqtt_cmd_encoder.h"
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void __libc_free(void*);
+
+static unsigned long g_allocs = 0;
+static bool g_counting = false;
+
+extern "C" void* malloc(size_t n) {
+  if (g_counting) g_allocs++;
+  return __libc_malloc(n);
+}
+extern "C" void* calloc(size_t n, size_t sz) {
+  if (g_counting) g_allocs++;
+  return __libc_calloc(n, sz);
+}
+extern "C" void* realloc(void* p, size_t n) {
+  if (g_counting) g_allocs++;
+  return __libc_realloc(p, n);
+}
+extern "C" void free(void* p) { __libc_free(p); }
+
+static const char* kAcademy = "6f1c2a7e-3b5d-4c8e-9a01-2b3c4d5e6f70";
+static const char* kDevice = "m5-core2-0a1b2c3d4e5f";
+static const char* kStudent = "9e8d7c6b-5a49-4382-b1c0-f1e2d3c4b5a6";
+static const char* kItem = "c0ffee00-1234-4abc-8def-0123456789ab";
+
+static volatile size_t g_sink = 0;  // 최적화로 본문이 사라지지 않게
+
+static MqttCmdEncoder g_enc;
+
+static void cmd_homework_action(uint32_t i) {
+  static CmdScratch<288> scratch;
+  static char topic[MqttCmdEncoder::kTopicBytes];
+  g_enc.bind(kAcademy, kDevice, kStudent);
+  if (!g_enc.homework_topic(kItem, topic, sizeof(topic))) return;
+  CmdJsonWriter w = scratch.begin();
+  w.str("action", "pause")
+      .str("academy_id", g_enc.academy_id())
+      .str("student_id", g_enc.student_id())
+      .str("item_id", kItem)
+      .hex32("idempotency_key", i * 2654435761u)
+      .str("at", "")
+      .str("updated_by", g_enc.student_id());
+  const char* payload = w.finish();
+  g_sink += payload ? w.length() + topic[0] : 0;
+}
+
+static void cmd_list_homeworks(uint32_t) {
+  CmdScratch<128> scratch;
+  g_enc.bind(kAcademy, kDevice, kStudent);
+  const char* payload = scratch.begin().str("action", "list_homeworks").str("student_id", kStudent).finish();
+  g_sink += payload ? payload[0] + g_enc.device_topic(MQTT_DEV_TOPIC_COMMAND)[0] : 0;
+}
+
+static void cmd_sync_ack(uint32_t i) {
+  CmdScratch<448> scratch;
+  g_enc.bind(kAcademy, kDevice, kStudent);
+  CmdJsonWriter w = scratch.begin();
+  w.str("type", "homeworks_apply")
+      .boolean("ok", true)
+      .str("device_id", g_enc.device_id())
+      .str("student_id", g_enc.student_id())
+      .num("sync_seq", (long)i)
+      .str("sync_fp", "3f2a9c1d8e7b6a50")
+      .str("source", "gateway")
+      .num("group_count", 6)
+      .str("report_reason", "apply")
+      .num("rx_coalesced", 0)
+      .num("rx_dropped", 0)
+      .num("decode_us", 812)
+      .str("wire", "msgpack")
+      .num("patch", 1)
+      .str("at", "");
+  const char* payload = w.finish();
+  g_sink += payload ? w.length() : 0;
+}
+
+// 예전 경로: 토픽을 덧셈으로 만들고 본문을 String에 직렬화한다(ArduinoJson 문서 할당은 빠져 있어 실제보다 적게 센다).
+static void legacy_homework_action(uint32_t i) {
+  std::string topic = std::string("academies/") + kAcademy + "/students/" + kStudent + "/homework/" + kItem + "/command";
+  char key[12];
+  snprintf(key, sizeof(key), "%lx", (unsigned long)(i * 2654435761u));
+  std::string payload;
+  payload += "{\"action\":\"pause\",\"academy_id\":\"";
+  payload += kAcademy;
+  payload += "\",\"student_id\":\"";
+  payload += kStudent;
+  payload += "\",\"item_id\":\"";
+  payload += kItem;
+  payload += "\",\"idempotency_key\":\"";
+  payload += key;
+  payload += "\",\"at\":\"\",\"updated_by\":\"";
+  payload += kStudent;
+  payload += "\"}";
+  g_sink += payload.size() + topic.size();
+}
+
+static void run(const char* name, void (*fn)(uint32_t), uint32_t iters) {
+  fn(0);  // 토픽 캐시 준비(첫 bind)는 재지 않는다
+  g_allocs = 0;
+  g_counting = true;
+  const auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 1; i <= iters; ++i) fn(i);
+  const auto t1 = std::chrono::steady_clock::now();
+  g_counting = false;
+  const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+  printf("%-24s allocs/cmd=%.2f us/cmd=%.3f\n", name, (double)g_allocs / iters, us / iters);
+}
+
+int main(int argc, char** argv) {
+  const uint32_t iters = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 10) : 200000;
+  run("homework_action", cmd_homework_action, iters);
+  run("list_homeworks", cmd_list_homeworks, iters);
+  run("sync_ack", cmd_sync_ack, iters);
+  run("legacy_homework_action", legacy_homework_action, iters);
+  return 0;
+}
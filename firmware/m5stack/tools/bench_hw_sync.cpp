@@ -0,0 +1,133 @@
+// homeworks 스트리밍 디코더(src/hw_sync.*) 호스트 벤치마크.
+//
+// 실제 수신 경로(HwSyncStream::on_chunk → take/release)에 페이로드를 MQTT 청크 크기로 잘라 넣고
+// 페이로드당 힙 할당 횟수·바이트와 µs를 잰다. 할당은 malloc/free를 가로채 세므로 Linux(glibc) 전용.
+// 예전 경로(String 재조립 + DynamicJsonDocument(len + 4096))는 ArduinoJson이 호스트에 없어 돌리지 않고,
+// 그 코드가 잡던 크기를 식으로 계산해 나란히 찍는다.
+//
+// 사용:
+//   g++ -O2 -std=c++17 -I tools/host -I src tools/bench_hw_sync.cpp src/hw_sync.cpp -o /tmp/bench_hw_sync
+//   /tmp/bench_hw_sync [반복 횟수=2000] [페이로드 파일(JSON/msgpack)] [청크 바이트=1436]
+// 파일을 주지 않으면 그룹 8개·그룹당 children 8개짜리 JSON 스냅샷을 만들어 쓴다.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "hw_sync.h"
+
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void __libc_free(void*);
+
+static unsigned long g_allocs = 0;
+static unsigned long g_alloc_bytes = 0;
+static bool g_counting = false;
+
+extern "C" void* malloc(size_t n) {
+  if (g_counting) { g_allocs++; g_alloc_bytes += n; }
+  return __libc_malloc(n);
+}
+extern "C" void* calloc(size_t n, size_t sz) {
+  if (g_counting) { g_allocs++; g_alloc_bytes += n * sz; }
+  return __libc_calloc(n, sz);
+}
+extern "C" void* realloc(void* p, size_t n) {
+  if (g_counting) { g_allocs++; g_alloc_bytes += n; }
+  return __libc_realloc(p, n);
+}
+extern "C" void free(void* p) { __libc_free(p); }
+
+static std::string make_snapshot() {
+  std::string s;
+  s += "{\"meta\":{\"sync_fp\":\"3f2a9c1d8e7b6a5049382716afbecd01\",\"sync_seq\":4182,\"source\":\"gateway\","
+       "\"student_id\":\"9e8d7c6b-5a49-4382-b1c0-f1e2d3c4b5a6\"},\"groups\":[";
+  for (int g = 0; g < HW_MAX_GROUPS; ++g) {
+    char buf[768];
+    snprintf(buf, sizeof(buf),
+             "%s{\"group_id\":\"c0ffee00-1234-4abc-8def-01234567%04d\",\"group_title\":\"%s %d\","
+             "\"page_summary\":\"p.%d-%d\",\"order_index\":%d,\"is_homework\":false,\"is_test\":%s,"
+             "\"is_naesin\":false,\"pending_complete\":false,\"phase\":%d,\"accumulated\":%d,"
+             "\"cycle_elapsed\":%d,\"check_count\":%d,\"total_count\":%d,\"time_limit_minutes\":null,"
+             "\"color\":%d,\"run_start\":\"2026-10-17T09:%02d:00.000Z\","
+             "\"content\":\"과정: 공통수학1\\n교재: 쎈 공통수학1 %d단원\\n\",\"type\":\"교재\","
+             "\"book_id\":\"b-%d\",\"grade_label\":\"고1\",\"m5_wait_title\":\"쎈 공통수학1 %d단원 유형 연습\","
+             "\"children\":[",
+             g ? "," : "", g, "공통수학1 과제", g, 10 + g, 14 + g, g, g % 3 == 0 ? "true" : "false", 1 + g % 4,
+             600 + g * 37, 120 + g, g % 3, 20 + g, 0x1E88E5 + g, g, g + 1, g, g + 1);
+    s += buf;
+    for (int c = 0; c < HW_MAX_CHILDREN; ++c) {
+      snprintf(buf, sizeof(buf),
+               "%s{\"item_id\":\"ab12cd34-0000-4000-8000-%04d%08d\",\"title\":\"유형 %d-%d\",\"page\":\"p.%d\","
+               "\"memo\":\"오답 다시 풀기\",\"count\":%d,\"check_count\":%d,\"phase\":%d,\"accumulated\":%d}",
+               c ? "," : "", g, c, g + 1, c + 1, 30 + c, 8 + c, c % 2, 1 + c % 4, 60 * c);
+      s += buf;
+    }
+    s += "]}";
+  }
+  s += "]}";
+  return s;
+}
+
+static std::string read_file(const char* path) {
+  std::string s;
+  FILE* f = fopen(path, "rb");
+  if (!f) return s;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) s.append(buf, n);
+  fclose(f);
+  return s;
+}
+
+static bool feed_once(HwSyncStream& st, const std::string& p, size_t chunk) {
+  for (size_t off = 0; off < p.size(); off += chunk) {
+    const size_t n = p.size() - off < chunk ? p.size() - off : chunk;
+    st.on_chunk(p.data() + off, n, off, p.size(), 0);
+  }
+  HwSyncFrame* fr = st.take();
+  if (!fr) return false;
+  const bool ok = fr->group_cnt > 0;
+  st.release(fr);
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  const uint32_t iters = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 10) : 2000;
+  const std::string payload = argc > 2 ? read_file(argv[2]) : make_snapshot();
+  const size_t chunk = argc > 3 ? (size_t)strtoul(argv[3], nullptr, 10) : 1436;
+  if (payload.empty() || chunk == 0) {
+    fprintf(stderr, "empty payload or chunk\n");
+    return 1;
+  }
+
+  static HwSyncStream stream;  // 디코더 상태가 커서 스택에 두지 않는다(기기에서도 전역)
+  if (!stream.begin()) return 1;
+  stream.set_applied("", "");
+  if (!feed_once(stream, payload, chunk)) {  // 프레임 풀 준비와 첫 디코딩은 재지 않는다
+    fprintf(stderr, "decode failed (parse_errors=%lu)\n", (unsigned long)stream.stats().parse_errors);
+    return 1;
+  }
+
+  g_allocs = 0;
+  g_alloc_bytes = 0;
+  g_counting = true;
+  const auto t0 = std::chrono::steady_clock::now();
+  uint32_t ok = 0;
+  for (uint32_t i = 0; i < iters; ++i) ok += feed_once(stream, payload, chunk) ? 1 : 0;
+  const auto t1 = std::chrono::steady_clock::now();
+  g_counting = false;
+  const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+
+  const HwSyncStats& hs = stream.stats();
+  printf("payload_bytes=%zu chunk=%zu chunks=%zu wire=%s frames_ok=%u/%u\n", payload.size(), chunk,
+         (payload.size() + chunk - 1) / chunk, hs.msgpack_frames ? "msgpack" : "json", ok, iters);
+  printf("stream   allocs/payload=%.2f alloc_bytes/payload=%.1f us/payload=%.1f fixed_footprint=%zu\n",
+         (double)g_allocs / iters, (double)g_alloc_bytes / iters, us / iters, stream.footprint_bytes());
+  // 예전 경로: 재조립 String(payload + 1, 한 글자씩 붙여 여러 번 재할당) + DOM 용량(len + 4096)
+  printf("legacy   peak_alloc_bytes~=%zu (estimate: String %zu + DynamicJsonDocument %zu)\n",
+         (payload.size() + 1) + (payload.size() + 4096), payload.size() + 1, payload.size() + 4096);
+  return 0;
+}
@@ -0,0 +1,78 @@
+// 글리프 LRU 캐시(src/glyph_cache.*) 호스트 검증.
+//
+// 무작위 조회/삽입을 std::list 기준 LRU와 나란히 돌려 적중 여부, 밀려나는 키, 칸 내용이 같은지 본다.
+// 키 분포는 한글 음절 구간(연속 코드포인트)과 흩어진 값 두 가지로 돌린다.
+//
+// 사용:
+//   g++ -O2 -std=c++17 -I src tools/check_glyph_cache.cpp src/glyph_cache.cpp -o /tmp/check_glyph_cache
+//   /tmp/check_glyph_cache
+
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "glyph_cache.h"
+
+static int run(uint16_t count, uint32_t key_lo, uint32_t key_span, uint32_t key_step, unsigned seed) {
+  const uint32_t cell = 8;
+  std::vector<uint8_t> index(GlyphCache::index_bytes(count));
+  std::vector<uint8_t> pool((size_t)count * cell);
+  GlyphCache c;
+  if (!c.init(index.data(), pool.data(), count, cell)) {
+    printf("init failed\n");
+    return 1;
+  }
+  std::list<uint32_t> ref;  // front가 최근
+  std::mt19937 rng(seed);
+  uint32_t hits = 0;
+  for (int op = 0; op < 200000; ++op) {
+    const uint32_t key = key_lo + (rng() % key_span) * key_step;
+    const uint8_t* got = c.find(key);
+    auto it = ref.begin();
+    while (it != ref.end() && *it != key) ++it;
+    const bool ref_hit = it != ref.end();
+    if ((got != nullptr) != ref_hit) {
+      printf("op %d key %u: cache %s, reference %s\n", op, key, got ? "hit" : "miss", ref_hit ? "hit" : "miss");
+      return 1;
+    }
+    if (ref_hit) {
+      ref.erase(it);
+      ref.push_front(key);
+      uint32_t stored;
+      memcpy(&stored, got, sizeof(stored));
+      if (stored != key) {
+        printf("op %d key %u: cell holds %u\n", op, key, stored);
+        return 1;
+      }
+      ++hits;
+      continue;
+    }
+    uint8_t* slot = c.insert(key, cell);
+    if (!slot) {
+      printf("op %d: insert failed\n", op);
+      return 1;
+    }
+    memcpy(slot, &key, sizeof(key));
+    ref.push_front(key);
+    if (ref.size() > count) ref.pop_back();
+  }
+  if (c.insert(1, cell + 1) != nullptr) {
+    printf("oversize glyph was cached\n");
+    return 1;
+  }
+  printf("count=%u keys=%u step=%u ok hits=%u evictions=%u\n", (unsigned)count, (unsigned)key_span,
+         (unsigned)key_step, (unsigned)hits, (unsigned)c.evictions());
+  return 0;
+}
+
+int main() {
+  int rc = 0;
+  rc |= run(1, 0xAC00, 4, 1, 1);
+  rc |= run(64, 0xAC00, 96, 1, 2);
+  rc |= run(300, 0xAC00, 11172, 1, 3);
+  rc |= run(256, 0x20, 400, 4099, 4);
+  rc |= run(257, 0xAC00, 1000, 1, 5);
+  return rc;
+}
@@ -0,0 +1,118 @@
+// 델타 OTA 적용기(src/ota_delta.*) 호스트 검증.
+//
+// 펌웨어와 같은 코드로 패치를 적용해 NEW와 바이트 단위로 같은지 본다. 네트워크 수신처럼
+// 입력을 무작위 크기로 잘라 넣고, 작업 버퍼도 펌웨어 크기(8KB)와 최소 크기(512B) 둘 다로 돌린다.
+//
+// 사용:
+//   g++ -O2 -std=c++17 -I src tools/check_ota_delta.cpp src/ota_delta.cpp -o /tmp/check_ota_delta
+//   /tmp/check_ota_delta OLD.bin PATCH.ydp NEW.bin
+//   python tools/ota_delta.py selftest --checker /tmp/check_ota_delta
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "ota_delta.h"
+
+struct Ctx {
+  const std::vector<uint8_t>* old;
+  std::vector<uint8_t> out;
+};
+
+static bool read_old(void* ctx, uint32_t off, uint8_t* dst, size_t len) {
+  const Ctx* c = (const Ctx*)ctx;
+  if ((size_t)off + len > c->old->size()) return false;
+  memcpy(dst, c->old->data() + off, len);
+  return true;
+}
+
+static bool write_new(void* ctx, const uint8_t* src, size_t len) {
+  Ctx* c = (Ctx*)ctx;
+  c->out.insert(c->out.end(), src, src + len);
+  return true;
+}
+
+static std::vector<uint8_t> load(const char* path) {
+  std::vector<uint8_t> v;
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "cannot open %s\n", path);
+    exit(2);
+  }
+  uint8_t buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) v.insert(v.end(), buf, buf + n);
+  fclose(f);
+  return v;
+}
+
+static bool run(const std::vector<uint8_t>& old, const std::vector<uint8_t>& patch, const std::vector<uint8_t>& expect,
+                size_t work_len, unsigned seed) {
+  OtaDelta::Header h;
+  if (!OtaDelta::parse_header(patch.data(), patch.size(), &h)) {
+    fprintf(stderr, "bad header\n");
+    return false;
+  }
+  if (h.old_size != old.size() || h.new_size != expect.size()) {
+    fprintf(stderr, "header sizes %u/%u do not match files %zu/%zu\n", h.old_size, h.new_size, old.size(), expect.size());
+    return false;
+  }
+  std::vector<uint8_t> work(work_len);
+  Ctx ctx{&old, {}};
+  OtaDelta d;
+  d.begin(h, work.data(), work.size(), read_old, write_new, &ctx);
+  std::mt19937 rng(seed);
+  size_t pos = OtaDelta::kHeaderBytes;
+  while (pos < patch.size()) {
+    size_t n = 1 + rng() % 3000;
+    if (n > patch.size() - pos) n = patch.size() - pos;
+    if (!d.feed(patch.data() + pos, n)) {
+      fprintf(stderr, "feed failed at %zu: %s\n", pos, d.error());
+      return false;
+    }
+    pos += n;
+  }
+  if (!d.finish()) {
+    fprintf(stderr, "finish failed: %s\n", d.error());
+    return false;
+  }
+  if (ctx.out != expect) {
+    fprintf(stderr, "output differs (work=%zu)\n", work_len);
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    fprintf(stderr, "usage: %s OLD PATCH NEW\n", argv[0]);
+    return 2;
+  }
+  const std::vector<uint8_t> old = load(argv[1]);
+  const std::vector<uint8_t> patch = load(argv[2]);
+  const std::vector<uint8_t> expect = load(argv[3]);
+  static const size_t kWork[] = {8192, 512};
+  for (size_t w : kWork) {
+    for (unsigned seed = 1; seed <= 3; ++seed) {
+      if (!run(old, patch, expect, w, seed)) return 1;
+    }
+  }
+  // 잘린 패치는 finish()에서 거절되어야 한다.
+  if (patch.size() > OtaDelta::kHeaderBytes + 1) {
+    std::vector<uint8_t> cut(patch.begin(), patch.end() - 1);
+    OtaDelta::Header h;
+    OtaDelta::parse_header(cut.data(), cut.size(), &h);
+    std::vector<uint8_t> work(8192);
+    Ctx ctx{&old, {}};
+    OtaDelta d;
+    d.begin(h, work.data(), work.size(), read_old, write_new, &ctx);
+    if (d.feed(cut.data() + OtaDelta::kHeaderBytes, cut.size() - OtaDelta::kHeaderBytes) && d.finish()) {
+      fprintf(stderr, "truncated patch accepted\n");
+      return 1;
+    }
+  }
+  printf("ok: %zu -> %zu bytes, patch %zu bytes\n", old.size(), expect.size(), patch.size());
+  return 0;
+}
@@ -0,0 +1,346 @@
+"""한글 UI 비트맵 폰트(kakao_kr_16/24)를 글자 서브셋으로 만든다.
+
+src/ 의 문자열 리터럴에 쓰인 글자 + tools/font_subset_extra.txt(이름·교재명에 흔한 음절) + ASCII만
+lv_font_conv로 비트맵 폰트에 넣는다. 서브셋에 없는 글자는 기기에서 tiny_ttf fallback이 그린다
+(src/font_fallback.h). 설정은 tools/font_subset.json.
+
+  python tools/font_subset.py                 # src/fonts/*.c 생성 + 크기 보고
+  python tools/font_subset.py --if-changed    # 글자·설정·TTF가 그대로면 건너뛴다(PlatformIO pre 스크립트)
+  python tools/font_subset.py --report        # 생성 없이 report_bpp 변형별 크기만 비교
+  python tools/font_subset.py --chars         # 서브셋 글자만 출력
+
+fallback 항목이 있으면 fontTools(pip install fonttools)로 fallback용 TTF 서브셋도 data/에 만든다.
+원본 TTF(약 1.4MB)는 LittleFS 파티션(0x70000)에 들어가지 않아서 data/ 밖(tools/fonts/)에 두고,
+fallback 기본값은 완성형 2,350자 + ASCII다. data/에 둔 파일은 uploadfs가 모두 이미지에 넣는다.
+
+lv_font_conv(npm)가 필요하다: PATH, LV_FONT_CONV 환경 변수, 없으면 npx 순으로 찾는다.
+LVGL 설정이 LV_USE_FONT_COMPRESSED 0이라 --no-compress로 만든다(그리기가 빠르고 플래시는 조금 더 쓴다).
+생성한 폰트는 fallback을 런타임에 붙일 수 있게 const를 뗀다.
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+STAMP = ".font_subset.stamp"
+HANGUL_SYLLABLES = 11172
+
+# lv_font_conv 출력의 배열 원소 크기(LV_FONT_FMT_TXT_LARGE 1 기준, 추정치)
+TYPE_BYTES = {
+    "uint8_t": 1,
+    "int8_t": 1,
+    "uint16_t": 2,
+    "int16_t": 2,
+    "uint32_t": 4,
+    "lv_font_fmt_txt_glyph_dsc_t": 12,
+    "lv_font_fmt_txt_cmap_t": 20,
+}
+
+
+def parse_args():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--config", default=os.path.join(HERE, "font_subset.json"))
+    ap.add_argument("--if-changed", action="store_true")
+    ap.add_argument("--report", action="store_true", help="compare report_bpp variants only")
+    ap.add_argument("--chars", action="store_true", help="print the subset and exit")
+    return ap.parse_args()
+
+
+def load_config(path):
+    with open(path, encoding="utf-8") as f:
+        cfg = json.load(f)
+    for key in ("ttf", "extra", "out_dir"):
+        if cfg.get(key):
+            cfg[key] = os.path.join(ROOT, cfg[key])
+    fb = cfg.get("fallback")
+    if fb and fb.get("out"):
+        fb["out"] = os.path.join(ROOT, fb["out"])
+    cfg["scan"] = [os.path.join(ROOT, p) for p in cfg.get("scan", [])]
+    return cfg
+
+
+def string_literals(text):
+    """C/C++ 소스의 문자열 리터럴 내용. 주석과 문자 리터럴은 건너뛴다."""
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if text.startswith("//", i):
+            j = text.find("\n", i)
+            i = n if j < 0 else j
+        elif text.startswith("/*", i):
+            j = text.find("*/", i + 2)
+            i = n if j < 0 else j + 2
+        elif c == "'":
+            i += 1
+            while i < n and text[i] != "'":
+                i += 2 if text[i] == "\\" else 1
+            i += 1
+        elif c == '"':
+            i += 1
+            start = i
+            while i < n and text[i] != '"':
+                i += 2 if text[i] == "\\" else 1
+            yield text[start:i]
+            i += 1
+        else:
+            i += 1
+
+
+def scan_sources(dirs):
+    chars = set()
+    for d in dirs:
+        for base, _, files in os.walk(d):
+            if os.path.basename(base) == "fonts":
+                continue
+            for name in files:
+                if not name.endswith((".c", ".cpp", ".h")):
+                    continue
+                with open(os.path.join(base, name), encoding="utf-8", errors="replace") as f:
+                    for lit in string_literals(f.read()):
+                        chars.update(ch for ch in lit if ord(ch) >= 0x80 and ch != "�")
+    return chars
+
+
+def read_extra(path):
+    chars = set()
+    if not path or not os.path.exists(path):
+        return chars
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            if line.lstrip().startswith("#"):
+                continue
+            chars.update(ch for ch in line if not ch.isspace())
+    return chars
+
+
+def ks2350():
+    """KS X 1001 완성형 한글 2,350자(EUC-KR 0xB0A1-0xC8FE)."""
+    out = set()
+    for hi in range(0xB0, 0xC9):
+        for lo in range(0xA1, 0xFF):
+            try:
+                out.add(bytes([hi, lo]).decode("euc-kr"))
+            except UnicodeDecodeError:
+                pass
+    return out
+
+
+def parse_ranges(ranges):
+    out = set()
+    for r in ranges:
+        a, _, b = r.partition("-")
+        lo = int(a, 0)
+        hi = int(b, 0) if b else lo
+        out.update(chr(cp) for cp in range(lo, hi + 1))
+    return out
+
+
+def collect(cfg):
+    scanned = scan_sources(cfg["scan"])
+    extra = read_extra(cfg.get("extra"))
+    chars = scanned | extra
+    if cfg.get("ks2350"):
+        chars |= ks2350()
+    ascii_ = parse_ranges(cfg.get("ranges", []))
+    chars -= ascii_
+    return sorted(chars), ascii_, len(scanned), len(extra)
+
+
+def find_converter():
+    env = os.environ.get("LV_FONT_CONV")
+    if env:
+        return env.split()
+    exe = shutil.which("lv_font_conv")
+    if exe:
+        return [exe]
+    npx = shutil.which("npx")
+    if npx:
+        return [npx, "--yes", "lv_font_conv@1.5.2"]
+    return None
+
+
+def convert(conv, cfg, name, size, bpp, symbols, out_path):
+    cmd = conv + [
+        "--font", cfg["ttf"],
+        "--size", str(size),
+        "--bpp", str(bpp),
+        "--format", "lvgl",
+        "--no-compress",
+        "--lv-include", "lvgl.h",
+        "--lv-font-name", name,
+        "-o", out_path,
+    ]
+    if not cfg.get("kerning"):
+        cmd.append("--no-kerning")
+    for r in cfg.get("ranges", []):
+        cmd += ["-r", r]
+    if symbols:
+        cmd += ["--symbols", symbols]
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL)
+
+
+def postprocess(path, name, glyphs, digest):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    # fallback(lv_font_t.fallback)을 font_fallback.cpp가 런타임에 붙인다. 구조체만 RAM에 가고 배열은 플래시에 남는다.
+    text, n = re.subn(r"\bconst lv_font_t %s = \{" % re.escape(name), "lv_font_t %s = {" % name, text)
+    if n == 0 and ("lv_font_t %s = {" % name) not in text:
+        raise RuntimeError("%s: font descriptor not found" % path)
+    head = "/* font_subset.py: %d glyphs, charset %s. 손으로 고치지 말 것. */\n" % (glyphs, digest[:12])
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(head + text)
+
+
+def flash_estimate(path):
+    """생성된 .c의 상수 배열 크기 합(바이트, 추정). (bitmap, 전체, 글리프 수)"""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    bitmap = total = glyphs = 0
+    arr = re.compile(r"static\s+(?:LV_ATTRIBUTE_LARGE_CONST\s+)?const\s+(\w+)\s+(\w+)\[\]\s*=\s*\{(.*?)\n\};", re.S)
+    for m in arr.finditer(text):
+        typ, name, body = m.groups()
+        size = TYPE_BYTES.get(typ, 4)
+        if typ.startswith("lv_"):
+            count = body.count("{")
+        else:
+            count = len(re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body))
+        total += count * size
+        if name == "glyph_bitmap":
+            bitmap = count * size
+        if name == "glyph_dsc":
+            glyphs = count - 1  # id 0 예약
+    return bitmap, total, glyphs
+
+
+def fs_partition_bytes():
+    """partitions_ota.csv의 spiffs(LittleFS) 파티션 크기. 없으면 0."""
+    path = os.path.join(ROOT, "partitions_ota.csv")
+    if not os.path.exists(path):
+        return 0
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            cols = [c.strip() for c in line.split(",")]
+            if len(cols) >= 5 and not cols[0].startswith("#") and cols[2] == "spiffs":
+                return int(cols[4], 0)
+    return 0
+
+
+def subset_fallback(cfg, ascii_):
+    """fallback TTF(tiny_ttf용)를 만든다. 만든 파일 크기, 건너뛰면 None."""
+    fb = cfg.get("fallback")
+    if not fb or not fb.get("out"):
+        return None
+    try:
+        from fontTools import subset
+    except ImportError:
+        print("[font_subset] fontTools not installed, fallback TTF skipped (pip install fonttools)", file=sys.stderr)
+        return None
+    chars = set(ascii_)
+    if fb.get("set", "ks2350") == "hangul":
+        chars.update(chr(0xAC00 + i) for i in range(HANGUL_SYLLABLES))
+    else:
+        chars |= ks2350()
+    chars |= read_extra(cfg.get("extra"))
+    opts = subset.Options()
+    opts.layout_features = []  # tiny_ttf(stb_truetype)는 GSUB/GPOS를 안 쓴다
+    opts.hinting = False
+    opts.name_IDs = [1, 2]
+    opts.notdef_outline = True
+    font = subset.load_font(cfg["ttf"], opts)
+    sub = subset.Subsetter(opts)
+    sub.populate(unicodes=[ord(c) for c in chars])
+    sub.subset(font)
+    os.makedirs(os.path.dirname(fb["out"]), exist_ok=True)
+    subset.save_font(font, fb["out"], opts)
+    return os.path.getsize(fb["out"])
+
+
+def digest_of(cfg, chars, ascii_):
+    h = hashlib.sha256()
+    h.update(json.dumps(cfg, sort_keys=True).encode())
+    h.update("".join(chars).encode())
+    h.update("".join(sorted(ascii_)).encode())
+    st = os.stat(cfg["ttf"])
+    h.update(("%d:%d" % (st.st_size, int(st.st_mtime))).encode())
+    with open(os.path.abspath(__file__), "rb") as f:
+        h.update(f.read())
+    return h.hexdigest()
+
+
+def report_line(label, size, bpp, path, ttf_bytes):
+    bitmap, total, glyphs = flash_estimate(path)
+    per = bitmap / glyphs if glyphs else 0
+    full = int(per * (HANGUL_SYLLABLES + 95)) + (total - bitmap) * (HANGUL_SYLLABLES + 95) // max(glyphs, 1)
+    return "%-12s %3dpx %dbpp glyphs=%5d bitmap=%7d flash~%7d (%.0f B/glyph)  full-hangul~%8d  ttf=%d" % (
+        label, size, bpp, glyphs, bitmap, total, per, full, ttf_bytes)
+
+
+def main():
+    args = parse_args()
+    cfg = load_config(args.config)
+    chars, ascii_, n_scanned, n_extra = collect(cfg)
+    symbols = "".join(chars)
+    if args.chars:
+        print(symbols)
+        return 0
+
+    digest = digest_of(cfg, chars, ascii_)
+    out_dir = cfg["out_dir"]
+    stamp = os.path.join(out_dir, STAMP)
+    outputs = [os.path.join(out_dir, f["name"] + ".c") for f in cfg["fonts"]]
+    if args.if_changed and not args.report and all(map(os.path.exists, outputs)) and os.path.exists(stamp):
+        with open(stamp, encoding="utf-8") as f:
+            if f.read().strip() == digest:
+                print("[font_subset] up to date (%d glyphs + ASCII)" % len(chars))
+                return 0
+
+    conv = find_converter()
+    if not conv:
+        print("[font_subset] lv_font_conv not found (npm i -g lv_font_conv, or set LV_FONT_CONV)", file=sys.stderr)
+        return 2
+    ttf_bytes = os.path.getsize(cfg["ttf"])
+    print("[font_subset] %d glyphs beyond ASCII (literals %d, extra %d%s)" % (
+        len(chars), n_scanned, n_extra, ", +KS2350" if cfg.get("ks2350") else ""))
+
+    if args.report:
+        with tempfile.TemporaryDirectory() as tmp:
+            for f in cfg["fonts"]:
+                for bpp in cfg.get("report_bpp", [f["bpp"]]):
+                    path = os.path.join(tmp, "%s_%d.c" % (f["name"], bpp))
+                    convert(conv, cfg, f["name"], f["size"], bpp, symbols, path)
+                    print(report_line(f["name"], f["size"], bpp, path, ttf_bytes))
+        return 0
+
+    os.makedirs(out_dir, exist_ok=True)
+    lines = []
+    for f, path in zip(cfg["fonts"], outputs):
+        convert(conv, cfg, f["name"], f["size"], f["bpp"], symbols, path)
+        postprocess(path, f["name"], len(chars) + len(ascii_), digest)
+        lines.append(report_line(f["name"], f["size"], f["bpp"], path, ttf_bytes))
+    fb_bytes = subset_fallback(cfg, ascii_)
+    if fb_bytes is not None:
+        part = fs_partition_bytes()
+        lines.append("fallback     %s %d bytes (LittleFS partition %d%s)" % (
+            os.path.relpath(cfg["fallback"]["out"], ROOT), fb_bytes, part,
+            ", DOES NOT FIT" if part and fb_bytes > part else ""))
+    with open(os.path.join(out_dir, "font_subset_report.txt"), "w", encoding="utf-8") as fp:
+        fp.write("\n".join(lines) + "\n")
+        fp.write("chars(%d): %s\n" % (len(chars), symbols))
+    with open(stamp, "w", encoding="utf-8") as fp:
+        fp.write(digest + "\n")
+    for line in lines:
+        print(line)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,18 @@
+# PlatformIO pre 스크립트: 빌드 전에 한글 서브셋 폰트(src/fonts/kakao_kr_*.c)를 최신으로 맞춘다.
+# 글자·설정·TTF가 그대로면 font_subset.py --if-changed가 바로 끝난다.
+# lv_font_conv가 없거나 실패하면 경고만 남기고 기존 폰트로 빌드한다(폰트가 아예 없으면 링크에서 멈춘다).
+import os
+import subprocess
+import sys
+
+Import("env")  # noqa: F821  (PlatformIO가 주입)
+
+_root = env.subst("$PROJECT_DIR")  # noqa: F821
+_script = os.path.join(_root, "tools", "font_subset.py")
+
+if os.environ.get("FONT_SUBSET_SKIP") == "1":
+    print("[font_subset] skipped (FONT_SUBSET_SKIP=1)")
+else:
+    rc = subprocess.call([sys.executable, _script, "--if-changed"], cwd=_root)
+    if rc != 0:
+        print("[font_subset] WARNING: generation failed (rc=%d), keeping existing src/fonts" % rc)
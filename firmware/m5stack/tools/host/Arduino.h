@@ -0,0 +1,13 @@
+#pragma once
+
+// 호스트 벤치마크·검사용 최소 Arduino/ESP-IDF 대체 헤더(tools/bench_*.cpp, tools/check_*.cpp).
+// 단일 스레드에서만 쓰므로 임계 구역은 아무것도 하지 않는다.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
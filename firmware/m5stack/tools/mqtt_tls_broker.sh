@@ -0,0 +1,72 @@
+#!/usr/bin/env bash
+# CFG_MQTT_TLS 빌드 시험용 로컬 TLS MQTT 브로커(mosquitto, Linux).
+#
+#   tools/mqtt_tls_broker.sh 192.168.0.10            # 인증서 생성(없을 때만) + 8883 TLS / 1883 평문 브로커 실행
+#   KEY=rsa tools/mqtt_tls_broker.sh 192.168.0.10    # RSA-2048 인증서(기본은 EC P-256)
+#   python3 tools/mqtt_tls_probe.py 192.168.0.10     # 호스트에서 전체/재개 핸드셰이크 확인
+#
+# 첫 인자는 펌웨어의 CFG_MQTT_HOST와 같아야 한다. mbedTLS 2.x는 IP SAN을 보지 않고 CN을 문자열로
+# 비교하므로 CN과 SAN(IP 또는 DNS)에 모두 넣는다.
+# CA 인증서를 data/mqtt_ca.pem으로 복사한다. `pio run -e m5-tls -t uploadfs`로 기기에 올린다
+# (uploadfs는 LittleFS 전체를 덮어쓰므로 부팅 스냅샷·커맨드 저널도 지워진다).
+# 1883 평문 리스너는 게이트웨이가 같은 브로커에 붙을 수 있게 남겨 둔다.
+set -euo pipefail
+
+HOST=${1:?usage: $0 <broker ip or hostname> [tls port]}
+PORT=${2:-8883}
+KEY=${KEY:-ec}
+HERE=$(cd "$(dirname "$0")" && pwd)
+DIR=${MQTT_TLS_DIR:-$HERE/../.mqtt_tls}
+mkdir -p "$DIR"
+cd "$DIR"
+
+new_key() {
+  if [ "$KEY" = rsa ]; then
+    openssl genrsa -out "$1" 2048 2>/dev/null
+  else
+    openssl ecparam -name prime256v1 -genkey -noout -out "$1"
+  fi
+}
+
+if [ ! -f ca.crt ]; then
+  new_key ca.key
+  openssl req -x509 -new -key ca.key -sha256 -days 3650 -subj "/CN=ygg-mqtt-test-ca" -out ca.crt
+fi
+
+if [ ! -f server.crt ] || [ "$(cat server.host 2>/dev/null)" != "$HOST" ]; then
+  if [[ "$HOST" =~ ^[0-9.]+$ ]]; then SAN="IP:$HOST"; else SAN="DNS:$HOST"; fi
+  new_key server.key
+  openssl req -new -key server.key -subj "/CN=$HOST" -out server.csr
+  printf 'basicConstraints=CA:FALSE\nkeyUsage=digitalSignature,keyEncipherment\nextendedKeyUsage=serverAuth\nsubjectAltName=%s\n' \
+    "$SAN" > server.ext
+  openssl x509 -req -in server.csr -CA ca.crt -CAkey ca.key -CAcreateserial -days 825 -sha256 \
+    -extfile server.ext -out server.crt 2>/dev/null
+  echo "$HOST" > server.host
+fi
+
+cat > mosquitto.conf <<CONF
+per_listener_settings false
+allow_anonymous true
+persistence false
+max_keepalive 0
+log_dest stdout
+log_type error
+log_type warning
+log_type notice
+log_type information
+
+listener 1883
+
+# mbedTLS 2.x(arduino-esp32 2.x)는 TLS 1.2까지만 한다. 세션 ID 캐시와 티켓은 OpenSSL 기본값(켜짐).
+listener $PORT
+cafile $DIR/ca.crt
+certfile $DIR/server.crt
+keyfile $DIR/server.key
+tls_version tlsv1.2
+CONF
+
+mkdir -p "$HERE/../data"
+cp ca.crt "$HERE/../data/mqtt_ca.pem"
+echo "CA -> data/mqtt_ca.pem ($(openssl x509 -in ca.crt -noout -subject))"
+echo "server cert CN=$HOST key=$KEY, TLS on :$PORT, plain on :1883"
+exec mosquitto -c "$DIR/mosquitto.conf"
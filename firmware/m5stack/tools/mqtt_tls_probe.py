@@ -0,0 +1,80 @@
+"""TLS MQTT 브로커의 세션 재개를 호스트에서 확인한다(tools/mqtt_tls_broker.sh와 짝).
+
+기기(mbedTLS 2.x)와 같게 TLS 1.2로 붙고, 두 번째 연결부터 앞 연결의 세션(ID/티켓)을 내민다.
+연결마다 TCP/TLS 소요와 재개 여부, MQTT CONNACK을 출력한다. 기기 쪽 수치는 WIFI-DIAG/TLS-DIAG의
+mqtt_tls_* 줄로 본다.
+
+  python3 tools/mqtt_tls_probe.py 192.168.0.10
+  python3 tools/mqtt_tls_probe.py 192.168.0.10 --port 8883 --ca .mqtt_tls/ca.crt --count 5
+"""
+
+import argparse
+import os
+import socket
+import ssl
+import struct
+import sys
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def parse_args():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("host")
+    ap.add_argument("--port", type=int, default=8883)
+    ap.add_argument("--ca", default=os.path.join(HERE, "..", ".mqtt_tls", "ca.crt"))
+    ap.add_argument("--count", type=int, default=3)
+    ap.add_argument("--no-resume", action="store_true", help="send no session (every handshake full)")
+    return ap.parse_args()
+
+
+def mqtt_connect_packet(client_id):
+    cid = client_id.encode()
+    var = struct.pack("!H4sBBH", 4, b"MQTT", 4, 0x02, 30)
+    payload = struct.pack("!H", len(cid)) + cid
+    body = var + payload
+    return bytes([0x10, len(body)]) + body
+
+
+def probe(ctx, host, port, session, i):
+    t0 = time.perf_counter()
+    raw = socket.create_connection((host, port), timeout=10)
+    t1 = time.perf_counter()
+    tls = ctx.wrap_socket(raw, server_hostname=host, session=session)
+    t2 = time.perf_counter()
+    tls.sendall(mqtt_connect_packet("tls-probe-%d" % os.getpid()))
+    connack = tls.recv(4)
+    t3 = time.perf_counter()
+    ok = len(connack) == 4 and connack[0] == 0x20 and connack[3] == 0
+    print("#%d tcp=%.1fms tls=%.1fms connack=%.1fms resumed=%s %s %s" % (
+        i, (t1 - t0) * 1e3, (t2 - t1) * 1e3, (t3 - t2) * 1e3,
+        tls.session_reused, tls.version(), "ok" if ok else "CONNACK %r" % connack))
+    reused = tls.session_reused
+    tls.sendall(b"\xe0\x00")  # DISCONNECT
+    sess = tls.session
+    tls.close()
+    return ok, reused, sess
+
+
+def main():
+    args = parse_args()
+    ctx = ssl.create_default_context(cafile=args.ca)
+    ctx.minimum_version = ssl.TLSVersion.TLSv1_2
+    ctx.maximum_version = ssl.TLSVersion.TLSv1_2
+    session = None
+    resumed = 0
+    for i in range(args.count):
+        ok, reused, sess = probe(ctx, args.host, args.port, None if args.no_resume else session, i)
+        if not ok:
+            return 1
+        resumed += 1 if reused else 0
+        session = sess
+    if args.count > 1 and not args.no_resume and resumed == 0:
+        print("broker never resumed a session: check that the listener does not disable tickets/cache")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,305 @@
+"""델타 OTA 패치(YDP1) 생성/적용 도구. 형식은 src/ota_delta.h 참고.
+
+  python ota_delta.py make  OLD.bin NEW.bin OUT.ydp     # 만들고 바로 적용해 검증한다
+  python ota_delta.py apply OLD.bin PATCH.ydp OUT.bin
+  python ota_delta.py info  PATCH.ydp
+  python ota_delta.py selftest [--checker /tmp/check_ota_delta]
+
+릴리스에는 전체 이미지와 함께 이전 릴리스 기준 패치를 올린다. 펌웨어는 자기 버전이 든 이름을 찾는다.
+  m5stack_firmware.bin
+  m5stack_firmware.bin.sha256
+  m5stack_firmware.from-1.1.1.4.ydp      (OLD = v1.1.1.4 릴리스의 m5stack_firmware.bin)
+기기 파티션이 OLD와 다르면(로컬 빌드 등) 헤더의 old_sha256이 맞지 않아 전체 이미지로 받는다.
+
+selftest는 펌웨어 빌드처럼 일부가 밀리고 주소가 바뀐 합성 이미지 쌍으로 make/apply를 돌리고,
+--checker가 주어지면 tools/check_ota_delta.cpp(펌웨어 적용 코드)로도 같은 결과인지 본다.
+"""
+
+import argparse
+import hashlib
+import os
+import random
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+MAGIC = b"YDP1"
+HEADER = struct.Struct("<4sIII32s32s")
+OP_END, OP_DIFF, OP_INSERT, OP_SEEK = 0, 1, 2, 3
+
+SEED = 16          # 이 길이 이상 정확히 같은 구간에서 매칭을 시작한다
+STEP = 4           # old 색인 간격(SEED + STEP - 1 이상 같은 구간은 반드시 찾는다)
+SLACK = 64         # 근사 확장: 이만큼 더 가도 점수가 안 오르면 멈춘다
+ZERO_RUN = re.compile(rb"\x00{3,}")
+
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def zigzag(d):
+    return (d << 1) if d >= 0 else ((-d) << 1) - 1
+
+
+def encode_diff(delta):
+    out = bytearray()
+    pos = 0
+    for m in ZERO_RUN.finditer(delta):
+        if m.start() > pos:
+            out += varint((m.start() - pos) << 1 | 1) + delta[pos:m.start()]
+        out += varint((m.end() - m.start()) << 1)
+        pos = m.end()
+    if pos < len(delta):
+        out += varint((len(delta) - pos) << 1 | 1) + delta[pos:]
+    return bytes(out)
+
+
+def extend(old, new, o, n):
+    """old[o:], new[n:]을 bsdiff처럼 근사 확장한다. 맞는 바이트*2 - 길이가 가장 큰 길이를 돌려준다."""
+    limit = min(len(old) - o, len(new) - n)
+    k = 0
+    # 정확히 같은 구간은 64바이트씩 건너뛴다
+    while k + 64 <= limit and old[o + k:o + k + 64] == new[n + k:n + k + 64]:
+        k += 64
+    score = best_score = k
+    best = k
+    while k < limit:
+        if old[o + k] == new[n + k]:
+            score += 1
+            if score > best_score:
+                best_score, best = score, k + 1
+                if k + 64 <= limit and old[o + k + 1:o + k + 65] == new[n + k + 1:n + k + 65]:
+                    k += 65
+                    score += 64
+                    best_score, best = score, k
+                    continue
+        else:
+            score -= 1
+        k += 1
+        if k - best > SLACK:
+            break
+    return best
+
+
+def make_patch(old, new):
+    index = {}
+    for i in range(0, len(old) - SEED + 1, STEP):
+        index.setdefault(old[i:i + SEED], i)
+
+    body = bytearray()
+    ins = 0        # 아직 내보내지 않은 new 시작
+    old_pos = 0
+    i = 0
+    stats = {"diff": 0, "insert": 0, "ops": 0}
+    while i <= len(new) - SEED:
+        # 직전 매칭이 이어지는 자리(같은 밀림)를 먼저 본다
+        cand = None
+        guess = old_pos + (i - ins)
+        if 0 <= guess <= len(old) - SEED and old[guess:guess + SEED] == new[i:i + SEED]:
+            cand = guess
+        else:
+            cand = index.get(new[i:i + SEED])
+        if cand is None:
+            i += 1
+            continue
+        # 색인이 STEP 간격이라 앞쪽으로도 넓힌다
+        while i > ins and cand > 0 and old[cand - 1] == new[i - 1]:
+            i -= 1
+            cand -= 1
+        length = extend(old, new, cand, i)
+        if length < SEED:
+            i += 1
+            continue
+        if i > ins:
+            body += bytes([OP_INSERT]) + varint(i - ins) + new[ins:i]
+            stats["insert"] += i - ins
+            stats["ops"] += 1
+        if cand != old_pos:
+            body += bytes([OP_SEEK]) + varint(zigzag(cand - old_pos))
+            stats["ops"] += 1
+        delta = bytes((b - a) & 0xFF for a, b in zip(old[cand:cand + length], new[i:i + length]))
+        body += bytes([OP_DIFF]) + varint(length) + encode_diff(delta)
+        stats["diff"] += length
+        stats["ops"] += 1
+        old_pos = cand + length
+        i += length
+        ins = i
+    if ins < len(new):
+        body += bytes([OP_INSERT]) + varint(len(new) - ins) + new[ins:]
+        stats["insert"] += len(new) - ins
+        stats["ops"] += 1
+    body.append(OP_END)
+    header = HEADER.pack(MAGIC, len(old), len(new), 0,
+                         hashlib.sha256(old).digest(), hashlib.sha256(new).digest())
+    return header + bytes(body), stats
+
+
+def read_varint(buf, p):
+    v = shift = 0
+    while True:
+        b = buf[p]
+        p += 1
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return v, p
+
+
+def parse_header(patch):
+    magic, old_size, new_size, flags, old_sha, new_sha = HEADER.unpack_from(patch)
+    if magic != MAGIC or flags != 0:
+        raise ValueError("not a YDP1 patch")
+    return old_size, new_size, old_sha, new_sha
+
+
+def apply_patch(old, patch):
+    old_size, new_size, old_sha, new_sha = parse_header(patch)
+    if len(old) != old_size or hashlib.sha256(old).digest() != old_sha:
+        raise ValueError("base image mismatch")
+    out = bytearray()
+    p = HEADER.size
+    old_pos = 0
+    while True:
+        op = patch[p]
+        p += 1
+        if op == OP_END:
+            break
+        v, p = read_varint(patch, p)
+        if op == OP_SEEK:
+            old_pos += (v >> 1) ^ -(v & 1)
+        elif op == OP_INSERT:
+            out += patch[p:p + v]
+            p += v
+        elif op == OP_DIFF:
+            end = old_pos + v
+            while old_pos < end:
+                t, p = read_varint(patch, p)
+                k = t >> 1
+                if t & 1:
+                    out += bytes((a + b) & 0xFF for a, b in zip(old[old_pos:old_pos + k], patch[p:p + k]))
+                    p += k
+                else:
+                    out += old[old_pos:old_pos + k]
+                old_pos += k
+        else:
+            raise ValueError("bad op %d at %d" % (op, p - 1))
+    if p != len(patch):
+        raise ValueError("trailing data")
+    if len(out) != new_size or hashlib.sha256(out).digest() != new_sha:
+        raise ValueError("result mismatch")
+    return bytes(out)
+
+
+def read(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def write(path, data):
+    with open(path, "wb") as f:
+        f.write(data)
+
+
+def cmd_make(a):
+    old, new = read(a.old), read(a.new)
+    patch, st = make_patch(old, new)
+    if apply_patch(old, patch) != new:
+        sys.exit("patch does not reproduce NEW")
+    write(a.out, patch)
+    print("%s: %d bytes (%.1f%% of %d) diff=%d insert=%d ops=%d sha256=%s" % (
+        a.out, len(patch), 100.0 * len(patch) / len(new), len(new),
+        st["diff"], st["insert"], st["ops"], hashlib.sha256(new).hexdigest()))
+
+
+def cmd_apply(a):
+    write(a.out, apply_patch(read(a.old), read(a.patch)))
+    print("%s: ok" % a.out)
+
+
+def cmd_info(a):
+    patch = read(a.patch)
+    old_size, new_size, old_sha, new_sha = parse_header(patch)
+    print("old_size=%d old_sha256=%s\nnew_size=%d new_sha256=%s\npatch=%d bytes" % (
+        old_size, old_sha.hex(), new_size, new_sha.hex(), len(patch)))
+
+
+def synth_pair(rng, size):
+    """펌웨어 빌드 차이 흉내: 코드 삽입/삭제로 밀리고, 4바이트 주소 몇 개가 바뀐다."""
+    words = [rng.getrandbits(32) for _ in range(512)]
+    old = bytearray()
+    while len(old) < size:
+        if rng.random() < 0.7:
+            old += struct.pack("<I", rng.choice(words))
+        else:
+            old += bytes(rng.getrandbits(8) for _ in range(rng.randint(1, 24)))
+    old = bytes(old[:size])
+    new = bytearray(old)
+    for _ in range(rng.randint(1, 6)):
+        at = rng.randrange(len(new))
+        if rng.random() < 0.6:
+            new[at:at] = bytes(rng.getrandbits(8) for _ in range(rng.randint(1, 4000)))
+        else:
+            del new[at:at + rng.randint(1, max(1, len(new) // 8))]
+    for _ in range(rng.randint(0, size // 200)):
+        at = rng.randrange(len(new) - 4) & ~3
+        v = struct.unpack_from("<I", new, at)[0]
+        struct.pack_into("<I", new, at, (v + rng.choice((4, 8, 16, 0x100))) & 0xFFFFFFFF)
+    return old, bytes(new)
+
+
+def cmd_selftest(a):
+    rng = random.Random(a.seed)
+    cases = [synth_pair(rng, rng.choice((1000, 50000, 200000))) for _ in range(a.cases)]
+    cases.append((b"\x00" * 4096, b"\x01" * 100))            # 매칭 없음
+    cases.append((bytes(range(256)) * 64, bytes(range(256)) * 64))  # 동일
+    tmp = tempfile.mkdtemp()
+    for n, (old, new) in enumerate(cases):
+        patch, _ = make_patch(old, new)
+        assert apply_patch(old, patch) == new, "python apply case %d" % n
+        if a.checker:
+            paths = [os.path.join(tmp, "%d.%s" % (n, ext)) for ext in ("old", "ydp", "new")]
+            for path, data in zip(paths, (old, patch, new)):
+                write(path, data)
+            subprocess.run([a.checker] + paths, check=True, stdout=subprocess.DEVNULL)
+        print("case %d: old=%d new=%d patch=%d (%.1f%%)" % (n, len(old), len(new), len(patch),
+                                                          100.0 * len(patch) / len(new)))
+    print("selftest ok (%d cases%s)" % (len(cases), ", firmware applier" if a.checker else ""))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="YDP1 delta OTA patches")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    p = sub.add_parser("make")
+    p.add_argument("old")
+    p.add_argument("new")
+    p.add_argument("out")
+    p.set_defaults(fn=cmd_make)
+    p = sub.add_parser("apply")
+    p.add_argument("old")
+    p.add_argument("patch")
+    p.add_argument("out")
+    p.set_defaults(fn=cmd_apply)
+    p = sub.add_parser("info")
+    p.add_argument("patch")
+    p.set_defaults(fn=cmd_info)
+    p = sub.add_parser("selftest")
+    p.add_argument("--checker")
+    p.add_argument("--cases", type=int, default=8)
+    p.add_argument("--seed", type=int, default=1)
+    p.set_defaults(fn=cmd_selftest)
+    a = ap.parse_args()
+    a.fn(a)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,155 @@
+"""OTA 다운로드 테스트용 로컬 HTTP 서버.
+
+펌웨어를 -D CFG_OTA_TEST_URL=\\"http://<PC IP>:8000/firmware.bin\\" 로 빌드하면
+설정 화면의 업데이트 버튼이 GitHub 대신 이 서버에서 받는다.
+
+  python ota_test_server.py .pio/build/m5-ota/firmware.bin
+  python ota_test_server.py firmware.bin --rate 200 --drop-at 40 --drop-at 75
+  python ota_test_server.py firmware.bin --no-range       # Range 무시(200 + 앞부분 버리기 경로)
+  python ota_test_server.py firmware.bin --bad-sha        # 검증 실패 경로
+  python ota_test_server.py new.bin --patch old_to_new.ydp # 델타 경로(tools/ota_delta.py make)
+
+/firmware.bin        : Range 요청에 206 + Content-Range로 답한다.
+/firmware.bin.sha256 : sha256sum 형식("<hex>  firmware.bin").
+/firmware.bin.ydp    : --patch로 준 델타 패치(없으면 404 → 기기는 전체 이미지로 받는다).
+--drop-at N          : 전체의 N% 지점을 지나면 연결을 한 번 끊는다(여러 번 줄 수 있음).
+--rate KB            : 초당 KB로 제한(0 = 제한 없음).
+요청마다 구간, 전송량, 속도를 출력한다.
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import socket
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+CHUNK = 4096
+
+
+def parse_args():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("firmware")
+    ap.add_argument("--host", default="0.0.0.0")
+    ap.add_argument("--port", type=int, default=8000)
+    ap.add_argument("--rate", type=float, default=0, help="KB/s limit (0 = unlimited)")
+    ap.add_argument("--drop-at", type=float, action="append", default=[], help="percent; drop once")
+    ap.add_argument("--no-range", action="store_true")
+    ap.add_argument("--bad-sha", action="store_true")
+    ap.add_argument("--patch", help="YDP1 delta served as <firmware>.ydp")
+    return ap.parse_args()
+
+
+class State:
+    def __init__(self, args):
+        with open(args.firmware, "rb") as f:
+            self.data = f.read()
+        self.sha = hashlib.sha256(self.data).hexdigest()
+        if args.bad_sha:
+            self.sha = "0" * 64
+        self.name = os.path.basename(args.firmware)
+        self.patch = None
+        if args.patch:
+            with open(args.patch, "rb") as f:
+                self.patch = f.read()
+        self.rate = args.rate * 1024
+        self.no_range = args.no_range
+        # 아직 쓰지 않은 끊김 지점(바이트 오프셋)
+        self.drops = sorted(int(len(self.data) * p / 100) for p in args.drop_at)
+        self.lock = threading.Lock()
+
+    def take_drop(self, start, end):
+        with self.lock:
+            for d in self.drops:
+                if start < d < end:
+                    self.drops.remove(d)
+                    return d
+        return None
+
+
+def make_handler(st):
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, fmt, *a):
+            sys.stdout.write("%s %s\n" % (time.strftime("%H:%M:%S"), fmt % a))
+            sys.stdout.flush()
+
+        def do_GET(self):
+            path = self.path.split("?", 1)[0]
+            if path.endswith(".sha256"):
+                body = ("%s  %s\n" % (st.sha, st.name)).encode()
+                self.send_response(200)
+                self.send_header("Content-Type", "text/plain")
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
+                return
+            if path.endswith(".ydp") and st.patch is not None:
+                data = st.patch
+            elif path.endswith(".bin"):
+                data = st.data
+            else:
+                self.send_error(404)
+                return
+
+            total = len(data)
+            start = 0
+            m = re.match(r"bytes=(\d+)-$", self.headers.get("Range", ""))
+            if m and not st.no_range:
+                start = int(m.group(1))
+                if start >= total:
+                    self.send_response(416)
+                    self.send_header("Content-Range", "bytes */%d" % total)
+                    self.send_header("Content-Length", "0")
+                    self.end_headers()
+                    return
+                self.send_response(206)
+                self.send_header("Content-Range", "bytes %d-%d/%d" % (start, total - 1, total))
+            else:
+                self.send_response(200)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Length", str(total - start))
+            self.send_header("Accept-Ranges", "none" if st.no_range else "bytes")
+            self.end_headers()
+
+            drop = st.take_drop(start, total) if data is st.data else None
+            pos = start
+            t0 = time.time()
+            try:
+                while pos < total:
+                    n = min(CHUNK, total - pos)
+                    if drop is not None and pos + n > drop:
+                        n = drop - pos
+                    self.wfile.write(data[pos:pos + n])
+                    pos += n
+                    if drop is not None and pos >= drop:
+                        self.log_message("drop at %d/%d", pos, total)
+                        self.connection.shutdown(socket.SHUT_RDWR)
+                        self.close_connection = True
+                        break
+                    if st.rate:
+                        ahead = (pos - start) / st.rate - (time.time() - t0)
+                        if ahead > 0:
+                            time.sleep(ahead)
+            except (BrokenPipeError, ConnectionResetError):
+                self.log_message("client closed at %d/%d", pos, total)
+            dt = max(time.time() - t0, 1e-6)
+            self.log_message("sent %d-%d (%d bytes) in %.1fs = %.1f KB/s",
+                             start, pos, pos - start, dt, (pos - start) / dt / 1024)
+
+    return Handler
+
+
+def main():
+    args = parse_args()
+    st = State(args)
+    print("serving %s (%d bytes) sha256=%s on %s:%d" % (st.name, len(st.data), st.sha, args.host, args.port))
+    ThreadingHTTPServer((args.host, args.port), make_handler(st)).serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,4 @@
-"""PNG -> LVGL 8 RGB565 + alpha (LV_IMG_CF_TRUE_COLOR_ALPHA), 16-bit LE + opa."""
+"""PNG -> LVGL 8 RGB565 + alpha (LV_IMG_CF_TRUE_COLOR_ALPHA), 16-bit BE(LV_COLOR_16_SWAP=1) + opa."""
 import sys
 from pathlib import Path
 
@@ -14,8 +14,9 @@ def rgb565(r: int, g: int, b: int) -> int:
 
 
 def pixel_bytes(r: int, g: int, b: int, a: int) -> bytes:
+    # lv_conf.h LV_COLOR_16_SWAP 1: 상위 바이트가 먼저(SPI 전송 순서)
     c = rgb565(r, g, b)
-    return bytes((c & 0xFF, (c >> 8) & 0xFF, a & 0xFF))
+    return bytes(((c >> 8) & 0xFF, c & 0xFF, a & 0xFF))
 
 
 def convert_png(src: Path, dst: Path, c_name: str, w: int = 64, h: int = 64) -> None:
@@ -35,6 +36,11 @@ def convert_png(src: Path, dst: Path, c_name: str, w: int = 64, h: int = 64) ->
     px = w * h * 3
     content = f'''#include <lvgl.h>
 
+/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */
+#if LV_COLOR_16_SWAP == 0
+#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"
+#endif
+
 const uint8_t {arr}[] = {{
 {body}
 }};
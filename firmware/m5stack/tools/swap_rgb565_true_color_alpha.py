@@ -0,0 +1,57 @@
+"""LV_IMG_CF_TRUE_COLOR_ALPHA C 배열의 RGB565 두 바이트를 LV_COLOR_16_SWAP=1 순서로 바꾼다.
+
+lv_conf.h가 LV_COLOR_16_SWAP 1이면 LVGL은 픽셀을 (상위, 하위, 알파) 순서로 읽는다.
+#if LV_COLOR_16_SWAP 분기가 없는 변환본은 이 스크립트로 한 번 뒤집어 둔다.
+이미 뒤집은 파일은 표식(MARKER)을 보고 건너뛴다.
+
+사용: python tools/swap_rgb565_true_color_alpha.py src/icon_home.c ...
+"""
+import re
+import sys
+from pathlib import Path
+
+MARKER = "/* RGB565 bytes pre-swapped for LV_COLOR_16_SWAP=1 (tools/swap_rgb565_true_color_alpha.py) */"
+GUARD = (
+    "#if LV_COLOR_16_SWAP == 0\n"
+    '#error "이 이미지는 LV_COLOR_16_SWAP=1 바이트 순서다 (tools/swap_rgb565_true_color_alpha.py)"\n'
+    "#endif\n"
+)
+
+ARRAY_RE = re.compile(r"(const uint8_t\s+\w+\[\]\s*=\s*\{)(.*?)(\};)", re.S)
+HEX_RE = re.compile(r"0x([0-9a-fA-F]{2})")
+
+
+def swap_file(path: Path) -> bool:
+    text = path.read_text(encoding="utf-8")
+    if MARKER in text:
+        print(path, "already swapped")
+        return False
+    if "LV_IMG_CF_TRUE_COLOR_ALPHA" not in text or "LV_COLOR_16_SWAP" in text:
+        print(path, "skipped (not a single-variant TRUE_COLOR_ALPHA image)")
+        return False
+    m = ARRAY_RE.search(text)
+    if not m:
+        raise SystemExit(f"{path}: pixel array not found")
+    body = m.group(2)
+    data = bytearray(int(h, 16) for h in HEX_RE.findall(body))
+    # LVGL이 읽는 그대로 배열 시작부터 3바이트(색 2 + 알파 1) 단위로 색 바이트만 뒤집는다.
+    for i in range(0, len(data) - 2, 3):
+        data[i], data[i + 1] = data[i + 1], data[i]
+    sep = ", " if ", 0x" in body else ","
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + sep.join(f"0x{b:02x}" for b in data[i : i + 16]) + ",")
+    new_body = "\n" + "\n".join(lines) + "\n"
+    text = text[: m.start(2)] + new_body + text[m.end(2) :]
+    text = text.replace("#include <lvgl.h>\n", "#include <lvgl.h>\n\n" + MARKER + "\n" + GUARD, 1)
+    path.write_text(text, encoding="utf-8")
+    print(path, len(data), "bytes swapped")
+    return True
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    for arg in sys.argv[1:]:
+        swap_file(Path(arg))
@@ -0,0 +1,108 @@
+#!/usr/bin/env node
+// M5 기기 토픽 wire 비교: JSON vs msgpack.
+//
+// 1) 전송 바이트(full 스냅샷 / tick patch / students_today)
+// 2) 게이트웨이 측 인코딩·디코딩 시간(참고용, 노드 기준)
+//
+// 기기 측 디코딩 시간과 힙은 펌웨어가 직접 보고한다.
+//  - sync_ack: wire, decode_us  (같은 스냅샷을 wire만 바꿔 비교)
+//  - diag:     hw_decode_us_last/max, hw_decode_footprint, rxq_* (students_today는 doc 용량 = len + 2048)
+//
+// 사용: node scripts/bench_m5_wire.mjs [groups=8] [children=3] [iterations=2000]
+
+import { createM5HomeworksEnvelope, sanitizeGroupsForDevicePayload } from '../src/m5_sync_fingerprint.js';
+import { createM5HomeworksPatchEnvelope } from '../src/m5_sync_patch.js';
+import { M5_HW_WIRE_KEYS, decodeMsgPack, encodeM5DeviceWire, encodeM5HomeworksWire } from '../src/m5_wire_codec.js';
+
+const groupCount = Number(process.argv[2] || 8);
+const childCount = Number(process.argv[3] || 3);
+const iterations = Number(process.argv[4] || 2000);
+
+function sampleGroups(tick = 0) {
+  return Array.from({ length: groupCount }, (_, i) => ({
+    group_id: `5f0c2a7e-1b7d-4c39-9d7e-${String(100000000000 + i)}`,
+    group_title: `쎈 공통수학1 ${i + 1}단원`,
+    page_summary: `p.${10 + i}-${14 + i}`,
+    order_index: i,
+    is_homework: i % 3 === 0,
+    is_test: false,
+    is_naesin: i === 2,
+    pending_complete: false,
+    phase: i === 0 ? 2 : 1,
+    accumulated: 600 * i + (i === 0 ? tick : 0),
+    cycle_elapsed: i === 0 ? 30 + tick : 0,
+    check_count: i,
+    total_count: 10,
+    time_limit_minutes: i % 2 ? 40 : null,
+    color: 4284955319,
+    run_start: i === 0 ? '2026-10-17T09:30:05.123+09:00' : null,
+    content: '교재: 쎈 수학\n과정: 공통수학1',
+    type: '교재',
+    book_id: i % 2 ? 'b4b6d7b2-0e0c-4d0f-8f8d-2a9c8b2f1e11' : null,
+    grade_label: '고1',
+    m5_wait_title: `쎈 ${i + 1}단원 유형 ${i + 3}`,
+    children: Array.from({ length: childCount }, (_, c) => ({
+      item_id: `c-${i}-${c}-7e1b2c3d4e5f`,
+      title: `유형 ${c + 1}`,
+      page: `${20 + c}`,
+      memo: c === 0 ? '오답 다시' : '',
+      count: 8,
+      check_count: c,
+      phase: 1,
+      accumulated: 120 * c
+    }))
+  }));
+}
+
+function envelope(tick, seq) {
+  return createM5HomeworksEnvelope({
+    academyId: '3ff51b8d-3cfb-4a36-a1a1-b63aebbde677',
+    deviceId: 'm5-device-001',
+    studentId: '9b2e5d4c-6a71-4c1f-8e3b-0d5f2a7c9e10',
+    groups: sanitizeGroupsForDevicePayload(sampleGroups(tick)),
+    source: 'bench',
+    syncSeq: seq
+  });
+}
+
+function timeIt(fn) {
+  const t0 = process.hrtime.bigint();
+  for (let i = 0; i < iterations; i++) fn();
+  return Number(process.hrtime.bigint() - t0) / 1000 / iterations;
+}
+
+const base = envelope(0, 1);
+const next = envelope(60, 2);
+const patch = createM5HomeworksPatchEnvelope(base, next);
+const students = {
+  students: Array.from({ length: 20 }, (_, i) => ({
+    student_id: `9b2e5d4c-6a71-4c1f-8e3b-${String(100000000000 + i)}`,
+    name: `학생${i + 1}`,
+    school_name: '한빛고',
+    grade: 1,
+    arrival_time: '2026-10-17T09:00:00+09:00'
+  }))
+};
+
+const rows = [
+  ['homeworks full', encodeM5HomeworksWire(next, 'json'), encodeM5HomeworksWire(next, 'msgpack')],
+  ['homeworks patch', patch && encodeM5HomeworksWire(patch, 'json'), patch && encodeM5HomeworksWire(patch, 'msgpack')],
+  ['students_today', encodeM5DeviceWire(students, 'json'), encodeM5DeviceWire(students, 'msgpack')]
+];
+
+console.log(`[bench] groups=${groupCount} children=${childCount} iterations=${iterations}`);
+for (const [name, json, mp] of rows) {
+  if (!json) {
+    console.log(`  ${name.padEnd(16)} (patch not smaller than snapshot)`);
+    continue;
+  }
+  const jsonBytes = Buffer.byteLength(json);
+  const ratio = ((mp.length / jsonBytes) * 100).toFixed(1);
+  console.log(`  ${name.padEnd(16)} json=${jsonBytes}B msgpack=${mp.length}B (${ratio}%)`);
+}
+
+const fullJson = encodeM5HomeworksWire(next, 'json');
+const fullMp = encodeM5HomeworksWire(next, 'msgpack');
+console.log('[bench] gateway encode/decode us/op (node, reference only)');
+console.log(`  encode json=${timeIt(() => encodeM5HomeworksWire(next, 'json')).toFixed(2)} msgpack=${timeIt(() => encodeM5HomeworksWire(next, 'msgpack')).toFixed(2)}`);
+console.log(`  decode json=${timeIt(() => JSON.parse(fullJson)).toFixed(2)} msgpack=${timeIt(() => decodeMsgPack(fullMp, M5_HW_WIRE_KEYS)).toFixed(2)}`);
@@ -9,6 +9,9 @@ import {
   sanitizeGroupsForDevicePayload as sanitizeM5GroupsForDevicePayload
 } from './m5_sync_fingerprint.js';
 import { isM5SyncAckMatch } from './m5_sync_ack.js';
+import { createM5HomeworksPatchEnvelope } from './m5_sync_patch.js';
+import { encodeM5DeviceWire, encodeM5HomeworksWire, normalizeM5WireFormat } from './m5_wire_codec.js';
+import { createM5OtaMirror } from './m5_ota_mirror.js';
 
 const SUPABASE_URL = process.env.SUPABASE_URL;
 const SUPABASE_ANON = process.env.SUPABASE_ANON_KEY;
@@ -37,6 +40,12 @@ const M5_FULL_RESYNC_COOLDOWN_MS = Number.parseInt(process.env.M5_FULL_RESYNC_CO
 const M5_SYNC_ACK_TIMEOUT_MS = Number.parseInt(process.env.M5_SYNC_ACK_TIMEOUT_MS ?? '12000', 10);
 const M5_REVISION_POLL_MS = Number.parseInt(process.env.M5_REVISION_POLL_MS ?? '15000', 10);
 const M5_SAFETY_RESYNC_MS = Number.parseInt(process.env.M5_SAFETY_RESYNC_MS ?? '300000', 10);
+// M5 펌웨어 LAN 미러: 포트를 주면 켜진다. PUBLIC_URL은 기기가 닿는 주소(http://<게이트웨이 IP>:<포트>).
+const M5_OTA_MIRROR_PORT = Number.parseInt(process.env.M5_OTA_MIRROR_PORT ?? '0', 10);
+const M5_OTA_PUBLIC_URL = process.env.M5_OTA_PUBLIC_URL || '';
+const M5_OTA_MIRROR_DIR = process.env.M5_OTA_MIRROR_DIR || new URL('../tmp/m5_ota', import.meta.url).pathname;
+const M5_OTA_GITHUB_REPO = process.env.M5_OTA_GITHUB_REPO || 'How-Know/Yggdrasill';
+const M5_OTA_POLL_MS = Number.parseInt(process.env.M5_OTA_POLL_MS ?? '600000', 10);
 // 학생 수가 LVGL 정지의 촉발 조건인지 확인하기 위한 단일 기기 A/B 테스트.
 // 다른 M5의 등원 목록은 그대로 유지한다.
 const M5_STUDENT_LIST_TEST_DEVICE_ID = 'm5-device-013';
@@ -155,6 +164,20 @@ const client = mqtt.connect(MQTT_URL, {
   ...tlsOpts
 });
 
+const m5OtaMirror =
+  M5_OTA_MIRROR_PORT > 0
+    ? createM5OtaMirror({
+        dir: M5_OTA_MIRROR_DIR,
+        port: M5_OTA_MIRROR_PORT,
+        publicUrl: M5_OTA_PUBLIC_URL,
+        githubRepo: M5_OTA_GITHUB_REPO,
+        githubToken: process.env.GITHUB_TOKEN || '',
+        pollMs: M5_OTA_POLL_MS,
+        log: (level, message, payload) => logEvent(level, message, payload ?? {})
+      })
+    : null;
+m5OtaMirror?.start().catch((e) => logEvent('error', '[m5-ota] mirror start failed', { error: e.message }));
+
 const rawPublish = client.publish.bind(client);
 function publish(topic, payload, options = { qos: 1, retain: false }) {
   gatewayState.lastPublishTs = nowMs();
@@ -217,9 +240,22 @@ function maybePublishAck(academyId, idempotencyKey, body) {
     logEvent('warn', '[gateway] missing idempotency key for ack', { academyId, action: body?.action });
     return;
   }
+  ackedBodies.set(idempotencyKey, body);
+  publishAck(academyId, idempotencyKey, body);
+}
+
+// 캐시를 건드리지 않고 ack만 보낸다(중복 재전송에 대한 재-ack).
+function publishAck(academyId, idempotencyKey, body) {
   publish(`academies/${academyId}/ack/${idempotencyKey}`, JSON.stringify(body), { qos: 1, retain: false });
 }
 
+// 실행하지 못하는 커맨드에도 키가 있으면 종결 ack(ok:false)를 보낸다. 안 보내면 M5 저널이 만료될 때까지 재전송한다.
+function publishTerminalAck(academyId, idempotencyKey, body) {
+  if (typeof idempotencyKey !== 'string' || !/^[\w-]{1,64}$/.test(idempotencyKey)) return;
+  processed.set(idempotencyKey, Date.now());
+  maybePublishAck(academyId, idempotencyKey, { ok: false, ...body });
+}
+
 client.on('connect', (packet = {}) => {
   gatewayState.connected = true;
   gatewayState.lastConnectTs = nowMs();
@@ -235,11 +271,18 @@ client.on('connect', (packet = {}) => {
 
 // simple idempotency cache (10 minutes TTL)
 const processed = new Map(); // key -> timestamp
+// M5 오프라인 저널은 ack를 받을 때까지 같은 키로 재전송한다. 중복은 실행하지 않고 처음 ack를 다시 보낸다.
+const ackedBodies = new Map(); // key -> ack body (processed와 같은 TTL)
 const IDEMP_TTL_MS = 10 * 60 * 1000;
 const groupTransitionInflightUntil = new Map();
 setInterval(() => {
   const now = Date.now();
-  for (const [k, ts] of processed.entries()) if (now - ts > IDEMP_TTL_MS) processed.delete(k);
+  for (const [k, ts] of processed.entries()) {
+    if (now - ts > IDEMP_TTL_MS) {
+      processed.delete(k);
+      ackedBodies.delete(k);
+    }
+  }
   for (const [k, ts] of groupTransitionInflightUntil.entries()) if (ts <= now) groupTransitionInflightUntil.delete(k);
 }, 60 * 1000);
 
@@ -300,6 +343,12 @@ const homeworkPublishChains = new Map();
 const homeworkPublishCoalesce = new Map();
 const m5SyncSequences = new Map();
 const m5LatestSnapshots = new Map();
+/** sync_ack에 patch:1 을 실어 보낸 기기(델타 적용 가능) */
+const m5PatchCapableDevices = new Set();
+/** presence의 wire 값(json|msgpack). 없으면 json */
+const m5WireFormats = new Map();
+/** 이번 접속 세션에 기기에 알린 OTA 소스(manifest_url, ''는 "미러 없음"). offline/LWT에서 지운다 */
+const m5OtaSourcesSent = new Map();
 let m5FullResyncTimer = null;
 let m5FullResyncInFlight = false;
 let m5FullResyncPendingReason = null;
@@ -325,6 +374,10 @@ function m5SnapshotKey(academy_id, device_id) {
   return `${academy_id}::${device_id}`;
 }
 
+function m5WireFormat(academy_id, device_id) {
+  return m5WireFormats.get(m5SnapshotKey(academy_id, device_id)) || 'json';
+}
+
 function publishHomeworksToDevice(academy_id, student_id, device_id, groups, source = 'unknown') {
   const payloadGroups = sanitizeGroupsForDevicePayload(groups || []);
   const envelope = createM5HomeworksEnvelope({
@@ -336,28 +389,57 @@ function publishHomeworksToDevice(academy_id, student_id, device_id, groups, sou
     syncSeq: nextM5SyncSeq(academy_id, device_id, student_id)
   });
   const topic = `academies/${academy_id}/devices/${device_id}/homeworks`;
-  const payload = JSON.stringify(envelope);
-  publish(topic, payload, { qos: 1, retain: false });
+  const wire = m5WireFormat(academy_id, device_id);
+  const payload = encodeM5HomeworksWire(envelope, wire);
   const key = m5SnapshotKey(academy_id, device_id);
+  // 직전 스냅샷이 ack된 경우에만 그 스냅샷 기준 patch를 보낸다. 기기는 마지막으로
+  // 디코딩한 스냅샷을 기준으로 병합하므로 미확인 스냅샷이 끼면 기준이 어긋난다.
+  const prev = m5LatestSnapshots.get(key);
+  let wirePayload = payload;
+  let mode = 'full';
+  if (
+    m5PatchCapableDevices.has(key) &&
+    prev &&
+    !prev.forceFull &&
+    prev.student_id === student_id &&
+    prev.ackedAt >= prev.publishedAt
+  ) {
+    const patch = createM5HomeworksPatchEnvelope(prev.envelope, envelope);
+    if (patch) {
+      wirePayload = encodeM5HomeworksWire(patch, wire);
+      mode = 'patch';
+    }
+  }
+  publish(topic, wirePayload, { qos: 1, retain: false });
   m5LatestSnapshots.set(key, {
     academy_id,
     student_id,
     device_id,
     topic,
+    // 재전송은 기준 스냅샷과 무관하게 적용되도록 항상 전체 스냅샷을 쓴다.
     payload,
     envelope,
+    mode,
     publishedAt: nowMs(),
     ackedAt: 0,
     cachedRetrySent: false,
     lastMismatchRecoveryAt: m5LatestSnapshots.get(key)?.lastMismatchRecoveryAt || 0
   });
-  logEvent('log', '[gateway][m5-sync] publish', envelope.meta);
+  logEvent('log', '[gateway][m5-sync] publish', {
+    ...envelope.meta,
+    mode,
+    wire,
+    bytes: wirePayload.length,
+    full_bytes: payload.length
+  });
   return envelope;
 }
 
 function handleM5SyncAck(academy_id, device_id, msg) {
   if (msg?.type !== 'homeworks_apply') return;
   const key = m5SnapshotKey(academy_id, device_id);
+  if (msg?.patch) m5PatchCapableDevices.add(key);
+  else m5PatchCapableDevices.delete(key);
   const latest = m5LatestSnapshots.get(key);
   if (!latest) {
     logSampled(
@@ -385,6 +467,9 @@ function handleM5SyncAck(academy_id, device_id, msg) {
     return;
   }
 
+  // 기기가 patch 기준(base_fp)을 갖고 있지 않으면 ok:false 로 알려 온다.
+  // 다음 발행은 반드시 전체 스냅샷으로 보낸다.
+  if (msg?.ok === false) latest.forceFull = true;
   const now = nowMs();
   if (now - latest.lastMismatchRecoveryAt < cfg.m5SyncAckTimeoutMs) return;
   latest.lastMismatchRecoveryAt = now;
@@ -392,7 +477,8 @@ function handleM5SyncAck(academy_id, device_id, msg) {
     academy_id,
     device_id,
     expected_fp: expectedFp,
-    applied_fp: appliedFp || null
+    applied_fp: appliedFp || null,
+    report_reason: msg?.report_reason || null
   });
   void queueHomeworksToBoundDevices(
     latest.academy_id,
@@ -510,7 +596,11 @@ async function publishStudentsTodayToDevice(academy_id, device_id, source = 'lis
     available: filtered.length,
     sent: sentStudents.length
   });
-  publish(`academies/${academy_id}/devices/${device_id}/students_today`, JSON.stringify({ students: sentStudents }), { qos: 1, retain: false });
+  publish(
+    `academies/${academy_id}/devices/${device_id}/students_today`,
+    encodeM5DeviceWire({ students: sentStudents }, m5WireFormat(academy_id, device_id)),
+    { qos: 1, retain: false }
+  );
   return sentStudents.length;
 }
 
@@ -534,7 +624,10 @@ async function republishStudentListToUnboundDevices(academy_id, source = 'rebind
       .map(d => d.device_id)
       .filter(id => id && !boundDevices.has(id));
     for (const device_id of targets) {
-      const payload = JSON.stringify({ students: studentsForDevice(filtered, device_id) });
+      const payload = encodeM5DeviceWire(
+        { students: studentsForDevice(filtered, device_id) },
+        m5WireFormat(academy_id, device_id)
+      );
       publish(`academies/${academy_id}/devices/${device_id}/students_today`, payload, { qos: 1, retain: false });
     }
     console.log('[gateway][list-resync] republished', { source, targets: targets.length, students: filtered.length });
@@ -874,6 +967,7 @@ client.on('message', async (topic, payload) => {
     if (parts.length >= 6 && parts[0] === 'academies' && parts[2] === 'students' && parts[4] === 'homework') {
       if (!validate(msg)) {
         console.warn('[gateway] invalid payload', validate.errors);
+        publishTerminalAck(parts[1], msg?.idempotency_key, { action: msg?.action ?? null, error: 'invalid_payload' });
         return;
       }
       const [, academy_id, , student_id, , item_id] = parts;
@@ -884,6 +978,9 @@ client.on('message', async (topic, payload) => {
     if (idempotency_key) {
       if (processed.has(idempotency_key)) {
         console.log('[gateway] skip duplicate', idempotency_key);
+        const prevAck = ackedBodies.get(idempotency_key);
+        // 아직 처리 중이면(ack 전) 조용히 건너뛴다. 처리 후 ack가 나간다.
+        if (prevAck) publishAck(academy_id, idempotency_key, { ...prevAck, duplicate: true });
         return;
       }
       processed.set(idempotency_key, Date.now());
@@ -967,7 +1064,11 @@ client.on('message', async (topic, payload) => {
       return;
     }
     const rpc = rpcMap[action];
-    if (!rpc) return;
+    if (!rpc) {
+      console.warn('[gateway] unknown homework action', { action, academy_id, student_id });
+      if (idempotency_key) maybePublishAck(academy_id, idempotency_key, { ok: false, action, error: 'unknown_action' });
+      return;
+    }
 
     const updated_by = msg.updated_by ?? null;
     let params = { p_item_id: item_id, p_academy_id: academy_id, p_updated_by: updated_by };
@@ -1000,6 +1101,24 @@ client.on('message', async (topic, payload) => {
       const device_id = parts[3];
       const online = !!msg.online;
       const at = msg.at || new Date().toISOString();
+      const deviceKey = m5SnapshotKey(academy_id, device_id);
+      // LWT(offline)에는 wire가 없으므로 online presence일 때만 갱신한다.
+      if (online) m5WireFormats.set(deviceKey, normalizeM5WireFormat(msg.wire));
+      // 업데이트 소스(LAN 미러 매니페스트)는 접속 세션마다 한 번, 값이 바뀌었을 때만 알린다(presence는 15초마다 온다).
+      // 미러를 광고하지 않으면(M5_OTA_PUBLIC_URL 없음) 빈 값을 보내 기기가 저장해 둔 미러를 잊게 한다.
+      if (!online) {
+        m5OtaSourcesSent.delete(deviceKey);
+      } else {
+        const manifestUrl = m5OtaMirror ? m5OtaMirror.manifestUrl() : '';
+        if (m5OtaSourcesSent.get(deviceKey) !== manifestUrl) {
+          m5OtaSourcesSent.set(deviceKey, manifestUrl);
+          publish(
+            `academies/${academy_id}/devices/${device_id}/update`,
+            JSON.stringify({ type: 'ota_source', manifest_url: manifestUrl }),
+            { qos: 1, retain: false }
+          );
+        }
+      }
       const { error } = await supa.rpc('m5_device_presence', { p_academy_id: academy_id, p_device_id: device_id, p_online: online, p_at: at });
       if (error) console.error('[gateway] presence rpc error', error);
       return;
@@ -1231,7 +1350,11 @@ client.on('message', async (topic, payload) => {
         const student_id = msg.student_id;
         const { data, error } = await supa.rpc('m5_get_student_info', { p_academy_id: academy_id, p_student_id: student_id });
         if (error) { console.error('[gateway] student_info error', error); return; }
-        publish(`academies/${academy_id}/devices/${device_id}/student_info`, JSON.stringify({ info: data && data[0] ? data[0] : null }), { qos: 1, retain: false });
+        publish(
+          `academies/${academy_id}/devices/${device_id}/student_info`,
+          encodeM5DeviceWire({ info: data && data[0] ? data[0] : null }, m5WireFormat(academy_id, device_id)),
+          { qos: 1, retain: false }
+        );
         return;
       }
       if (action === 'raise_question') {
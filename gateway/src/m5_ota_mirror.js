@@ -0,0 +1,316 @@
+// M5 펌웨어 LAN 미러.
+//
+// 기기마다 GitHub Releases API(TLS)를 치고 전체 이미지를 따로 받던 것을, 게이트웨이가 최신 릴리스를
+// 한 번 받아 두고 LAN에서 나눠 주는 구조로 바꾼다.
+//  - GET /m5/manifest.json : {"v","size","sha256","url","deltas":{"<이전 버전>":"<url>"}}
+//    ETag/If-None-Match를 지원해 "업데이트 없음" 확인은 304 한 줄로 끝난다.
+//  - GET /m5/fw/<tag>/<name> : 이미지/델타 파일. Range(206)를 지원해 기기가 끊긴 곳부터 이어 받는다.
+// 기기에는 presence(online) 때 .../devices/{d}/update 토픽으로 manifest_url을 알려 준다.
+// url은 매니페스트 기준 상대 경로라 게이트웨이 주소가 바뀌어도 매니페스트는 그대로다.
+
+import { createHash } from 'crypto';
+import { createReadStream, existsSync, mkdirSync, readFileSync, renameSync, statSync, writeFileSync } from 'fs';
+import { createServer } from 'http';
+import { join, resolve, sep } from 'path';
+
+const MANIFEST_PATH = '/m5/manifest.json';
+const FILE_PREFIX = '/m5/fw/';
+const DELTA_RE = /\.from-([0-9A-Za-z.\-]+)\.ydp$/;
+
+function versionParts(v) {
+  return String(v ?? '')
+    .trim()
+    .replace(/^v/i, '')
+    .split('.')
+    .map((p) => Number.parseInt(p, 10) || 0);
+}
+
+// 점으로 나눈 숫자 비교. a > b면 양수.
+export function compareM5Versions(a, b) {
+  const pa = versionParts(a);
+  const pb = versionParts(b);
+  for (let i = 0; i < Math.max(pa.length, pb.length); i += 1) {
+    const d = (pa[i] ?? 0) - (pb[i] ?? 0);
+    if (d !== 0) return d;
+  }
+  return 0;
+}
+
+export function buildM5OtaManifest({ version, size, sha256, url, deltas = {} }) {
+  const manifest = { v: String(version).replace(/^v/i, ''), size, sha256, url };
+  const keys = Object.keys(deltas).sort(compareM5Versions);
+  if (keys.length) manifest.deltas = Object.fromEntries(keys.map((k) => [k, deltas[k]]));
+  return manifest;
+}
+
+export function m5OtaEtag(body) {
+  return `"${createHash('sha256').update(body).digest('hex').slice(0, 16)}"`;
+}
+
+// If-None-Match: "a", W/"b" 또는 *
+export function ifNoneMatchHit(header, etag) {
+  if (!header || !etag) return false;
+  return String(header)
+    .split(',')
+    .map((t) => t.trim().replace(/^W\//, ''))
+    .some((t) => t === '*' || t === etag);
+}
+
+// Range: bytes=a-b / bytes=a- / bytes=-n (단일 구간만). 없으면 null, 만족 불가면 'invalid'.
+export function parseByteRange(header, size) {
+  if (!header) return null;
+  const m = /^bytes=(\d*)-(\d*)$/.exec(String(header).trim());
+  if (!m || (m[1] === '' && m[2] === '')) return 'invalid';
+  let start;
+  let end;
+  if (m[1] === '') {
+    const n = Number(m[2]);
+    if (n === 0) return 'invalid';
+    start = Math.max(0, size - n);
+    end = size - 1;
+  } else {
+    start = Number(m[1]);
+    end = m[2] === '' ? size - 1 : Math.min(Number(m[2]), size - 1);
+  }
+  if (start >= size || end < start) return 'invalid';
+  return { start, end };
+}
+
+function safeFilePath(root, urlPath) {
+  let rel;
+  try {
+    rel = decodeURIComponent(urlPath.slice(FILE_PREFIX.length));
+  } catch {
+    return null;
+  }
+  if (!rel || rel.includes('\0')) return null;
+  const full = resolve(root, rel);
+  return full.startsWith(resolve(root) + sep) ? full : null;
+}
+
+async function sha256File(path) {
+  const h = createHash('sha256');
+  for await (const chunk of createReadStream(path)) h.update(chunk);
+  return h.digest('hex');
+}
+
+export function createM5OtaMirror({
+  dir,
+  port = 0,
+  publicUrl = '',
+  githubRepo = '',
+  githubToken = '',
+  pollMs = 10 * 60 * 1000,
+  fetchImpl = globalThis.fetch,
+  log = (level, message, payload) => console[level](message, payload ?? '')
+} = {}) {
+  const root = resolve(dir);
+  mkdirSync(root, { recursive: true });
+  const state = {
+    manifestBody: null,
+    etag: null,
+    githubEtag: null,
+    tag: null,
+    syncing: null,
+    stats: { manifest200: 0, manifest304: 0, fileBytes: 0, githubChecks: 0, githubDownloads: 0 }
+  };
+  let server = null;
+  let timer = null;
+
+  function setManifest(manifest) {
+    const body = JSON.stringify(manifest);
+    state.manifestBody = body;
+    state.etag = m5OtaEtag(body);
+    writeFileSync(join(root, 'manifest.json'), body);
+  }
+
+  const saved = join(root, 'manifest.json');
+  if (existsSync(saved)) {
+    try {
+      const body = readFileSync(saved, 'utf8');
+      JSON.parse(body);
+      state.manifestBody = body;
+      state.etag = m5OtaEtag(body);
+    } catch (e) {
+      log('warn', '[m5-ota] saved manifest unreadable', { error: e.message });
+    }
+  }
+
+  async function download(url, dest) {
+    if (existsSync(dest)) return;
+    const headers = { 'User-Agent': 'ygg-gateway-m5-ota', Accept: 'application/octet-stream' };
+    const res = await fetchImpl(url, { headers, redirect: 'follow' });
+    if (!res.ok) throw new Error(`download ${url} -> ${res.status}`);
+    const tmp = `${dest}.part`;
+    writeFileSync(tmp, Buffer.from(await res.arrayBuffer()));
+    renameSync(tmp, dest);
+    state.stats.githubDownloads += 1;
+  }
+
+  // GitHub 최신 릴리스를 미러에 반영한다. 릴리스가 그대로면 GitHub도 304라 비용이 거의 없다.
+  async function syncFromGithub() {
+    if (!githubRepo) return false;
+    state.stats.githubChecks += 1;
+    const headers = { 'User-Agent': 'ygg-gateway-m5-ota', Accept: 'application/vnd.github+json' };
+    if (githubToken) headers.Authorization = `Bearer ${githubToken}`;
+    if (state.githubEtag) headers['If-None-Match'] = state.githubEtag;
+    const res = await fetchImpl(`https://api.github.com/repos/${githubRepo}/releases/latest`, { headers });
+    if (res.status === 304) return false;
+    if (!res.ok) throw new Error(`releases/latest -> ${res.status}`);
+    const release = await res.json();
+    const tag = String(release.tag_name || '');
+    const assets = Array.isArray(release.assets) ? release.assets : [];
+    const bin = assets.find((a) => /m5stack/.test(a.name) && a.name.endsWith('.bin'));
+    if (!tag || !bin || /[\\/]/.test(tag)) {
+      log('warn', '[m5-ota] release has no m5stack image', { tag });
+      state.githubEtag = res.headers.get('etag');
+      return false;
+    }
+    const tagDir = join(root, tag);
+    mkdirSync(tagDir, { recursive: true });
+    const binPath = join(tagDir, bin.name);
+    await download(bin.browser_download_url, binPath);
+    const sha256 = await sha256File(binPath);
+    const published = String(bin.digest || '').replace(/^sha256:/, '');
+    if (published && published !== sha256) {
+      renameSync(binPath, `${binPath}.bad`);
+      throw new Error(`sha256 mismatch for ${bin.name}`);
+    }
+    const deltas = {};
+    for (const a of assets) {
+      const m = DELTA_RE.exec(a.name || '');
+      if (!m || !/m5stack/.test(a.name)) continue;
+      await download(a.browser_download_url, join(tagDir, a.name));
+      deltas[m[1]] = `fw/${encodeURIComponent(tag)}/${encodeURIComponent(a.name)}`;
+    }
+    setManifest(
+      buildM5OtaManifest({
+        version: tag,
+        size: statSync(binPath).size,
+        sha256,
+        url: `fw/${encodeURIComponent(tag)}/${encodeURIComponent(bin.name)}`,
+        deltas
+      })
+    );
+    state.githubEtag = res.headers.get('etag');
+    state.tag = tag;
+    log('log', '[m5-ota] mirrored release', { tag, sha256, deltas: Object.keys(deltas) });
+    return true;
+  }
+
+  function refresh() {
+    if (!state.syncing) {
+      state.syncing = syncFromGithub()
+        .catch((e) => {
+          log('warn', '[m5-ota] github sync failed', { error: e.message });
+          return false;
+        })
+        .finally(() => {
+          state.syncing = null;
+        });
+    }
+    return state.syncing;
+  }
+
+  function serveManifest(req, res) {
+    if (!state.manifestBody) {
+      res.writeHead(404, { 'Content-Length': 0 });
+      res.end();
+      return;
+    }
+    const common = { ETag: state.etag, 'Cache-Control': 'no-cache' };
+    if (ifNoneMatchHit(req.headers['if-none-match'], state.etag)) {
+      state.stats.manifest304 += 1;
+      res.writeHead(304, common);
+      res.end();
+      return;
+    }
+    state.stats.manifest200 += 1;
+    res.writeHead(200, {
+      ...common,
+      'Content-Type': 'application/json',
+      'Content-Length': Buffer.byteLength(state.manifestBody)
+    });
+    res.end(state.manifestBody);
+  }
+
+  function serveFile(req, res, path) {
+    let size;
+    try {
+      const st = statSync(path);
+      if (!st.isFile()) throw new Error('not a file');
+      size = st.size;
+    } catch {
+      res.writeHead(404, { 'Content-Length': 0 });
+      res.end();
+      return;
+    }
+    const range = parseByteRange(req.headers.range, size);
+    if (range === 'invalid') {
+      res.writeHead(416, { 'Content-Range': `bytes */${size}`, 'Content-Length': 0 });
+      res.end();
+      return;
+    }
+    const { start, end } = range ?? { start: 0, end: size - 1 };
+    const headers = {
+      'Content-Type': 'application/octet-stream',
+      'Content-Length': end - start + 1,
+      'Accept-Ranges': 'bytes'
+    };
+    if (range) headers['Content-Range'] = `bytes ${start}-${end}/${size}`;
+    res.writeHead(range ? 206 : 200, headers);
+    const stream = createReadStream(path, { start, end });
+    stream.on('data', (chunk) => {
+      state.stats.fileBytes += chunk.length;
+    });
+    stream.pipe(res);
+  }
+
+  function handler(req, res) {
+    const path = (req.url || '').split('?')[0];
+    if (req.method !== 'GET') {
+      res.writeHead(405, { 'Content-Length': 0 });
+      res.end();
+      return;
+    }
+    if (path === MANIFEST_PATH) return serveManifest(req, res);
+    if (path.startsWith(FILE_PREFIX)) {
+      const full = safeFilePath(root, path);
+      if (full) return serveFile(req, res, full);
+    }
+    res.writeHead(404, { 'Content-Length': 0 });
+    res.end();
+  }
+
+  // 기기는 받은 주소를 NVS에 저장해 먼저 시도한다. 기기가 닿는 주소(M5_OTA_PUBLIC_URL)를 모르면
+  // 광고하지 않는다(루프백 주소를 알리면 모든 기기가 닿지 않는 미러부터 두드리게 된다).
+  function manifestUrl() {
+    return publicUrl ? `${publicUrl.replace(/\/+$/, '')}${MANIFEST_PATH}` : '';
+  }
+
+  async function start() {
+    server = createServer(handler);
+    await new Promise((ok, fail) => {
+      server.once('error', fail);
+      server.listen(port, ok);
+    });
+    log('log', '[m5-ota] mirror listening', { port: server.address().port, manifestUrl: manifestUrl() });
+    if (!publicUrl) log('warn', '[m5-ota] M5_OTA_PUBLIC_URL not set; mirror is not advertised to devices');
+    if (githubRepo) {
+      refresh();
+      timer = setInterval(refresh, pollMs);
+      timer.unref?.();
+    }
+    return server.address().port;
+  }
+
+  async function stop() {
+    if (timer) clearInterval(timer);
+    timer = null;
+    if (state.syncing) await state.syncing;
+    if (server) await new Promise((ok) => server.close(ok));
+    server = null;
+  }
+
+  return { start, stop, refresh, handler, manifestUrl, setManifest, state };
+}
@@ -54,8 +54,9 @@ export function createM5HomeworksEnvelope({
   publishedAt = new Date().toISOString()
 }) {
   const payloadGroups = Array.isArray(groups) ? groups : [];
+  // meta must serialize before groups: the device reads sync_fp while the
+  // payload is still streaming in and skips decoding groups it already has.
   return {
-    groups: payloadGroups,
     meta: {
       sync_seq: syncSeq,
       sync_fp: computeM5SyncFingerprint(payloadGroups),
@@ -65,6 +66,7 @@ export function createM5HomeworksEnvelope({
       student_id: studentId,
       published_at: publishedAt,
       group_count: payloadGroups.length
-    }
+    },
+    groups: payloadGroups
   };
 }
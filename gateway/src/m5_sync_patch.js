@@ -0,0 +1,121 @@
+import { computeM5SyncFingerprint, stableStringify } from './m5_sync_fingerprint.js';
+
+// Fields the device combines into one display value (book_name). When any of
+// them changes, all of them are sent so the device can recompute it without
+// keeping the raw content around.
+export const M5_PATCH_DERIVED_FIELDS = [
+  'content',
+  'group_title',
+  'book_id',
+  'grade_label',
+  'type',
+  'is_naesin'
+];
+
+function normalizeForWire(value) {
+  return value === undefined ? undefined : JSON.parse(JSON.stringify(value));
+}
+
+function sameValue(a, b) {
+  return stableStringify(a) === stableStringify(b);
+}
+
+function diffGroup(base, next) {
+  const baseKeys = Object.keys(base).filter((k) => base[k] !== undefined);
+  const nextKeys = new Set(Object.keys(next).filter((k) => next[k] !== undefined));
+  // The device merges fields over its copy of the base group; a key that
+  // disappears cannot be expressed, so the caller falls back to a snapshot.
+  if (baseKeys.some((k) => !nextKeys.has(k))) return null;
+
+  const changed = new Set();
+  for (const key of nextKeys) {
+    if (key === 'group_id') continue;
+    if (!sameValue(base[key], next[key])) changed.add(key);
+  }
+  if (M5_PATCH_DERIVED_FIELDS.some((k) => changed.has(k))) {
+    for (const k of M5_PATCH_DERIVED_FIELDS) {
+      if (nextKeys.has(k)) changed.add(k);
+    }
+  }
+  if (changed.size === 0) return {};
+  const entry = {};
+  for (const key of changed) entry[key] = next[key];
+  return entry;
+}
+
+/**
+ * Builds a patch envelope that turns `baseEnvelope.groups` into
+ * `nextEnvelope.groups`. Returns null when a full snapshot is required or
+ * would not be larger than the patch.
+ *
+ * Wire order matters to the device's streaming decoder: meta, then order,
+ * then groups; every group entry starts with group_id.
+ */
+export function createM5HomeworksPatchEnvelope(baseEnvelope, nextEnvelope) {
+  const baseGroups = normalizeForWire(baseEnvelope?.groups);
+  const nextGroups = normalizeForWire(nextEnvelope?.groups);
+  const baseMeta = baseEnvelope?.meta;
+  const nextMeta = nextEnvelope?.meta;
+  if (!Array.isArray(baseGroups) || !Array.isArray(nextGroups) || !baseMeta || !nextMeta) {
+    return null;
+  }
+  if (!baseMeta.sync_fp || baseMeta.student_id !== nextMeta.student_id) return null;
+
+  const baseById = new Map();
+  for (const group of baseGroups) {
+    const id = group?.group_id;
+    if (!id || baseById.has(id)) return null;
+    baseById.set(id, group);
+  }
+
+  const order = [];
+  const groups = [];
+  for (const group of nextGroups) {
+    const id = group?.group_id;
+    if (!id || order.includes(id)) return null;
+    order.push(id);
+    const base = baseById.get(id);
+    if (!base) {
+      const { group_id, ...rest } = group;
+      groups.push({ group_id, ...rest });
+      continue;
+    }
+    const entry = diffGroup(base, group);
+    if (entry === null) return null;
+    if (Object.keys(entry).length > 0) groups.push({ group_id: id, ...entry });
+  }
+
+  const envelope = {
+    meta: {
+      mode: 'patch',
+      sync_seq: nextMeta.sync_seq,
+      sync_fp: nextMeta.sync_fp,
+      base_seq: baseMeta.sync_seq,
+      base_fp: baseMeta.sync_fp,
+      source: nextMeta.source,
+      academy_id: nextMeta.academy_id,
+      device_id: nextMeta.device_id,
+      student_id: nextMeta.student_id,
+      published_at: nextMeta.published_at,
+      group_count: nextGroups.length
+    },
+    order,
+    groups
+  };
+  if (JSON.stringify(envelope).length >= JSON.stringify(nextEnvelope).length) return null;
+  return envelope;
+}
+
+/**
+ * Reference merge matching the firmware: unchanged groups come from the
+ * base, patch entries overlay their fields, `children` is replaced whole.
+ */
+export function applyM5HomeworksPatch(baseGroups, patchEnvelope) {
+  const baseById = new Map((baseGroups || []).map((g) => [g.group_id, g]));
+  const entryById = new Map((patchEnvelope?.groups || []).map((g) => [g.group_id, g]));
+  const groups = (patchEnvelope?.order || []).map((id) => ({
+    ...(baseById.get(id) || {}),
+    ...(entryById.get(id) || {})
+  }));
+  return { groups, sync_fp: computeM5SyncFingerprint(groups) };
+}
@@ -0,0 +1,266 @@
+// Binary wire format for device topics (MessagePack subset).
+//
+// Devices advertise `wire: 'msgpack'` in presence; everything else keeps JSON.
+// The homeworks envelope additionally maps known keys to small integers and
+// sends timestamps as epoch seconds, so the device never re-parses ISO text.
+// Fingerprints are always computed on the JSON-shaped envelope, not the wire.
+
+export const M5_WIRE_JSON = 'json';
+export const M5_WIRE_MSGPACK = 'msgpack';
+
+// Integer key = index. The firmware keeps the same table in hw_sync.cpp
+// (kHwWireKeys); append only, never reorder.
+export const M5_HW_WIRE_KEYS = [
+  'meta',
+  'groups',
+  'order',
+  'sync_seq',
+  'sync_fp',
+  'source',
+  'academy_id',
+  'device_id',
+  'student_id',
+  'published_at',
+  'group_count',
+  'mode',
+  'base_seq',
+  'base_fp',
+  'group_id',
+  'group_title',
+  'page_summary',
+  'order_index',
+  'is_homework',
+  'is_test',
+  'is_naesin',
+  'pending_complete',
+  'phase',
+  'accumulated',
+  'cycle_elapsed',
+  'check_count',
+  'total_count',
+  'time_limit_minutes',
+  'color',
+  'run_start',
+  'content',
+  'type',
+  'book_id',
+  'grade_label',
+  'm5_wait_title',
+  'children',
+  'item_id',
+  'title',
+  'page',
+  'memo',
+  'count'
+];
+
+const HW_KEY_INDEX = new Map(M5_HW_WIRE_KEYS.map((key, i) => [key, i]));
+const HW_EPOCH_FIELDS = new Set(['run_start', 'published_at']);
+
+export function normalizeM5WireFormat(value) {
+  return value === M5_WIRE_MSGPACK ? M5_WIRE_MSGPACK : M5_WIRE_JSON;
+}
+
+function toEpochSeconds(value) {
+  if (typeof value !== 'string' || !value) return value ?? null;
+  const ms = Date.parse(value);
+  return Number.isFinite(ms) ? Math.floor(ms / 1000) : null;
+}
+
+class Writer {
+  constructor() {
+    this.buf = Buffer.allocUnsafe(1024);
+    this.len = 0;
+  }
+
+  reserve(n) {
+    if (this.len + n <= this.buf.length) return;
+    let size = this.buf.length * 2;
+    while (size < this.len + n) size *= 2;
+    const next = Buffer.allocUnsafe(size);
+    this.buf.copy(next, 0, 0, this.len);
+    this.buf = next;
+  }
+
+  u8(v) {
+    this.reserve(1);
+    this.buf[this.len++] = v;
+  }
+
+  head(tag, v, width) {
+    this.reserve(1 + width);
+    this.buf[this.len++] = tag;
+    if (width === 1) this.buf.writeUInt8(v, this.len);
+    else if (width === 2) this.buf.writeUInt16BE(v, this.len);
+    else this.buf.writeUInt32BE(v, this.len);
+    this.len += width;
+  }
+
+  bytes(b) {
+    this.reserve(b.length);
+    b.copy(this.buf, this.len);
+    this.len += b.length;
+  }
+
+  result() {
+    return this.buf.subarray(0, this.len);
+  }
+}
+
+function writeNumber(w, v) {
+  if (Number.isInteger(v) && v >= -0x80000000 && v <= 0xffffffff) {
+    if (v >= 0) {
+      if (v < 0x80) w.u8(v);
+      else if (v < 0x100) w.head(0xcc, v, 1);
+      else if (v < 0x10000) w.head(0xcd, v, 2);
+      else w.head(0xce, v, 4);
+      return;
+    }
+    if (v >= -32) {
+      w.u8(v & 0xff);
+    } else if (v >= -0x80) {
+      w.u8(0xd0);
+      w.u8(v & 0xff);
+    } else if (v >= -0x8000) {
+      w.head(0xd1, v & 0xffff, 2);
+    } else {
+      w.head(0xd2, v >>> 0, 4);
+    }
+    return;
+  }
+  w.reserve(9);
+  w.buf[w.len++] = 0xcb;
+  w.buf.writeDoubleBE(v, w.len);
+  w.len += 8;
+}
+
+function writeString(w, s) {
+  const b = Buffer.from(s, 'utf8');
+  if (b.length < 32) w.u8(0xa0 | b.length);
+  else if (b.length < 0x100) w.head(0xd9, b.length, 1);
+  else if (b.length < 0x10000) w.head(0xda, b.length, 2);
+  else w.head(0xdb, b.length, 4);
+  w.bytes(b);
+}
+
+function writeValue(w, v, keyOf) {
+  if (v === null || v === undefined) return w.u8(0xc0);
+  if (v === false) return w.u8(0xc2);
+  if (v === true) return w.u8(0xc3);
+  if (typeof v === 'number') {
+    // JSON.stringify turns NaN/Infinity into null; keep the same meaning.
+    return Number.isFinite(v) ? writeNumber(w, v) : w.u8(0xc0);
+  }
+  if (typeof v === 'string') return writeString(w, v);
+  if (Array.isArray(v)) {
+    if (v.length < 16) w.u8(0x90 | v.length);
+    else if (v.length < 0x10000) w.head(0xdc, v.length, 2);
+    else w.head(0xdd, v.length, 4);
+    for (const item of v) writeValue(w, item === undefined ? null : item, keyOf);
+    return;
+  }
+  if (typeof v.toJSON === 'function') return writeValue(w, v.toJSON(), keyOf);
+  const keys = Object.keys(v).filter((k) => v[k] !== undefined);
+  if (keys.length < 16) w.u8(0x80 | keys.length);
+  else if (keys.length < 0x10000) w.head(0xde, keys.length, 2);
+  else w.head(0xdf, keys.length, 4);
+  for (const key of keys) {
+    const mapped = keyOf ? keyOf(key) : undefined;
+    if (mapped !== undefined) writeNumber(w, mapped);
+    else writeString(w, key);
+    writeValue(w, v[key], keyOf);
+  }
+}
+
+/** MessagePack encoding of a JSON-compatible value (string keys). */
+export function encodeMsgPack(value) {
+  const w = new Writer();
+  writeValue(w, value, null);
+  return w.result();
+}
+
+function hwWireValue(value, key) {
+  if (HW_EPOCH_FIELDS.has(key)) return toEpochSeconds(value);
+  if (Array.isArray(value)) return value.map((item) => hwWireValue(item, null));
+  if (value && typeof value === 'object') {
+    const out = {};
+    for (const [k, v] of Object.entries(value)) out[k] = hwWireValue(v, k);
+    return out;
+  }
+  return value;
+}
+
+/**
+ * Homeworks envelope (full or patch) in the device's wire format. Key order
+ * is preserved, so meta still precedes order/groups on the wire.
+ */
+export function encodeM5HomeworksWire(envelope, wire = M5_WIRE_JSON) {
+  if (normalizeM5WireFormat(wire) !== M5_WIRE_MSGPACK) return JSON.stringify(envelope);
+  const w = new Writer();
+  writeValue(w, hwWireValue(envelope, null), (key) => HW_KEY_INDEX.get(key));
+  return w.result();
+}
+
+/** students_today / student_info bodies; the device decodes them with ArduinoJson. */
+export function encodeM5DeviceWire(body, wire = M5_WIRE_JSON) {
+  return normalizeM5WireFormat(wire) === M5_WIRE_MSGPACK ? encodeMsgPack(body) : JSON.stringify(body);
+}
+
+/**
+ * Reference decoder (tests/bench). Integer map keys are resolved through
+ * `keys` the same way the firmware does; unknown integers stay numeric.
+ */
+export function decodeMsgPack(buf, keys = null) {
+  let pos = 0;
+  const u = (n) => {
+    const v = n === 1 ? buf.readUInt8(pos) : n === 2 ? buf.readUInt16BE(pos) : buf.readUInt32BE(pos);
+    pos += n;
+    return v;
+  };
+  const str = (n) => {
+    const s = buf.toString('utf8', pos, pos + n);
+    pos += n;
+    return s;
+  };
+  const arr = (n) => Array.from({ length: n }, () => read());
+  const map = (n) => {
+    const out = {};
+    for (let i = 0; i < n; i++) {
+      let key = read();
+      if (typeof key === 'number' && keys && keys[key] !== undefined) key = keys[key];
+      out[key] = read();
+    }
+    return out;
+  };
+  function read() {
+    const b = buf[pos++];
+    if (b <= 0x7f) return b;
+    if (b <= 0x8f) return map(b & 0x0f);
+    if (b <= 0x9f) return arr(b & 0x0f);
+    if (b <= 0xbf) return str(b & 0x1f);
+    if (b >= 0xe0) return b - 0x100;
+    switch (b) {
+      case 0xc0: return null;
+      case 0xc2: return false;
+      case 0xc3: return true;
+      case 0xcb: { const v = buf.readDoubleBE(pos); pos += 8; return v; }
+      case 0xcc: return u(1);
+      case 0xcd: return u(2);
+      case 0xce: return u(4);
+      case 0xd0: { const v = buf.readInt8(pos); pos += 1; return v; }
+      case 0xd1: { const v = buf.readInt16BE(pos); pos += 2; return v; }
+      case 0xd2: { const v = buf.readInt32BE(pos); pos += 4; return v; }
+      case 0xd9: return str(u(1));
+      case 0xda: return str(u(2));
+      case 0xdb: return str(u(4));
+      case 0xdc: return arr(u(2));
+      case 0xdd: return arr(u(4));
+      case 0xde: return map(u(2));
+      case 0xdf: return map(u(4));
+      default: throw new Error(`unsupported msgpack type 0x${b.toString(16)}`);
+    }
+  }
+  const value = read();
+  if (pos !== buf.length) throw new Error('trailing bytes after msgpack value');
+  return value;
+}
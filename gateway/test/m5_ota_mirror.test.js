@@ -0,0 +1,146 @@
+import test from 'node:test';
+import assert from 'node:assert/strict';
+import { createHash } from 'crypto';
+import { mkdtempSync, readFileSync, rmSync } from 'fs';
+import { request } from 'http';
+import { tmpdir } from 'os';
+import { join } from 'path';
+
+import {
+  buildM5OtaManifest,
+  compareM5Versions,
+  createM5OtaMirror,
+  ifNoneMatchHit,
+  m5OtaEtag,
+  parseByteRange
+} from '../src/m5_ota_mirror.js';
+
+function get(port, path, headers = {}) {
+  return new Promise((ok, fail) => {
+    const req = request({ host: '127.0.0.1', port, path, headers }, (res) => {
+      const chunks = [];
+      res.on('data', (c) => chunks.push(c));
+      res.on('end', () => ok({ status: res.statusCode, headers: res.headers, body: Buffer.concat(chunks) }));
+    });
+    req.on('error', fail);
+    req.end();
+  });
+}
+
+function jsonResponse(status, body, etag) {
+  return {
+    ok: status >= 200 && status < 300,
+    status,
+    headers: { get: (k) => (k.toLowerCase() === 'etag' ? etag : null) },
+    json: async () => body,
+    arrayBuffer: async () => new ArrayBuffer(0)
+  };
+}
+
+function binResponse(buf) {
+  return {
+    ok: true,
+    status: 200,
+    headers: { get: () => null },
+    arrayBuffer: async () => buf.buffer.slice(buf.byteOffset, buf.byteOffset + buf.length)
+  };
+}
+
+test('versions compare numerically per dotted part', () => {
+  assert.ok(compareM5Versions('1.1.1.10', '1.1.1.9') > 0);
+  assert.ok(compareM5Versions('v1.2', '1.1.9.9') > 0);
+  assert.equal(compareM5Versions('1.1.1.4', 'v1.1.1.4'), 0);
+  assert.ok(compareM5Versions('1.1', '1.1.0.1') < 0);
+});
+
+test('manifest is compact and its etag is stable', () => {
+  const m = buildM5OtaManifest({ version: 'v1.1.1.5', size: 10, sha256: 'ab', url: 'fw/x.bin', deltas: { '1.1.1.4': 'd' } });
+  assert.deepEqual(m, { v: '1.1.1.5', size: 10, sha256: 'ab', url: 'fw/x.bin', deltas: { '1.1.1.4': 'd' } });
+  assert.equal(buildM5OtaManifest({ version: '1', size: 1, sha256: 'a', url: 'u' }).deltas, undefined);
+  const body = JSON.stringify(m);
+  assert.equal(m5OtaEtag(body), m5OtaEtag(body));
+  assert.notEqual(m5OtaEtag(body), m5OtaEtag(body + ' '));
+});
+
+test('If-None-Match and Range parsing', () => {
+  assert.ok(ifNoneMatchHit('"x", W/"abc"', '"abc"'));
+  assert.ok(ifNoneMatchHit('*', '"abc"'));
+  assert.ok(!ifNoneMatchHit('"abd"', '"abc"'));
+  assert.ok(!ifNoneMatchHit(undefined, '"abc"'));
+  assert.equal(parseByteRange(undefined, 100), null);
+  assert.deepEqual(parseByteRange('bytes=10-', 100), { start: 10, end: 99 });
+  assert.deepEqual(parseByteRange('bytes=10-19', 100), { start: 10, end: 19 });
+  assert.deepEqual(parseByteRange('bytes=-5', 100), { start: 95, end: 99 });
+  assert.equal(parseByteRange('bytes=100-', 100), 'invalid');
+  assert.equal(parseByteRange('bytes=1-2,5-6', 100), 'invalid');
+});
+
+test('mirror is advertised only with a public url', async (t) => {
+  const dir = mkdtempSync(join(tmpdir(), 'm5-ota-'));
+  t.after(() => rmSync(dir, { recursive: true, force: true }));
+  const local = createM5OtaMirror({ dir, log: () => {} });
+  await local.start();
+  t.after(() => local.stop());
+  assert.equal(local.manifestUrl(), '');
+  const lan = createM5OtaMirror({ dir, publicUrl: 'http://172.30.1.48:8090/', log: () => {} });
+  assert.equal(lan.manifestUrl(), 'http://172.30.1.48:8090/m5/manifest.json');
+});
+
+test('mirror downloads the release once and serves manifest, 304 and ranges', async (t) => {
+  const dir = mkdtempSync(join(tmpdir(), 'm5-ota-'));
+  t.after(() => rmSync(dir, { recursive: true, force: true }));
+  const image = Buffer.alloc(5000);
+  for (let i = 0; i < image.length; i += 1) image[i] = (i * 7) & 0xff;
+  const patch = Buffer.from('YDP1-patch');
+  const sha = createHash('sha256').update(image).digest('hex');
+  const release = {
+    tag_name: 'v1.1.1.5',
+    assets: [
+      { name: 'm5stack_firmware.bin', browser_download_url: 'https://dl/bin', digest: `sha256:${sha}` },
+      { name: 'm5stack_firmware.from-1.1.1.4.ydp', browser_download_url: 'https://dl/ydp' },
+      { name: 'notes.txt', browser_download_url: 'https://dl/notes' }
+    ]
+  };
+  const calls = [];
+  const fetchImpl = async (url, opts = {}) => {
+    calls.push(url);
+    if (url.includes('/releases/latest')) {
+      return opts.headers?.['If-None-Match'] === '"rel1"' ? jsonResponse(304, null, '"rel1"') : jsonResponse(200, release, '"rel1"');
+    }
+    if (url === 'https://dl/bin') return binResponse(image);
+    if (url === 'https://dl/ydp') return binResponse(patch);
+    throw new Error(`unexpected ${url}`);
+  };
+  const mirror = createM5OtaMirror({ dir, githubRepo: 'o/r', fetchImpl, log: () => {} });
+  const port = await mirror.start();
+  t.after(() => mirror.stop());
+  await mirror.refresh();
+  assert.equal(await mirror.refresh(), false); // GitHub 304: 다시 받지 않는다
+  assert.equal(calls.filter((u) => u.startsWith('https://dl/')).length, 2);
+
+  const m1 = await get(port, '/m5/manifest.json');
+  assert.equal(m1.status, 200);
+  const manifest = JSON.parse(m1.body.toString());
+  assert.equal(manifest.v, '1.1.1.5');
+  assert.equal(manifest.size, image.length);
+  assert.equal(manifest.sha256, sha);
+  assert.equal(manifest.url, 'fw/v1.1.1.5/m5stack_firmware.bin');
+  assert.deepEqual(Object.keys(manifest.deltas), ['1.1.1.4']);
+
+  const m2 = await get(port, '/m5/manifest.json', { 'If-None-Match': m1.headers.etag });
+  assert.equal(m2.status, 304);
+  assert.equal(m2.body.length, 0);
+
+  const full = await get(port, `/m5/${manifest.url}`);
+  assert.equal(full.status, 200);
+  assert.ok(full.body.equals(image));
+  const part = await get(port, `/m5/${manifest.url}`, { Range: 'bytes=4000-' });
+  assert.equal(part.status, 206);
+  assert.equal(part.headers['content-range'], `bytes 4000-4999/${image.length}`);
+  assert.ok(part.body.equals(image.subarray(4000)));
+  assert.equal((await get(port, `/m5/${manifest.deltas['1.1.1.4']}`)).body.toString(), 'YDP1-patch');
+
+  assert.equal((await get(port, '/m5/fw/../manifest.json')).status, 404);
+  assert.equal((await get(port, '/m5/fw/%2e%2e%2fmanifest.json')).status, 404);
+  assert.equal(JSON.parse(readFileSync(join(dir, 'manifest.json'), 'utf8')).v, '1.1.1.5');
+});
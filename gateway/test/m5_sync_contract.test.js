@@ -40,6 +40,21 @@ test('device payload limits are applied before envelope fingerprinting', () => {
   assert.equal(envelope.meta.sync_seq, 7);
 });
 
+test('envelope serializes meta before groups', () => {
+  const envelope = createM5HomeworksEnvelope({
+    academyId: 'a1',
+    deviceId: 'm5-device-010',
+    studentId: 's1',
+    groups: [{ group_id: 'g1', meta: { nested: true } }],
+    syncSeq: 3,
+    publishedAt: '2026-08-06T00:00:00.000Z'
+  });
+  const text = JSON.stringify(envelope);
+  assert.deepEqual(Object.keys(envelope), ['meta', 'groups']);
+  assert.ok(text.startsWith('{"meta":{"sync_seq":3,"sync_fp":"'));
+  assert.ok(text.indexOf('"student_id":"s1"') < text.indexOf('"groups":'));
+});
+
 test('sync ack only matches a successful apply with the latest fingerprint', () => {
   const expected = '0123456789abcdef';
   assert.equal(
@@ -0,0 +1,109 @@
+import test from 'node:test';
+import assert from 'node:assert/strict';
+
+import { createM5HomeworksEnvelope } from '../src/m5_sync_fingerprint.js';
+import {
+  M5_PATCH_DERIVED_FIELDS,
+  applyM5HomeworksPatch,
+  createM5HomeworksPatchEnvelope
+} from '../src/m5_sync_patch.js';
+
+function makeGroup(index, overrides = {}) {
+  return {
+    group_id: `g${index}`,
+    group_title: `쎈 · 공통수학1 ${index}`,
+    page_summary: 'p.10-12',
+    order_index: index,
+    phase: 2,
+    accumulated: 100 * index,
+    cycle_elapsed: 30,
+    check_count: 1,
+    total_count: 10,
+    time_limit_minutes: null,
+    color: 4284955319,
+    run_start: '2026-08-06T00:00:00.000Z',
+    content: '교재: 쎈 수학\n과정: 공통수학1',
+    type: '프린트',
+    book_id: 'b1',
+    grade_label: '',
+    is_naesin: false,
+    m5_wait_title: `대기 ${index}`,
+    children: [{ item_id: `g${index}-c0`, title: '1단원', page: '12', count: 5, phase: 2 }],
+    ...overrides
+  };
+}
+
+function envelopeFor(groups, syncSeq) {
+  return createM5HomeworksEnvelope({
+    academyId: 'a1',
+    deviceId: 'm5-device-010',
+    studentId: 's1',
+    groups,
+    syncSeq,
+    publishedAt: '2026-08-06T00:00:00.000Z'
+  });
+}
+
+test('timer tick patch carries only the changed field and is much smaller', () => {
+  const base = envelopeFor(Array.from({ length: 8 }, (_, i) => makeGroup(i)), 1);
+  const next = envelopeFor(
+    Array.from({ length: 8 }, (_, i) => makeGroup(i, { accumulated: 100 * i + 5 })),
+    2
+  );
+  const patch = createM5HomeworksPatchEnvelope(base, next);
+
+  assert.ok(patch);
+  assert.deepEqual(Object.keys(patch), ['meta', 'order', 'groups']);
+  assert.equal(patch.meta.mode, 'patch');
+  assert.equal(patch.meta.base_fp, base.meta.sync_fp);
+  assert.equal(patch.meta.sync_fp, next.meta.sync_fp);
+  assert.deepEqual(patch.groups[1], { group_id: 'g1', accumulated: 105 });
+  assert.ok(JSON.stringify(patch).length * 5 < JSON.stringify(next).length);
+  assert.equal(applyM5HomeworksPatch(base.groups, patch).sync_fp, next.meta.sync_fp);
+});
+
+test('derived display fields travel together and children are replaced whole', () => {
+  const base = envelopeFor([makeGroup(0), makeGroup(1)], 1);
+  const changedChildren = [{ item_id: 'g1-c9', title: '2단원', page: '30', count: 3, phase: 1 }];
+  const next = envelopeFor(
+    [makeGroup(0, { grade_label: '미적분2' }), makeGroup(1, { children: changedChildren })],
+    2
+  );
+  const patch = createM5HomeworksPatchEnvelope(base, next);
+
+  assert.ok(patch);
+  const [first, second] = patch.groups;
+  assert.equal(Object.keys(first)[0], 'group_id');
+  for (const field of M5_PATCH_DERIVED_FIELDS) {
+    assert.ok(field in first, `${field} missing`);
+  }
+  assert.deepEqual(second, { group_id: 'g1', children: changedChildren });
+  assert.equal(applyM5HomeworksPatch(base.groups, patch).sync_fp, next.meta.sync_fp);
+});
+
+test('reorder, insert and delete are expressed through order', () => {
+  const base = envelopeFor([makeGroup(0), makeGroup(1), makeGroup(2)], 1);
+  const next = envelopeFor([makeGroup(2), makeGroup(0), makeGroup(5)], 2);
+  const patch = createM5HomeworksPatchEnvelope(base, next);
+
+  assert.ok(patch);
+  assert.deepEqual(patch.order, ['g2', 'g0', 'g5']);
+  assert.deepEqual(patch.groups.map((g) => g.group_id), ['g5']);
+  assert.equal(applyM5HomeworksPatch(base.groups, patch).sync_fp, next.meta.sync_fp);
+});
+
+test('falls back to a snapshot when a field disappears or the student changes', () => {
+  const base = envelopeFor([makeGroup(0)], 1);
+  const { m5_wait_title, ...withoutWaitTitle } = makeGroup(0);
+  assert.ok(m5_wait_title);
+  assert.equal(createM5HomeworksPatchEnvelope(base, envelopeFor([withoutWaitTitle], 2)), null);
+
+  const otherStudent = createM5HomeworksEnvelope({
+    academyId: 'a1',
+    deviceId: 'm5-device-010',
+    studentId: 's2',
+    groups: [makeGroup(0)],
+    syncSeq: 2
+  });
+  assert.equal(createM5HomeworksPatchEnvelope(base, otherStudent), null);
+});
@@ -0,0 +1,100 @@
+import test from 'node:test';
+import assert from 'node:assert/strict';
+import fs from 'node:fs';
+
+import { createM5HomeworksEnvelope } from '../src/m5_sync_fingerprint.js';
+import { createM5HomeworksPatchEnvelope } from '../src/m5_sync_patch.js';
+import {
+  M5_HW_WIRE_KEYS,
+  decodeMsgPack,
+  encodeM5DeviceWire,
+  encodeM5HomeworksWire,
+  encodeMsgPack,
+  normalizeM5WireFormat
+} from '../src/m5_wire_codec.js';
+
+function group(i, overrides = {}) {
+  return {
+    group_id: `g-${i}`,
+    group_title: `쎈 그룹 ${i}`,
+    order_index: i,
+    phase: 2,
+    accumulated: 95 * i,
+    time_limit_minutes: null,
+    color: 4284955319,
+    run_start: '2026-10-17T09:30:05.123+09:00',
+    content: '교재: 쎈 수학\n과정: 확률과 통계',
+    children: [{ item_id: `c${i}`, title: '1단원', count: 5, check_count: -1 }],
+    ...overrides
+  };
+}
+
+function envelope(groups, syncSeq = 1) {
+  return createM5HomeworksEnvelope({
+    academyId: 'a1',
+    deviceId: 'm5-device-010',
+    studentId: 's1',
+    groups,
+    syncSeq,
+    publishedAt: '2026-10-17T00:00:00.000Z'
+  });
+}
+
+test('msgpack round-trips JSON-compatible values', () => {
+  const value = {
+    s: 'é😀',
+    long: 'x'.repeat(300),
+    ints: [0, 127, 128, 255, 65535, 65536, 4294967295, -1, -32, -33, -200, -40000, -3000000000],
+    f: 1.5,
+    b: [true, false, null],
+    nested: { arr: Array.from({ length: 20 }, (_, i) => i) }
+  };
+  assert.deepEqual(decodeMsgPack(encodeMsgPack(value)), value);
+});
+
+test('device bodies stay JSON unless the device advertised msgpack', () => {
+  const body = { students: [{ student_id: 's1', name: '홍길동' }] };
+  assert.equal(encodeM5DeviceWire(body), JSON.stringify(body));
+  assert.equal(encodeM5DeviceWire(body, 'cbor'), JSON.stringify(body));
+  assert.equal(normalizeM5WireFormat(undefined), 'json');
+  assert.deepEqual(decodeMsgPack(encodeM5DeviceWire(body, 'msgpack')), body);
+});
+
+test('homeworks wire uses integer keys, epoch timestamps and keeps meta first', () => {
+  const env = envelope([group(0), group(1, { run_start: null })]);
+  const wire = encodeM5HomeworksWire(env, 'msgpack');
+  assert.ok(Buffer.isBuffer(wire));
+  assert.ok(wire.length < JSON.stringify(env).length * 0.8);
+
+  const decoded = decodeMsgPack(wire, M5_HW_WIRE_KEYS);
+  assert.deepEqual(Object.keys(decoded), ['meta', 'groups']);
+  assert.equal(decoded.meta.sync_fp, env.meta.sync_fp);
+  assert.equal(decoded.meta.published_at, Date.parse(env.meta.published_at) / 1000);
+  assert.equal(decoded.groups[0].run_start, Math.floor(Date.parse(group(0).run_start) / 1000));
+  assert.equal(decoded.groups[1].run_start, null);
+  const { run_start: _a, ...restWire } = decoded.groups[0];
+  const { run_start: _b, ...restJson } = env.groups[0];
+  assert.deepEqual(restWire, restJson);
+});
+
+test('homeworks patch envelopes encode with order before groups', () => {
+  const base = envelope([group(0), group(1)], 1);
+  const next = envelope([group(1), group(0, { accumulated: 500 })], 2);
+  const patch = createM5HomeworksPatchEnvelope(base, next);
+  assert.ok(patch);
+  const decoded = decodeMsgPack(encodeM5HomeworksWire(patch, 'msgpack'), M5_HW_WIRE_KEYS);
+  assert.deepEqual(Object.keys(decoded), ['meta', 'order', 'groups']);
+  assert.deepEqual(decoded.order, ['g-1', 'g-0']);
+  assert.deepEqual(decoded.groups, [{ group_id: 'g-0', accumulated: 500 }]);
+});
+
+test('firmware integer key table matches the gateway table', () => {
+  const src = fs.readFileSync(
+    new URL('../../firmware/m5stack/src/hw_sync.cpp', import.meta.url),
+    'utf8'
+  );
+  const block = src.match(/kHwWireKeys\[\]\s*=\s*\{([\s\S]*?)\};/);
+  assert.ok(block, 'kHwWireKeys table not found in hw_sync.cpp');
+  const keys = [...block[1].matchAll(/"([^"]+)"/g)].map((m) => m[1]);
+  assert.deepEqual(keys, M5_HW_WIRE_KEYS);
+});